@@ -0,0 +1,388 @@
+#include "animation_component.h"
+#include "../core/component_registry.h"
+#include "../core/game_object.h"
+#include "../core/memory_budget.h"
+#include "../core/scene.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ANIMATION_NO_SLOT UINT32_MAX
+
+// Per-instance state, one entry per live component, kept dense by moving
+// the last entry into a destroyed one's slot
+typedef struct AnimationState {
+    float* timeMs;                 // Time into the current frame
+    uint16_t* clip;                // Clip index or ANIMATION_CLIP_NONE
+    uint16_t* frame;
+    struct Scene** scenes;         // Scene the instance advances with, NULL while disabled
+    AnimationComponent** owners;   // Component of each slot, for moves and sprite lookups
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t bytes;                // Charged to the components budget
+} AnimationState;
+
+static AnimationState g_animationState = {0};
+static AnimationClip g_clips[ANIMATION_MAX_CLIPS];
+static float g_clipLengthMs[ANIMATION_MAX_CLIPS];       // Sum of the frame durations
+static uint32_t g_clipCount = 0;
+
+// Forward declarations for vtable functions
+static void animation_init(Component* component, GameObject* gameObject);
+static void animation_destroy(Component* component);
+static void animation_on_enabled(Component* component);
+static void animation_on_disabled(Component* component);
+
+// Animation component vtable
+static const ComponentVTable animationVTable = {
+    .init = animation_init,
+    .destroy = animation_destroy,
+    .clone = NULL,
+    .update = NULL,
+    .fixedUpdate = NULL,
+    .render = NULL,
+    .onEnabled = animation_on_enabled,
+    .onDisabled = animation_on_disabled,
+    .onGameObjectDestroyed = NULL,
+    .getSerializedSize = NULL,
+    .serialize = NULL,
+    .deserialize = NULL
+};
+
+static void animation_state_free(void) {
+    if (g_animationState.scenes) {
+        memory_budget_release(MEMORY_SUBSYSTEM_COMPONENTS, g_animationState.bytes);
+        free(g_animationState.scenes);      // Start of the single block
+    }
+    memset(&g_animationState, 0, sizeof(AnimationState));
+}
+
+// One block: pointers first, then floats, then the 16-bit arrays
+static ComponentResult animation_state_allocate(uint32_t capacity) {
+    animation_state_free();
+
+    size_t bytes = (size_t)capacity * (sizeof(struct Scene*) + sizeof(AnimationComponent*) + sizeof(float) +
+                                       2 * sizeof(uint16_t));
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_COMPONENTS, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return COMPONENT_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* block = calloc(1, bytes ? bytes : 1);
+    if (!block) {
+        memory_budget_release(MEMORY_SUBSYSTEM_COMPONENTS, (uint32_t)bytes);
+        return COMPONENT_ERROR_POOL_FULL;
+    }
+
+    g_animationState.scenes = (struct Scene**)block;
+    g_animationState.owners = (AnimationComponent**)(g_animationState.scenes + capacity);
+    g_animationState.timeMs = (float*)(g_animationState.owners + capacity);
+    g_animationState.clip = (uint16_t*)(g_animationState.timeMs + capacity);
+    g_animationState.frame = g_animationState.clip + capacity;
+    g_animationState.capacity = capacity;
+    g_animationState.bytes = (uint32_t)bytes;
+    return COMPONENT_OK;
+}
+
+static inline bool animation_has_slot(const AnimationComponent* animation) {
+    return animation && animation->slot < g_animationState.count && g_animationState.owners[animation->slot] == animation;
+}
+
+// Remembers a sprite with its id: destroyed components are cleared and
+// reused pool slots get a new id, so a stale pointer never matches
+static void animation_cache_sprite(AnimationComponent* animation, SpriteComponent* sprite) {
+    animation->sprite = sprite;
+    animation->spriteId = sprite ? sprite->base.id : 0;
+}
+
+// The sprite to animate: the one set explicitly while it lives, else the
+// object's own, looked up again once the remembered one is destroyed
+static SpriteComponent* animation_resolve_sprite(AnimationComponent* animation) {
+    SpriteComponent* sprite = animation->sprite;
+    if (sprite && sprite->base.id == animation->spriteId && sprite->base.gameObject) {
+        return sprite;
+    }
+
+    animation_cache_sprite(animation, NULL);
+    if (animation->base.gameObject) {
+        Component* component = game_object_get_component(animation->base.gameObject, COMPONENT_TYPE_SPRITE);
+        if (sprite_component_is_sprite(component)) {
+            animation_cache_sprite(animation, (SpriteComponent*)component);
+        }
+    }
+    return animation->sprite;
+}
+
+// VTable implementations
+static void animation_init(Component* component, GameObject* gameObject) {
+    if (!component) return;
+
+    AnimationComponent* animation = (AnimationComponent*)component;
+    animation_cache_sprite(animation, NULL);
+    animation->slot = ANIMATION_NO_SLOT;
+
+    // The pool and the state arrays share a capacity, so a slot is free
+    // whenever a component could be allocated
+    AnimationState* state = &g_animationState;
+    if (state->count >= state->capacity) return;
+
+    uint32_t slot = state->count++;
+    state->timeMs[slot] = 0.0f;
+    state->clip[slot] = ANIMATION_CLIP_NONE;
+    state->frame[slot] = 0;
+    state->scenes[slot] = gameObject ? gameObject->scene : NULL;
+    state->owners[slot] = animation;
+    animation->slot = slot;
+}
+
+static void animation_destroy(Component* component) {
+    AnimationComponent* animation = (AnimationComponent*)component;
+    if (!animation_has_slot(animation)) return;
+
+    // Base component cleanup is handled by component_registry_destroy()
+    AnimationState* state = &g_animationState;
+    uint32_t slot = animation->slot;
+    uint32_t last = --state->count;
+    if (slot != last) {
+        state->timeMs[slot] = state->timeMs[last];
+        state->clip[slot] = state->clip[last];
+        state->frame[slot] = state->frame[last];
+        state->scenes[slot] = state->scenes[last];
+        state->owners[slot] = state->owners[last];
+        state->owners[slot]->slot = slot;
+    }
+    animation->slot = ANIMATION_NO_SLOT;
+    animation_cache_sprite(animation, NULL);
+}
+
+// Disabled instances keep their state but match no scene
+static void animation_on_enabled(Component* component) {
+    AnimationComponent* animation = (AnimationComponent*)component;
+    if (animation_has_slot(animation)) {
+        g_animationState.scenes[animation->slot] = component->gameObject ? component->gameObject->scene : NULL;
+    }
+}
+
+static void animation_on_disabled(Component* component) {
+    AnimationComponent* animation = (AnimationComponent*)component;
+    if (animation_has_slot(animation)) {
+        g_animationState.scenes[animation->slot] = NULL;
+    }
+}
+
+// Public API implementations
+AnimationComponent* animation_component_create(GameObject* gameObject) {
+    if (!gameObject) return NULL;
+
+    if (animation_component_register() != COMPONENT_OK) {
+        return NULL;
+    }
+
+    const ComponentTypeInfo* info = component_registry_get_type_info(COMPONENT_TYPE_ANIMATION);
+    if (!info || info->defaultVTable != &animationVTable) {
+        return NULL;
+    }
+
+    Component* component = component_registry_create(COMPONENT_TYPE_ANIMATION, gameObject);
+    return (AnimationComponent*)component;
+}
+
+void animation_component_destroy(AnimationComponent* animation) {
+    if (!animation) return;
+
+    component_registry_destroy((Component*)animation);
+}
+
+bool animation_component_is_animation(const Component* component) {
+    return component && component->vtable == &animationVTable;
+}
+
+// Clip library
+
+AnimationResult animation_clip_add(const AnimationClip* clip, uint16_t* index) {
+    if (!clip || !index) {
+        return ANIMATION_ERROR_NULL_POINTER;
+    }
+    if (clip->frameCount == 0 || !clip->frames || !clip->durationsMs) {
+        return ANIMATION_ERROR_INVALID_CLIP;
+    }
+    if (g_clipCount >= ANIMATION_MAX_CLIPS) {
+        return ANIMATION_ERROR_FULL;
+    }
+
+    float lengthMs = 0.0f;
+    for (uint32_t i = 0; i < clip->frameCount; i++) {
+        if (clip->durationsMs[i] == 0) {
+            return ANIMATION_ERROR_INVALID_CLIP;
+        }
+        lengthMs += (float)clip->durationsMs[i];
+    }
+
+    g_clips[g_clipCount] = *clip;
+    g_clipLengthMs[g_clipCount] = lengthMs;
+    *index = (uint16_t)g_clipCount++;
+    return ANIMATION_OK;
+}
+
+const AnimationClip* animation_clip_get(uint16_t index) {
+    return index < g_clipCount ? &g_clips[index] : NULL;
+}
+
+uint32_t animation_clip_get_count(void) {
+    return g_clipCount;
+}
+
+void animation_clips_clear(void) {
+    for (uint32_t i = 0; i < g_animationState.count; i++) {
+        g_animationState.clip[i] = ANIMATION_CLIP_NONE;
+    }
+    g_clipCount = 0;
+}
+
+// Playback
+
+void animation_component_set_sprite(AnimationComponent* animation, SpriteComponent* sprite) {
+    if (!animation) return;
+
+    animation_cache_sprite(animation, sprite);
+}
+
+void animation_component_play(AnimationComponent* animation, uint16_t clip) {
+    if (!animation_has_slot(animation) || clip >= g_clipCount) return;
+
+    uint32_t slot = animation->slot;
+    g_animationState.clip[slot] = clip;
+    g_animationState.frame[slot] = 0;
+    g_animationState.timeMs[slot] = 0.0f;
+
+    SpriteComponent* sprite = animation_resolve_sprite(animation);
+    if (sprite) {
+        sprite_component_set_bitmap(sprite, g_clips[clip].frames[0]);
+    }
+}
+
+void animation_component_stop(AnimationComponent* animation) {
+    if (!animation_has_slot(animation)) return;
+
+    g_animationState.clip[animation->slot] = ANIMATION_CLIP_NONE;
+}
+
+uint16_t animation_component_get_clip(const AnimationComponent* animation) {
+    return animation_has_slot(animation) ? g_animationState.clip[animation->slot] : ANIMATION_CLIP_NONE;
+}
+
+uint16_t animation_component_get_frame(const AnimationComponent* animation) {
+    return animation_has_slot(animation) ? g_animationState.frame[animation->slot] : 0;
+}
+
+bool animation_component_is_finished(const AnimationComponent* animation) {
+    uint16_t clipIndex = animation_component_get_clip(animation);
+    if (clipIndex >= g_clipCount) return false;
+
+    const AnimationClip* clip = &g_clips[clipIndex];
+    uint32_t last = clip->frameCount - 1u;
+    uint32_t slot = animation->slot;
+    return !clip->loop && g_animationState.frame[slot] == last &&
+           g_animationState.timeMs[slot] >= (float)clip->durationsMs[last];
+}
+
+// Batched update
+
+uint32_t animation_system_update(struct Scene* scene, float deltaTime) {
+    AnimationState* state = &g_animationState;
+    float stepMs = deltaTime * 1000.0f;
+    if (!(stepMs > 0.0f)) return 0;
+
+    float* timeMs = state->timeMs;
+    const uint16_t* clips = state->clip;
+    uint16_t* frames = state->frame;
+    struct Scene* const* scenes = state->scenes;
+    uint32_t changed = 0;
+
+    for (uint32_t i = 0; i < state->count; i++) {
+        uint32_t clipIndex = clips[i];
+        if (scenes[i] != scene || clipIndex >= g_clipCount) continue;
+
+        // Most instances stay on their frame: one add and one compare
+        const AnimationClip* clip = &g_clips[clipIndex];
+        uint32_t frame = frames[i];
+        float time = timeMs[i] + stepMs;
+        if (time < (float)clip->durationsMs[frame]) {
+            timeMs[i] = time;
+            continue;
+        }
+
+        // Whole loops of a looping clip are skipped at once
+        if (clip->loop && time >= g_clipLengthMs[clipIndex]) {
+            time = fmodf(time, g_clipLengthMs[clipIndex]);
+        }
+        uint32_t start = frame;
+        while (time >= (float)clip->durationsMs[frame]) {
+            if (frame + 1u < clip->frameCount) {
+                time -= (float)clip->durationsMs[frame];
+                frame++;
+            } else if (clip->loop) {
+                time -= (float)clip->durationsMs[frame];
+                frame = 0;
+            } else {
+                time = (float)clip->durationsMs[frame];      // Finished; holds the last frame
+                break;
+            }
+        }
+        timeMs[i] = time;
+
+        if (frame != start) {
+            frames[i] = (uint16_t)frame;
+            SpriteComponent* sprite = animation_resolve_sprite(state->owners[i]);
+            if (sprite) {
+                sprite_component_set_bitmap(sprite, clip->frames[frame]);
+            }
+            changed++;
+        }
+    }
+    return changed;
+}
+
+void animation_system_update_batch(Component** components, uint32_t count, float deltaTime) {
+    if (!components || count == 0 || !components[0]) return;
+
+    // The scene's own list only names the scene; the state arrays are walked instead
+    GameObject* gameObject = components[0]->gameObject;
+    animation_system_update(gameObject ? gameObject->scene : NULL, deltaTime);
+}
+
+uint32_t animation_system_get_instance_count(void) {
+    return g_animationState.count;
+}
+
+void animation_system_shutdown(void) {
+    animation_state_free();
+    g_clipCount = 0;
+}
+
+// Registration function
+ComponentResult animation_component_register(void) {
+    return animation_component_register_with_capacity(DEFAULT_COMPONENT_POOL_SIZE);
+}
+
+ComponentResult animation_component_register_with_capacity(uint32_t poolCapacity) {
+    if (component_registry_is_type_registered(COMPONENT_TYPE_ANIMATION)) {
+        return COMPONENT_OK; // Already registered
+    }
+
+    // A new registry means any earlier instances are gone
+    ComponentResult result = animation_state_allocate(poolCapacity);
+    if (result != COMPONENT_OK) {
+        return result;
+    }
+
+    result = component_registry_register_type(
+        COMPONENT_TYPE_ANIMATION,
+        sizeof(AnimationComponent),
+        poolCapacity,
+        &animationVTable,
+        "Animation"
+    );
+    if (result != COMPONENT_OK) {
+        animation_state_free();
+    }
+    return result;
+}
@@ -0,0 +1,80 @@
+#ifndef ANIMATION_COMPONENT_H
+#define ANIMATION_COMPONENT_H
+
+#include "../core/component.h"
+#include "sprite_component.h"
+
+// Flipbook animation of a sprite's bitmap.
+//
+// Clips (frame bitmaps and per-frame durations) are shared, immutable data
+// registered once and referred to by index. An instance's only state is
+// its clip index, time into the current frame and frame number, kept by the
+// animation system in parallel arrays (structure of arrays) rather than in
+// the component, so the batched update streams through three dense arrays.
+// Only instances whose frame changed touch their sprite, through
+// sprite_component_set_bitmap(), which also flags it for the dirty-region
+// pass. Frames are centred on the sprite like any set_bitmap() call.
+//
+// The state arrays are sized once, by the component pool capacity given at
+// registration, so the update never allocates.
+
+#define ANIMATION_MAX_CLIPS 256
+#define ANIMATION_CLIP_NONE UINT16_MAX
+
+// Animation results
+typedef enum {
+    ANIMATION_OK = 0,
+    ANIMATION_ERROR_NULL_POINTER,
+    ANIMATION_ERROR_INVALID_CLIP,          // No frames, or a frame lasting 0 ms
+    ANIMATION_ERROR_FULL
+} AnimationResult;
+
+// Shared clip data; the arrays are not copied and must outlive the clip
+typedef struct AnimationClip {
+    const Bitmap* const* frames;   // frameCount bitmaps
+    const uint16_t* durationsMs;   // Time on each frame, at least 1 ms
+    uint16_t frameCount;
+    bool loop;                     // Otherwise the last frame holds
+} AnimationClip;
+
+// Animation component structure (64 bytes)
+typedef struct AnimationComponent {
+    Component base;                // 48 bytes - base component
+    SpriteComponent* sprite;       // 8 bytes - animated sprite, found on the object when NULL
+    uint32_t slot;                 // 4 bytes - index into the system's state arrays
+    uint32_t spriteId;             // 4 bytes - id of sprite, to notice when it is destroyed
+} AnimationComponent;
+
+// Animation component interface
+ComponentResult animation_component_register(void);
+ComponentResult animation_component_register_with_capacity(uint32_t poolCapacity);
+AnimationComponent* animation_component_create(GameObject* gameObject);
+void animation_component_destroy(AnimationComponent* animation);
+bool animation_component_is_animation(const Component* component);
+
+// Clip library, shared by every instance
+AnimationResult animation_clip_add(const AnimationClip* clip, uint16_t* index);
+const AnimationClip* animation_clip_get(uint16_t index);
+uint32_t animation_clip_get_count(void);
+void animation_clips_clear(void);                   // Stops every instance
+
+// Playback. play() starts the clip from its first frame and shows it now;
+// stop() keeps the current bitmap. Once the animated sprite is destroyed,
+// the instance animates the object's sprite again, if it has one.
+void animation_component_set_sprite(AnimationComponent* animation, SpriteComponent* sprite);
+void animation_component_play(AnimationComponent* animation, uint16_t clip);
+void animation_component_stop(AnimationComponent* animation);
+uint16_t animation_component_get_clip(const AnimationComponent* animation);
+uint16_t animation_component_get_frame(const AnimationComponent* animation);
+bool animation_component_is_finished(const AnimationComponent* animation);   // Non-looping clip done
+
+// Advances every playing instance in the scene's batch in one pass over
+// the state arrays; returns the number of sprites whose frame changed.
+// animation_system_update_batch() is the scene system entry point.
+struct Scene;
+uint32_t animation_system_update(struct Scene* scene, float deltaTime);
+void animation_system_update_batch(Component** components, uint32_t count, float deltaTime);
+uint32_t animation_system_get_instance_count(void);
+void animation_system_shutdown(void);              // Frees the state arrays and clears the clips
+
+#endif // ANIMATION_COMPONENT_H
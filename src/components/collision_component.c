@@ -0,0 +1,348 @@
+#include "collision_component.h"
+#include "transform_component.h"
+#include "../core/component_registry.h"
+#include "../core/game_object.h"
+#include "../core/memory_budget.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COLLISION_NO_SLOT UINT32_MAX
+#define COLLISION_FLOAT_ARRAYS 9           // offsetX .. radius
+
+static CollisionColliders g_colliders = {0};
+
+// Forward declarations for vtable functions
+static void collision_init(Component* component, GameObject* gameObject);
+static void collision_destroy(Component* component);
+static void collision_on_enabled(Component* component);
+static void collision_on_disabled(Component* component);
+
+// Collision component vtable
+static const ComponentVTable collisionVTable = {
+    .init = collision_init,
+    .destroy = collision_destroy,
+    .clone = NULL,
+    .update = NULL,
+    .fixedUpdate = NULL,
+    .render = NULL,
+    .onEnabled = collision_on_enabled,
+    .onDisabled = collision_on_disabled,
+    .onGameObjectDestroyed = NULL,
+    .getSerializedSize = NULL,
+    .serialize = NULL,
+    .deserialize = NULL
+};
+
+void collision_colliders_shutdown(void) {
+    if (g_colliders.owners) {
+        memory_budget_release(MEMORY_SUBSYSTEM_COMPONENTS, g_colliders.bytes);
+        free(g_colliders.owners);      // Start of the single block
+    }
+    memset(&g_colliders, 0, sizeof(CollisionColliders));
+}
+
+// One block: pointers, then floats, then layer and mask words, then flag bytes
+static ComponentResult collision_colliders_allocate(uint32_t capacity) {
+    collision_colliders_shutdown();
+
+    size_t bytes = (size_t)capacity * (sizeof(CollisionComponent*) + sizeof(struct Scene*) +
+                                       COLLISION_FLOAT_ARRAYS * sizeof(float) + 2 * sizeof(uint32_t) +
+                                       3 * sizeof(uint8_t));
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_COMPONENTS, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return COMPONENT_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* block = calloc(1, bytes ? bytes : 1);
+    if (!block) {
+        memory_budget_release(MEMORY_SUBSYSTEM_COMPONENTS, (uint32_t)bytes);
+        return COMPONENT_ERROR_POOL_FULL;
+    }
+
+    CollisionColliders* store = &g_colliders;
+    store->owners = (CollisionComponent**)block;
+    store->scenes = (struct Scene**)(store->owners + capacity);
+    float* floats = (float*)(store->scenes + capacity);
+    float** arrays[COLLISION_FLOAT_ARRAYS] = {
+        &store->offsetX, &store->offsetY, &store->halfWidth, &store->halfHeight,
+        &store->minX, &store->minY, &store->maxX, &store->maxY, &store->radius
+    };
+    for (uint32_t i = 0; i < COLLISION_FLOAT_ARRAYS; i++) {
+        *arrays[i] = floats + (size_t)i * capacity;
+    }
+    store->layer = (uint32_t*)(floats + (size_t)COLLISION_FLOAT_ARRAYS * capacity);
+    store->mask = store->layer + capacity;
+    store->shape = (uint8_t*)(store->mask + capacity);
+    store->continuous = store->shape + capacity;
+    store->placed = store->continuous + capacity;
+    store->capacity = capacity;
+    store->bytes = (uint32_t)bytes;
+    return COMPONENT_OK;
+}
+
+static inline bool collision_has_slot(const CollisionComponent* collider) {
+    return collider && collider->slot < g_colliders.count && g_colliders.owners[collider->slot] == collider;
+}
+
+void collision_colliders_refresh(uint32_t index) {
+    CollisionColliders* store = &g_colliders;
+    if (index >= store->count) return;
+
+    float x = 0.0f, y = 0.0f;
+    GameObject* gameObject = store->owners[index]->base.gameObject;
+    if (gameObject && gameObject->transform) {
+        transform_component_get_position(gameObject->transform, &x, &y);
+    }
+    x += store->offsetX[index];
+    y += store->offsetY[index];
+    store->minX[index] = x - store->halfWidth[index];
+    store->minY[index] = y - store->halfHeight[index];
+    store->maxX[index] = x + store->halfWidth[index];
+    store->maxY[index] = y + store->halfHeight[index];
+}
+
+// Refreshes a collider whose transform is where it is meant to be, so a
+// sweep may start from it
+static void collision_place(uint32_t index) {
+    collision_colliders_refresh(index);
+    g_colliders.placed[index] = 1;
+}
+
+// VTable implementations
+static void collision_init(Component* component, GameObject* gameObject) {
+    if (!component) return;
+
+    CollisionComponent* collider = (CollisionComponent*)component;
+    collider->slot = COLLISION_NO_SLOT;
+    memset(collider->padding, 0, sizeof(collider->padding));
+
+    // The pool and the store share a capacity, so a slot is free whenever
+    // a component could be allocated
+    CollisionColliders* store = &g_colliders;
+    if (store->count >= store->capacity) return;
+
+    uint32_t slot = store->count++;
+    store->owners[slot] = collider;
+    store->scenes[slot] = gameObject ? gameObject->scene : NULL;
+    store->offsetX[slot] = store->offsetY[slot] = 0.0f;
+    store->halfWidth[slot] = store->halfHeight[slot] = 0.0f;
+    store->radius[slot] = 0.0f;
+    store->layer[slot] = COLLISION_LAYER_DEFAULT;
+    store->mask[slot] = COLLISION_MASK_ALL;
+    store->shape[slot] = COLLISION_SHAPE_AABB;
+    store->continuous[slot] = 0;
+    collider->slot = slot;
+    store->placed[slot] = 0;           // The transform is usually positioned after creation
+    collision_colliders_refresh(slot);
+}
+
+static void collision_destroy(Component* component) {
+    CollisionComponent* collider = (CollisionComponent*)component;
+    if (!collision_has_slot(collider)) return;
+
+    // Base component cleanup is handled by component_registry_destroy()
+    CollisionColliders* store = &g_colliders;
+    uint32_t slot = collider->slot;
+    uint32_t last = --store->count;
+    if (slot != last) {
+        store->owners[slot] = store->owners[last];
+        store->scenes[slot] = store->scenes[last];
+        store->offsetX[slot] = store->offsetX[last];
+        store->offsetY[slot] = store->offsetY[last];
+        store->halfWidth[slot] = store->halfWidth[last];
+        store->halfHeight[slot] = store->halfHeight[last];
+        store->minX[slot] = store->minX[last];
+        store->minY[slot] = store->minY[last];
+        store->maxX[slot] = store->maxX[last];
+        store->maxY[slot] = store->maxY[last];
+        store->radius[slot] = store->radius[last];
+        store->layer[slot] = store->layer[last];
+        store->mask[slot] = store->mask[last];
+        store->shape[slot] = store->shape[last];
+        store->continuous[slot] = store->continuous[last];
+        store->placed[slot] = store->placed[last];
+        store->owners[slot]->slot = slot;
+    }
+    collider->slot = COLLISION_NO_SLOT;
+}
+
+// Disabled colliders keep their shape but match no scene; enabling one
+// places it where its transform is now, so it does not sweep from where
+// it was disabled
+static void collision_on_enabled(Component* component) {
+    CollisionComponent* collider = (CollisionComponent*)component;
+    if (collision_has_slot(collider)) {
+        g_colliders.scenes[collider->slot] = component->gameObject ? component->gameObject->scene : NULL;
+        collision_place(collider->slot);
+    }
+}
+
+static void collision_on_disabled(Component* component) {
+    CollisionComponent* collider = (CollisionComponent*)component;
+    if (collision_has_slot(collider)) {
+        g_colliders.scenes[collider->slot] = NULL;
+    }
+}
+
+// Public API implementations
+CollisionComponent* collision_component_create(GameObject* gameObject) {
+    if (!gameObject) return NULL;
+
+    if (collision_component_register() != COMPONENT_OK) {
+        return NULL;
+    }
+
+    const ComponentTypeInfo* info = component_registry_get_type_info(COMPONENT_TYPE_COLLISION);
+    if (!info || info->defaultVTable != &collisionVTable) {
+        return NULL;
+    }
+
+    Component* component = component_registry_create(COMPONENT_TYPE_COLLISION, gameObject);
+    return (CollisionComponent*)component;
+}
+
+void collision_component_destroy(CollisionComponent* collider) {
+    if (!collider) return;
+
+    component_registry_destroy((Component*)collider);
+}
+
+bool collision_component_is_collision(const Component* component) {
+    return component && component->vtable == &collisionVTable;
+}
+
+// Shapes
+
+static inline bool valid_extent(float value) {
+    return value >= 0.0f && isfinite(value);
+}
+
+CollisionResult collision_component_set_aabb(CollisionComponent* collider, float width, float height) {
+    if (!collision_has_slot(collider)) {
+        return COLLISION_ERROR_NULL_POINTER;
+    }
+    if (!valid_extent(width) || !valid_extent(height)) {
+        return COLLISION_ERROR_INVALID_SHAPE;
+    }
+
+    uint32_t slot = collider->slot;
+    g_colliders.shape[slot] = COLLISION_SHAPE_AABB;
+    g_colliders.halfWidth[slot] = width * 0.5f;
+    g_colliders.halfHeight[slot] = height * 0.5f;
+    g_colliders.radius[slot] = 0.0f;
+    collision_colliders_refresh(slot);
+    return COLLISION_OK;
+}
+
+CollisionResult collision_component_set_circle(CollisionComponent* collider, float radius) {
+    if (!collision_has_slot(collider)) {
+        return COLLISION_ERROR_NULL_POINTER;
+    }
+    if (!valid_extent(radius)) {
+        return COLLISION_ERROR_INVALID_SHAPE;
+    }
+
+    uint32_t slot = collider->slot;
+    g_colliders.shape[slot] = COLLISION_SHAPE_CIRCLE;
+    g_colliders.halfWidth[slot] = 0.0f;
+    g_colliders.halfHeight[slot] = 0.0f;
+    g_colliders.radius[slot] = radius;
+    collision_colliders_refresh(slot);
+    return COLLISION_OK;
+}
+
+void collision_component_set_offset(CollisionComponent* collider, float offsetX, float offsetY) {
+    if (!collision_has_slot(collider)) return;
+
+    g_colliders.offsetX[collider->slot] = offsetX;
+    g_colliders.offsetY[collider->slot] = offsetY;
+    collision_colliders_refresh(collider->slot);
+}
+
+CollisionShape collision_component_get_shape(const CollisionComponent* collider) {
+    return collision_has_slot(collider) ? (CollisionShape)g_colliders.shape[collider->slot] : COLLISION_SHAPE_AABB;
+}
+
+void collision_component_set_layer(CollisionComponent* collider, uint32_t layer) {
+    if (!collision_has_slot(collider)) return;
+
+    g_colliders.layer[collider->slot] = layer;
+}
+
+void collision_component_set_mask(CollisionComponent* collider, uint32_t mask) {
+    if (!collision_has_slot(collider)) return;
+
+    g_colliders.mask[collider->slot] = mask;
+}
+
+uint32_t collision_component_get_layer(const CollisionComponent* collider) {
+    return collision_has_slot(collider) ? g_colliders.layer[collider->slot] : 0;
+}
+
+uint32_t collision_component_get_mask(const CollisionComponent* collider) {
+    return collision_has_slot(collider) ? g_colliders.mask[collider->slot] : 0;
+}
+
+void collision_component_set_continuous(CollisionComponent* collider, bool continuous) {
+    if (!collision_has_slot(collider)) return;
+
+    g_colliders.continuous[collider->slot] = continuous ? 1 : 0;
+    collision_place(collider->slot);   // The first sweep starts here
+}
+
+bool collision_component_is_continuous(const CollisionComponent* collider) {
+    return collision_has_slot(collider) && g_colliders.continuous[collider->slot];
+}
+
+void collision_component_refresh(CollisionComponent* collider) {
+    if (!collision_has_slot(collider)) return;
+
+    collision_place(collider->slot);
+}
+
+bool collision_component_get_bounds(const CollisionComponent* collider, float* minX, float* minY,
+                                    float* maxX, float* maxY) {
+    if (!collision_has_slot(collider) || !minX || !minY || !maxX || !maxY) {
+        return false;
+    }
+
+    uint32_t slot = collider->slot;
+    float radius = g_colliders.radius[slot];
+    *minX = g_colliders.minX[slot] - radius;
+    *minY = g_colliders.minY[slot] - radius;
+    *maxX = g_colliders.maxX[slot] + radius;
+    *maxY = g_colliders.maxY[slot] + radius;
+    return true;
+}
+
+CollisionColliders* collision_colliders_get(void) {
+    return &g_colliders;
+}
+
+// Registration function
+ComponentResult collision_component_register(void) {
+    return collision_component_register_with_capacity(DEFAULT_COMPONENT_POOL_SIZE);
+}
+
+ComponentResult collision_component_register_with_capacity(uint32_t poolCapacity) {
+    if (component_registry_is_type_registered(COMPONENT_TYPE_COLLISION)) {
+        return COMPONENT_OK; // Already registered
+    }
+
+    // A new registry means any earlier colliders are gone
+    ComponentResult result = collision_colliders_allocate(poolCapacity);
+    if (result != COMPONENT_OK) {
+        return result;
+    }
+
+    result = component_registry_register_type(
+        COMPONENT_TYPE_COLLISION,
+        sizeof(CollisionComponent),
+        poolCapacity,
+        &collisionVTable,
+        "Collision"
+    );
+    if (result != COMPONENT_OK) {
+        collision_colliders_shutdown();
+    }
+    return result;
+}
@@ -0,0 +1,120 @@
+#ifndef COLLISION_COMPONENT_H
+#define COLLISION_COMPONENT_H
+
+#include "../core/component.h"
+
+// An axis-aligned box or circle collider centred on its transform (plus an
+// offset); rotation and scale are ignored.
+//
+// Shapes and world-space bounds live in the collider store, parallel arrays
+// indexed by the component's slot (structure of arrays), which the
+// collision system refreshes from the transforms and scans each update.
+// Every shape is kept as a core box plus a radius: a box has radius 0, a
+// circle is a point-sized box with its radius, so one overlap test covers
+// every shape pair. Destroyed colliders are replaced by the last slot.
+//
+// Colliders flagged continuous are also swept from where the previous
+// update left them to where they are now, so fast movers cannot pass
+// through thin colliders between updates (see collision_system.h). A new
+// collider is not swept until its bounds have been refreshed once (by an
+// update, collision_component_refresh, enabling it or flagging it
+// continuous; shape setters do not count), so positioning it after
+// creation is not a move.
+//
+// Layers and masks filter pairs before the narrow phase: two colliders
+// interact only when each one's layer shares a bit with the other's mask.
+//
+// The store is sized once, by the component pool capacity given at
+// registration.
+
+#define COLLISION_LAYER_DEFAULT 0x1u       // Layer of new colliders
+#define COLLISION_MASK_ALL 0xFFFFFFFFu     // Mask of new colliders
+
+// Collision results
+typedef enum {
+    COLLISION_OK = 0,
+    COLLISION_ERROR_NULL_POINTER,
+    COLLISION_ERROR_INVALID_SHAPE,         // Negative or non-finite size
+    COLLISION_ERROR_OUT_OF_MEMORY,
+    COLLISION_ERROR_UNSUPPORTED            // Kernel not available in this build
+} CollisionResult;
+
+typedef enum {
+    COLLISION_SHAPE_AABB = 0,
+    COLLISION_SHAPE_CIRCLE
+} CollisionShape;
+
+// Collision component structure (64 bytes)
+typedef struct CollisionComponent {
+    Component base;                // 48 bytes - base component
+    uint32_t slot;                 // 4 bytes - index into the collider store
+    uint8_t padding[12];           // 12 bytes - alignment padding to reach 64 bytes
+} CollisionComponent;
+
+// Collider store, one entry per live collider. Written by the component
+// API and the collision system only.
+typedef struct CollisionColliders {
+    CollisionComponent** owners;
+    struct Scene** scenes;         // Scene the collider belongs to, NULL while disabled
+    float* offsetX;                // Shape centre relative to the transform
+    float* offsetY;
+    float* halfWidth;              // Box half extents; 0 for circles
+    float* halfHeight;
+    float* minX;                   // Core box, world space, as of the last refresh
+    float* minY;
+    float* maxX;
+    float* maxY;
+    float* radius;                 // 0 for boxes
+    uint32_t* layer;               // Layer bits the collider is on
+    uint32_t* mask;                // Layer bits the collider collides with
+    uint8_t* shape;                // CollisionShape
+    uint8_t* continuous;           // Swept each update (fast movers)
+    uint8_t* placed;               // Bounds refreshed since creation, so a sweep can start there
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t bytes;                // Charged to the components budget
+} CollisionColliders;
+
+// Collision component interface
+ComponentResult collision_component_register(void);
+ComponentResult collision_component_register_with_capacity(uint32_t poolCapacity);
+CollisionComponent* collision_component_create(GameObject* gameObject);
+void collision_component_destroy(CollisionComponent* collider);
+bool collision_component_is_collision(const Component* component);
+
+// Shapes. New colliders are 0 x 0 boxes at the transform position.
+CollisionResult collision_component_set_aabb(CollisionComponent* collider, float width, float height);
+CollisionResult collision_component_set_circle(CollisionComponent* collider, float radius);
+void collision_component_set_offset(CollisionComponent* collider, float offsetX, float offsetY);
+CollisionShape collision_component_get_shape(const CollisionComponent* collider);
+
+// Filtering. A layer or mask of 0 turns the collider off for collisions.
+void collision_component_set_layer(CollisionComponent* collider, uint32_t layer);
+void collision_component_set_mask(CollisionComponent* collider, uint32_t mask);
+uint32_t collision_component_get_layer(const CollisionComponent* collider);
+uint32_t collision_component_get_mask(const CollisionComponent* collider);
+
+static inline bool collision_layers_interact(uint32_t layerA, uint32_t maskA, uint32_t layerB, uint32_t maskB) {
+    return (layerA & maskB) != 0 && (layerB & maskA) != 0;
+}
+
+// Continuous collision detection for fast movers; off by default. Also
+// refreshes the bounds, so the first sweep starts from the current position.
+void collision_component_set_continuous(CollisionComponent* collider, bool continuous);
+bool collision_component_is_continuous(const CollisionComponent* collider);
+
+// Recomputes the collider's world bounds from its transform now, instead
+// of at the next collision update. A continuous collider then sweeps from
+// here, so call it after teleporting one.
+void collision_component_refresh(CollisionComponent* collider);
+
+// World bounds as of the last refresh (the core box grown by the radius)
+bool collision_component_get_bounds(const CollisionComponent* collider, float* minX, float* minY,
+                                    float* maxX, float* maxY);
+
+// The store, for the collision system
+CollisionColliders* collision_colliders_get(void);
+void collision_colliders_refresh(uint32_t index);   // Bounds of one entry from its transform
+void collision_colliders_shutdown(void);            // Frees the store
+
+#endif // COLLISION_COMPONENT_H
@@ -62,7 +62,9 @@ uint32_t component_factory_get_registered_type_count(void) {
         COMPONENT_TYPE_AUDIO,
         COMPONENT_TYPE_ANIMATION,
         COMPONENT_TYPE_PARTICLES,
-        COMPONENT_TYPE_UI
+        COMPONENT_TYPE_UI,
+        COMPONENT_TYPE_TILEMAP,
+        COMPONENT_TYPE_RIGIDBODY
     };
     
     for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
@@ -0,0 +1,586 @@
+#include "particle_component.h"
+#include "transform_component.h"
+#include "../core/component_registry.h"
+#include "../core/game_object.h"
+#include "../core/memory_budget.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define PARTICLE_HAS_SIMD 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PARTICLE_HAS_SIMD 1
+#else
+    #define PARTICLE_HAS_SIMD 0
+#endif
+
+#define PARTICLE_ARRAYS 5                  // x, y, vx, vy, life
+#define PARTICLE_DRAW_BATCH 64             // Bitmap placements per framebuffer_blit_batch()
+
+// Forward declarations for vtable functions
+static void particle_init(Component* component, GameObject* gameObject);
+static void particle_destroy(Component* component);
+static void particle_render(Component* component);
+
+// Particle component vtable
+static const ComponentVTable particleVTable = {
+    .init = particle_init,
+    .destroy = particle_destroy,
+    .clone = NULL,
+    .update = NULL,
+    .fixedUpdate = NULL,
+    .render = particle_render,
+    .onEnabled = NULL,
+    .onDisabled = NULL,
+    .onGameObjectDestroyed = NULL,
+    .getSerializedSize = NULL,
+    .serialize = NULL,
+    .deserialize = NULL
+};
+
+static void particle_free_storage(ParticleComponent* particles) {
+    if (particles->x) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, particles->storageBytes);
+        free(particles->x);
+    }
+    particles->x = particles->y = NULL;
+    particles->vx = particles->vy = NULL;
+    particles->life = NULL;
+    particles->count = 0;
+    particles->capacity = 0;
+    particles->storageBytes = 0;
+}
+
+// Uniform in [0, 1)
+static inline float particle_random(ParticleComponent* particles) {
+    particles->seed = particles->seed * 1664525u + 1013904223u;
+    return (float)(particles->seed >> 8) * (1.0f / 16777216.0f);
+}
+
+static inline float random_range(ParticleComponent* particles, float low, float high) {
+    return low + (high - low) * particle_random(particles);
+}
+
+static void particle_emitter_origin(const ParticleComponent* particles, float* x, float* y) {
+    *x = 0.0f;
+    *y = 0.0f;
+    if (particles->base.gameObject && particles->base.gameObject->transform) {
+        transform_component_get_position(particles->base.gameObject->transform, x, y);
+    }
+}
+
+// VTable implementations
+static void particle_init(Component* component, GameObject* gameObject) {
+    (void)gameObject;
+
+    if (!component) return;
+
+    ParticleComponent* particles = (ParticleComponent*)component;
+    particles->x = particles->y = NULL;
+    particles->vx = particles->vy = NULL;
+    particles->life = NULL;
+    particles->count = 0;
+    particles->capacity = 0;
+    particles->storageBytes = 0;
+    particles->seed = 0x2545F491u ^ component->id;
+    particles->spawnDebt = 0.0f;
+    particles->config = (ParticleEmitterConfig){
+        .rate = 0.0f,
+        .lifetimeMin = 1.0f,
+        .lifetimeMax = 1.0f,
+        .speedMin = 0.0f,
+        .speedMax = 0.0f,
+        .direction = 0.0f,
+        .spread = 0.0f,
+        .gravityX = 0.0f,
+        .gravityY = 0.0f,
+        .drag = 0.0f
+    };
+    particles->bitmap = NULL;
+    particles->color = BITMAP_COLOR_BLACK;
+    particles->drawMode = BLIT_MODE_COPY;
+    particles->kernel = (uint8_t)particle_kernel_best();
+    particles->emitting = false;
+    particles->visible = true;
+}
+
+static void particle_destroy(Component* component) {
+    if (!component) return;
+
+    // Base component cleanup is handled by component_registry_destroy()
+    ParticleComponent* particles = (ParticleComponent*)component;
+    particle_free_storage(particles);
+    particles->emitting = false;
+    particles->visible = false;
+}
+
+// Draws into the current render target in screen space
+static void particle_render(Component* component) {
+    particle_component_render((ParticleComponent*)component, framebuffer_get_render_target(), NULL);
+}
+
+// Public API implementations
+ParticleComponent* particle_component_create(GameObject* gameObject) {
+    if (!gameObject) return NULL;
+
+    if (particle_component_register() != COMPONENT_OK) {
+        return NULL;
+    }
+
+    const ComponentTypeInfo* info = component_registry_get_type_info(COMPONENT_TYPE_PARTICLES);
+    if (!info || info->defaultVTable != &particleVTable) {
+        return NULL;
+    }
+
+    Component* component = component_registry_create(COMPONENT_TYPE_PARTICLES, gameObject);
+    return (ParticleComponent*)component;
+}
+
+void particle_component_destroy(ParticleComponent* particles) {
+    if (!particles) return;
+
+    component_registry_destroy((Component*)particles);
+}
+
+bool particle_component_is_particles(const Component* component) {
+    return component && component->vtable == &particleVTable;
+}
+
+ParticleResult particle_component_set_capacity(ParticleComponent* particles, uint32_t capacity) {
+    if (!particles) {
+        return PARTICLE_ERROR_NULL_POINTER;
+    }
+    if (capacity == 0 || capacity > PARTICLE_MAX_CAPACITY) {
+        return PARTICLE_ERROR_INVALID_CAPACITY;
+    }
+
+    // Whole SIMD groups, so every array is a multiple of 16 bytes
+    uint32_t rounded = (capacity + PARTICLE_LANES - 1) & ~(uint32_t)(PARTICLE_LANES - 1);
+    uint32_t bytes = rounded * PARTICLE_ARRAYS * (uint32_t)sizeof(float);
+
+    particle_free_storage(particles);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, bytes) != MEMORY_BUDGET_OK) {
+        return PARTICLE_ERROR_BUDGET_EXCEEDED;
+    }
+    float* storage = calloc(1, bytes);
+    if (!storage) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, bytes);
+        return PARTICLE_ERROR_OUT_OF_MEMORY;
+    }
+
+    particles->x = storage;
+    particles->y = particles->x + rounded;
+    particles->vx = particles->y + rounded;
+    particles->vy = particles->vx + rounded;
+    particles->life = particles->vy + rounded;
+    particles->capacity = rounded;
+    particles->storageBytes = bytes;
+    return PARTICLE_OK;
+}
+
+// Emission
+
+void particle_component_set_config(ParticleComponent* particles, const ParticleEmitterConfig* config) {
+    if (!particles || !config) return;
+
+    particles->config = *config;
+    if (particles->config.lifetimeMax < particles->config.lifetimeMin) {
+        particles->config.lifetimeMax = particles->config.lifetimeMin;
+    }
+    if (particles->config.speedMax < particles->config.speedMin) {
+        particles->config.speedMax = particles->config.speedMin;
+    }
+}
+
+void particle_component_set_emitting(ParticleComponent* particles, bool emitting) {
+    if (!particles) return;
+
+    particles->emitting = emitting;
+    if (!emitting) {
+        particles->spawnDebt = 0.0f;
+    }
+}
+
+bool particle_component_spawn(ParticleComponent* particles, float x, float y, float vx, float vy, float life) {
+    if (!particles || particles->count >= particles->capacity || !(life > 0.0f)) {
+        return false;
+    }
+
+    uint32_t i = particles->count++;
+    particles->x[i] = x;
+    particles->y[i] = y;
+    particles->vx[i] = vx;
+    particles->vy[i] = vy;
+    particles->life[i] = life;
+    return true;
+}
+
+uint32_t particle_component_emit(ParticleComponent* particles, uint32_t count) {
+    if (!particles) return 0;
+
+    uint32_t room = particles->capacity - particles->count;
+    if (count > room) count = room;
+
+    const ParticleEmitterConfig* config = &particles->config;
+    float originX, originY;
+    particle_emitter_origin(particles, &originX, &originY);
+    for (uint32_t n = 0; n < count; n++) {
+        float angle = config->direction + config->spread * (particle_random(particles) - 0.5f);
+        float speed = random_range(particles, config->speedMin, config->speedMax);
+        float life = random_range(particles, config->lifetimeMin, config->lifetimeMax);
+
+        uint32_t i = particles->count++;
+        particles->x[i] = originX;
+        particles->y[i] = originY;
+        particles->vx[i] = cosf(angle) * speed;
+        particles->vy[i] = sinf(angle) * speed;
+        particles->life[i] = life > 0.0f ? life : FLT_MIN;
+    }
+    return count;
+}
+
+void particle_component_clear(ParticleComponent* particles) {
+    if (!particles) return;
+
+    particles->count = 0;
+    particles->spawnDebt = 0.0f;
+}
+
+// Simulation. Both kernels do the same float operations in the same order:
+// v = v * damping + gravity * dt, x = x + v * dt, life = life - dt. Each
+// returns the lowest index from which a dead particle may follow.
+
+typedef struct ParticleStep {
+    float dt;
+    float damping;                 // 1 - drag * dt, clamped to [0, 1]
+    float gravityX;                // Gravity times dt
+    float gravityY;
+} ParticleStep;
+
+static uint32_t integrate_scalar(ParticleComponent* particles, const ParticleStep* step, uint32_t start) {
+    float* restrict x = particles->x;
+    float* restrict y = particles->y;
+    float* restrict vx = particles->vx;
+    float* restrict vy = particles->vy;
+    float* restrict life = particles->life;
+    uint32_t firstDead = particles->count;
+
+    for (uint32_t i = start; i < particles->count; i++) {
+        float vxi = vx[i] * step->damping + step->gravityX;
+        float vyi = vy[i] * step->damping + step->gravityY;
+        vx[i] = vxi;
+        vy[i] = vyi;
+        x[i] = x[i] + vxi * step->dt;
+        y[i] = y[i] + vyi * step->dt;
+        life[i] = life[i] - step->dt;
+        if (!(life[i] > 0.0f) && i < firstDead) {
+            firstDead = i;
+        }
+    }
+    return firstDead;
+}
+
+#if PARTICLE_HAS_SIMD
+// Whole groups of four; the remainder goes to the scalar kernel
+static uint32_t integrate_simd(ParticleComponent* particles, const ParticleStep* step) {
+    float* x = particles->x;
+    float* y = particles->y;
+    float* vx = particles->vx;
+    float* vy = particles->vy;
+    float* life = particles->life;
+    uint32_t count = particles->count;
+    uint32_t firstDead = count;
+    uint32_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128 dt = _mm_set1_ps(step->dt);
+    const __m128 damping = _mm_set1_ps(step->damping);
+    const __m128 gravityX = _mm_set1_ps(step->gravityX);
+    const __m128 gravityY = _mm_set1_ps(step->gravityY);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + PARTICLE_LANES <= count; i += PARTICLE_LANES) {
+        __m128 vxi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vx + i), damping), gravityX);
+        __m128 vyi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), damping), gravityY);
+        _mm_storeu_ps(vx + i, vxi);
+        _mm_storeu_ps(vy + i, vyi);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(vxi, dt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(vyi, dt)));
+        __m128 lifei = _mm_sub_ps(_mm_loadu_ps(life + i), dt);
+        _mm_storeu_ps(life + i, lifei);
+        if (_mm_movemask_ps(_mm_cmpngt_ps(lifei, zero)) && i < firstDead) {
+            firstDead = i;
+        }
+    }
+#else
+    const float32x4_t dt = vdupq_n_f32(step->dt);
+    const float32x4_t damping = vdupq_n_f32(step->damping);
+    const float32x4_t gravityX = vdupq_n_f32(step->gravityX);
+    const float32x4_t gravityY = vdupq_n_f32(step->gravityY);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    for (; i + PARTICLE_LANES <= count; i += PARTICLE_LANES) {
+        float32x4_t vxi = vaddq_f32(vmulq_f32(vld1q_f32(vx + i), damping), gravityX);
+        float32x4_t vyi = vaddq_f32(vmulq_f32(vld1q_f32(vy + i), damping), gravityY);
+        vst1q_f32(vx + i, vxi);
+        vst1q_f32(vy + i, vyi);
+        vst1q_f32(x + i, vaddq_f32(vld1q_f32(x + i), vmulq_f32(vxi, dt)));
+        vst1q_f32(y + i, vaddq_f32(vld1q_f32(y + i), vmulq_f32(vyi, dt)));
+        float32x4_t lifei = vsubq_f32(vld1q_f32(life + i), dt);
+        vst1q_f32(life + i, lifei);
+        // Alive lanes compare all-ones; any other lane is dead (NaN included)
+        uint32x4_t alive = vcgtq_f32(lifei, zero);
+        uint32x2_t both = vand_u32(vget_low_u32(alive), vget_high_u32(alive));
+        if ((vget_lane_u32(both, 0) & vget_lane_u32(both, 1)) != UINT32_MAX && i < firstDead) {
+            firstDead = i;
+        }
+    }
+#endif
+
+    uint32_t tailDead = integrate_scalar(particles, step, i);
+    return firstDead < tailDead ? firstDead : tailDead;
+}
+#endif
+
+// Moves the last live particle into each dead one's place
+static void particles_compact(ParticleComponent* particles, uint32_t start) {
+    uint32_t count = particles->count;
+    for (uint32_t i = start; i < count;) {
+        if (particles->life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        count--;
+        particles->x[i] = particles->x[count];
+        particles->y[i] = particles->y[count];
+        particles->vx[i] = particles->vx[count];
+        particles->vy[i] = particles->vy[count];
+        particles->life[i] = particles->life[count];
+    }
+    particles->count = count;
+}
+
+bool particle_kernel_is_supported(ParticleKernel kernel) {
+    switch (kernel) {
+        case PARTICLE_KERNEL_SCALAR: return true;
+        case PARTICLE_KERNEL_SIMD: return PARTICLE_HAS_SIMD;
+        default: return false;
+    }
+}
+
+ParticleKernel particle_kernel_best(void) {
+    return PARTICLE_HAS_SIMD ? PARTICLE_KERNEL_SIMD : PARTICLE_KERNEL_SCALAR;
+}
+
+ParticleResult particle_component_set_kernel(ParticleComponent* particles, ParticleKernel kernel) {
+    if (!particles) {
+        return PARTICLE_ERROR_NULL_POINTER;
+    }
+    if (!particle_kernel_is_supported(kernel)) {
+        return PARTICLE_ERROR_UNSUPPORTED;
+    }
+
+    particles->kernel = (uint8_t)kernel;
+    return PARTICLE_OK;
+}
+
+void particle_component_update(ParticleComponent* particles, float deltaTime) {
+    if (!particles || !(deltaTime > 0.0f)) return;
+
+    if (particles->count > 0) {
+        float damping = 1.0f - particles->config.drag * deltaTime;
+        ParticleStep step = {
+            .dt = deltaTime,
+            .damping = damping < 0.0f ? 0.0f : (damping > 1.0f ? 1.0f : damping),
+            .gravityX = particles->config.gravityX * deltaTime,
+            .gravityY = particles->config.gravityY * deltaTime
+        };
+
+        uint32_t firstDead;
+#if PARTICLE_HAS_SIMD
+        if (particles->kernel == PARTICLE_KERNEL_SIMD) {
+            firstDead = integrate_simd(particles, &step);
+        } else
+#endif
+        {
+            firstDead = integrate_scalar(particles, &step, 0);
+        }
+        if (firstDead < particles->count) {
+            particles_compact(particles, firstDead);
+        }
+    }
+
+    // New particles start at the emitter this frame
+    if (particles->emitting && particles->config.rate > 0.0f) {
+        particles->spawnDebt += particles->config.rate * deltaTime;
+        uint32_t spawn = particles->capacity;
+        if (particles->spawnDebt < (float)particles->capacity) {
+            spawn = (uint32_t)particles->spawnDebt;
+            particles->spawnDebt -= (float)spawn;
+        } else {
+            particles->spawnDebt = 0.0f;
+        }
+        particle_component_emit(particles, spawn);
+    }
+}
+
+// Appearance
+
+void particle_component_set_bitmap(ParticleComponent* particles, const Bitmap* bitmap) {
+    if (!particles) return;
+
+    particles->bitmap = bitmap;
+}
+
+void particle_component_set_color(ParticleComponent* particles, BitmapColor color) {
+    if (!particles) return;
+
+    particles->color = (uint8_t)color;
+}
+
+void particle_component_set_draw_mode(ParticleComponent* particles, BlitMode mode) {
+    if (!particles || mode >= BLIT_MODE_COUNT) return;
+
+    particles->drawMode = (uint8_t)mode;
+}
+
+void particle_component_set_visible(ParticleComponent* particles, bool visible) {
+    if (!particles) return;
+
+    particles->visible = visible;
+}
+
+// Rendering. Positions round like sprite positions.
+
+static inline void plot_point(uint64_t* words, uint32_t stride, uint32_t px, uint32_t py, bool white) {
+    uint64_t* word = &words[(size_t)py * stride + px / BITMAP_WORD_BITS];
+    uint64_t bit = UINT64_C(1) << (px % BITMAP_WORD_BITS);
+    *word = white ? (*word | bit) : (*word & ~bit);
+}
+
+static void render_points(const ParticleComponent* particles, Framebuffer* target, float originX, float originY) {
+    const float* x = particles->x;
+    const float* y = particles->y;
+    uint32_t count = particles->count;
+    uint32_t width = target->width;
+    uint32_t height = target->height;
+    bool white = particles->color == BITMAP_COLOR_WHITE;
+    uint32_t i = 0;
+
+#if defined(__SSE2__)
+    // Four conversions at once, rounding to nearest like lrintf(); values out
+    // of int32 range (and NaN) convert to INT32_MIN and fail the bounds test
+    const __m128 offsetX = _mm_set1_ps(originX);
+    const __m128 offsetY = _mm_set1_ps(originY);
+    for (; i + PARTICLE_LANES <= count; i += PARTICLE_LANES) {
+        uint32_t px[PARTICLE_LANES], py[PARTICLE_LANES];
+        _mm_storeu_si128((__m128i*)px, _mm_cvtps_epi32(_mm_sub_ps(_mm_loadu_ps(x + i), offsetX)));
+        _mm_storeu_si128((__m128i*)py, _mm_cvtps_epi32(_mm_sub_ps(_mm_loadu_ps(y + i), offsetY)));
+        for (uint32_t lane = 0; lane < PARTICLE_LANES; lane++) {
+            if (px[lane] < width && py[lane] < height) {
+                plot_point(target->words, target->stride, px[lane], py[lane], white);
+            }
+        }
+    }
+#endif
+
+    float limitX = (float)width;
+    float limitY = (float)height;
+    for (; i < count; i++) {
+        float screenX = x[i] - originX;
+        float screenY = y[i] - originY;
+        if (!(screenX > -1.0f && screenX < limitX && screenY > -1.0f && screenY < limitY)) continue;
+
+        uint32_t px = (uint32_t)lrintf(screenX);
+        uint32_t py = (uint32_t)lrintf(screenY);
+        if (px < width && py < height) {
+            plot_point(target->words, target->stride, px, py, white);
+        }
+    }
+}
+
+static void render_bitmaps(const ParticleComponent* particles, Framebuffer* target, float originX, float originY) {
+    const Bitmap* bitmap = particles->bitmap;
+    BlitDraw draws[PARTICLE_DRAW_BATCH];
+    uint32_t pending = 0;
+
+    // Centred like a sprite; anything that can't touch the target is skipped
+    float halfWidth = (float)(bitmap->width / 2);
+    float halfHeight = (float)(bitmap->height / 2);
+    float minX = -(float)bitmap->width, maxX = (float)target->width + (float)bitmap->width;
+    float minY = -(float)bitmap->height, maxY = (float)target->height + (float)bitmap->height;
+    for (uint32_t i = 0; i < particles->count; i++) {
+        float screenX = particles->x[i] - originX;
+        float screenY = particles->y[i] - originY;
+        if (!(screenX > minX && screenX < maxX && screenY > minY && screenY < maxY)) continue;
+
+        draws[pending].bitmap = bitmap;
+        draws[pending].x = (int32_t)lrintf(screenX - halfWidth);
+        draws[pending].y = (int32_t)lrintf(screenY - halfHeight);
+        if (++pending == PARTICLE_DRAW_BATCH) {
+            framebuffer_blit_batch(target, draws, pending, (BlitMode)particles->drawMode);
+            pending = 0;
+        }
+    }
+    if (pending > 0) {
+        framebuffer_blit_batch(target, draws, pending, (BlitMode)particles->drawMode);
+    }
+}
+
+void particle_component_render(const ParticleComponent* particles, Framebuffer* target, const RenderCamera* camera) {
+    if (!particles || !target || !particles->visible || particles->count == 0) return;
+
+    float originX = camera ? camera->x : 0.0f;
+    float originY = camera ? camera->y : 0.0f;
+    if (particles->bitmap) {
+        render_bitmaps(particles, target, originX, originY);
+    } else {
+        render_points(particles, target, originX, originY);
+    }
+}
+
+// Scene systems
+
+void particle_system_update_batch(Component** components, uint32_t count, float deltaTime) {
+    if (!components) return;
+
+    for (uint32_t i = 0; i < count; i++) {
+        Component* component = components[i];
+        if (particle_component_is_particles(component) && component->enabled) {
+            particle_component_update((ParticleComponent*)component, deltaTime);
+        }
+    }
+}
+
+void particle_system_render_batch(Component** components, uint32_t count) {
+    Framebuffer* target = framebuffer_get_render_target();
+    if (!components || !target) return;
+
+    for (uint32_t i = 0; i < count; i++) {
+        Component* component = components[i];
+        if (particle_component_is_particles(component) && component->enabled) {
+            particle_component_render((ParticleComponent*)component, target, NULL);
+        }
+    }
+}
+
+// Registration function
+ComponentResult particle_component_register(void) {
+    return particle_component_register_with_capacity(PARTICLE_DEFAULT_POOL_SIZE);
+}
+
+ComponentResult particle_component_register_with_capacity(uint32_t poolCapacity) {
+    if (component_registry_is_type_registered(COMPONENT_TYPE_PARTICLES)) {
+        return COMPONENT_OK; // Already registered
+    }
+
+    return component_registry_register_type(
+        COMPONENT_TYPE_PARTICLES,
+        sizeof(ParticleComponent),
+        poolCapacity,
+        &particleVTable,
+        "Particles"
+    );
+}
@@ -0,0 +1,119 @@
+#ifndef PARTICLE_COMPONENT_H
+#define PARTICLE_COMPONENT_H
+
+#include "../core/component.h"
+#include "../graphics/framebuffer.h"
+#include "../graphics/render_queue.h"
+
+// A particle emitter owning a fixed-capacity pool of particles, instead of
+// a GameObject and transform per particle. Particles are stored as parallel
+// float arrays (structure of arrays); a dying particle is replaced by the
+// last live one, so live particles are always 0 .. count - 1 and nothing
+// is allocated after particle_component_set_capacity().
+//
+// particle_component_update() integrates every live particle four at a
+// time (SSE2 or NEON when available): velocity gains gravity and loses drag,
+// then position moves by the new velocity (semi-implicit Euler) and life
+// counts down. New particles then spawn at the owning transform position,
+// at the configured rate. Particles live in world space, so moving the
+// emitter leaves trails.
+//
+// Rendering plots one pixel per particle, or blits a small bitmap centred
+// on each one in batches.
+
+#define PARTICLE_DEFAULT_POOL_SIZE 16                           // Emitters are few; particles are many
+#define PARTICLE_MAX_CAPACITY (1u << 20)
+#define PARTICLE_LANES 4                                        // Capacity is rounded up to a multiple
+
+// Particle results
+typedef enum {
+    PARTICLE_OK = 0,
+    PARTICLE_ERROR_NULL_POINTER,
+    PARTICLE_ERROR_INVALID_CAPACITY,
+    PARTICLE_ERROR_OUT_OF_MEMORY,
+    PARTICLE_ERROR_BUDGET_EXCEEDED,
+    PARTICLE_ERROR_UNSUPPORTED             // Kernel not available in this build
+} ParticleResult;
+
+// Integration kernels (same results up to float rounding)
+typedef enum {
+    PARTICLE_KERNEL_SCALAR = 0,
+    PARTICLE_KERNEL_SIMD,                  // 4 particles per step
+    PARTICLE_KERNEL_COUNT
+} ParticleKernel;
+
+// How new particles start
+typedef struct ParticleEmitterConfig {
+    float rate;                    // Particles per second, 0 = bursts only
+    float lifetimeMin;             // Seconds
+    float lifetimeMax;
+    float speedMin;                // Pixels per second
+    float speedMax;
+    float direction;               // Radians, 0 = +x, pi / 2 = down the screen
+    float spread;                  // Full cone width in radians
+    float gravityX;                // Pixels per second squared
+    float gravityY;
+    float drag;                    // Fraction of velocity lost per second
+} ParticleEmitterConfig;
+
+// Particle component structure
+typedef struct ParticleComponent {
+    Component base;                // 48 bytes - base component
+    float* x;                      // Positions, world space
+    float* y;
+    float* vx;                     // Velocities, pixels per second
+    float* vy;
+    float* life;                   // Seconds left; dead at 0
+    uint32_t count;                // Live particles
+    uint32_t capacity;
+    uint32_t storageBytes;         // Particle arrays, charged to the scene budget
+    uint32_t seed;                 // Spawn randomness
+    float spawnDebt;               // Fraction of a particle owed by the rate
+    ParticleEmitterConfig config;
+    const Bitmap* bitmap;          // NULL plots single pixels
+    uint8_t color;                 // BitmapColor of plotted pixels
+    uint8_t drawMode;              // BlitMode of bitmaps
+    uint8_t kernel;                // ParticleKernel
+    bool emitting;                 // Spawns at config.rate
+    bool visible;
+} ParticleComponent;
+
+// Particle component interface
+ComponentResult particle_component_register(void);
+ComponentResult particle_component_register_with_capacity(uint32_t poolCapacity);
+ParticleComponent* particle_component_create(GameObject* gameObject);
+void particle_component_destroy(ParticleComponent* particles);
+bool particle_component_is_particles(const Component* component);
+
+// Allocates room for capacity particles (rounded up to PARTICLE_LANES);
+// live particles are discarded
+ParticleResult particle_component_set_capacity(ParticleComponent* particles, uint32_t capacity);
+
+// Emission. Spawning stops silently when the pool is full.
+void particle_component_set_config(ParticleComponent* particles, const ParticleEmitterConfig* config);
+void particle_component_set_emitting(ParticleComponent* particles, bool emitting);
+uint32_t particle_component_emit(ParticleComponent* particles, uint32_t count);   // Burst; returns spawned
+bool particle_component_spawn(ParticleComponent* particles, float x, float y, float vx, float vy, float life);
+void particle_component_clear(ParticleComponent* particles);
+
+// Simulation
+ParticleResult particle_component_set_kernel(ParticleComponent* particles, ParticleKernel kernel);
+void particle_component_update(ParticleComponent* particles, float deltaTime);
+bool particle_kernel_is_supported(ParticleKernel kernel);
+ParticleKernel particle_kernel_best(void);
+
+// Appearance
+void particle_component_set_bitmap(ParticleComponent* particles, const Bitmap* bitmap);
+void particle_component_set_color(ParticleComponent* particles, BitmapColor color);
+void particle_component_set_draw_mode(ParticleComponent* particles, BlitMode mode);
+void particle_component_set_visible(ParticleComponent* particles, bool visible);
+
+// Draws the live particles; camera NULL draws in screen space
+void particle_component_render(const ParticleComponent* particles, Framebuffer* target, const RenderCamera* camera);
+
+// Scene system entry points: update every emitter, then draw them into the
+// current render target in screen space
+void particle_system_update_batch(Component** components, uint32_t count, float deltaTime);
+void particle_system_render_batch(Component** components, uint32_t count);
+
+#endif // PARTICLE_COMPONENT_H
@@ -0,0 +1,279 @@
+#include "rigidbody_component.h"
+#include "../core/component_registry.h"
+#include "../core/game_object.h"
+#include "../core/memory_budget.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RIGIDBODY_NO_SLOT UINT32_MAX
+#define RIGIDBODY_FLOAT_ARRAYS 10          // vx .. stepY
+
+static RigidBodies g_bodies = {0};
+
+// Forward declarations for vtable functions
+static void rigidbody_init(Component* component, GameObject* gameObject);
+static void rigidbody_destroy(Component* component);
+static void rigidbody_on_enabled(Component* component);
+static void rigidbody_on_disabled(Component* component);
+
+// Rigid body component vtable
+static const ComponentVTable rigidbodyVTable = {
+    .init = rigidbody_init,
+    .destroy = rigidbody_destroy,
+    .clone = NULL,
+    .update = NULL,
+    .fixedUpdate = NULL,
+    .render = NULL,
+    .onEnabled = rigidbody_on_enabled,
+    .onDisabled = rigidbody_on_disabled,
+    .onGameObjectDestroyed = NULL,
+    .getSerializedSize = NULL,
+    .serialize = NULL,
+    .deserialize = NULL
+};
+
+void rigidbody_bodies_shutdown(void) {
+    if (g_bodies.owners) {
+        memory_budget_release(MEMORY_SUBSYSTEM_COMPONENTS, g_bodies.bytes);
+        free(g_bodies.owners);         // Start of the single block
+    }
+    memset(&g_bodies, 0, sizeof(RigidBodies));
+}
+
+// One block: pointers, then floats, then the moved bits
+static ComponentResult rigidbody_bodies_allocate(uint32_t capacity) {
+    rigidbody_bodies_shutdown();
+
+    size_t words = (size_t)capacity / 32 + 1;
+    size_t bytes = (size_t)capacity * (sizeof(RigidBodyComponent*) + sizeof(struct Scene*) +
+                                       RIGIDBODY_FLOAT_ARRAYS * sizeof(float)) + words * sizeof(uint32_t);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_COMPONENTS, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return COMPONENT_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* block = calloc(1, bytes ? bytes : 1);
+    if (!block) {
+        memory_budget_release(MEMORY_SUBSYSTEM_COMPONENTS, (uint32_t)bytes);
+        return COMPONENT_ERROR_POOL_FULL;
+    }
+
+    RigidBodies* store = &g_bodies;
+    store->owners = (RigidBodyComponent**)block;
+    store->scenes = (struct Scene**)(store->owners + capacity);
+    float* floats = (float*)(store->scenes + capacity);
+    float** arrays[RIGIDBODY_FLOAT_ARRAYS] = {
+        &store->vx, &store->vy, &store->ax, &store->ay, &store->forceX, &store->forceY,
+        &store->inverseMass, &store->damping, &store->stepX, &store->stepY
+    };
+    for (uint32_t i = 0; i < RIGIDBODY_FLOAT_ARRAYS; i++) {
+        *arrays[i] = floats + (size_t)i * capacity;
+    }
+    store->moved = (uint32_t*)(floats + (size_t)RIGIDBODY_FLOAT_ARRAYS * capacity);
+    store->capacity = capacity;
+    store->bytes = (uint32_t)bytes;
+    return COMPONENT_OK;
+}
+
+static inline bool rigidbody_has_slot(const RigidBodyComponent* body) {
+    return body && body->slot < g_bodies.count && g_bodies.owners[body->slot] == body;
+}
+
+// VTable implementations
+static void rigidbody_init(Component* component, GameObject* gameObject) {
+    if (!component) return;
+
+    RigidBodyComponent* body = (RigidBodyComponent*)component;
+    body->slot = RIGIDBODY_NO_SLOT;
+    memset(body->padding, 0, sizeof(body->padding));
+
+    // The pool and the store share a capacity, so a slot is free whenever
+    // a component could be allocated
+    RigidBodies* store = &g_bodies;
+    if (store->count >= store->capacity) return;
+
+    uint32_t slot = store->count++;
+    store->owners[slot] = body;
+    store->scenes[slot] = gameObject ? gameObject->scene : NULL;
+    store->vx[slot] = store->vy[slot] = 0.0f;
+    store->ax[slot] = store->ay[slot] = 0.0f;
+    store->forceX[slot] = store->forceY[slot] = 0.0f;
+    store->inverseMass[slot] = 1.0f;
+    store->damping[slot] = 0.0f;
+    store->stepX[slot] = store->stepY[slot] = 0.0f;
+    store->moved[slot / 32] &= ~(1u << (slot % 32));
+    body->slot = slot;
+}
+
+static void rigidbody_destroy(Component* component) {
+    RigidBodyComponent* body = (RigidBodyComponent*)component;
+    if (!rigidbody_has_slot(body)) return;
+
+    // Base component cleanup is handled by component_registry_destroy()
+    RigidBodies* store = &g_bodies;
+    uint32_t slot = body->slot;
+    uint32_t last = --store->count;
+    if (slot != last) {
+        store->owners[slot] = store->owners[last];
+        store->scenes[slot] = store->scenes[last];
+        store->vx[slot] = store->vx[last];
+        store->vy[slot] = store->vy[last];
+        store->ax[slot] = store->ax[last];
+        store->ay[slot] = store->ay[last];
+        store->forceX[slot] = store->forceX[last];
+        store->forceY[slot] = store->forceY[last];
+        store->inverseMass[slot] = store->inverseMass[last];
+        store->damping[slot] = store->damping[last];
+        store->stepX[slot] = store->stepX[last];
+        store->stepY[slot] = store->stepY[last];
+        uint32_t lastMoved = (store->moved[last / 32] >> (last % 32)) & 1u;
+        store->moved[slot / 32] = (store->moved[slot / 32] & ~(1u << (slot % 32))) | lastMoved << (slot % 32);
+        store->owners[slot]->slot = slot;
+    }
+    store->moved[last / 32] &= ~(1u << (last % 32));
+    body->slot = RIGIDBODY_NO_SLOT;
+}
+
+static void rigidbody_on_enabled(Component* component) {
+    RigidBodyComponent* body = (RigidBodyComponent*)component;
+    if (rigidbody_has_slot(body)) {
+        g_bodies.scenes[body->slot] = component->gameObject ? component->gameObject->scene : NULL;
+    }
+}
+
+static void rigidbody_on_disabled(Component* component) {
+    RigidBodyComponent* body = (RigidBodyComponent*)component;
+    if (rigidbody_has_slot(body)) {
+        g_bodies.scenes[body->slot] = NULL;
+        g_bodies.moved[body->slot / 32] &= ~(1u << (body->slot % 32));   // No scene update clears it now
+    }
+}
+
+// Public API implementations
+RigidBodyComponent* rigidbody_component_create(GameObject* gameObject) {
+    if (!gameObject) return NULL;
+
+    if (rigidbody_component_register() != COMPONENT_OK) {
+        return NULL;
+    }
+
+    const ComponentTypeInfo* info = component_registry_get_type_info(COMPONENT_TYPE_RIGIDBODY);
+    if (!info || info->defaultVTable != &rigidbodyVTable) {
+        return NULL;
+    }
+
+    Component* component = component_registry_create(COMPONENT_TYPE_RIGIDBODY, gameObject);
+    return (RigidBodyComponent*)component;
+}
+
+void rigidbody_component_destroy(RigidBodyComponent* body) {
+    if (!body) return;
+
+    component_registry_destroy((Component*)body);
+}
+
+bool rigidbody_component_is_rigidbody(const Component* component) {
+    return component && component->vtable == &rigidbodyVTable;
+}
+
+// Motion
+
+void rigidbody_component_set_velocity(RigidBodyComponent* body, float vx, float vy) {
+    if (!rigidbody_has_slot(body)) return;
+
+    g_bodies.vx[body->slot] = vx;
+    g_bodies.vy[body->slot] = vy;
+}
+
+void rigidbody_component_get_velocity(const RigidBodyComponent* body, float* vx, float* vy) {
+    bool valid = rigidbody_has_slot(body);
+    if (vx) *vx = valid ? g_bodies.vx[body->slot] : 0.0f;
+    if (vy) *vy = valid ? g_bodies.vy[body->slot] : 0.0f;
+}
+
+void rigidbody_component_set_acceleration(RigidBodyComponent* body, float ax, float ay) {
+    if (!rigidbody_has_slot(body)) return;
+
+    g_bodies.ax[body->slot] = ax;
+    g_bodies.ay[body->slot] = ay;
+}
+
+RigidBodyResult rigidbody_component_set_damping(RigidBodyComponent* body, float damping) {
+    if (!rigidbody_has_slot(body)) {
+        return RIGIDBODY_ERROR_NULL_POINTER;
+    }
+    if (!(damping >= 0.0f) || !isfinite(damping)) {
+        return RIGIDBODY_ERROR_INVALID_VALUE;
+    }
+
+    g_bodies.damping[body->slot] = damping;
+    return RIGIDBODY_OK;
+}
+
+RigidBodyResult rigidbody_component_set_mass(RigidBodyComponent* body, float mass) {
+    if (!rigidbody_has_slot(body)) {
+        return RIGIDBODY_ERROR_NULL_POINTER;
+    }
+    if (!(mass >= 0.0f) || !isfinite(mass)) {
+        return RIGIDBODY_ERROR_INVALID_VALUE;
+    }
+
+    g_bodies.inverseMass[body->slot] = mass > 0.0f ? 1.0f / mass : 0.0f;
+    return RIGIDBODY_OK;
+}
+
+float rigidbody_component_get_mass(const RigidBodyComponent* body) {
+    if (!rigidbody_has_slot(body)) return 0.0f;
+
+    float inverseMass = g_bodies.inverseMass[body->slot];
+    return inverseMass > 0.0f ? 1.0f / inverseMass : 0.0f;
+}
+
+// Forces
+
+void rigidbody_component_apply_force(RigidBodyComponent* body, float forceX, float forceY) {
+    if (!rigidbody_has_slot(body)) return;
+
+    g_bodies.forceX[body->slot] += forceX;
+    g_bodies.forceY[body->slot] += forceY;
+}
+
+void rigidbody_component_apply_impulse(RigidBodyComponent* body, float impulseX, float impulseY) {
+    if (!rigidbody_has_slot(body)) return;
+
+    float inverseMass = g_bodies.inverseMass[body->slot];
+    g_bodies.vx[body->slot] += impulseX * inverseMass;
+    g_bodies.vy[body->slot] += impulseY * inverseMass;
+}
+
+RigidBodies* rigidbody_bodies_get(void) {
+    return &g_bodies;
+}
+
+// Registration function
+ComponentResult rigidbody_component_register(void) {
+    return rigidbody_component_register_with_capacity(DEFAULT_COMPONENT_POOL_SIZE);
+}
+
+ComponentResult rigidbody_component_register_with_capacity(uint32_t poolCapacity) {
+    if (component_registry_is_type_registered(COMPONENT_TYPE_RIGIDBODY)) {
+        return COMPONENT_OK; // Already registered
+    }
+
+    // A new registry means any earlier bodies are gone
+    ComponentResult result = rigidbody_bodies_allocate(poolCapacity);
+    if (result != COMPONENT_OK) {
+        return result;
+    }
+
+    result = component_registry_register_type(
+        COMPONENT_TYPE_RIGIDBODY,
+        sizeof(RigidBodyComponent),
+        poolCapacity,
+        &rigidbodyVTable,
+        "RigidBody"
+    );
+    if (result != COMPONENT_OK) {
+        rigidbody_bodies_shutdown();
+    }
+    return result;
+}
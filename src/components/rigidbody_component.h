@@ -0,0 +1,84 @@
+#ifndef RIGIDBODY_COMPONENT_H
+#define RIGIDBODY_COMPONENT_H
+
+#include "../core/component.h"
+
+// A moving body: velocity, constant acceleration, damping and mass, moved
+// by the rigid body system instead of per-object translate calls. Rotation
+// is not simulated.
+//
+// Body state lives in the body store, parallel arrays indexed by the
+// component's slot (structure of arrays), so the system can integrate
+// every body in a scene four at a time (see rigidbody_system.h). The
+// transform stays the owner of the position: the system adds each step's
+// displacement to it, so setting a position directly still works.
+// Destroyed bodies are replaced by the last slot.
+//
+// Forces applied between steps are scaled by the inverse mass and cleared
+// by the next step; impulses change the velocity at once. A body with
+// mass 0 is kinematic: it keeps its velocity and acceleration but ignores
+// forces and impulses.
+//
+// The store is sized once, by the component pool capacity given at
+// registration.
+
+// Rigid body results
+typedef enum {
+    RIGIDBODY_OK = 0,
+    RIGIDBODY_ERROR_NULL_POINTER,
+    RIGIDBODY_ERROR_INVALID_VALUE,         // Negative or non-finite mass, damping or step
+    RIGIDBODY_ERROR_UNSUPPORTED            // Kernel not available in this build
+} RigidBodyResult;
+
+// Rigid body component structure (64 bytes)
+typedef struct RigidBodyComponent {
+    Component base;                // 48 bytes - base component
+    uint32_t slot;                 // 4 bytes - index into the body store
+    uint8_t padding[12];           // 12 bytes - alignment padding to reach 64 bytes
+} RigidBodyComponent;
+
+// Body store, one entry per live body. Written by the component API and
+// the rigid body system only.
+typedef struct RigidBodies {
+    RigidBodyComponent** owners;
+    struct Scene** scenes;         // Scene the body belongs to, NULL while disabled
+    float* vx;                     // Velocity, world units per second
+    float* vy;
+    float* ax;                     // Constant acceleration (gravity), units per second squared
+    float* ay;
+    float* forceX;                 // Accumulated since the last step
+    float* forceY;
+    float* inverseMass;            // 0 for kinematic bodies
+    float* damping;                // Fraction of velocity lost per second
+    float* stepX;                  // Displacement over the last system update
+    float* stepY;
+    uint32_t* moved;               // Bit per slot: moved by the last system update
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t bytes;                // Charged to the components budget
+} RigidBodies;
+
+// Rigid body component interface
+ComponentResult rigidbody_component_register(void);
+ComponentResult rigidbody_component_register_with_capacity(uint32_t poolCapacity);
+RigidBodyComponent* rigidbody_component_create(GameObject* gameObject);
+void rigidbody_component_destroy(RigidBodyComponent* body);
+bool rigidbody_component_is_rigidbody(const Component* component);
+
+// Motion. New bodies are at rest with mass 1 and no damping.
+void rigidbody_component_set_velocity(RigidBodyComponent* body, float vx, float vy);
+void rigidbody_component_get_velocity(const RigidBodyComponent* body, float* vx, float* vy);
+void rigidbody_component_set_acceleration(RigidBodyComponent* body, float ax, float ay);
+RigidBodyResult rigidbody_component_set_damping(RigidBodyComponent* body, float damping);
+RigidBodyResult rigidbody_component_set_mass(RigidBodyComponent* body, float mass);   // 0 = kinematic
+float rigidbody_component_get_mass(const RigidBodyComponent* body);
+
+// Forces
+void rigidbody_component_apply_force(RigidBodyComponent* body, float forceX, float forceY);
+void rigidbody_component_apply_impulse(RigidBodyComponent* body, float impulseX, float impulseY);
+
+// The store, for the rigid body system
+RigidBodies* rigidbody_bodies_get(void);
+void rigidbody_bodies_shutdown(void);      // Frees the store
+
+#endif // RIGIDBODY_COMPONENT_H
@@ -0,0 +1,205 @@
+#include "sprite_component.h"
+#include "transform_component.h"
+#include "../core/component_registry.h"
+#include "../core/game_object.h"
+#include <math.h>
+#include <string.h>
+
+// Forward declarations for vtable functions
+static void sprite_init(Component* component, GameObject* gameObject);
+static void sprite_destroy(Component* component);
+static void sprite_render(Component* component);
+
+// Largest distance from any sprite's position to its bitmap edge, used to
+// expand culling queries (only grows; set through the setters below)
+static int32_t g_maxSpriteExtent = 0;
+
+static void sprite_track_extent(const SpriteComponent* sprite) {
+    if (!sprite->bitmap) return;
+
+    int32_t extents[4] = {
+        sprite->offsetX, sprite->offsetX + (int32_t)sprite->bitmap->width,
+        sprite->offsetY, sprite->offsetY + (int32_t)sprite->bitmap->height
+    };
+    for (int i = 0; i < 4; i++) {
+        int32_t extent = extents[i] < 0 ? -extents[i] : extents[i];
+        if (extent > g_maxSpriteExtent) g_maxSpriteExtent = extent;
+    }
+}
+
+// Appearance changes are recorded on the transform so the dirty-region
+// pass sees moves and sprite changes through one flag
+static void sprite_mark_dirty(SpriteComponent* sprite) {
+    if (sprite->base.gameObject && sprite->base.gameObject->transform) {
+        sprite->base.gameObject->transform->renderDirty = true;
+    }
+}
+
+// Sprite component vtable
+static const ComponentVTable spriteVTable = {
+    .init = sprite_init,
+    .destroy = sprite_destroy,
+    .clone = NULL,
+    .update = NULL,
+    .fixedUpdate = NULL,
+    .render = sprite_render,
+    .onEnabled = NULL,
+    .onDisabled = NULL,
+    .onGameObjectDestroyed = NULL,
+    .getSerializedSize = NULL,
+    .serialize = NULL,
+    .deserialize = NULL
+};
+
+// VTable implementations
+static void sprite_init(Component* component, GameObject* gameObject) {
+    (void)gameObject;
+
+    if (!component) return;
+
+    SpriteComponent* sprite = (SpriteComponent*)component;
+    sprite->bitmap = NULL;
+    sprite->offsetX = 0;
+    sprite->offsetY = 0;
+    sprite->layer = 0;
+    sprite->z = 0;
+    sprite->drawMode = BLIT_MODE_COPY;
+    sprite->visible = true;
+}
+
+static void sprite_destroy(Component* component) {
+    if (!component) return;
+
+    // Base component cleanup is handled by component_registry_destroy()
+    SpriteComponent* sprite = (SpriteComponent*)component;
+    sprite->bitmap = NULL;
+    sprite->visible = false;
+}
+
+// Draws into the current render target; translation only, rotation and
+// scale of the transform do not apply to 1-bit blits
+static void sprite_render(Component* component) {
+    SpriteComponent* sprite = (SpriteComponent*)component;
+    Framebuffer* target = framebuffer_get_render_target();
+    if (!target || !sprite->visible || !sprite->bitmap) return;
+
+    int32_t x, y;
+    sprite_component_get_screen_position(sprite, &x, &y);
+    framebuffer_blit_mode(target, sprite->bitmap, x, y, (BlitMode)sprite->drawMode);
+}
+
+// Public API implementations
+SpriteComponent* sprite_component_create(GameObject* gameObject) {
+    if (!gameObject) return NULL;
+
+    if (sprite_component_register() != COMPONENT_OK) {
+        return NULL;
+    }
+
+    // The sprite type may have been registered with a different layout
+    const ComponentTypeInfo* info = component_registry_get_type_info(COMPONENT_TYPE_SPRITE);
+    if (!info || info->defaultVTable != &spriteVTable) {
+        return NULL;
+    }
+
+    Component* component = component_registry_create(COMPONENT_TYPE_SPRITE, gameObject);
+    return (SpriteComponent*)component;
+}
+
+void sprite_component_destroy(SpriteComponent* sprite) {
+    if (!sprite) return;
+
+    component_registry_destroy((Component*)sprite);
+}
+
+void sprite_component_set_bitmap(SpriteComponent* sprite, const Bitmap* bitmap) {
+    if (!sprite) return;
+
+    sprite->bitmap = bitmap;
+    if (bitmap) {
+        sprite->offsetX = (int16_t)-(int32_t)(bitmap->width / 2);
+        sprite->offsetY = (int16_t)-(int32_t)(bitmap->height / 2);
+        sprite_track_extent(sprite);
+    }
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_component_set_offset(SpriteComponent* sprite, int16_t offsetX, int16_t offsetY) {
+    if (!sprite) return;
+
+    sprite->offsetX = offsetX;
+    sprite->offsetY = offsetY;
+    sprite_track_extent(sprite);
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_component_set_visible(SpriteComponent* sprite, bool visible) {
+    if (!sprite) return;
+
+    sprite->visible = visible;
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_component_set_layer(SpriteComponent* sprite, uint8_t layer) {
+    if (!sprite) return;
+
+    sprite->layer = layer;
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_component_set_z(SpriteComponent* sprite, uint8_t z) {
+    if (!sprite) return;
+
+    sprite->z = z;
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_component_set_draw_mode(SpriteComponent* sprite, BlitMode mode) {
+    if (!sprite || mode >= BLIT_MODE_COUNT) return;
+
+    sprite->drawMode = (uint8_t)mode;
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_component_mark_dirty(SpriteComponent* sprite) {
+    if (sprite) sprite_mark_dirty(sprite);
+}
+
+uint32_t sprite_component_get_max_extent(void) {
+    return (uint32_t)g_maxSpriteExtent;
+}
+
+bool sprite_component_is_sprite(const Component* component) {
+    return component && component->vtable == &spriteVTable;
+}
+
+void sprite_component_get_screen_position(const SpriteComponent* sprite, int32_t* x, int32_t* y) {
+    float worldX = 0.0f, worldY = 0.0f;
+    if (sprite && sprite->base.gameObject && sprite->base.gameObject->transform) {
+        transform_component_get_position(sprite->base.gameObject->transform, &worldX, &worldY);
+    }
+
+    int32_t offsetX = sprite ? sprite->offsetX : 0;
+    int32_t offsetY = sprite ? sprite->offsetY : 0;
+    if (x) *x = (int32_t)lrintf(worldX) + offsetX;
+    if (y) *y = (int32_t)lrintf(worldY) + offsetY;
+}
+
+// Registration function
+ComponentResult sprite_component_register(void) {
+    return sprite_component_register_with_capacity(DEFAULT_COMPONENT_POOL_SIZE);
+}
+
+ComponentResult sprite_component_register_with_capacity(uint32_t poolCapacity) {
+    if (component_registry_is_type_registered(COMPONENT_TYPE_SPRITE)) {
+        return COMPONENT_OK; // Already registered
+    }
+
+    return component_registry_register_type(
+        COMPONENT_TYPE_SPRITE,
+        sizeof(SpriteComponent),
+        poolCapacity,
+        &spriteVTable,
+        "Sprite"
+    );
+}
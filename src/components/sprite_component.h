@@ -0,0 +1,46 @@
+#ifndef SPRITE_COMPONENT_H
+#define SPRITE_COMPONENT_H
+
+#include "../core/component.h"
+#include "../graphics/framebuffer.h"
+
+// Sprite component structure (64 bytes)
+typedef struct SpriteComponent {
+    Component base;                // 48 bytes - base component
+    const Bitmap* bitmap;          // 8 bytes - image, not owned (NULL draws nothing)
+    int16_t offsetX, offsetY;      // 4 bytes - top-left corner relative to the transform position
+    uint8_t layer;                 // 1 byte - draw layer, higher draws on top
+    uint8_t z;                     // 1 byte - order within the layer, higher draws on top
+    uint8_t drawMode;              // 1 byte - BlitMode
+    bool visible;                  // 1 byte - hidden sprites are skipped
+} SpriteComponent;
+
+// Sprite component interface
+ComponentResult sprite_component_register(void);
+ComponentResult sprite_component_register_with_capacity(uint32_t poolCapacity);
+SpriteComponent* sprite_component_create(GameObject* gameObject);
+void sprite_component_destroy(SpriteComponent* sprite);
+
+// Appearance
+void sprite_component_set_bitmap(SpriteComponent* sprite, const Bitmap* bitmap);  // Centers the sprite
+void sprite_component_set_offset(SpriteComponent* sprite, int16_t offsetX, int16_t offsetY);
+void sprite_component_set_visible(SpriteComponent* sprite, bool visible);
+void sprite_component_set_layer(SpriteComponent* sprite, uint8_t layer);
+void sprite_component_set_z(SpriteComponent* sprite, uint8_t z);
+void sprite_component_set_draw_mode(SpriteComponent* sprite, BlitMode mode);
+
+// The setters above flag the sprite for the dirty-region pass; call this
+// after drawing into the sprite's bitmap directly
+void sprite_component_mark_dirty(SpriteComponent* sprite);
+
+// True if the component uses the SpriteComponent layout (SPRITE may be registered with another)
+bool sprite_component_is_sprite(const Component* component);
+
+// Largest distance from a sprite's position to its bitmap edge, over every
+// sprite configured with set_bitmap/set_offset; bounds culling queries
+uint32_t sprite_component_get_max_extent(void);
+
+// Screen-space top-left corner (transform position rounded, plus offset)
+void sprite_component_get_screen_position(const SpriteComponent* sprite, int32_t* x, int32_t* y);
+
+#endif // SPRITE_COMPONENT_H
@@ -0,0 +1,497 @@
+#include "tilemap_component.h"
+#include "transform_component.h"
+#include "../core/component_registry.h"
+#include "../core/game_object.h"
+#include "../core/memory_budget.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Forward declarations for vtable functions
+static void tilemap_init(Component* component, GameObject* gameObject);
+static void tilemap_destroy(Component* component);
+static void tilemap_render(Component* component);
+
+// Tilemap component vtable
+static const ComponentVTable tilemapVTable = {
+    .init = tilemap_init,
+    .destroy = tilemap_destroy,
+    .clone = NULL,
+    .update = NULL,
+    .fixedUpdate = NULL,
+    .render = tilemap_render,
+    .onEnabled = NULL,
+    .onDisabled = NULL,
+    .onGameObjectDestroyed = NULL,
+    .getSerializedSize = NULL,
+    .serialize = NULL,
+    .deserialize = NULL
+};
+
+static inline int32_t floor_div(int32_t value, int32_t divisor) {
+    return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+static inline bool tile_is_solid(const TilemapComponent* tilemap, uint8_t tile) {
+    return (tilemap->solid[tile >> 6] >> (tile & 63)) & 1;
+}
+
+static inline uint32_t tile_index(const TilemapComponent* tilemap, uint32_t column, uint32_t row) {
+    uint32_t chunk = (row / TILEMAP_CHUNK_SIZE) * tilemap->chunkColumns + column / TILEMAP_CHUNK_SIZE;
+    return chunk * TILEMAP_CHUNK_TILES + (row % TILEMAP_CHUNK_SIZE) * TILEMAP_CHUNK_SIZE + column % TILEMAP_CHUNK_SIZE;
+}
+
+static inline bool tile_in_map(const TilemapComponent* tilemap, int32_t column, int32_t row) {
+    return tilemap->tiles && column >= 0 && row >= 0 &&
+           (uint32_t)column < tilemap->columns && (uint32_t)row < tilemap->rows;
+}
+
+// Top-left corner of the map, rounded like sprite positions
+static void tilemap_origin(const TilemapComponent* tilemap, int32_t* x, int32_t* y) {
+    float worldX = 0.0f, worldY = 0.0f;
+    if (tilemap->base.gameObject && tilemap->base.gameObject->transform) {
+        transform_component_get_position(tilemap->base.gameObject->transform, &worldX, &worldY);
+    }
+    *x = (int32_t)lrintf(worldX);
+    *y = (int32_t)lrintf(worldY);
+}
+
+static void tilemap_free_storage(TilemapComponent* tilemap) {
+    if (tilemap->tiles) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, tilemap->storageBytes);
+        free(tilemap->tiles);
+    }
+    tilemap->tiles = NULL;
+    tilemap->chunkFilled = NULL;
+    tilemap->chunkSolid = NULL;
+    tilemap->storageBytes = 0;
+}
+
+static void tilemap_free_tileset(TilemapComponent* tilemap) {
+    if (tilemap->tileRows) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, tilemap->tilesetBytes);
+        free(tilemap->tileRows);
+    }
+    tilemap->tileRows = NULL;
+    tilemap->tileCount = 0;
+    tilemap->tilesetBytes = 0;
+}
+
+// VTable implementations
+static void tilemap_init(Component* component, GameObject* gameObject) {
+    (void)gameObject;
+
+    if (!component) return;
+
+    TilemapComponent* tilemap = (TilemapComponent*)component;
+    tilemap->tiles = NULL;
+    tilemap->chunkFilled = NULL;
+    tilemap->chunkSolid = NULL;
+    tilemap->tileRows = NULL;
+    tilemap->columns = tilemap->rows = 0;
+    tilemap->chunkColumns = tilemap->chunkRows = 0;
+    tilemap->tileCount = 0;
+    tilemap->storageBytes = 0;
+    tilemap->tilesetBytes = 0;
+    memset(tilemap->solid, 0, sizeof(tilemap->solid));
+    tilemap->tileSize = 0;
+    tilemap->drawMode = BLIT_MODE_COPY;
+    tilemap->visible = true;
+}
+
+static void tilemap_destroy(Component* component) {
+    if (!component) return;
+
+    // Base component cleanup is handled by component_registry_destroy()
+    TilemapComponent* tilemap = (TilemapComponent*)component;
+    tilemap_free_storage(tilemap);
+    tilemap_free_tileset(tilemap);
+    tilemap->visible = false;
+}
+
+// Draws into the current render target in screen space
+static void tilemap_render(Component* component) {
+    tilemap_component_render((TilemapComponent*)component, framebuffer_get_render_target(), NULL);
+}
+
+// Public API implementations
+TilemapComponent* tilemap_component_create(GameObject* gameObject) {
+    if (!gameObject) return NULL;
+
+    if (tilemap_component_register() != COMPONENT_OK) {
+        return NULL;
+    }
+
+    const ComponentTypeInfo* info = component_registry_get_type_info(COMPONENT_TYPE_TILEMAP);
+    if (!info || info->defaultVTable != &tilemapVTable) {
+        return NULL;
+    }
+
+    Component* component = component_registry_create(COMPONENT_TYPE_TILEMAP, gameObject);
+    return (TilemapComponent*)component;
+}
+
+void tilemap_component_destroy(TilemapComponent* tilemap) {
+    if (!tilemap) return;
+
+    component_registry_destroy((Component*)tilemap);
+}
+
+bool tilemap_component_is_tilemap(const Component* component) {
+    return component && component->vtable == &tilemapVTable;
+}
+
+TilemapResult tilemap_component_set_size(TilemapComponent* tilemap, uint32_t columns, uint32_t rows, uint32_t tileSize) {
+    if (!tilemap) {
+        return TILEMAP_ERROR_NULL_POINTER;
+    }
+    if (columns == 0 || rows == 0 || (tileSize != 8 && tileSize != 16 && tileSize != 32) ||
+        columns > INT32_MAX / tileSize || rows > INT32_MAX / tileSize) {
+        return TILEMAP_ERROR_INVALID_SIZE;
+    }
+
+    uint32_t chunkColumns = (columns + TILEMAP_CHUNK_SIZE - 1) / TILEMAP_CHUNK_SIZE;
+    uint32_t chunkRows = (rows + TILEMAP_CHUNK_SIZE - 1) / TILEMAP_CHUNK_SIZE;
+    uint64_t chunks = (uint64_t)chunkColumns * chunkRows;
+    uint64_t bytes = chunks * (TILEMAP_CHUNK_TILES + 2 * sizeof(uint16_t));
+    if (bytes > UINT32_MAX) {
+        return TILEMAP_ERROR_INVALID_SIZE;
+    }
+
+    tilemap_free_storage(tilemap);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return TILEMAP_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* storage = calloc(1, (size_t)bytes);
+    if (!storage) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes);
+        return TILEMAP_ERROR_OUT_OF_MEMORY;
+    }
+
+    // Chunk counts follow the tiles; every chunk is a multiple of 2 bytes
+    tilemap->tiles = storage;
+    tilemap->chunkFilled = (uint16_t*)(storage + chunks * TILEMAP_CHUNK_TILES);
+    tilemap->chunkSolid = tilemap->chunkFilled + chunks;
+    tilemap->columns = columns;
+    tilemap->rows = rows;
+    tilemap->chunkColumns = chunkColumns;
+    tilemap->chunkRows = chunkRows;
+    tilemap->storageBytes = (uint32_t)bytes;
+
+    // Packed tileset rows depend on the tile size
+    if (tilemap->tileSize != tileSize) {
+        tilemap_free_tileset(tilemap);
+    }
+    tilemap->tileSize = (uint8_t)tileSize;
+    return TILEMAP_OK;
+}
+
+TilemapResult tilemap_component_set_tileset(TilemapComponent* tilemap, const Bitmap* const* tiles, uint32_t count) {
+    if (!tilemap || (!tiles && count > 0)) {
+        return TILEMAP_ERROR_NULL_POINTER;
+    }
+    uint32_t tileSize = tilemap->tileSize;
+    if (tileSize == 0 || count > TILEMAP_MAX_TILE_IDS) {
+        return TILEMAP_ERROR_INVALID_SIZE;
+    }
+    for (uint32_t id = 1; id < count; id++) {
+        if (tiles[id] && (tiles[id]->width < tileSize || tiles[id]->height < tileSize)) {
+            return TILEMAP_ERROR_INVALID_SIZE;
+        }
+    }
+
+    tilemap_free_tileset(tilemap);
+    if (count == 0) {
+        return TILEMAP_OK;
+    }
+
+    uint32_t bytes = count * tileSize * 2 * (uint32_t)sizeof(uint32_t);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, bytes) != MEMORY_BUDGET_OK) {
+        return TILEMAP_ERROR_BUDGET_EXCEEDED;
+    }
+    uint32_t* rows = calloc(1, bytes);
+    if (!rows) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, bytes);
+        return TILEMAP_ERROR_OUT_OF_MEMORY;
+    }
+
+    // Id 0 and missing bitmaps stay all transparent
+    uint64_t keep = (UINT64_C(1) << tileSize) - 1;
+    for (uint32_t id = 1; id < count; id++) {
+        if (!tiles[id]) continue;
+        for (uint32_t y = 0; y < tileSize; y++) {
+            uint64_t mask = bitmap_row_mask(tiles[id], y)[0] & keep;
+            rows[(id * tileSize + y) * 2] = (uint32_t)(bitmap_row_pixels(tiles[id], y)[0] & mask);
+            rows[(id * tileSize + y) * 2 + 1] = (uint32_t)mask;
+        }
+    }
+    tilemap->tileRows = rows;
+    tilemap->tileCount = count;
+    tilemap->tilesetBytes = bytes;
+    return TILEMAP_OK;
+}
+
+void tilemap_component_set_tile(TilemapComponent* tilemap, int32_t column, int32_t row, uint8_t tile) {
+    if (!tilemap || !tile_in_map(tilemap, column, row)) return;
+
+    uint32_t index = tile_index(tilemap, (uint32_t)column, (uint32_t)row);
+    uint32_t chunk = index / TILEMAP_CHUNK_TILES;
+    uint8_t old = tilemap->tiles[index];
+    tilemap->chunkFilled[chunk] += (uint16_t)((tile != TILEMAP_EMPTY_TILE) - (old != TILEMAP_EMPTY_TILE));
+    tilemap->chunkSolid[chunk] += (uint16_t)(tile_is_solid(tilemap, tile) - tile_is_solid(tilemap, old));
+    tilemap->tiles[index] = tile;
+}
+
+uint8_t tilemap_component_get_tile(const TilemapComponent* tilemap, int32_t column, int32_t row) {
+    if (!tilemap || !tile_in_map(tilemap, column, row)) return TILEMAP_EMPTY_TILE;
+
+    return tilemap->tiles[tile_index(tilemap, (uint32_t)column, (uint32_t)row)];
+}
+
+void tilemap_component_set_solid(TilemapComponent* tilemap, uint8_t tile, bool solid) {
+    if (!tilemap || tile == TILEMAP_EMPTY_TILE || tile_is_solid(tilemap, tile) == solid) return;
+
+    tilemap->solid[tile >> 6] ^= UINT64_C(1) << (tile & 63);
+
+    // Flags change at load time; recount the chunks that hold this id
+    uint32_t chunks = tilemap->chunkColumns * tilemap->chunkRows;
+    for (uint32_t chunk = 0; chunk < chunks; chunk++) {
+        if (tilemap->chunkFilled[chunk] == 0) continue;
+
+        const uint8_t* tiles = tilemap->tiles + (size_t)chunk * TILEMAP_CHUNK_TILES;
+        uint32_t matches = 0;
+        for (uint32_t i = 0; i < TILEMAP_CHUNK_TILES; i++) {
+            matches += tiles[i] == tile;
+        }
+        tilemap->chunkSolid[chunk] = (uint16_t)(solid ? tilemap->chunkSolid[chunk] + matches
+                                                      : tilemap->chunkSolid[chunk] - matches);
+    }
+}
+
+bool tilemap_component_is_solid(const TilemapComponent* tilemap, int32_t column, int32_t row) {
+    return tilemap && tile_is_solid(tilemap, tilemap_component_get_tile(tilemap, column, row));
+}
+
+void tilemap_component_set_visible(TilemapComponent* tilemap, bool visible) {
+    if (!tilemap) return;
+
+    tilemap->visible = visible;
+}
+
+void tilemap_component_set_draw_mode(TilemapComponent* tilemap, BlitMode mode) {
+    if (!tilemap || mode >= BLIT_MODE_COUNT) return;
+
+    tilemap->drawMode = (uint8_t)mode;
+}
+
+// Collision queries
+
+bool tilemap_component_world_to_tile(const TilemapComponent* tilemap, float x, float y, int32_t* column, int32_t* row) {
+    if (!tilemap || tilemap->tileSize == 0) return false;
+
+    int32_t originX, originY;
+    tilemap_origin(tilemap, &originX, &originY);
+    int32_t tileColumn = (int32_t)floorf((x - (float)originX) / (float)tilemap->tileSize);
+    int32_t tileRow = (int32_t)floorf((y - (float)originY) / (float)tilemap->tileSize);
+    if (column) *column = tileColumn;
+    if (row) *row = tileRow;
+    return tile_in_map(tilemap, tileColumn, tileRow);
+}
+
+bool tilemap_component_solid_at(const TilemapComponent* tilemap, float x, float y) {
+    int32_t column, row;
+    return tilemap_component_world_to_tile(tilemap, x, y, &column, &row) &&
+           tilemap_component_is_solid(tilemap, column, row);
+}
+
+// Visits the chunks the rectangle overlaps, skipping those without solid
+// tiles, and counts (and records) the solid tiles inside it. With
+// stopAtFirst it returns as soon as one is found.
+static uint32_t tilemap_scan_rect(const TilemapComponent* tilemap, float x, float y, float width, float height,
+                                  TilemapTileHit* hits, uint32_t maxHits, bool stopAtFirst) {
+    if (!tilemap || !tilemap->tiles || !(width > 0.0f) || !(height > 0.0f)) return 0;
+
+    int32_t originX, originY;
+    tilemap_origin(tilemap, &originX, &originY);
+    float tileSize = (float)tilemap->tileSize;
+    float left = floorf((x - (float)originX) / tileSize);
+    float top = floorf((y - (float)originY) / tileSize);
+    float right = ceilf((x + width - (float)originX) / tileSize) - 1.0f;
+    float bottom = ceilf((y + height - (float)originY) / tileSize) - 1.0f;
+    if (right < 0.0f || bottom < 0.0f || left >= (float)tilemap->columns || top >= (float)tilemap->rows) return 0;
+
+    uint32_t column0 = left > 0.0f ? (uint32_t)left : 0;
+    uint32_t row0 = top > 0.0f ? (uint32_t)top : 0;
+    uint32_t column1 = right < (float)(tilemap->columns - 1) ? (uint32_t)right : tilemap->columns - 1;
+    uint32_t row1 = bottom < (float)(tilemap->rows - 1) ? (uint32_t)bottom : tilemap->rows - 1;
+
+    uint32_t found = 0;
+    for (uint32_t chunkRow = row0 / TILEMAP_CHUNK_SIZE; chunkRow <= row1 / TILEMAP_CHUNK_SIZE; chunkRow++) {
+        for (uint32_t chunkColumn = column0 / TILEMAP_CHUNK_SIZE; chunkColumn <= column1 / TILEMAP_CHUNK_SIZE; chunkColumn++) {
+            uint32_t chunk = chunkRow * tilemap->chunkColumns + chunkColumn;
+            if (tilemap->chunkSolid[chunk] == 0) continue;
+
+            const uint8_t* tiles = tilemap->tiles + (size_t)chunk * TILEMAP_CHUNK_TILES;
+            uint32_t baseColumn = chunkColumn * TILEMAP_CHUNK_SIZE, baseRow = chunkRow * TILEMAP_CHUNK_SIZE;
+            uint32_t rowStart = row0 > baseRow ? row0 - baseRow : 0;
+            uint32_t rowEnd = row1 - baseRow < TILEMAP_CHUNK_SIZE ? row1 - baseRow + 1 : TILEMAP_CHUNK_SIZE;
+            uint32_t columnStart = column0 > baseColumn ? column0 - baseColumn : 0;
+            uint32_t columnEnd = column1 - baseColumn < TILEMAP_CHUNK_SIZE ? column1 - baseColumn + 1 : TILEMAP_CHUNK_SIZE;
+
+            for (uint32_t r = rowStart; r < rowEnd; r++) {
+                const uint8_t* tileRow = tiles + r * TILEMAP_CHUNK_SIZE;
+                for (uint32_t c = columnStart; c < columnEnd; c++) {
+                    if (!tile_is_solid(tilemap, tileRow[c])) continue;
+
+                    if (stopAtFirst) return 1;
+                    if (hits && found < maxHits) {
+                        hits[found].column = (int32_t)(baseColumn + c);
+                        hits[found].row = (int32_t)(baseRow + r);
+                        hits[found].tile = tileRow[c];
+                    }
+                    found++;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+bool tilemap_component_overlaps_solid(const TilemapComponent* tilemap, float x, float y, float width, float height) {
+    return tilemap_scan_rect(tilemap, x, y, width, height, NULL, 0, true) > 0;
+}
+
+uint32_t tilemap_component_query_rect(const TilemapComponent* tilemap, float x, float y, float width, float height,
+                                      TilemapTileHit* hits, uint32_t maxHits) {
+    return tilemap_scan_rect(tilemap, x, y, width, height, hits, maxHits, false);
+}
+
+// Rendering
+
+// Framebuffer words drawn per strip; the tile lookups for a strip's map
+// words are made once per tile row and reused for each of its pixel rows
+#define TILEMAP_STRIP_WORDS 8
+#define TILEMAP_MAX_TILES_PER_WORD (BITMAP_WORD_BITS / 8)
+
+// Offsets into tileRows of the tiles making up map words firstWord ..
+// firstWord + count - 1 on one tile row; empty and unknown tiles point at
+// tile 0's transparent rows. Returns false if every one of them is empty.
+static bool tilemap_gather_row(const TilemapComponent* tilemap, uint32_t tileRow, int32_t firstWord, uint32_t count,
+                               uint32_t* offsets) {
+    uint32_t tileSize = tilemap->tileSize;
+    uint32_t tilesPerWord = BITMAP_WORD_BITS / tileSize;
+    int32_t mapWords = (int32_t)(((uint64_t)tilemap->columns * tileSize + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS);
+    uint32_t chunkRow = tileRow / TILEMAP_CHUNK_SIZE;
+    const uint8_t* tiles = tilemap->tiles + (size_t)chunkRow * tilemap->chunkColumns * TILEMAP_CHUNK_TILES +
+                           (tileRow % TILEMAP_CHUNK_SIZE) * TILEMAP_CHUNK_SIZE;
+    const uint16_t* chunkFilled = tilemap->chunkFilled + chunkRow * tilemap->chunkColumns;
+
+    bool any = false;
+    memset(offsets, 0, count * tilesPerWord * sizeof(uint32_t));
+    for (uint32_t w = 0; w < count; w++) {
+        int32_t m = firstWord + (int32_t)w;
+        if (m < 0 || m >= mapWords) continue;
+
+        // tilesPerWord divides the chunk size, so a word's tiles share a
+        // chunk; past the last column the chunk's padding ids are 0
+        uint32_t column = (uint32_t)m * tilesPerWord;
+        uint32_t chunk = column / TILEMAP_CHUNK_SIZE;
+        if (chunkFilled[chunk] == 0) continue;
+
+        const uint8_t* ids = tiles + (size_t)chunk * TILEMAP_CHUNK_TILES + column % TILEMAP_CHUNK_SIZE;
+        for (uint32_t i = 0; i < tilesPerWord; i++) {
+            uint32_t id = ids[i] < tilemap->tileCount ? ids[i] : TILEMAP_EMPTY_TILE;
+            offsets[w * tilesPerWord + i] = id * tileSize * 2;
+            any |= id != TILEMAP_EMPTY_TILE;
+        }
+    }
+    return any;
+}
+
+// One map word of a pixel row from its tiles' rows
+static inline void tilemap_compose_word(const uint32_t* rows, const uint32_t* offsets, uint32_t tilesPerWord,
+                                        uint32_t tileSize, uint64_t* pixels, uint64_t* mask) {
+    uint64_t wordPixels = 0, wordMask = 0;
+    for (uint32_t i = 0; i < tilesPerWord; i++) {
+        const uint32_t* row = rows + offsets[i];
+        wordPixels |= (uint64_t)row[0] << (i * tileSize);
+        wordMask |= (uint64_t)row[1] << (i * tileSize);
+    }
+    *pixels = wordPixels;
+    *mask = wordMask;
+}
+
+void tilemap_component_render(const TilemapComponent* tilemap, Framebuffer* target, const RenderCamera* camera) {
+    if (!tilemap || !target || !tilemap->visible || !tilemap->tiles || !tilemap->tileRows) return;
+
+    int32_t originX, originY;
+    tilemap_origin(tilemap, &originX, &originY);
+    int32_t mapX = (camera ? (int32_t)lrintf(camera->x) : 0) - originX;    // Map pixel at framebuffer (0, 0)
+    int32_t mapY = (camera ? (int32_t)lrintf(camera->y) : 0) - originY;
+
+    int32_t tileSize = tilemap->tileSize;
+    int32_t mapHeight = (int32_t)tilemap->rows * tileSize;
+    int32_t y0 = mapY < 0 ? -mapY : 0;
+    int32_t y1 = mapHeight - mapY < (int32_t)target->height ? mapHeight - mapY : (int32_t)target->height;
+    if (y0 >= y1 || mapX >= (int32_t)tilemap->columns * tileSize || mapX + (int32_t)target->width <= 0) return;
+
+    // Framebuffer word j takes map words firstWord + j and + j + 1, shifted
+    int32_t firstWord = floor_div(mapX, BITMAP_WORD_BITS);
+    uint32_t shift = (uint32_t)(mapX - firstWord * BITMAP_WORD_BITS);
+    uint64_t invert = tilemap->drawMode == BLIT_MODE_INVERTED ? ~UINT64_C(0) : 0;
+    uint32_t tilesPerWord = BITMAP_WORD_BITS / (uint32_t)tileSize;
+    uint32_t offsets[(TILEMAP_STRIP_WORDS + 1) * TILEMAP_MAX_TILES_PER_WORD];
+
+    for (uint32_t strip = 0; strip < target->wordsPerRow; strip += TILEMAP_STRIP_WORDS) {
+        uint32_t stripWords = target->wordsPerRow - strip < TILEMAP_STRIP_WORDS ? target->wordsPerRow - strip
+                                                                                : TILEMAP_STRIP_WORDS;
+        bool lastStrip = strip + stripWords == target->wordsPerRow;
+
+        for (int32_t y = y0; y < y1;) {
+            // The pixel rows of this tile row inside [y0, y1)
+            uint32_t tileRow = (uint32_t)(y + mapY) / (uint32_t)tileSize;
+            int32_t rowEnd = (int32_t)((tileRow + 1) * (uint32_t)tileSize) - mapY;
+            rowEnd = rowEnd < y1 ? rowEnd : y1;
+            if (!tilemap_gather_row(tilemap, tileRow, firstWord + (int32_t)strip, stripWords + 1, offsets)) {
+                y = rowEnd;
+                continue;
+            }
+
+            for (; y < rowEnd; y++) {
+                const uint32_t* rows = tilemap->tileRows + ((uint32_t)(y + mapY) % (uint32_t)tileSize) * 2;
+                uint64_t* dst = target->words + (size_t)y * target->stride + strip;
+                uint64_t pixels, mask, nextPixels, nextMask;
+                tilemap_compose_word(rows, offsets, tilesPerWord, (uint32_t)tileSize, &pixels, &mask);
+                for (uint32_t j = 0; j < stripWords; j++) {
+                    tilemap_compose_word(rows, offsets + (j + 1) * tilesPerWord, tilesPerWord, (uint32_t)tileSize,
+                                         &nextPixels, &nextMask);
+                    uint64_t srcPixels = shift ? (pixels >> shift) | (nextPixels << (BITMAP_WORD_BITS - shift)) : pixels;
+                    uint64_t srcMask = shift ? (mask >> shift) | (nextMask << (BITMAP_WORD_BITS - shift)) : mask;
+                    if (lastStrip && j == stripWords - 1) srcMask &= target->lastWordMask;
+                    dst[j] = (dst[j] & ~srcMask) | ((srcPixels ^ invert) & srcMask);
+                    pixels = nextPixels;
+                    mask = nextMask;
+                }
+            }
+        }
+    }
+}
+
+// Registration function
+ComponentResult tilemap_component_register(void) {
+    return tilemap_component_register_with_capacity(TILEMAP_DEFAULT_POOL_SIZE);
+}
+
+ComponentResult tilemap_component_register_with_capacity(uint32_t poolCapacity) {
+    if (component_registry_is_type_registered(COMPONENT_TYPE_TILEMAP)) {
+        return COMPONENT_OK; // Already registered
+    }
+
+    return component_registry_register_type(
+        COMPONENT_TYPE_TILEMAP,
+        sizeof(TilemapComponent),
+        poolCapacity,
+        &tilemapVTable,
+        "Tilemap"
+    );
+}
@@ -0,0 +1,102 @@
+#ifndef TILEMAP_COMPONENT_H
+#define TILEMAP_COMPONENT_H
+
+#include "../core/component.h"
+#include "../graphics/framebuffer.h"
+#include "../graphics/render_queue.h"
+
+// A whole tile layer in one component: one byte per tile instead of a
+// GameObject and transform per tile. Tile ids are stored in chunks of
+// 16x16 tiles, each chunk's 256 ids contiguous row by row, with per-chunk
+// counts of non-empty and solid tiles so drawing and collision queries skip
+// empty chunks. The map's top-left corner is the owning transform position.
+//
+// Tile 0 is empty. Other ids index the tileset; each tile bitmap's
+// top-left tileSize x tileSize pixels are copied into packed rows when the
+// tileset is set, so call tilemap_component_set_tileset() again after
+// drawing into a tile bitmap.
+//
+// Rendering composes each framebuffer row from whole 64-bit words of tile
+// rows (tileSize divides 64, so tiles never straddle a word) and merges the
+// row into the framebuffer in one shifted, masked pass. Output matches
+// blitting every tile bitmap separately.
+
+#define TILEMAP_CHUNK_SIZE 16                                   // Tiles per chunk side
+#define TILEMAP_CHUNK_TILES (TILEMAP_CHUNK_SIZE * TILEMAP_CHUNK_SIZE)
+#define TILEMAP_EMPTY_TILE 0
+#define TILEMAP_MAX_TILE_IDS 256
+#define TILEMAP_DEFAULT_POOL_SIZE 16                            // Tilemaps are few; levels are big
+
+// Tilemap results
+typedef enum {
+    TILEMAP_OK = 0,
+    TILEMAP_ERROR_NULL_POINTER,
+    TILEMAP_ERROR_INVALID_SIZE,
+    TILEMAP_ERROR_OUT_OF_MEMORY,
+    TILEMAP_ERROR_BUDGET_EXCEEDED
+} TilemapResult;
+
+// One solid tile found by a query
+typedef struct TilemapTileHit {
+    int32_t column;
+    int32_t row;
+    uint8_t tile;
+} TilemapTileHit;
+
+// Tilemap component structure
+typedef struct TilemapComponent {
+    Component base;                // 48 bytes - base component
+    uint8_t* tiles;                // Chunk-major tile ids, TILEMAP_CHUNK_TILES per chunk
+    uint16_t* chunkFilled;         // Non-empty tiles per chunk
+    uint16_t* chunkSolid;          // Solid tiles per chunk
+    uint32_t* tileRows;            // Tileset rows: pixels, mask pairs for (tile * tileSize + row)
+    uint32_t columns, rows;        // Map size in tiles
+    uint32_t chunkColumns, chunkRows;
+    uint32_t tileCount;            // Tileset ids, 0 .. tileCount - 1
+    uint32_t storageBytes;         // Tiles and chunk counts, charged to the scene budget
+    uint32_t tilesetBytes;         // Packed tileset rows, charged to the scene budget
+    uint64_t solid[TILEMAP_MAX_TILE_IDS / 64];   // Solid flag per tile id
+    uint8_t tileSize;              // 8, 16 or 32 pixels
+    uint8_t drawMode;              // BlitMode
+    bool visible;
+} TilemapComponent;
+
+// Tilemap component interface
+ComponentResult tilemap_component_register(void);
+ComponentResult tilemap_component_register_with_capacity(uint32_t poolCapacity);
+TilemapComponent* tilemap_component_create(GameObject* gameObject);
+void tilemap_component_destroy(TilemapComponent* tilemap);
+bool tilemap_component_is_tilemap(const Component* component);
+
+// Allocates an empty map (every tile 0); calling it again discards the old tiles
+TilemapResult tilemap_component_set_size(TilemapComponent* tilemap, uint32_t columns, uint32_t rows, uint32_t tileSize);
+
+// Copies tile bitmaps 1 .. count - 1 (tiles[0] is ignored, NULL entries draw
+// nothing); each must be at least tileSize pixels square. Set the size first.
+TilemapResult tilemap_component_set_tileset(TilemapComponent* tilemap, const Bitmap* const* tiles, uint32_t count);
+
+// Tiles outside the map read as empty; writes outside it are ignored
+void tilemap_component_set_tile(TilemapComponent* tilemap, int32_t column, int32_t row, uint8_t tile);
+uint8_t tilemap_component_get_tile(const TilemapComponent* tilemap, int32_t column, int32_t row);
+
+// Collision flags are per tile id
+void tilemap_component_set_solid(TilemapComponent* tilemap, uint8_t tile, bool solid);
+bool tilemap_component_is_solid(const TilemapComponent* tilemap, int32_t column, int32_t row);
+
+// Appearance
+void tilemap_component_set_visible(TilemapComponent* tilemap, bool visible);
+void tilemap_component_set_draw_mode(TilemapComponent* tilemap, BlitMode mode);
+
+// World-space collision against the tile grid. The rectangle covers
+// [x, x + width) by [y, y + height). Returns the number of solid tiles it
+// overlaps; the first maxHits are stored in hits (which may be NULL).
+bool tilemap_component_world_to_tile(const TilemapComponent* tilemap, float x, float y, int32_t* column, int32_t* row);
+bool tilemap_component_solid_at(const TilemapComponent* tilemap, float x, float y);
+bool tilemap_component_overlaps_solid(const TilemapComponent* tilemap, float x, float y, float width, float height);
+uint32_t tilemap_component_query_rect(const TilemapComponent* tilemap, float x, float y, float width, float height,
+                                      TilemapTileHit* hits, uint32_t maxHits);
+
+// Draws the visible part of the map; camera NULL draws in screen space
+void tilemap_component_render(const TilemapComponent* tilemap, Framebuffer* target, const RenderCamera* camera);
+
+#endif // TILEMAP_COMPONENT_H
@@ -59,6 +59,7 @@ static void transform_init(Component* component, GameObject* gameObject) {
     transform->scaleX = 1.0f;
     transform->scaleY = 1.0f;
     transform->matrixDirty = true;
+    transform->renderDirty = true;
     
     // Initialize matrix to identity
     memset(transform->matrix, 0, sizeof(transform->matrix));
@@ -80,6 +81,7 @@ static void transform_destroy(Component* component) {
     transform->scaleX = 1.0f;
     transform->scaleY = 1.0f;
     transform->matrixDirty = false;
+    transform->renderDirty = false;
     memset(transform->matrix, 0, sizeof(transform->matrix));
     
     // Base component cleanup is handled by component_registry_destroy()
@@ -126,6 +128,7 @@ void transform_component_set_position(TransformComponent* transform, float x, fl
     transform->x = x;
     transform->y = y;
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 void transform_component_get_position(const TransformComponent* transform, float* x, float* y) {
@@ -145,6 +148,7 @@ void transform_component_translate(TransformComponent* transform, float dx, floa
     transform->x += dx;
     transform->y += dy;
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 void transform_component_set_rotation(TransformComponent* transform, float rotation) {
@@ -152,6 +156,7 @@ void transform_component_set_rotation(TransformComponent* transform, float rotat
     
     transform->rotation = rotation;
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 float transform_component_get_rotation(const TransformComponent* transform) {
@@ -163,6 +168,7 @@ void transform_component_rotate(TransformComponent* transform, float deltaRotati
     
     transform->rotation += deltaRotation;
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 void transform_component_set_scale(TransformComponent* transform, float scaleX, float scaleY) {
@@ -171,6 +177,7 @@ void transform_component_set_scale(TransformComponent* transform, float scaleX,
     transform->scaleX = scaleX;
     transform->scaleY = scaleY;
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 void transform_component_get_scale(const TransformComponent* transform, float* scaleX, float* scaleY) {
@@ -205,6 +212,7 @@ void transform_component_mark_dirty(TransformComponent* transform) {
     if (!transform) return;
     
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 void transform_component_look_at(TransformComponent* transform, float targetX, float targetY) {
@@ -215,6 +223,7 @@ void transform_component_look_at(TransformComponent* transform, float targetX, f
     
     transform->rotation = atan2f(dy, dx);
     transform->matrixDirty = true;
+    transform->renderDirty = true;
 }
 
 void transform_component_transform_point(const TransformComponent* transform, 
@@ -235,6 +244,10 @@ void transform_component_transform_point(const TransformComponent* transform,
 
 // Registration function
 ComponentResult transform_component_register(void) {
+    return transform_component_register_with_capacity(DEFAULT_COMPONENT_POOL_SIZE);
+}
+
+ComponentResult transform_component_register_with_capacity(uint32_t poolCapacity) {
     if (component_registry_is_type_registered(COMPONENT_TYPE_TRANSFORM)) {
         return COMPONENT_OK; // Already registered
     }
@@ -242,7 +255,7 @@ ComponentResult transform_component_register(void) {
     return component_registry_register_type(
         COMPONENT_TYPE_TRANSFORM,
         sizeof(TransformComponent),
-        DEFAULT_COMPONENT_POOL_SIZE,
+        poolCapacity,
         &transformVTable,
         "Transform"
     );
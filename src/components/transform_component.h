@@ -11,11 +11,13 @@ typedef struct TransformComponent {
     float scaleX, scaleY;         // 8 bytes - scale factors
     float matrix[6];              // 24 bytes - cached 2D transformation matrix [a,b,c,d,tx,ty]
     bool matrixDirty;            // 1 byte - needs matrix recalculation
-    uint8_t padding[7];          // 7 bytes - alignment padding to reach 64 bytes
+    bool renderDirty;            // 1 byte - moved since the last dirty-region pass
+    uint8_t padding[6];          // 6 bytes - alignment padding to reach 64 bytes
 } TransformComponent;
 
 // Transform component interface
 ComponentResult transform_component_register(void);
+ComponentResult transform_component_register_with_capacity(uint32_t poolCapacity);
 TransformComponent* transform_component_create(GameObject* gameObject);
 void transform_component_destroy(TransformComponent* transform);
 
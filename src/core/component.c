@@ -61,6 +61,8 @@ const char* component_type_to_string(ComponentType type) {
         case COMPONENT_TYPE_ANIMATION: return "Animation";
         case COMPONENT_TYPE_PARTICLES: return "Particles";
         case COMPONENT_TYPE_UI: return "UI";
+        case COMPONENT_TYPE_TILEMAP: return "Tilemap";
+        case COMPONENT_TYPE_RIGIDBODY: return "RigidBody";
         default: return "Unknown";
     }
 }
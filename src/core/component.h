@@ -19,7 +19,9 @@ typedef enum {
     COMPONENT_TYPE_ANIMATION = 1 << 5,   // Animation, bit 5
     COMPONENT_TYPE_PARTICLES = 1 << 6,   // Particle systems, bit 6
     COMPONENT_TYPE_UI        = 1 << 7,   // UI elements, bit 7
-    // Reserve bits 8-31 for future component types
+    COMPONENT_TYPE_TILEMAP   = 1 << 8,   // Tile layers, bit 8
+    COMPONENT_TYPE_RIGIDBODY = 1 << 9,   // Moving bodies, bit 9
+    // Reserve bits 10-31 for future component types
     COMPONENT_TYPE_CUSTOM_BASE = 1 << 16 // Custom components start here
 } ComponentType;
 
@@ -67,7 +69,8 @@ typedef enum {
     COMPONENT_ERROR_ALREADY_EXISTS,
     COMPONENT_ERROR_NOT_FOUND,
     COMPONENT_ERROR_POOL_FULL,
-    COMPONENT_ERROR_VTABLE_NULL
+    COMPONENT_ERROR_VTABLE_NULL,
+    COMPONENT_ERROR_BUDGET_EXCEEDED     // Component memory budget hard limit
 } ComponentResult;
 
 // Core component operations
@@ -1,4 +1,5 @@
 #include "component_registry.h"
+#include "memory_debug.h"
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
@@ -7,6 +8,14 @@
 static ComponentRegistry g_componentRegistry = {0};
 
 ComponentResult component_registry_init(void) {
+    // Pools left over from a registry that was never shut down are abandoned
+    // as before, but must leave the memory_debug pool list before the reset
+    for (uint32_t i = 0; i < MAX_COMPONENT_TYPES; i++) {
+        if (g_componentRegistry.typeInfo[i].registered) {
+            memory_debug_unregister_pool(&g_componentRegistry.typeInfo[i].pool);
+        }
+    }
+    
     memset(&g_componentRegistry, 0, sizeof(ComponentRegistry));
     g_componentRegistry.nextComponentId = 1; // Start from 1 (0 is invalid)
     return COMPONENT_OK;
@@ -70,11 +79,15 @@ ComponentResult component_registry_register_type(ComponentType type,
     uint32_t alignedSize = componentSize < sizeof(Component) ? sizeof(Component) : componentSize;
     alignedSize = ALIGN_SIZE(alignedSize);
     
-    // Initialize object pool
-    char poolName[64];
-    snprintf(poolName, sizeof(poolName), "ComponentPool_%s", typeName);
+    // Initialize object pool (the pool keeps a pointer to its name, so the
+    // name lives in the type info rather than on the stack)
+    snprintf(info->poolName, sizeof(info->poolName), "ComponentPool_%s", typeName);
     
-    PoolResult poolResult = object_pool_init(&info->pool, alignedSize, poolCapacity, poolName);
+    PoolResult poolResult = object_pool_init_for_subsystem(&info->pool, MEMORY_SUBSYSTEM_COMPONENTS,
+                                                           alignedSize, poolCapacity, info->poolName);
+    if (poolResult == POOL_ERROR_BUDGET_EXCEEDED) {
+        return COMPONENT_ERROR_BUDGET_EXCEEDED;
+    }
     if (poolResult != POOL_OK) {
         return COMPONENT_ERROR_POOL_FULL;
     }
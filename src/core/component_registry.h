@@ -6,6 +6,7 @@
 
 #define MAX_COMPONENT_TYPES 32
 #define DEFAULT_COMPONENT_POOL_SIZE 1000
+#define COMPONENT_POOL_NAME_LENGTH 64
 
 // Component type registration info
 typedef struct ComponentTypeInfo {
@@ -13,6 +14,7 @@ typedef struct ComponentTypeInfo {
     uint32_t componentSize;
     uint32_t poolCapacity;
     ObjectPool pool;
+    char poolName[COMPONENT_POOL_NAME_LENGTH];   // Backing storage for pool.debugName
     const ComponentVTable* defaultVTable;
     const char* typeName;
     bool registered;
@@ -0,0 +1,209 @@
+#include "memory_budget.h"
+#include <string.h>
+
+static MemoryBudget g_budgets[MEMORY_SUBSYSTEM_COUNT] = {0};
+
+static inline uint32_t saturating_sub(uint32_t value, uint32_t amount) {
+    return amount < value ? value - amount : 0;
+}
+
+static void update_soft_limit(MemorySubsystem subsystem) {
+    MemoryBudget* budget = &g_budgets[subsystem];
+    if (budget->softLimitBytes == 0) {
+        return;
+    }
+
+    bool over = budget->usedBytes > budget->softLimitBytes;
+    if (over && !budget->overSoftLimit) {
+        // Set first so a callback that allocates does not re-enter
+        budget->overSoftLimit = true;
+        budget->softLimitCrossings++;
+        if (budget->onSoftLimit) {
+            budget->onSoftLimit(subsystem, budget->usedBytes, budget->softLimitBytes, budget->userData);
+        }
+    } else if (!over) {
+        budget->overSoftLimit = false;
+    }
+}
+
+static MemoryBudgetResult try_reserve(MemorySubsystem subsystem, uint32_t bytes) {
+    MemoryBudget* budget = &g_budgets[subsystem];
+    if (budget->hardLimitBytes &&
+        (bytes > budget->hardLimitBytes || budget->reservedBytes > budget->hardLimitBytes - bytes)) {
+        budget->hardLimitFailures++;
+        return MEMORY_BUDGET_ERROR_HARD_LIMIT;
+    }
+
+    budget->reservedBytes += bytes;
+    if (budget->reservedBytes > budget->peakReservedBytes) {
+        budget->peakReservedBytes = budget->reservedBytes;
+    }
+    return MEMORY_BUDGET_OK;
+}
+
+// Configuration
+MemoryBudgetResult memory_budget_set_limits(MemorySubsystem subsystem,
+                                            uint32_t softLimitBytes, uint32_t hardLimitBytes) {
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) {
+        return MEMORY_BUDGET_ERROR_INVALID_SUBSYSTEM;
+    }
+    if (hardLimitBytes && softLimitBytes > hardLimitBytes) {
+        return MEMORY_BUDGET_ERROR_INVALID_LIMITS;
+    }
+
+    // Tightening below current reservations is allowed; only new reservations fail
+    MemoryBudget* budget = &g_budgets[subsystem];
+    budget->softLimitBytes = softLimitBytes;
+    budget->hardLimitBytes = hardLimitBytes;
+    budget->overSoftLimit = false;
+    update_soft_limit(subsystem);
+    return MEMORY_BUDGET_OK;
+}
+
+MemoryBudgetResult memory_budget_set_soft_limit_callback(MemorySubsystem subsystem,
+                                                         MemoryBudgetCallback callback, void* userData) {
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) {
+        return MEMORY_BUDGET_ERROR_INVALID_SUBSYSTEM;
+    }
+    g_budgets[subsystem].onSoftLimit = callback;
+    g_budgets[subsystem].userData = userData;
+    return MEMORY_BUDGET_OK;
+}
+
+void memory_budget_reset(void) {
+    for (uint32_t i = 0; i < MEMORY_SUBSYSTEM_COUNT; i++) {
+        MemoryBudget* budget = &g_budgets[i];
+        uint32_t reserved = budget->reservedBytes;
+        uint32_t used = budget->usedBytes;
+        memset(budget, 0, sizeof(MemoryBudget));
+        budget->reservedBytes = reserved;
+        budget->usedBytes = used;
+        budget->peakReservedBytes = reserved;
+        budget->peakUsedBytes = used;
+    }
+}
+
+// Explicit charges
+MemoryBudgetResult memory_budget_reserve(MemorySubsystem subsystem, uint32_t bytes) {
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) {
+        return MEMORY_BUDGET_ERROR_INVALID_SUBSYSTEM;
+    }
+
+    MemoryBudgetResult result = try_reserve(subsystem, bytes);
+    if (result == MEMORY_BUDGET_OK) {
+        memory_budget_charge_object(subsystem, bytes);
+    }
+    return result;
+}
+
+void memory_budget_release(MemorySubsystem subsystem, uint32_t bytes) {
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) return;
+    memory_budget_release_pool(subsystem, bytes, bytes);
+}
+
+// Pool accounting
+MemoryBudgetResult memory_budget_reserve_pool(MemorySubsystem subsystem, uint32_t bytes) {
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) {
+        return MEMORY_BUDGET_ERROR_INVALID_SUBSYSTEM;
+    }
+    return try_reserve(subsystem, bytes);
+}
+
+void memory_budget_release_pool(MemorySubsystem subsystem, uint32_t reservedBytes, uint32_t usedBytes) {
+    MemoryBudget* budget = &g_budgets[subsystem];
+    budget->reservedBytes = saturating_sub(budget->reservedBytes, reservedBytes);
+    budget->usedBytes = saturating_sub(budget->usedBytes, usedBytes);
+    update_soft_limit(subsystem);
+}
+
+void memory_budget_move_pool(MemorySubsystem from, MemorySubsystem to,
+                             uint32_t reservedBytes, uint32_t usedBytes) {
+    memory_budget_release_pool(from, reservedBytes, usedBytes);
+
+    MemoryBudget* budget = &g_budgets[to];
+    budget->reservedBytes += reservedBytes;
+    if (budget->reservedBytes > budget->peakReservedBytes) {
+        budget->peakReservedBytes = budget->reservedBytes;
+    }
+    memory_budget_charge_object(to, usedBytes);
+}
+
+void memory_budget_charge_object(MemorySubsystem subsystem, uint32_t bytes) {
+    MemoryBudget* budget = &g_budgets[subsystem];
+    budget->usedBytes += bytes;
+    if (budget->usedBytes > budget->peakUsedBytes) {
+        budget->peakUsedBytes = budget->usedBytes;
+    }
+    if (budget->softLimitBytes && budget->usedBytes > budget->softLimitBytes) {
+        update_soft_limit(subsystem);
+    }
+}
+
+void memory_budget_refund_object(MemorySubsystem subsystem, uint32_t bytes) {
+    MemoryBudget* budget = &g_budgets[subsystem];
+    budget->usedBytes = saturating_sub(budget->usedBytes, bytes);
+    if (budget->overSoftLimit && budget->usedBytes <= budget->softLimitBytes) {
+        budget->overSoftLimit = false;
+    }
+}
+
+// Reporting
+const MemoryBudget* memory_budget_get(MemorySubsystem subsystem) {
+    return subsystem < MEMORY_SUBSYSTEM_COUNT ? &g_budgets[subsystem] : NULL;
+}
+
+uint32_t memory_budget_get_headroom(MemorySubsystem subsystem) {
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) return 0;
+
+    const MemoryBudget* budget = &g_budgets[subsystem];
+    if (budget->hardLimitBytes == 0) {
+        return UINT32_MAX;
+    }
+    return saturating_sub(budget->hardLimitBytes, budget->reservedBytes);
+}
+
+void memory_budget_get_report(MemoryBudgetReport* report) {
+    if (!report) return;
+
+    memset(report, 0, sizeof(MemoryBudgetReport));
+    for (uint32_t i = 0; i < MEMORY_SUBSYSTEM_COUNT; i++) {
+        report->subsystems[i] = g_budgets[i];
+        report->totalReservedBytes += g_budgets[i].reservedBytes;
+        report->totalUsedBytes += g_budgets[i].usedBytes;
+        if (g_budgets[i].overSoftLimit) {
+            report->subsystemsOverSoftLimit++;
+        }
+    }
+}
+
+static void print_limit(FILE* out, uint32_t bytes) {
+    if (bytes) {
+        fprintf(out, "%10.1f", bytes / 1024.0f);
+    } else {
+        fprintf(out, "%10s", "-");
+    }
+}
+
+void memory_budget_print_report(const MemoryBudgetReport* report, FILE* out) {
+    if (!report || !out) return;
+
+    fprintf(out, "=== Memory Budget Report (KB) ===\n");
+    fprintf(out, "%-12s %10s %10s %10s %10s %10s  %s\n",
+            "Subsystem", "Used", "Reserved", "Soft", "Hard", "Peak", "Status");
+    for (uint32_t i = 0; i < MEMORY_SUBSYSTEM_COUNT; i++) {
+        const MemoryBudget* budget = &report->subsystems[i];
+        fprintf(out, "%-12s %10.1f %10.1f ", memory_subsystem_to_string((MemorySubsystem)i),
+                budget->usedBytes / 1024.0f, budget->reservedBytes / 1024.0f);
+        print_limit(out, budget->softLimitBytes);
+        fprintf(out, " ");
+        print_limit(out, budget->hardLimitBytes);
+        fprintf(out, " %10.1f  %s", budget->peakReservedBytes / 1024.0f,
+                budget->overSoftLimit ? "OVER SOFT" : "ok");
+        if (budget->hardLimitFailures) {
+            fprintf(out, " (%u refused)", budget->hardLimitFailures);
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "Total: %.1f KB used, %.1f KB reserved\n",
+            report->totalUsedBytes / 1024.0f, report->totalReservedBytes / 1024.0f);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file memory_budget.h
+ * @brief Per-subsystem memory budgets with soft and hard limits
+ *
+ * Every subsystem (MemorySubsystem) owns one budget. Pools are charged when
+ * they are created: their whole capacity is reserved up front, so the hard
+ * limit is checked against reserved bytes and a pool that would exceed it
+ * fails to initialize with POOL_ERROR_BUDGET_EXCEEDED. Memory that does not
+ * live in a pool (arenas, lookup tables) is charged explicitly with
+ * memory_budget_reserve()/memory_budget_release().
+ *
+ * The soft limit is checked against bytes in use (live pool objects plus
+ * explicit reservations). The first allocation that crosses it calls the
+ * subsystem's callback once, which is the place to evict caches or degrade
+ * quality; the callback re-arms when usage drops back below the limit.
+ *
+ * A limit of 0 means unlimited. Accounting is always on; with no limits set
+ * it costs one add and one compare per pool operation.
+ *
+ * Usage Example:
+ * @code
+ * memory_budget_set_limits(MEMORY_SUBSYSTEM_COMPONENTS, 256 * 1024, 512 * 1024);
+ * memory_budget_set_soft_limit_callback(MEMORY_SUBSYSTEM_COMPONENTS, evict_particles, world);
+ *
+ * Scene* scene = scene_create("Match", 2000);   // NULL if over a hard limit
+ *
+ * MemoryBudgetReport report;
+ * memory_budget_get_report(&report);
+ * memory_budget_print_report(&report, stdout);
+ * @endcode
+ */
+
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include "memory_pool.h"
+#include <stdio.h>
+
+// Called once when a subsystem's usage first crosses its soft limit
+typedef void (*MemoryBudgetCallback)(MemorySubsystem subsystem, uint32_t usedBytes,
+                                     uint32_t softLimitBytes, void* userData);
+
+// Budget results
+typedef enum {
+    MEMORY_BUDGET_OK = 0,
+    MEMORY_BUDGET_ERROR_INVALID_SUBSYSTEM,
+    MEMORY_BUDGET_ERROR_INVALID_LIMITS,   // Soft limit above the hard limit
+    MEMORY_BUDGET_ERROR_HARD_LIMIT        // Reservation refused
+} MemoryBudgetResult;
+
+// Budget and live accounting for one subsystem (sizes in bytes)
+typedef struct MemoryBudget {
+    uint32_t softLimitBytes;               // 0 = no soft limit
+    uint32_t hardLimitBytes;               // 0 = unlimited
+    uint32_t reservedBytes;                // Pool capacity plus explicit reservations
+    uint32_t usedBytes;                    // Live pool objects plus explicit reservations
+    uint32_t peakReservedBytes;
+    uint32_t peakUsedBytes;
+    uint32_t softLimitCrossings;
+    uint32_t hardLimitFailures;
+    MemoryBudgetCallback onSoftLimit;
+    void* userData;
+    bool overSoftLimit;
+} MemoryBudget;
+
+// Budget against actual use for every subsystem
+typedef struct MemoryBudgetReport {
+    MemoryBudget subsystems[MEMORY_SUBSYSTEM_COUNT];
+    uint32_t totalReservedBytes;
+    uint32_t totalUsedBytes;
+    uint32_t subsystemsOverSoftLimit;
+} MemoryBudgetReport;
+
+// Configuration (limits and callbacks survive until memory_budget_reset)
+MemoryBudgetResult memory_budget_set_limits(MemorySubsystem subsystem,
+                                            uint32_t softLimitBytes, uint32_t hardLimitBytes);
+MemoryBudgetResult memory_budget_set_soft_limit_callback(MemorySubsystem subsystem,
+                                                         MemoryBudgetCallback callback, void* userData);
+void memory_budget_reset(void);            // Clears limits, callbacks and counters, keeps live charges
+
+// Explicit charges for memory outside pools (count as both reserved and used)
+MemoryBudgetResult memory_budget_reserve(MemorySubsystem subsystem, uint32_t bytes);
+void memory_budget_release(MemorySubsystem subsystem, uint32_t bytes);
+
+// Pool accounting (called by memory_pool.c)
+MemoryBudgetResult memory_budget_reserve_pool(MemorySubsystem subsystem, uint32_t bytes);
+void memory_budget_release_pool(MemorySubsystem subsystem, uint32_t reservedBytes, uint32_t usedBytes);
+void memory_budget_move_pool(MemorySubsystem from, MemorySubsystem to,
+                             uint32_t reservedBytes, uint32_t usedBytes);
+void memory_budget_charge_object(MemorySubsystem subsystem, uint32_t bytes);
+void memory_budget_refund_object(MemorySubsystem subsystem, uint32_t bytes);
+
+// Reporting
+const MemoryBudget* memory_budget_get(MemorySubsystem subsystem);
+uint32_t memory_budget_get_headroom(MemorySubsystem subsystem);  // Bytes left under the hard limit
+void memory_budget_get_report(MemoryBudgetReport* report);
+void memory_budget_print_report(const MemoryBudgetReport* report, FILE* out);
+
+#endif // MEMORY_BUDGET_H
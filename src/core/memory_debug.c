@@ -1,13 +1,31 @@
 #include "memory_debug.h"
+#include "../profiling/profiler.h"
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
 
 static PoolRegistry g_registry = {0};
 
+// Unlinks every registered pool so stale links never survive a reset
+static void detach_all_pools(void) {
+    ObjectPool* pool = g_registry.head;
+    while (pool) {
+        ObjectPool* next = pool->debugNext;
+        pool->debugNext = NULL;
+        pool->debugPrev = NULL;
+        pool = next;
+    }
+    g_registry.head = NULL;
+    g_registry.poolCount = 0;
+}
+
+static bool is_registered(const ObjectPool* pool) {
+    return pool == g_registry.head || (pool->debugPrev && pool->debugPrev->debugNext == pool);
+}
+
 void memory_debug_init(void) {
+    detach_all_pools();
     memset(&g_registry, 0, sizeof(PoolRegistry));
-    g_registry.poolCount = 0;
     g_registry.hasSnapshot = false;
 }
 
@@ -24,66 +42,68 @@ void memory_debug_shutdown(void) {
         }
     }
     
+    detach_all_pools();
     memset(&g_registry, 0, sizeof(PoolRegistry));
 }
 
 void memory_debug_register_pool(ObjectPool* pool) {
     if (!pool) return;
     
-#if ENABLE_MEMORY_TRACKING
-    if (g_registry.poolCount >= MAX_TRACKED_POOLS) {
-        printf("WARNING: Cannot register pool '%s' - registry full\n", 
-               pool->debugName ? pool->debugName : "unnamed");
-        return;
+    // Membership is checked by walking the list: a freshly initialized pool
+    // may carry stale links from a previous life
+    for (ObjectPool* it = g_registry.head; it; it = it->debugNext) {
+        if (it == pool) {
+            return;
+        }
     }
     
-    g_registry.pools[g_registry.poolCount] = pool;
+    pool->debugPrev = NULL;
+    pool->debugNext = g_registry.head;
+    if (g_registry.head) {
+        g_registry.head->debugPrev = pool;
+    }
+    g_registry.head = pool;
     g_registry.poolCount++;
     
-    printf("Registered memory pool: %s (capacity: %u, element size: %u bytes)\n",
-           pool->debugName ? pool->debugName : "unnamed",
-           pool->capacity, pool->elementSize);
-#endif
+    pool->pollAllocations = pool->totalAllocations;
+    pool->allocsPerSecond = 0.0f;
 }
 
 void memory_debug_unregister_pool(ObjectPool* pool) {
-    if (!pool) return;
+    if (!pool || !is_registered(pool)) return;
     
-#if ENABLE_MEMORY_TRACKING
-    for (uint32_t i = 0; i < g_registry.poolCount; i++) {
-        if (g_registry.pools[i] == pool) {
-            // Check for leaks before unregistering
-            uint32_t usedCount = object_pool_get_used_count(pool);
-            if (usedCount > 0) {
-                printf("WARNING: Pool '%s' has %u objects still allocated\n",
-                       pool->debugName ? pool->debugName : "unnamed", usedCount);
-            }
-            
-            // Shift remaining pools down
-            for (uint32_t j = i; j < g_registry.poolCount - 1; j++) {
-                g_registry.pools[j] = g_registry.pools[j + 1];
-            }
-            g_registry.poolCount--;
-            
-            printf("Unregistered memory pool: %s\n",
-                   pool->debugName ? pool->debugName : "unnamed");
-            return;
-        }
+    if (pool->debugPrev) {
+        pool->debugPrev->debugNext = pool->debugNext;
+    } else {
+        g_registry.head = pool->debugNext;
+    }
+    if (pool->debugNext) {
+        pool->debugNext->debugPrev = pool->debugPrev;
     }
     
-    printf("WARNING: Attempted to unregister unknown pool\n");
-#endif
+    pool->debugNext = NULL;
+    pool->debugPrev = NULL;
+    g_registry.poolCount--;
+}
+
+uint32_t memory_debug_get_pool_count(void) {
+    return g_registry.poolCount;
+}
+
+bool memory_debug_is_pool_registered(const ObjectPool* pool) {
+    for (const ObjectPool* it = g_registry.head; it; it = it->debugNext) {
+        if (it == pool) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void memory_debug_update_stats(void) {
-#if ENABLE_MEMORY_STATS
     memset(&g_registry.globalStats, 0, sizeof(MemoryStats));
     g_registry.globalStats.totalPools = g_registry.poolCount;
     
-    for (uint32_t i = 0; i < g_registry.poolCount; i++) {
-        ObjectPool* pool = g_registry.pools[i];
-        if (!pool) continue;
-        
+    for (ObjectPool* pool = g_registry.head; pool; pool = pool->debugNext) {
         uint32_t usedCount = object_pool_get_used_count(pool);
         uint32_t memoryUsed = usedCount * pool->elementSize;
         
@@ -98,7 +118,62 @@ void memory_debug_update_stats(void) {
             g_registry.globalStats.peakMemoryUsed = peakMemory;
         }
     }
-#endif
+}
+
+void memory_debug_poll(MemoryTelemetry* telemetry) {
+    if (!telemetry) return;
+    
+    memset(telemetry, 0, sizeof(MemoryTelemetry));
+    uint64_t now = profiler_get_time_ns();
+    float interval = g_registry.lastPollNs ? (float)(now - g_registry.lastPollNs) / 1e9f : 0.0f;
+    g_registry.lastPollNs = now;
+    
+    telemetry->timestampNs = now;
+    telemetry->intervalSeconds = interval;
+    
+    for (ObjectPool* pool = g_registry.head; pool; pool = pool->debugNext) {
+        uint32_t allocations = pool->totalAllocations - pool->pollAllocations;
+        pool->pollAllocations = pool->totalAllocations;
+        pool->allocsPerSecond = interval > 0.0f ? (float)allocations / interval : 0.0f;
+        
+        SubsystemTelemetry* subsystem = &telemetry->subsystems[pool->subsystem];
+        uint32_t used = object_pool_get_used_count(pool);
+        subsystem->poolCount++;
+        subsystem->capacityBytes += pool->capacity * pool->elementSize;
+        subsystem->usedBytes += used * pool->elementSize;
+        subsystem->peakBytes += pool->peakUsage * pool->elementSize;
+        subsystem->allocsPerSecond += pool->allocsPerSecond;
+    }
+    
+    for (uint32_t i = 0; i < MEMORY_SUBSYSTEM_COUNT; i++) {
+        SubsystemTelemetry* subsystem = &telemetry->subsystems[i];
+        if (subsystem->usedBytes > g_registry.highWaterBytes[i]) {
+            g_registry.highWaterBytes[i] = subsystem->usedBytes;
+        }
+        subsystem->highWaterBytes = g_registry.highWaterBytes[i];
+    }
+    
+    memory_debug_update_stats();
+    telemetry->totals = g_registry.globalStats;
+}
+
+uint32_t memory_debug_get_pool_telemetry(PoolTelemetry* pools, uint32_t capacity) {
+    if (!pools) return 0;
+    
+    uint32_t count = 0;
+    for (ObjectPool* pool = g_registry.head; pool && count < capacity; pool = pool->debugNext) {
+        PoolTelemetry* entry = &pools[count++];
+        entry->pool = pool;
+        entry->name = pool->debugName ? pool->debugName : "unnamed";
+        entry->subsystem = pool->subsystem;
+        entry->capacity = pool->capacity;
+        entry->used = object_pool_get_used_count(pool);
+        entry->peak = pool->peakUsage;
+        entry->elementSize = pool->elementSize;
+        entry->usagePercent = object_pool_get_usage_percent(pool);
+        entry->allocsPerSecond = pool->allocsPerSecond;
+    }
+    return count;
 }
 
 MemoryStats memory_debug_get_stats(void) {
@@ -127,8 +202,8 @@ void memory_debug_print_report(void) {
     }
     
     printf("\n--- Per-Pool Statistics ---\n");
-    for (uint32_t i = 0; i < g_registry.poolCount; i++) {
-        memory_debug_print_pool_stats(g_registry.pools[i]);
+    for (ObjectPool* pool = g_registry.head; pool; pool = pool->debugNext) {
+        memory_debug_print_pool_stats(pool);
     }
     printf("=============================\n\n");
 #else
@@ -145,7 +220,8 @@ void memory_debug_print_pool_stats(const ObjectPool* pool) {
     uint32_t memoryUsed = usedCount * pool->elementSize;
     uint32_t totalMemory = pool->capacity * pool->elementSize;
     
-    printf("Pool: %s\n", pool->debugName ? pool->debugName : "unnamed");
+    printf("Pool: %s (%s)\n", pool->debugName ? pool->debugName : "unnamed",
+           memory_subsystem_to_string(pool->subsystem));
     printf("  Capacity: %u objects\n", pool->capacity);
     printf("  Used: %u objects (%.1f%%)\n", usedCount, usagePercent);
     printf("  Element Size: %u bytes\n", pool->elementSize);
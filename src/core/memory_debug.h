@@ -12,8 +12,6 @@
     #define ENABLE_MEMORY_STATS 0
 #endif
 
-#define MAX_TRACKED_POOLS 32
-
 typedef struct MemoryStats {
     uint32_t totalPools;
     uint32_t totalAllocatedObjects;
@@ -23,19 +21,61 @@ typedef struct MemoryStats {
     uint32_t totalDeallocations;
 } MemoryStats;
 
+// Live telemetry for one pool
+typedef struct PoolTelemetry {
+    const ObjectPool* pool;
+    const char* name;
+    MemorySubsystem subsystem;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t peak;                 // Pool lifetime high-water mark (objects)
+    uint32_t elementSize;
+    float usagePercent;
+    float allocsPerSecond;         // Over the previous poll interval
+} PoolTelemetry;
+
+// Pools grouped by owning subsystem (sizes in bytes)
+typedef struct SubsystemTelemetry {
+    uint32_t poolCount;
+    uint32_t capacityBytes;
+    uint32_t usedBytes;
+    uint32_t peakBytes;            // Sum of the pools' own peaks
+    uint32_t highWaterBytes;       // Highest usedBytes seen by any poll since init
+    float allocsPerSecond;
+} SubsystemTelemetry;
+
+// Structured snapshot filled by memory_debug_poll()
+typedef struct MemoryTelemetry {
+    uint64_t timestampNs;
+    float intervalSeconds;         // Since the previous poll (0 on the first)
+    MemoryStats totals;
+    SubsystemTelemetry subsystems[MEMORY_SUBSYSTEM_COUNT];
+} MemoryTelemetry;
+
+// Registered pools form an intrusive list through ObjectPool::debugNext/Prev,
+// so there is no cap and registration never allocates
 typedef struct PoolRegistry {
-    ObjectPool* pools[MAX_TRACKED_POOLS];
+    ObjectPool* head;
     uint32_t poolCount;
     MemoryStats globalStats;
     MemoryStats snapshot;
     bool hasSnapshot;
+    uint64_t lastPollNs;
+    uint32_t highWaterBytes[MEMORY_SUBSYSTEM_COUNT];
 } PoolRegistry;
 
-// Global memory tracking
+// Global memory tracking. object_pool_init/destroy register and unregister
+// automatically; both calls are idempotent and silent
 void memory_debug_init(void);
 void memory_debug_shutdown(void);
 void memory_debug_register_pool(ObjectPool* pool);
 void memory_debug_unregister_pool(ObjectPool* pool);
+uint32_t memory_debug_get_pool_count(void);
+bool memory_debug_is_pool_registered(const ObjectPool* pool);
+
+// Live telemetry: polling walks the pool list once, never allocates or prints
+void memory_debug_poll(MemoryTelemetry* telemetry);
+uint32_t memory_debug_get_pool_telemetry(PoolTelemetry* pools, uint32_t capacity);
 
 // Statistics and reporting
 MemoryStats memory_debug_get_stats(void);
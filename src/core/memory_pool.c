@@ -1,20 +1,44 @@
+#define _ISOC11_SOURCE
+
 #include "memory_pool.h"
+#include "memory_debug.h"
+#include "memory_budget.h"
+#include "pool_trace.h"
+#include "../profiling/profiler.h"
+#include "../profiling/alloc_tracker.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
 PoolResult object_pool_init(ObjectPool* pool, uint32_t elementSize, 
                            uint32_t capacity, const char* debugName) {
+    return object_pool_init_for_subsystem(pool, MEMORY_SUBSYSTEM_GENERAL, elementSize, capacity, debugName);
+}
+
+PoolResult object_pool_init_for_subsystem(ObjectPool* pool, MemorySubsystem subsystem,
+                                          uint32_t elementSize, uint32_t capacity,
+                                          const char* debugName) {
     if (!pool || elementSize == 0 || capacity == 0) {
         return POOL_ERROR_NULL_POINTER;
     }
+    if (subsystem >= MEMORY_SUBSYSTEM_COUNT) {
+        return POOL_ERROR_INVALID_SIZE;
+    }
     
     // Align element size for optimal ARM performance
     uint32_t alignedSize = ALIGN_SIZE(elementSize);
+    uint32_t reservedBytes = alignedSize * capacity;
+    
+    // The whole capacity is charged up front; over the hard limit the pool
+    // is refused before anything is allocated
+    if (memory_budget_reserve_pool(subsystem, reservedBytes) != MEMORY_BUDGET_OK) {
+        return POOL_ERROR_BUDGET_EXCEEDED;
+    }
     
     // Allocate aligned memory block
-    pool->memory = aligned_alloc(MEMORY_ALIGNMENT, alignedSize * capacity);
+    pool->memory = aligned_alloc(MEMORY_ALIGNMENT, reservedBytes);
     if (!pool->memory) {
+        memory_budget_release_pool(subsystem, reservedBytes, 0);
         return POOL_ERROR_OUT_OF_MEMORY;
     }
     
@@ -22,6 +46,7 @@ PoolResult object_pool_init(ObjectPool* pool, uint32_t elementSize,
     pool->freeList = malloc(capacity * sizeof(uint32_t));
     if (!pool->freeList) {
         free(pool->memory);
+        memory_budget_release_pool(subsystem, reservedBytes, 0);
         return POOL_ERROR_OUT_OF_MEMORY;
     }
     
@@ -30,6 +55,7 @@ PoolResult object_pool_init(ObjectPool* pool, uint32_t elementSize,
     if (!pool->objectStates) {
         free(pool->memory);
         free(pool->freeList);
+        memory_budget_release_pool(subsystem, reservedBytes, 0);
         return POOL_ERROR_OUT_OF_MEMORY;
     }
     
@@ -49,11 +75,24 @@ PoolResult object_pool_init(ObjectPool* pool, uint32_t elementSize,
     pool->totalDeallocations = 0;
     pool->peakUsage = 0;
     
+    // Telemetry
+    pool->debugNext = NULL;
+    pool->debugPrev = NULL;
+    pool->pollAllocations = 0;
+    pool->allocsPerSecond = 0.0f;
+    pool->subsystem = subsystem;
+    memory_debug_register_pool(pool);
+    
     return POOL_OK;
 }
 
 void object_pool_destroy(ObjectPool* pool) {
     if (pool) {
+        memory_debug_unregister_pool(pool);
+        if (pool->memory) {
+            memory_budget_release_pool(pool->subsystem, pool->capacity * pool->elementSize,
+                                       object_pool_get_used_count(pool) * pool->elementSize);
+        }
         free(pool->memory);
         free(pool->freeList);
         free(pool->objectStates);
@@ -61,11 +100,29 @@ void object_pool_destroy(ObjectPool* pool) {
     }
 }
 
-void* object_pool_alloc(ObjectPool* pool) {
-    if (!pool || pool->freeCount == 0) {
+// Caller attribution for the pool trace
+#if defined(__GNUC__) || defined(__clang__)
+    #define POOL_CALLER_ADDRESS() __builtin_return_address(0)
+#else
+    #define POOL_CALLER_ADDRESS() NULL
+#endif
+
+static inline void* pool_acquire_object(ObjectPool* pool, const void* caller, uint8_t traceFlags) {
+    if (!pool) {
         return NULL;
     }
     
+    if (pool->freeCount == 0) {
+#if ENABLE_POOL_TRACE
+        pool_trace_record(pool, POOL_TRACE_EXHAUSTED, 0, caller, traceFlags);
+#endif
+        return NULL;
+    }
+    
+    // Attributed to the caller's zone, so report before opening our own
+    alloc_tracker_record_pool_alloc(pool->elementSize);
+    PROFILER_ZONE_BEGIN("object_pool_alloc");
+    
     // Pop from free list
     uint32_t index = pool->freeList[pool->freeHead];
     pool->freeHead++;
@@ -79,19 +136,32 @@ void* object_pool_alloc(ObjectPool* pool) {
     
     // Update statistics
     pool->totalAllocations++;
+    memory_budget_charge_object(pool->subsystem, pool->elementSize);
     uint32_t currentUsage = pool->capacity - pool->freeCount;
     if (currentUsage > pool->peakUsage) {
         pool->peakUsage = currentUsage;
     }
     
+#if ENABLE_POOL_TRACE
+    pool_trace_record(pool, POOL_TRACE_ALLOC, index, caller, traceFlags);
+#else
+    (void)caller;
+    (void)traceFlags;
+#endif
+    
+    PROFILER_ZONE_END();
     return object;
 }
 
-PoolResult object_pool_free(ObjectPool* pool, void* object) {
-    if (!pool || !object) {
-        return POOL_ERROR_NULL_POINTER;
-    }
-    
+void* object_pool_alloc(ObjectPool* pool) {
+    return pool_acquire_object(pool, POOL_CALLER_ADDRESS(), 0);
+}
+
+void* object_pool_alloc_tagged(ObjectPool* pool, const char* tag) {
+    return pool_acquire_object(pool, tag, tag ? POOL_TRACE_FLAG_TAG : 0);
+}
+
+static inline PoolResult pool_release_object(ObjectPool* pool, void* object) {
     // Validate object belongs to this pool
     if (!object_pool_owns_object(pool, object)) {
         return POOL_ERROR_INVALID_INDEX;
@@ -117,10 +187,55 @@ PoolResult object_pool_free(ObjectPool* pool, void* object) {
     pool->freeCount++;
     
     pool->totalDeallocations++;
+    memory_budget_refund_object(pool->subsystem, pool->elementSize);
     
     return POOL_OK;
 }
 
+PoolResult object_pool_free(ObjectPool* pool, void* object) {
+    if (!pool || !object) {
+        return POOL_ERROR_NULL_POINTER;
+    }
+    
+    PROFILER_ZONE_BEGIN("object_pool_free");
+    PoolResult result = pool_release_object(pool, object);
+#if ENABLE_POOL_TRACE
+    if (result == POOL_OK) {
+        pool_trace_record(pool, POOL_TRACE_FREE, object_pool_get_object_index(pool, object),
+                          POOL_CALLER_ADDRESS(), 0);
+    }
+#endif
+    PROFILER_ZONE_END();
+    
+    return result;
+}
+
+void object_pool_set_subsystem(ObjectPool* pool, MemorySubsystem subsystem) {
+    if (!pool || subsystem >= MEMORY_SUBSYSTEM_COUNT || subsystem == pool->subsystem) {
+        return;
+    }
+    
+    // Moves the pool's charges; the new budget's hard limit is not enforced
+    // (use object_pool_init_for_subsystem for that)
+    uint32_t reservedBytes = pool->capacity * pool->elementSize;
+    uint32_t usedBytes = object_pool_get_used_count(pool) * pool->elementSize;
+    if (pool->memory) {
+        memory_budget_move_pool(pool->subsystem, subsystem, reservedBytes, usedBytes);
+    }
+    pool->subsystem = subsystem;
+}
+
+const char* memory_subsystem_to_string(MemorySubsystem subsystem) {
+    switch (subsystem) {
+        case MEMORY_SUBSYSTEM_GENERAL: return "General";
+        case MEMORY_SUBSYSTEM_COMPONENTS: return "Components";
+        case MEMORY_SUBSYSTEM_SCENE: return "Scene";
+        case MEMORY_SUBSYSTEM_SPATIAL: return "Spatial";
+        case MEMORY_SUBSYSTEM_ARENA: return "Arena";
+        default: return "Unknown";
+    }
+}
+
 uint32_t object_pool_get_used_count(const ObjectPool* pool) {
     if (!pool) return 0;
     return pool->capacity - pool->freeCount;
@@ -16,9 +16,21 @@ typedef enum {
     POOL_ERROR_INVALID_SIZE,
     POOL_ERROR_POOL_FULL,
     POOL_ERROR_INVALID_INDEX,
-    POOL_ERROR_DOUBLE_FREE
+    POOL_ERROR_DOUBLE_FREE,
+    POOL_ERROR_BUDGET_EXCEEDED     // Subsystem hard limit (see memory_budget.h)
 } PoolResult;
 
+// Owning subsystem, used to group pool telemetry (see memory_debug.h) and
+// to charge the subsystem's memory budget (see memory_budget.h)
+typedef enum {
+    MEMORY_SUBSYSTEM_GENERAL = 0,
+    MEMORY_SUBSYSTEM_COMPONENTS,
+    MEMORY_SUBSYSTEM_SCENE,
+    MEMORY_SUBSYSTEM_SPATIAL,
+    MEMORY_SUBSYSTEM_ARENA,        // Scratch/arena memory charged explicitly
+    MEMORY_SUBSYSTEM_COUNT
+} MemorySubsystem;
+
 typedef struct ObjectPool {
     void* memory;              // Pre-allocated aligned memory block
     uint32_t* freeList;        // Stack of free indices
@@ -33,16 +45,31 @@ typedef struct ObjectPool {
     uint32_t totalAllocations;
     uint32_t totalDeallocations;
     uint32_t peakUsage;
+    
+    // Telemetry, maintained by memory_debug (pools register themselves on init)
+    struct ObjectPool* debugNext;  // Intrusive registry list
+    struct ObjectPool* debugPrev;
+    uint32_t pollAllocations;      // totalAllocations at the previous poll
+    float allocsPerSecond;         // Allocation rate over the previous poll interval
+    MemorySubsystem subsystem;
 } ObjectPool;
 
 // Core pool operations
 PoolResult object_pool_init(ObjectPool* pool, uint32_t elementSize, 
                            uint32_t capacity, const char* debugName);
+PoolResult object_pool_init_for_subsystem(ObjectPool* pool, MemorySubsystem subsystem,
+                                          uint32_t elementSize, uint32_t capacity,
+                                          const char* debugName);
 void object_pool_destroy(ObjectPool* pool);
 
 void* object_pool_alloc(ObjectPool* pool);
+void* object_pool_alloc_tagged(ObjectPool* pool, const char* tag);  // Tag shows in the pool trace
 PoolResult object_pool_free(ObjectPool* pool, void* object);
 
+// Telemetry grouping and budget owner (defaults to MEMORY_SUBSYSTEM_GENERAL)
+void object_pool_set_subsystem(ObjectPool* pool, MemorySubsystem subsystem);
+const char* memory_subsystem_to_string(MemorySubsystem subsystem);
+
 // Pool queries
 uint32_t object_pool_get_used_count(const ObjectPool* pool);
 uint32_t object_pool_get_free_count(const ObjectPool* pool);
@@ -0,0 +1,240 @@
+#include "pool_trace.h"
+#include "memory_debug.h"
+#include "../profiling/profiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Lock-free slot claim (Playdate builds are single-threaded)
+#if defined(__GNUC__) || defined(__clang__)
+    #define POOL_TRACE_CLAIM(ptr) __atomic_fetch_add((ptr), 1, __ATOMIC_RELAXED)
+#else
+    #define POOL_TRACE_CLAIM(ptr) ((*(ptr))++)
+#endif
+
+#define POOL_TRACE_MAX_DUMPED_POOLS 16
+#define POOL_TRACE_CALIBRATION_NS 1000000ull   // Shortest window for the tick rate
+
+typedef struct PoolTrace {
+    PoolTraceEvent* events;
+    uint32_t capacity;             // Power of 2
+    uint32_t mask;
+    uint64_t writeIndex;           // Total events claimed
+    uint64_t startTicks;           // Calibration pair taken at init
+    uint64_t startNs;
+    double nsPerTick;              // Frozen on first conversion, 0 until then
+    FILE* exhaustionDump;
+    const ObjectPool* dumpedPools[POOL_TRACE_MAX_DUMPED_POOLS];
+    uint32_t dumpedPoolCount;
+    volatile bool enabled;
+} PoolTrace;
+
+static PoolTrace g_poolTrace = {0};
+
+// Raw cycle/tick counter: a few cycles to read, converted to ns only on dump
+static inline uint64_t read_ticks(void) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return profiler_get_time_ns();
+#endif
+}
+
+// Lifecycle
+PoolTraceResult pool_trace_init(uint32_t capacity) {
+#if ENABLE_POOL_TRACE
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        return POOL_TRACE_ERROR_INVALID_CAPACITY;
+    }
+
+    pool_trace_shutdown();
+
+    PoolTraceEvent* events = calloc(capacity, sizeof(PoolTraceEvent));
+    if (!events) {
+        return POOL_TRACE_ERROR_OUT_OF_MEMORY;
+    }
+
+    g_poolTrace.events = events;
+    g_poolTrace.capacity = capacity;
+    g_poolTrace.mask = capacity - 1;
+    g_poolTrace.writeIndex = 0;
+    g_poolTrace.startTicks = read_ticks();
+    g_poolTrace.startNs = profiler_get_time_ns();
+    g_poolTrace.nsPerTick = 0.0;
+    g_poolTrace.dumpedPoolCount = 0;
+    g_poolTrace.enabled = true;
+    return POOL_TRACE_OK;
+#else
+    (void)capacity;
+    return POOL_TRACE_ERROR_DISABLED;
+#endif
+}
+
+void pool_trace_shutdown(void) {
+    g_poolTrace.enabled = false;
+    free(g_poolTrace.events);
+    memset(&g_poolTrace, 0, sizeof(PoolTrace));
+}
+
+bool pool_trace_is_enabled(void) {
+    return g_poolTrace.enabled;
+}
+
+void pool_trace_clear(void) {
+    g_poolTrace.writeIndex = 0;
+    g_poolTrace.dumpedPoolCount = 0;
+    if (g_poolTrace.events) {
+        memset(g_poolTrace.events, 0, g_poolTrace.capacity * sizeof(PoolTraceEvent));
+    }
+}
+
+// Exhaustion dump, at most once per pool until the next clear
+static void dump_exhausted_pool(const ObjectPool* pool) {
+    for (uint32_t i = 0; i < g_poolTrace.dumpedPoolCount; i++) {
+        if (g_poolTrace.dumpedPools[i] == pool) {
+            return;
+        }
+    }
+    if (g_poolTrace.dumpedPoolCount < POOL_TRACE_MAX_DUMPED_POOLS) {
+        g_poolTrace.dumpedPools[g_poolTrace.dumpedPoolCount++] = pool;
+    }
+
+    fprintf(g_poolTrace.exhaustionDump, "# Pool '%s' exhausted (capacity %u)\n",
+            pool->debugName ? pool->debugName : "unnamed", pool->capacity);
+    pool_trace_dump(g_poolTrace.exhaustionDump, pool);
+}
+
+// Recording
+void pool_trace_record(const ObjectPool* pool, PoolTraceEventType type, uint32_t slot,
+                       const void* caller, uint8_t flags) {
+    if (!g_poolTrace.enabled) {
+        return;
+    }
+
+    uint64_t index = POOL_TRACE_CLAIM(&g_poolTrace.writeIndex);
+    PoolTraceEvent* event = &g_poolTrace.events[index & g_poolTrace.mask];
+    event->ticks = read_ticks();
+    event->pool = pool;
+    event->caller = caller;
+    event->slot = slot;
+    event->type = (uint8_t)type;
+    event->flags = flags;
+    event->sequence = (uint16_t)index;
+
+    if (type == POOL_TRACE_EXHAUSTED && g_poolTrace.exhaustionDump) {
+        dump_exhausted_pool(pool);
+    }
+}
+
+void pool_trace_set_exhaustion_dump(FILE* out) {
+    g_poolTrace.exhaustionDump = out;
+}
+
+// Reading
+uint64_t pool_trace_get_event_count(void) {
+    return g_poolTrace.writeIndex;
+}
+
+uint32_t pool_trace_snapshot(PoolTraceEvent* events, uint32_t capacity) {
+    if (!events || !g_poolTrace.events) {
+        return 0;
+    }
+
+    uint64_t end = g_poolTrace.writeIndex;
+    uint64_t available = end < g_poolTrace.capacity ? end : g_poolTrace.capacity;
+    uint32_t count = available < capacity ? (uint32_t)available : capacity;
+
+    // Most recent events win when the caller's buffer is smaller than the ring
+    uint64_t start = end - count;
+    for (uint32_t i = 0; i < count; i++) {
+        events[i] = g_poolTrace.events[(start + i) & g_poolTrace.mask];
+    }
+    return count;
+}
+
+uint64_t pool_trace_read_ticks(void) {
+    return read_ticks();
+}
+
+// Calibrates ticks against the monotonic clock once, from the init pair, and
+// keeps the rate so conversions stay monotonic
+static double get_ns_per_tick(void) {
+    if (g_poolTrace.nsPerTick > 0.0) {
+        return g_poolTrace.nsPerTick;
+    }
+
+    uint64_t nowTicks, nowNs;
+    do {
+        nowTicks = read_ticks();
+        nowNs = profiler_get_time_ns();
+    } while (nowNs - g_poolTrace.startNs < POOL_TRACE_CALIBRATION_NS);
+
+    double nsPerTick = 1.0;
+    if (nowTicks > g_poolTrace.startTicks) {
+        nsPerTick = (double)(nowNs - g_poolTrace.startNs) / (double)(nowTicks - g_poolTrace.startTicks);
+    }
+    if (g_poolTrace.events) {
+        g_poolTrace.nsPerTick = nsPerTick;
+    }
+    return nsPerTick;
+}
+
+static uint64_t convert_ticks(uint64_t ticks, double nsPerTick) {
+    if (ticks <= g_poolTrace.startTicks) {
+        return 0;
+    }
+    return (uint64_t)((double)(ticks - g_poolTrace.startTicks) * nsPerTick);
+}
+
+uint64_t pool_trace_ticks_to_ns(uint64_t ticks) {
+    return convert_ticks(ticks, get_ns_per_tick());
+}
+
+void pool_trace_dump(FILE* out, const ObjectPool* pool) {
+    if (!out || !g_poolTrace.events) {
+        return;
+    }
+
+    uint64_t end = g_poolTrace.writeIndex;
+    uint64_t count = end < g_poolTrace.capacity ? end : g_poolTrace.capacity;
+    double nsPerTick = get_ns_per_tick();
+
+    fprintf(out, "timestamp_ns,event,pool,pool_address,slot,caller\n");
+    for (uint64_t i = end - count; i < end; i++) {
+        const PoolTraceEvent* event = &g_poolTrace.events[i & g_poolTrace.mask];
+        if (pool && event->pool != pool) continue;
+
+        // Destroyed pools are reported by address only
+        const char* name = "destroyed";
+        if (memory_debug_is_pool_registered(event->pool)) {
+            name = event->pool->debugName ? event->pool->debugName : "unnamed";
+        }
+
+        fprintf(out, "%llu,%s,%s,%p,", (unsigned long long)convert_ticks(event->ticks, nsPerTick),
+                pool_trace_event_type_to_string((PoolTraceEventType)event->type), name,
+                (const void*)event->pool);
+        if (event->type == POOL_TRACE_EXHAUSTED) {
+            fprintf(out, "-,");
+        } else {
+            fprintf(out, "%u,", event->slot);
+        }
+        if (event->flags & POOL_TRACE_FLAG_TAG) {
+            fprintf(out, "%s\n", (const char*)event->caller);
+        } else {
+            fprintf(out, "%p\n", event->caller);
+        }
+    }
+}
+
+// Utility
+const char* pool_trace_event_type_to_string(PoolTraceEventType type) {
+    switch (type) {
+        case POOL_TRACE_ALLOC: return "alloc";
+        case POOL_TRACE_FREE: return "free";
+        case POOL_TRACE_EXHAUSTED: return "exhausted";
+        default: return "unknown";
+    }
+}
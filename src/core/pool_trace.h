@@ -0,0 +1,103 @@
+/**
+ * @file pool_trace.h
+ * @brief Optional ring-buffer trace of object pool alloc/free events
+ *
+ * When enabled, every object_pool_alloc/object_pool_free records a 32-byte
+ * event (raw tick timestamp, pool, slot, caller return address or tag) into
+ * one global ring buffer. Writers claim a slot with a single atomic
+ * increment, so recording is lock-free and never allocates; when the ring
+ * wraps the oldest events are overwritten.
+ *
+ * A failed allocation records a POOL_TRACE_EXHAUSTED event and, if
+ * configured, dumps the trace of the exhausted pool once so the log shows
+ * who filled it and how fast. The CSV dump (timestamp, event, pool, slot,
+ * caller) is meant for offline tooling; caller addresses resolve with
+ * addr2line against the binary.
+ *
+ * Tracing compiles out unless ENABLE_POOL_TRACE is non-zero (the default for
+ * DEBUG builds; release builds can opt in with -DENABLE_POOL_TRACE=1), and
+ * costs one branch per pool operation until pool_trace_init() is called.
+ *
+ * Usage Example:
+ * @code
+ * pool_trace_init(POOL_TRACE_DEFAULT_CAPACITY);
+ * pool_trace_set_exhaustion_dump(stderr);
+ *
+ * Bullet* bullet = object_pool_alloc_tagged(&bulletPool, "enemy_spread");
+ *
+ * pool_trace_dump(stdout, &bulletPool);   // On demand, one pool
+ * pool_trace_shutdown();
+ * @endcode
+ */
+
+#ifndef POOL_TRACE_H
+#define POOL_TRACE_H
+
+#include "memory_pool.h"
+#include <stdio.h>
+
+// Trace configuration
+#ifndef ENABLE_POOL_TRACE
+    #ifdef DEBUG
+        #define ENABLE_POOL_TRACE 1
+    #else
+        #define ENABLE_POOL_TRACE 0
+    #endif
+#endif
+
+#define POOL_TRACE_DEFAULT_CAPACITY 8192   // Events (power of 2)
+
+// Event kinds
+typedef enum {
+    POOL_TRACE_ALLOC = 0,
+    POOL_TRACE_FREE,
+    POOL_TRACE_EXHAUSTED                   // Allocation failed, slot is invalid
+} PoolTraceEventType;
+
+// PoolTraceEvent flags
+#define POOL_TRACE_FLAG_TAG 0x1u           // caller is a tag string, not an address
+
+// Recorded event (32 bytes)
+typedef struct PoolTraceEvent {
+    uint64_t ticks;                        // 8 bytes - raw timestamp, see pool_trace_ticks_to_ns
+    const ObjectPool* pool;                // 8 bytes - pool the event belongs to
+    const void* caller;                    // 8 bytes - return address or tag
+    uint32_t slot;                         // 4 bytes - object index in the pool
+    uint8_t type;                          // 1 byte  - PoolTraceEventType
+    uint8_t flags;                         // 1 byte  - POOL_TRACE_FLAG_* bits
+    uint16_t sequence;                     // 2 bytes - low bits of the write index
+} PoolTraceEvent;
+
+// Trace results
+typedef enum {
+    POOL_TRACE_OK = 0,
+    POOL_TRACE_ERROR_INVALID_CAPACITY,
+    POOL_TRACE_ERROR_OUT_OF_MEMORY,
+    POOL_TRACE_ERROR_DISABLED              // Compiled out
+} PoolTraceResult;
+
+// Lifecycle
+PoolTraceResult pool_trace_init(uint32_t capacity);
+void pool_trace_shutdown(void);
+bool pool_trace_is_enabled(void);
+void pool_trace_clear(void);
+
+// Recording (called by memory_pool.c)
+void pool_trace_record(const ObjectPool* pool, PoolTraceEventType type, uint32_t slot,
+                       const void* caller, uint8_t flags);
+
+// Exhaustion: dump the exhausted pool's events to out the first time it fills
+// up after init/clear (NULL disables)
+void pool_trace_set_exhaustion_dump(FILE* out);
+
+// Reading (best-effort while other threads are still recording)
+uint64_t pool_trace_get_event_count(void);            // Total recorded, including overwritten
+uint32_t pool_trace_snapshot(PoolTraceEvent* events, uint32_t capacity);  // Oldest first
+uint64_t pool_trace_read_ticks(void);                 // Same clock as PoolTraceEvent ticks
+uint64_t pool_trace_ticks_to_ns(uint64_t ticks);      // Rate calibrated once, on first use
+void pool_trace_dump(FILE* out, const ObjectPool* pool);  // NULL pool = every pool
+
+// Utility
+const char* pool_trace_event_type_to_string(PoolTraceEventType type);
+
+#endif // POOL_TRACE_H
@@ -1,6 +1,8 @@
 #include "scene.h"
 #include "component_registry.h"
 #include "update_systems.h"
+#include "memory_budget.h"
+#include "../profiling/profiler.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -8,14 +10,117 @@
 
 static uint32_t g_nextSceneId = 1;
 
+static ComponentSystem* find_system(const Scene* scene, ComponentType type) {
+    for (uint32_t i = 0; i < scene->systemCount; i++) {
+        if (scene->systems[i].type == type) {
+            return (ComponentSystem*)&scene->systems[i];
+        }
+    }
+    return NULL;
+}
+
+// Record one batch call and raise the budget event if it overran
+static void record_system_sample(Scene* scene, ComponentSystem* system, SystemTimingWindow* timing,
+                                 uint64_t elapsedNs, uint32_t entityCount) {
+    float elapsedUs = (float)elapsedNs / 1000.0f;
+    
+    timing->samplesUs[timing->cursor] = elapsedUs;
+    timing->entityCounts[timing->cursor] = entityCount;
+    timing->cursor = (timing->cursor + 1) % SYSTEM_STATS_WINDOW;
+    if (timing->sampleCount < SYSTEM_STATS_WINDOW) {
+        timing->sampleCount++;
+    }
+    timing->callCount++;
+    
+    if (system->budgetUs > 0.0f && elapsedUs > system->budgetUs) {
+        system->budgetOverruns++;
+        if (system->onBudgetExceeded) {
+            system->onBudgetExceeded(scene, system->type, elapsedUs, system->budgetUs,
+                                     system->budgetUserData);
+        }
+    }
+}
+
+static void summarize_timing_window(const SystemTimingWindow* timing, SystemTimingStats* stats) {
+    memset(stats, 0, sizeof(SystemTimingStats));
+    stats->callCount = timing->callCount;
+    stats->sampleCount = timing->sampleCount;
+    if (timing->sampleCount == 0) {
+        return;
+    }
+    
+    uint32_t lastIndex = (timing->cursor + SYSTEM_STATS_WINDOW - 1) % SYSTEM_STATS_WINDOW;
+    stats->lastUs = timing->samplesUs[lastIndex];
+    stats->lastEntityCount = timing->entityCounts[lastIndex];
+    
+    // Insertion sort a copy of the window for the percentile
+    float sorted[SYSTEM_STATS_WINDOW];
+    double totalUs = 0.0;
+    uint64_t totalEntities = 0;
+    for (uint32_t i = 0; i < timing->sampleCount; i++) {
+        float sample = timing->samplesUs[i];
+        totalUs += sample;
+        totalEntities += timing->entityCounts[i];
+        
+        uint32_t j = i;
+        while (j > 0 && sorted[j - 1] > sample) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = sample;
+    }
+    
+    uint32_t p95Index = (timing->sampleCount * 95 + 99) / 100 - 1;
+    stats->averageUs = (float)(totalUs / timing->sampleCount);
+    stats->p95Us = sorted[p95Index];
+    stats->maxUs = sorted[timing->sampleCount - 1];
+    stats->nsPerEntity = totalEntities > 0 ? (float)(totalUs * 1000.0 / (double)totalEntities) : 0.0f;
+}
+
 // Scene lifecycle
+// Scene-owned arrays outside the pools, charged to the scene budget
+static uint32_t scene_array_bytes(uint32_t maxGameObjects, uint32_t rootObjectCapacity) {
+    return (maxGameObjects * 7 + rootObjectCapacity) * (uint32_t)sizeof(GameObject*);
+}
+
+// Releases everything scene_create may have acquired (pools must be zeroed or initialized)
+static void scene_free_storage(Scene* scene) {
+    object_pool_destroy(&scene->gameObjectPool);
+    for (uint32_t i = 0; i < 8; i++) {
+        object_pool_destroy(&scene->componentPools[i]);
+    }
+    
+    free(scene->gameObjects);
+    free(scene->rootObjects);
+    free(scene->transformComponents);
+    free(scene->spriteComponents);
+    free(scene->collisionComponents);
+    free(scene->animationComponents);
+    free(scene->particleComponents);
+    free(scene->rigidbodyComponents);
+    memory_budget_release(MEMORY_SUBSYSTEM_SCENE,
+                          scene_array_bytes(scene->gameObjectCapacity, scene->rootObjectCapacity));
+    free(scene);
+}
+
 Scene* scene_create(const char* name, uint32_t maxGameObjects) {
     if (maxGameObjects == 0) {
         return NULL;
     }
     
+    // Assume 25% are root objects
+    uint32_t rootObjectCapacity = maxGameObjects / 4;
+    if (rootObjectCapacity < 10) rootObjectCapacity = 10; // Minimum capacity
+    
+    // Over the scene hard limit the scene is refused before allocating
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE,
+                              scene_array_bytes(maxGameObjects, rootObjectCapacity)) != MEMORY_BUDGET_OK) {
+        return NULL;
+    }
+    
     Scene* scene = malloc(sizeof(Scene));
     if (!scene) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, scene_array_bytes(maxGameObjects, rootObjectCapacity));
         return NULL;
     }
     
@@ -28,74 +133,50 @@ Scene* scene_create(const char* name, uint32_t maxGameObjects) {
     scene->state = SCENE_STATE_INACTIVE;
     scene->timeScale = 1.0f;
     scene->gameObjectCapacity = maxGameObjects;
+    scene->rootObjectCapacity = rootObjectCapacity;
     
-    // Allocate GameObject array
-    scene->gameObjects = malloc(maxGameObjects * sizeof(GameObject*));
-    if (!scene->gameObjects) {
-        free(scene);
+    // Allocate GameObject and root object arrays
+    scene->gameObjects = calloc(maxGameObjects, sizeof(GameObject*));
+    scene->rootObjects = calloc(scene->rootObjectCapacity, sizeof(GameObject*));
+    if (!scene->gameObjects || !scene->rootObjects) {
+        scene_free_storage(scene);
         return NULL;
     }
-    memset(scene->gameObjects, 0, maxGameObjects * sizeof(GameObject*));
-    
-    // Initialize root objects array
-    scene->rootObjectCapacity = maxGameObjects / 4; // Assume 25% are root objects
-    if (scene->rootObjectCapacity < 10) scene->rootObjectCapacity = 10; // Minimum capacity
-    scene->rootObjects = malloc(scene->rootObjectCapacity * sizeof(GameObject*));
-    if (!scene->rootObjects) {
-        free(scene->gameObjects);
-        free(scene);
-        return NULL;
-    }
-    memset(scene->rootObjects, 0, scene->rootObjectCapacity * sizeof(GameObject*));
     
     // Initialize GameObject pool
-    PoolResult result = object_pool_init(&scene->gameObjectPool, 
-                                        sizeof(GameObject), 
-                                        maxGameObjects, 
-                                        "SceneGameObjects");
+    PoolResult result = object_pool_init_for_subsystem(&scene->gameObjectPool, MEMORY_SUBSYSTEM_SCENE,
+                                                       sizeof(GameObject), maxGameObjects,
+                                                       "SceneGameObjects");
     if (result != POOL_OK) {
-        free(scene->rootObjects);
-        free(scene->gameObjects);
-        free(scene);
+        scene_free_storage(scene);
         return NULL;
     }
     
-    // Initialize component pools (for basic component types)
-    for (uint32_t i = 0; i < 32; i++) {
-        ComponentType type = 1 << i;
-        if (i < 8) { // Initialize pools for basic types
-            object_pool_init(&scene->componentPools[i], 
-                           64, // Basic component size estimation 
-                           maxGameObjects / 2, // Assume not all objects have every component
-                           "SceneComponent");
+    // Initialize component pools for the basic types (assume not all objects
+    // have every component, 64 bytes is the basic component size estimation)
+    for (uint32_t i = 0; i < 8; i++) {
+        result = object_pool_init_for_subsystem(&scene->componentPools[i], MEMORY_SUBSYSTEM_SCENE,
+                                                64, maxGameObjects / 2, "SceneComponent");
+        if (result == POOL_ERROR_BUDGET_EXCEEDED) {
+            scene_free_storage(scene);
+            return NULL;
         }
     }
     
     // Allocate component arrays for batch processing
-    scene->transformComponents = malloc(maxGameObjects * sizeof(Component*));
-    scene->spriteComponents = malloc(maxGameObjects * sizeof(Component*));
-    scene->collisionComponents = malloc(maxGameObjects * sizeof(Component*));
-    
-    if (!scene->transformComponents || !scene->spriteComponents || !scene->collisionComponents) {
-        // Cleanup on failure
-        if (scene->transformComponents) free(scene->transformComponents);
-        if (scene->spriteComponents) free(scene->spriteComponents);
-        if (scene->collisionComponents) free(scene->collisionComponents);
-        object_pool_destroy(&scene->gameObjectPool);
-        for (uint32_t i = 0; i < 8; i++) {
-            object_pool_destroy(&scene->componentPools[i]);
-        }
-        free(scene->rootObjects);
-        free(scene->gameObjects);
-        free(scene);
+    scene->transformComponents = calloc(maxGameObjects, sizeof(Component*));
+    scene->spriteComponents = calloc(maxGameObjects, sizeof(Component*));
+    scene->collisionComponents = calloc(maxGameObjects, sizeof(Component*));
+    scene->animationComponents = calloc(maxGameObjects, sizeof(Component*));
+    scene->particleComponents = calloc(maxGameObjects, sizeof(Component*));
+    scene->rigidbodyComponents = calloc(maxGameObjects, sizeof(Component*));
+    
+    if (!scene->transformComponents || !scene->spriteComponents || !scene->collisionComponents ||
+        !scene->animationComponents || !scene->particleComponents || !scene->rigidbodyComponents) {
+        scene_free_storage(scene);
         return NULL;
     }
     
-    // Initialize component arrays to NULL
-    memset(scene->transformComponents, 0, maxGameObjects * sizeof(Component*));
-    memset(scene->spriteComponents, 0, maxGameObjects * sizeof(Component*));
-    memset(scene->collisionComponents, 0, maxGameObjects * sizeof(Component*));
-    
     return scene;
 }
 
@@ -115,22 +196,12 @@ void scene_destroy(Scene* scene) {
         }
     }
     
-    // Destroy object pools
-    object_pool_destroy(&scene->gameObjectPool);
-    for (uint32_t i = 0; i < 32; i++) {
-        if (i < 8) { // Only destroy initialized pools
-            object_pool_destroy(&scene->componentPools[i]);
-        }
+    for (uint32_t i = 0; i < scene->systemCount; i++) {
+        free(scene->systems[i].timing);
     }
     
-    // Free arrays
-    free(scene->gameObjects);
-    free(scene->rootObjects);
-    free(scene->transformComponents);
-    free(scene->spriteComponents);
-    free(scene->collisionComponents);
-    
-    free(scene);
+    // Destroy object pools and arrays
+    scene_free_storage(scene);
 }
 
 // Scene state management
@@ -230,6 +301,15 @@ SceneResult scene_add_game_object(Scene* scene, GameObject* gameObject) {
             } else if (component->type == COMPONENT_TYPE_COLLISION && scene->collisionCount < scene->gameObjectCapacity) {
                 scene->collisionComponents[scene->collisionCount] = component;
                 scene->collisionCount++;
+            } else if (component->type == COMPONENT_TYPE_ANIMATION && scene->animationCount < scene->gameObjectCapacity) {
+                scene->animationComponents[scene->animationCount] = component;
+                scene->animationCount++;
+            } else if (component->type == COMPONENT_TYPE_PARTICLES && scene->particleCount < scene->gameObjectCapacity) {
+                scene->particleComponents[scene->particleCount] = component;
+                scene->particleCount++;
+            } else if (component->type == COMPONENT_TYPE_RIGIDBODY && scene->rigidbodyCount < scene->gameObjectCapacity) {
+                scene->rigidbodyComponents[scene->rigidbodyCount] = component;
+                scene->rigidbodyCount++;
             }
         }
     }
@@ -329,7 +409,15 @@ SceneResult scene_register_component_system(Scene* scene, ComponentType type,
     
     if (!system) {
         // Create new system
+        SystemTimingHistory* timing = calloc(1, sizeof(SystemTimingHistory));
+        if (!timing) {
+            return SCENE_ERROR_OUT_OF_MEMORY;
+        }
+        
         system = &scene->systems[scene->systemCount];
+        memset(system, 0, sizeof(ComponentSystem));
+        system->timing = timing;
+        system->passes = SYSTEM_PASS_FRAME;
         scene->systemCount++;
     }
     
@@ -358,26 +446,84 @@ SceneResult scene_enable_component_system(Scene* scene, ComponentType type, bool
     return SCENE_ERROR_SYSTEM_NOT_FOUND;
 }
 
-// Scene updates
-void scene_update(Scene* scene, float deltaTime) {
-    if (!scene || scene->state != SCENE_STATE_ACTIVE) {
-        return;
+SceneResult scene_set_component_system_passes(Scene* scene, ComponentType type, uint32_t passes) {
+    if (!scene) {
+        return SCENE_ERROR_NULL_POINTER;
     }
     
-    clock_t start = clock();
+    ComponentSystem* system = find_system(scene, type);
+    if (!system) {
+        return SCENE_ERROR_SYSTEM_NOT_FOUND;
+    }
     
-    // Apply time scale
-    float scaledDeltaTime = deltaTime * scene->timeScale;
+    system->passes = passes & SYSTEM_PASS_BOTH;
+    return SCENE_OK;
+}
+
+// Per-system statistics and budgets
+SceneResult scene_get_system_stats(const Scene* scene, ComponentType type,
+                                   SystemTimingStats* updateStats, SystemTimingStats* renderStats) {
+    if (!scene) {
+        return SCENE_ERROR_NULL_POINTER;
+    }
     
-    // Update scene time
-    scene->totalTime += scaledDeltaTime;
-    scene->frameCount++;
+    const ComponentSystem* system = find_system(scene, type);
+    if (!system) {
+        return SCENE_ERROR_SYSTEM_NOT_FOUND;
+    }
+    
+    if (updateStats) {
+        summarize_timing_window(&system->timing->update, updateStats);
+    }
+    if (renderStats) {
+        summarize_timing_window(&system->timing->render, renderStats);
+    }
+    
+    return SCENE_OK;
+}
+
+SceneResult scene_set_system_budget(Scene* scene, ComponentType type, float budgetUs,
+                                    SystemBudgetCallback callback, void* userData) {
+    if (!scene) {
+        return SCENE_ERROR_NULL_POINTER;
+    }
     
-    // Run component systems in priority order
+    ComponentSystem* system = find_system(scene, type);
+    if (!system) {
+        return SCENE_ERROR_SYSTEM_NOT_FOUND;
+    }
+    
+    system->budgetUs = budgetUs > 0.0f ? budgetUs : 0.0f;
+    system->onBudgetExceeded = callback;
+    system->budgetUserData = userData;
+    
+    return SCENE_OK;
+}
+
+uint32_t scene_get_system_budget_overruns(const Scene* scene, ComponentType type) {
+    if (!scene) return 0;
+    
+    const ComponentSystem* system = find_system(scene, type);
+    return system ? system->budgetOverruns : 0;
+}
+
+void scene_reset_system_stats(Scene* scene) {
+    if (!scene) return;
+    
+    for (uint32_t i = 0; i < scene->systemCount; i++) {
+        ComponentSystem* system = &scene->systems[i];
+        memset(system->timing, 0, sizeof(SystemTimingHistory));
+        system->budgetOverruns = 0;
+    }
+}
+
+// Runs the systems of one pass in priority order
+static void run_systems(Scene* scene, uint32_t pass, float deltaTime) {
     for (uint32_t priority = 0; priority < 10; priority++) {
         for (uint32_t i = 0; i < scene->systemCount; i++) {
             ComponentSystem* system = &scene->systems[i];
-            if (system->enabled && system->priority == priority && system->updateBatch) {
+            if (system->enabled && system->priority == priority && (system->passes & pass) &&
+                system->updateBatch) {
                 
                 // Get components of this type
                 Component** components = NULL;
@@ -396,26 +542,69 @@ void scene_update(Scene* scene, float deltaTime) {
                         components = scene->collisionComponents;
                         count = scene->collisionCount;
                         break;
+                    case COMPONENT_TYPE_ANIMATION:
+                        components = scene->animationComponents;
+                        count = scene->animationCount;
+                        break;
+                    case COMPONENT_TYPE_PARTICLES:
+                        components = scene->particleComponents;
+                        count = scene->particleCount;
+                        break;
+                    case COMPONENT_TYPE_RIGIDBODY:
+                        components = scene->rigidbodyComponents;
+                        count = scene->rigidbodyCount;
+                        break;
                     default:
                         break;
                 }
                 
                 if (components && count > 0) {
-                    system->updateBatch(components, count, scaledDeltaTime);
+                    PROFILER_COUNTED_ZONE_BEGIN(component_type_to_string(system->type));
+                    uint64_t systemStart = profiler_get_time_ns();
+                    system->updateBatch(components, count, deltaTime);
+                    record_system_sample(scene, system, &system->timing->update,
+                                         profiler_get_time_ns() - systemStart, count);
+                    PROFILER_ZONE_END();
                 }
             }
         }
     }
+}
+
+// Scene updates
+void scene_update(Scene* scene, float deltaTime) {
+    if (!scene || scene->state != SCENE_STATE_ACTIVE) {
+        return;
+    }
+    
+    PROFILER_ZONE_BEGIN("scene_update");
+    uint64_t start = profiler_get_time_ns();
     
-    clock_t end = clock();
-    scene->lastUpdateTime = ((float)(end - start)) / CLOCKS_PER_SEC * 1000.0f; // milliseconds
+    // Apply time scale
+    float scaledDeltaTime = deltaTime * scene->timeScale;
+    
+    // Update scene time
+    scene->totalTime += scaledDeltaTime;
+    scene->frameCount++;
+    
+    // Run per-frame component systems in priority order
+    run_systems(scene, SYSTEM_PASS_FRAME, scaledDeltaTime);
+    
+    uint64_t end = profiler_get_time_ns();
+    scene->lastUpdateTime = (float)(end - start) / 1000000.0f; // milliseconds
+    PROFILER_ZONE_END();
 }
 
 void scene_fixed_update(Scene* scene, float fixedDeltaTime) {
-    // For now, just call regular update - can be extended later for physics
-    if (scene && scene->state == SCENE_STATE_ACTIVE) {
-        scene_update(scene, fixedDeltaTime);
+    if (!scene || scene->state != SCENE_STATE_ACTIVE) {
+        return;
     }
+    
+    // Only the systems that step with the simulation; the frame's own
+    // scene_update covers per-frame systems, so they see each second once
+    PROFILER_ZONE_BEGIN("scene_fixed_update");
+    run_systems(scene, SYSTEM_PASS_FIXED, fixedDeltaTime * scene->timeScale);
+    PROFILER_ZONE_END();
 }
 
 void scene_render(Scene* scene) {
@@ -423,7 +612,8 @@ void scene_render(Scene* scene) {
         return;
     }
     
-    clock_t start = clock();
+    PROFILER_ZONE_BEGIN("scene_render");
+    uint64_t start = profiler_get_time_ns();
     
     // Run render systems
     for (uint32_t i = 0; i < scene->systemCount; i++) {
@@ -438,18 +628,28 @@ void scene_render(Scene* scene) {
                     components = scene->spriteComponents;
                     count = scene->spriteCount;
                     break;
+                case COMPONENT_TYPE_PARTICLES:
+                    components = scene->particleComponents;
+                    count = scene->particleCount;
+                    break;
                 default:
                     break;
             }
             
             if (components && count > 0) {
+                PROFILER_COUNTED_ZONE_BEGIN(component_type_to_string(system->type));
+                uint64_t systemStart = profiler_get_time_ns();
                 system->renderBatch(components, count);
+                record_system_sample(scene, system, &system->timing->render,
+                                     profiler_get_time_ns() - systemStart, count);
+                PROFILER_ZONE_END();
             }
         }
     }
     
-    clock_t end = clock();
-    scene->lastRenderTime = ((float)(end - start)) / CLOCKS_PER_SEC * 1000.0f; // milliseconds
+    uint64_t end = profiler_get_time_ns();
+    scene->lastRenderTime = (float)(end - start) / 1000000.0f; // milliseconds
+    PROFILER_ZONE_END();
 }
 
 // Batch operations
@@ -458,7 +658,9 @@ void scene_update_transforms(Scene* scene, float deltaTime) {
     
     // Use the registered transform system for batch processing
     if (scene->transformCount > 0) {
+        PROFILER_ZONE_BEGIN("transform_system_update_batch");
         transform_system_update_batch(scene->transformComponents, scene->transformCount, deltaTime);
+        PROFILER_ZONE_END();
     }
 }
 
@@ -467,7 +669,9 @@ void scene_update_sprites(Scene* scene, float deltaTime) {
     
     // Use the registered sprite system for batch processing
     if (scene->spriteCount > 0) {
+        PROFILER_ZONE_BEGIN("sprite_system_update_batch");
         sprite_system_update_batch(scene->spriteComponents, scene->spriteCount, deltaTime);
+        PROFILER_ZONE_END();
     }
 }
 
@@ -476,7 +680,9 @@ void scene_render_sprites(Scene* scene) {
     
     // Use the registered sprite system for batch rendering
     if (scene->spriteCount > 0) {
+        PROFILER_ZONE_BEGIN("sprite_system_render_batch");
         sprite_system_render_batch(scene->spriteComponents, scene->spriteCount);
+        PROFILER_ZONE_END();
     }
 }
 
@@ -509,13 +715,37 @@ void scene_print_stats(const Scene* scene) {
     printf("GameObjects: %u / %u\n", scene->gameObjectCount, scene->gameObjectCapacity);
     printf("Active Objects: %u\n", scene->activeObjectCount);
     printf("Root Objects: %u / %u\n", scene->rootObjectCount, scene->rootObjectCapacity);
-    printf("Components - Transform: %u, Sprite: %u, Collision: %u\n", 
-           scene->transformCount, scene->spriteCount, scene->collisionCount);
+    printf("Components - Transform: %u, Sprite: %u, Collision: %u, Animation: %u, Particles: %u, RigidBody: %u\n", 
+           scene->transformCount, scene->spriteCount, scene->collisionCount, scene->animationCount,
+           scene->particleCount, scene->rigidbodyCount);
     printf("Time Scale: %.2f\n", scene->timeScale);
     printf("Total Time: %.2f\n", scene->totalTime);
     printf("Frames: %u\n", scene->frameCount);
     printf("Last Update: %.3f ms\n", scene->lastUpdateTime);
     printf("Last Render: %.3f ms\n", scene->lastRenderTime);
+    
+    for (uint32_t i = 0; i < scene->systemCount; i++) {
+        const ComponentSystem* system = &scene->systems[i];
+        SystemTimingStats update, render;
+        summarize_timing_window(&system->timing->update, &update);
+        summarize_timing_window(&system->timing->render, &render);
+        
+        printf("System %s (priority %u%s):\n", component_type_to_string(system->type),
+               system->priority, system->enabled ? "" : ", disabled");
+        printf("  Update: last %.2f us, avg %.2f us, p95 %.2f us, max %.2f us, "
+               "%u entities, %.1f ns/entity\n",
+               update.lastUs, update.averageUs, update.p95Us, update.maxUs,
+               update.lastEntityCount, update.nsPerEntity);
+        if (render.callCount > 0) {
+            printf("  Render: last %.2f us, avg %.2f us, p95 %.2f us, max %.2f us, "
+                   "%u entities, %.1f ns/entity\n",
+                   render.lastUs, render.averageUs, render.p95Us, render.maxUs,
+                   render.lastEntityCount, render.nsPerEntity);
+        }
+        if (system->budgetUs > 0.0f) {
+            printf("  Budget: %.2f us, %u overruns\n", system->budgetUs, system->budgetOverruns);
+        }
+    }
     printf("========================\n");
 }
 
@@ -525,7 +755,8 @@ uint32_t scene_get_memory_usage(const Scene* scene) {
     uint32_t usage = sizeof(Scene);
     usage += scene->gameObjectCapacity * sizeof(GameObject*); // gameObjects array
     usage += scene->rootObjectCapacity * sizeof(GameObject*); // rootObjects array
-    usage += scene->gameObjectCapacity * sizeof(Component*) * 3; // component arrays
+    usage += scene->gameObjectCapacity * sizeof(Component*) * 6; // component arrays
+    usage += scene->systemCount * sizeof(SystemTimingHistory); // per-system timing
     
     // Add pool memory usage (estimate)
     usage += scene->gameObjectCapacity * sizeof(GameObject); // GameObject pool
@@ -540,6 +771,9 @@ void scene_rebuild_component_arrays(Scene* scene) {
     scene->transformCount = 0;
     scene->spriteCount = 0;
     scene->collisionCount = 0;
+    scene->animationCount = 0;
+    scene->particleCount = 0;
+    scene->rigidbodyCount = 0;
     
     for (uint32_t i = 0; i < scene->gameObjectCount; i++) {
         GameObject* gameObject = scene->gameObjects[i];
@@ -562,6 +796,15 @@ void scene_rebuild_component_arrays(Scene* scene) {
             } else if (component->type == COMPONENT_TYPE_COLLISION && scene->collisionCount < scene->gameObjectCapacity) {
                 scene->collisionComponents[scene->collisionCount] = component;
                 scene->collisionCount++;
+            } else if (component->type == COMPONENT_TYPE_ANIMATION && scene->animationCount < scene->gameObjectCapacity) {
+                scene->animationComponents[scene->animationCount] = component;
+                scene->animationCount++;
+            } else if (component->type == COMPONENT_TYPE_PARTICLES && scene->particleCount < scene->gameObjectCapacity) {
+                scene->particleComponents[scene->particleCount] = component;
+                scene->particleCount++;
+            } else if (component->type == COMPONENT_TYPE_RIGIDBODY && scene->rigidbodyCount < scene->gameObjectCapacity) {
+                scene->rigidbodyComponents[scene->rigidbodyCount] = component;
+                scene->rigidbodyCount++;
             }
         }
     }
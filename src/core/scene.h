@@ -10,6 +10,7 @@
 
 #define MAX_GAMEOBJECTS_PER_SCENE 10000
 #define SCENE_INVALID_ID 0
+#define SYSTEM_STATS_WINDOW 64      // Frames kept for rolling system statistics
 
 // Forward declarations
 typedef struct Scene Scene;
@@ -24,6 +25,44 @@ typedef enum {
     SCENE_STATE_UNLOADING
 } SceneState;
 
+// Called when a system pass takes longer than its budget
+typedef void (*SystemBudgetCallback)(Scene* scene, ComponentType type,
+                                     float elapsedUs, float budgetUs, void* userData);
+
+// Rolling window of per-pass samples (update or render)
+typedef struct SystemTimingWindow {
+    float samplesUs[SYSTEM_STATS_WINDOW];        // Elapsed time per call
+    uint32_t entityCounts[SYSTEM_STATS_WINDOW];  // Components processed per call
+    uint32_t cursor;                             // Next sample slot
+    uint32_t sampleCount;                        // Valid samples (<= window)
+    uint32_t callCount;                          // Lifetime number of calls
+} SystemTimingWindow;
+
+// Timing history for one registered system (allocated on registration)
+typedef struct SystemTimingHistory {
+    SystemTimingWindow update;
+    SystemTimingWindow render;
+} SystemTimingHistory;
+
+// Summary computed from a SystemTimingWindow
+typedef struct SystemTimingStats {
+    float lastUs;
+    float averageUs;
+    float p95Us;
+    float maxUs;
+    uint32_t lastEntityCount;
+    float nsPerEntity;
+    uint32_t callCount;
+    uint32_t sampleCount;
+} SystemTimingStats;
+
+// Which scene updates run a system (bits)
+typedef enum {
+    SYSTEM_PASS_FRAME = 1 << 0,                // scene_update: once per frame, with the frame's time
+    SYSTEM_PASS_FIXED = 1 << 1,                // scene_fixed_update: once per fixed step
+    SYSTEM_PASS_BOTH = SYSTEM_PASS_FRAME | SYSTEM_PASS_FIXED
+} SystemPass;
+
 // Component system information
 typedef struct ComponentSystem {
     ComponentType type;
@@ -31,6 +70,14 @@ typedef struct ComponentSystem {
     void (*renderBatch)(Component** components, uint32_t count);
     bool enabled;
     uint32_t priority; // Lower numbers update first
+    uint32_t passes;   // SystemPass bits; SYSTEM_PASS_FRAME when registered
+    
+    // Per-system cost tracking
+    SystemTimingHistory* timing;
+    float budgetUs;                           // 0 = no budget
+    uint32_t budgetOverruns;
+    SystemBudgetCallback onBudgetExceeded;
+    void* budgetUserData;
 } ComponentSystem;
 
 // Scene structure
@@ -56,9 +103,15 @@ typedef struct Scene {
     Component** transformComponents;          // All transform components
     Component** spriteComponents;             // All sprite components
     Component** collisionComponents;          // All collision components
+    Component** animationComponents;          // All animation components
+    Component** particleComponents;           // All particle emitters
+    Component** rigidbodyComponents;          // All rigid bodies
     uint32_t transformCount;
     uint32_t spriteCount;
     uint32_t collisionCount;
+    uint32_t animationCount;
+    uint32_t particleCount;
+    uint32_t rigidbodyCount;
     
     // Scene hierarchy root objects (objects with no parent)
     GameObject** rootObjects;
@@ -116,8 +169,18 @@ SceneResult scene_register_component_system(Scene* scene, ComponentType type,
                                            void (*renderBatch)(Component**, uint32_t),
                                            uint32_t priority);
 SceneResult scene_enable_component_system(Scene* scene, ComponentType type, bool enabled);
-
-// Scene updates (called by SceneManager)
+SceneResult scene_set_component_system_passes(Scene* scene, ComponentType type, uint32_t passes);
+
+// Per-system statistics and budgets
+SceneResult scene_get_system_stats(const Scene* scene, ComponentType type,
+                                   SystemTimingStats* updateStats, SystemTimingStats* renderStats);
+SceneResult scene_set_system_budget(Scene* scene, ComponentType type, float budgetUs,
+                                    SystemBudgetCallback callback, void* userData);
+uint32_t scene_get_system_budget_overruns(const Scene* scene, ComponentType type);
+void scene_reset_system_stats(Scene* scene);
+
+// Scene updates (called by SceneManager). A frame runs any number of
+// fixed updates, then one update; each system runs only in its passes.
 void scene_update(Scene* scene, float deltaTime);
 void scene_fixed_update(Scene* scene, float fixedDeltaTime);
 void scene_render(Scene* scene);
@@ -1,4 +1,6 @@
 #include "scene_manager.h"
+#include "../profiling/profiler.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -16,6 +18,8 @@ SceneManager* scene_manager_create(void) {
     manager->globalTimeScale = 1.0f;
     manager->fixedTimeStep = 1.0f / 60.0f; // 60 FPS default
     manager->accumulatedTime = 0.0f;
+    manager->maxFixedStepsPerFrame = SCENE_MANAGER_NO_FIXED_STEP_CAP;
+    frame_time_recorder_reset(&manager->frameTiming);
     
     return manager;
 }
@@ -166,10 +170,35 @@ Scene* scene_manager_get_active_scene(SceneManager* manager) {
     return manager ? manager->activeScene : NULL;
 }
 
+// Disarms the tracker and reports frames that allocated against the policy
+static void check_frame_allocations(SceneManager* manager) {
+    AllocTrackerReport report;
+    uint32_t violations = alloc_tracker_end(&report);
+    if (violations == 0) {
+        return;
+    }
+    
+    manager->lastAllocReport = report;
+    manager->allocViolationFrames++;
+    manager->allocViolations += violations;
+    
+    if (manager->allocCheckMode == SCENE_ALLOC_CHECK_ASSERT || manager->allocViolationFrames == 1) {
+        printf("WARNING: scene_manager_update allocated during a steady-state frame\n");
+        alloc_tracker_print_report(&manager->lastAllocReport, stdout);
+    }
+    assert(manager->allocCheckMode != SCENE_ALLOC_CHECK_ASSERT && "allocation inside scene_manager_update");
+}
+
 // Main update loop
 void scene_manager_update(SceneManager* manager, float deltaTime) {
     if (!manager) return;
     
+    bool checkAllocations = manager->allocCheckMode != SCENE_ALLOC_CHECK_OFF &&
+        alloc_tracker_begin("scene_manager_update", manager->allocCheckPolicy) == ALLOC_TRACKER_OK;
+    
+    PROFILER_ZONE_BEGIN("scene_manager_update");
+    uint64_t frameStart = profiler_get_time_ns();
+    
     // Apply global time scale
     float scaledDeltaTime = deltaTime * manager->globalTimeScale;
     
@@ -177,13 +206,28 @@ void scene_manager_update(SceneManager* manager, float deltaTime) {
     manager->accumulatedTime += scaledDeltaTime;
     
     // Process fixed updates while we have enough accumulated time
-    while (manager->accumulatedTime >= manager->fixedTimeStep) {
+    uint32_t stepsRun = 0;
+    uint32_t maxSteps = manager->maxFixedStepsPerFrame;
+    while (manager->accumulatedTime >= manager->fixedTimeStep &&
+           (maxSteps == SCENE_MANAGER_NO_FIXED_STEP_CAP || stepsRun < maxSteps)) {
         if (manager->activeScene) {
+            uint64_t stepStart = profiler_get_time_ns();
             scene_fixed_update(manager->activeScene, manager->fixedTimeStep);
+            frame_time_recorder_record(&manager->frameTiming, FRAME_METRIC_FIXED_STEP,
+                                       profiler_get_time_ns() - stepStart);
         }
         manager->accumulatedTime -= manager->fixedTimeStep;
+        stepsRun++;
     }
     
+    // Drop whole steps beyond the cap, keep the fractional remainder
+    uint32_t stepsDropped = 0;
+    if (manager->accumulatedTime >= manager->fixedTimeStep) {
+        stepsDropped = (uint32_t)(manager->accumulatedTime / manager->fixedTimeStep);
+        manager->accumulatedTime -= stepsDropped * manager->fixedTimeStep;
+    }
+    frame_time_recorder_record_fixed_steps(&manager->frameTiming, stepsRun, stepsDropped);
+    
     // Variable timestep update
     if (manager->activeScene) {
         scene_update(manager->activeScene, scaledDeltaTime);
@@ -198,15 +242,30 @@ void scene_manager_update(SceneManager* manager, float deltaTime) {
             manager->loadingScene = NULL;
         }
     }
+    
+    frame_time_recorder_record(&manager->frameTiming, FRAME_METRIC_UPDATE,
+                               profiler_get_time_ns() - frameStart);
+    PROFILER_ZONE_END();
+    
+    if (checkAllocations) {
+        check_frame_allocations(manager);
+    }
 }
 
 void scene_manager_render(SceneManager* manager) {
     if (!manager) return;
     
+    PROFILER_ZONE_BEGIN("scene_manager_render");
+    uint64_t renderStart = profiler_get_time_ns();
+    
     // Render active scene
     if (manager->activeScene) {
         scene_render(manager->activeScene);
     }
+    
+    frame_time_recorder_record(&manager->frameTiming, FRAME_METRIC_RENDER,
+                               profiler_get_time_ns() - renderStart);
+    PROFILER_ZONE_END();
 }
 
 // Global settings
@@ -222,4 +281,40 @@ void scene_manager_set_fixed_timestep(SceneManager* manager, float fixedTimeStep
         // Reset accumulated time to prevent large jumps
         manager->accumulatedTime = 0.0f;
     }
-}
\ No newline at end of file
+}
+
+void scene_manager_set_max_fixed_steps(SceneManager* manager, uint32_t maxSteps) {
+    if (manager) {
+        manager->maxFixedStepsPerFrame = maxSteps;
+    }
+}
+
+// Frame-time telemetry
+const FrameTimeRecorder* scene_manager_get_frame_timing(const SceneManager* manager) {
+    return manager ? &manager->frameTiming : NULL;
+}
+
+void scene_manager_reset_frame_timing(SceneManager* manager) {
+    if (manager) {
+        frame_time_recorder_reset(&manager->frameTiming);
+    }
+}
+
+// Allocation check
+void scene_manager_set_alloc_check(SceneManager* manager, SceneAllocCheckMode mode, uint32_t policy) {
+    if (!manager) return;
+    
+    manager->allocCheckMode = mode;
+    manager->allocCheckPolicy = policy;
+    manager->allocViolationFrames = 0;
+    manager->allocViolations = 0;
+    memset(&manager->lastAllocReport, 0, sizeof(AllocTrackerReport));
+}
+
+uint32_t scene_manager_get_alloc_violation_frames(const SceneManager* manager) {
+    return manager ? manager->allocViolationFrames : 0;
+}
+
+const AllocTrackerReport* scene_manager_get_last_alloc_report(const SceneManager* manager) {
+    return manager && manager->allocViolationFrames > 0 ? &manager->lastAllocReport : NULL;
+}
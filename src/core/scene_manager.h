@@ -2,8 +2,18 @@
 #define SCENE_MANAGER_H
 
 #include "scene.h"
+#include "../profiling/frame_timing.h"
+#include "../profiling/alloc_tracker.h"
 
 #define MAX_SCENES 16
+#define SCENE_MANAGER_NO_FIXED_STEP_CAP 0u       // Every accumulated fixed step runs
+
+// Zero-allocation check for scene_manager_update (see alloc_tracker.h)
+typedef enum {
+    SCENE_ALLOC_CHECK_OFF = 0,
+    SCENE_ALLOC_CHECK_REPORT,           // Count violations, print the first offending frame
+    SCENE_ALLOC_CHECK_ASSERT            // Print the report and assert
+} SceneAllocCheckMode;
 
 typedef struct SceneManager {
     Scene* scenes[MAX_SCENES];
@@ -15,6 +25,17 @@ typedef struct SceneManager {
     float globalTimeScale;
     float fixedTimeStep;
     float accumulatedTime;
+    uint32_t maxFixedStepsPerFrame;     // 0 = no cap; excess steps are dropped, not deferred
+    
+    // Frame-time telemetry
+    FrameTimeRecorder frameTiming;
+    
+    // Allocation check
+    SceneAllocCheckMode allocCheckMode;
+    uint32_t allocCheckPolicy;          // ALLOC_TRACK_* bits
+    uint32_t allocViolationFrames;      // Frames that allocated against the policy
+    uint64_t allocViolations;           // Total offending events
+    AllocTrackerReport lastAllocReport; // Most recent offending frame
     
 } SceneManager;
 
@@ -38,5 +59,15 @@ void scene_manager_render(SceneManager* manager);
 // Global settings
 void scene_manager_set_time_scale(SceneManager* manager, float timeScale);
 void scene_manager_set_fixed_timestep(SceneManager* manager, float fixedTimeStep);
+void scene_manager_set_max_fixed_steps(SceneManager* manager, uint32_t maxSteps);   // Opt-in spiral-of-death guard
+
+// Frame-time telemetry
+const FrameTimeRecorder* scene_manager_get_frame_timing(const SceneManager* manager);
+void scene_manager_reset_frame_timing(SceneManager* manager);
+
+// Allocation check (frames already inside a tracking scope are not re-armed)
+void scene_manager_set_alloc_check(SceneManager* manager, SceneAllocCheckMode mode, uint32_t policy);
+uint32_t scene_manager_get_alloc_violation_frames(const SceneManager* manager);
+const AllocTrackerReport* scene_manager_get_last_alloc_report(const SceneManager* manager);
 
 #endif // SCENE_MANAGER_H
\ No newline at end of file
@@ -1,6 +1,22 @@
 #include "update_systems.h"
 #include "../components/transform_component.h"
+#include "../components/animation_component.h"
+#include "../components/particle_component.h"
+#include "../components/sprite_component.h"
+#include "../graphics/band_renderer.h"
+#include "../graphics/dirty_rect.h"
+#include "../graphics/render_queue.h"
+#include "../graphics/sprite_cache.h"
+#include "../systems/collision_system.h"
+#include "../systems/rigidbody_system.h"
+#include "component_registry.h"
 #include <assert.h>
+#include <math.h>
+
+// Sprite render commands and culling results, grown to the largest counts seen
+static RenderQueue g_spriteQueue;
+static SpatialQuery* g_cullQuery = NULL;
+static BandRenderer* g_bandRenderer = NULL;
 
 void transform_system_update_batch(Component** components, uint32_t count, float deltaTime) {
     if (!components || count == 0) return;
@@ -34,77 +50,316 @@ void sprite_system_update_batch(Component** components, uint32_t count, float de
     }
 }
 
+// Queues one sprite if its bounds overlap the camera. Transform matrices
+// are only refreshed for sprites that pass.
+static void sprite_submit(Component* component, int32_t cameraX, int32_t cameraY, int32_t viewWidth, int32_t viewHeight) {
+    GameObject* gameObject = component->gameObject;
+    if (!component->enabled || !gameObject || !gameObject->transform) return;
+
+    // Sprite types with a custom layout draw themselves
+    if (!sprite_component_is_sprite(component)) {
+        component_call_render(component);
+        return;
+    }
+
+    SpriteComponent* sprite = (SpriteComponent*)component;
+    if (!sprite->visible || !sprite->bitmap) return;
+
+    int32_t x, y;
+    sprite_component_get_screen_position(sprite, &x, &y);
+    x -= cameraX;
+    y -= cameraY;
+    int32_t width = (int32_t)sprite->bitmap->width;
+    int32_t height = (int32_t)sprite->bitmap->height;
+    if (x >= viewWidth || y >= viewHeight || x + width <= 0 || y + height <= 0) return;
+
+    // Ensure transform matrix is up to date
+    TransformComponent* transform = gameObject->transform;
+    if (transform->matrixDirty) {
+        transform_component_calculate_matrix(transform);
+    }
+
+    uint64_t key = render_key_make(sprite->layer, sprite->z, sprite->bitmap->atlasId,
+                                   (BlitMode)sprite->drawMode, y + height);
+    render_queue_submit(&g_spriteQueue, key, sprite->bitmap, x, y);
+}
+
+// Whole-screen passes may split into bands; dirty regions are too small
+// to be worth waking the workers for
+static void sprite_queue_draw(Framebuffer* target, bool banded) {
+    render_queue_sort(&g_spriteQueue);
+    if (banded && g_bandRenderer) {
+        band_renderer_execute(g_bandRenderer, &g_spriteQueue, target);
+    } else {
+        render_queue_execute(&g_spriteQueue, target);
+    }
+}
+
 void sprite_system_render_batch(Component** components, uint32_t count) {
     if (!components || count == 0) return;
-    
-    // Batch render all visible sprites
-    // Note: In a real implementation, this would be optimized with:
-    // - Z-order sorting
-    // - Frustum culling
-    // - Texture atlas batching
-    // - Draw call minimization
-    
+
+    Framebuffer* target = framebuffer_get_render_target();
+    if (!target || render_queue_reserve(&g_spriteQueue, count) != RENDER_QUEUE_OK) return;
+
+    // One command per on-screen sprite: sorted by layer, z, atlas and mode,
+    // bottom edge, then drawn in batches that share atlas and mode
+    render_queue_clear(&g_spriteQueue);
     for (uint32_t i = 0; i < count; i++) {
         Component* component = components[i];
-        if (component && component->enabled && component->type == COMPONENT_TYPE_SPRITE) {
-            // Get the transform for positioning
-            GameObject* gameObject = component->gameObject;
-            if (gameObject && gameObject->transform) {
-                TransformComponent* transform = gameObject->transform;
-                
-                // Ensure transform matrix is up to date
-                if (transform->matrixDirty) {
-                    transform_component_calculate_matrix(transform);
-                }
-                
-                // Call component's render function
-                component_call_render(component);
+        if (component && component->type == COMPONENT_TYPE_SPRITE) {
+            sprite_submit(component, 0, 0, (int32_t)target->width, (int32_t)target->height);
+        }
+    }
+    sprite_queue_draw(target, true);
+}
+
+uint32_t sprite_system_render_culled(Scene* scene, SpatialGrid* grid, const RenderCamera* camera) {
+    Framebuffer* target = framebuffer_get_render_target();
+    if (!scene || !camera || !target) return 0;
+
+    int32_t cameraX = (int32_t)lrintf(camera->x);
+    int32_t cameraY = (int32_t)lrintf(camera->y);
+    int32_t viewWidth = (int32_t)camera->width;
+    int32_t viewHeight = (int32_t)camera->height;
+
+    if (!grid || !grid->enableFrustumCulling) {
+        if (render_queue_reserve(&g_spriteQueue, scene->spriteCount) != RENDER_QUEUE_OK) return 0;
+
+        render_queue_clear(&g_spriteQueue);
+        for (uint32_t i = 0; i < scene->spriteCount; i++) {
+            Component* component = scene->spriteComponents[i];
+            if (component && component->type == COMPONENT_TYPE_SPRITE) {
+                sprite_submit(component, cameraX, cameraY, viewWidth, viewHeight);
             }
         }
+        sprite_queue_draw(target, true);
+        return g_spriteQueue.count;
     }
+
+    // The query finds positions; widen it by the largest sprite extent so
+    // sprites whose centre is off screen but whose edge is visible are kept
+    if (!g_cullQuery || g_cullQuery->maxResults < grid->totalObjects) {
+        uint32_t capacity = g_cullQuery ? g_cullQuery->maxResults : 64;
+        while (capacity < grid->totalObjects) capacity *= 2;
+        spatial_query_destroy(g_cullQuery);
+        g_cullQuery = spatial_query_create(capacity);
+        if (!g_cullQuery) return 0;
+    }
+    float margin = (float)sprite_component_get_max_extent() + 1.0f;
+    uint32_t found = spatial_grid_query_rectangle(grid, (float)cameraX - margin, (float)cameraY - margin,
+                                                  camera->width + 2.0f * margin, camera->height + 2.0f * margin,
+                                                  g_cullQuery);
+    if (render_queue_reserve(&g_spriteQueue, found ? found : 1) != RENDER_QUEUE_OK) return 0;
+
+    render_queue_clear(&g_spriteQueue);
+    for (uint32_t i = 0; i < found; i++) {
+        GameObject* gameObject = g_cullQuery->results[i];
+        if (!game_object_has_component(gameObject, COMPONENT_TYPE_SPRITE)) continue;
+
+        Component* component = game_object_get_component(gameObject, COMPONENT_TYPE_SPRITE);
+        if (component) {
+            sprite_submit(component, cameraX, cameraY, viewWidth, viewHeight);
+        }
+    }
+    sprite_queue_draw(target, true);
+    return g_spriteQueue.count;
 }
 
-void collision_system_update_batch(Component** components, uint32_t count, float deltaTime) {
-    if (!components || count == 0) return;
-    
-    // Update collision bounds, spatial partitioning, etc.
-    // Phase 1: Update all collision component bounds
-    for (uint32_t i = 0; i < count; i++) {
-        Component* component = components[i];
-        if (component && component->enabled && component->type == COMPONENT_TYPE_COLLISION) {
-            // Update collision component
-            component_call_update(component, deltaTime);
+static int16_t clamp_i16(int32_t value) {
+    return (int16_t)(value < INT16_MIN ? INT16_MIN : value > INT16_MAX ? INT16_MAX : value);
+}
+
+static bool dirty_state_is_drawn(const DirtySpriteState* state) {
+    return state->x0 < state->x1 && state->y0 < state->y1;
+}
+
+static void dirty_state_add(DirtyRectTracker* tracker, const DirtySpriteState* state) {
+    if (dirty_state_is_drawn(state)) {
+        dirty_rect_tracker_add(tracker, state->x0, state->y0, state->x1 - state->x0, state->y1 - state->y0);
+    }
+}
+
+// Records one sprite's old and new bounds if it changed since the last pass
+static void sprite_track_dirty(DirtyRectTracker* tracker, DirtySpriteState* state, SpriteComponent* sprite) {
+    Component* component = &sprite->base;
+    TransformComponent* transform = component->gameObject ? component->gameObject->transform : NULL;
+    bool wasDrawn = dirty_state_is_drawn(state);
+    bool changed = transform && transform->renderDirty;
+
+    // A different sprite in the slot: the old one is gone
+    if (state->componentId != component->id) {
+        state->componentId = component->id;
+        changed = true;
+    }
+    state->lastSeen = tracker->pass;
+
+    bool drawable = component->enabled && transform && sprite->visible && sprite->bitmap;
+    if (!changed && drawable == wasDrawn) return;
+
+    dirty_state_add(tracker, state);
+    if (drawable) {
+        int32_t x, y;
+        sprite_component_get_screen_position(sprite, &x, &y);
+        state->x0 = clamp_i16(x);
+        state->y0 = clamp_i16(y);
+        state->x1 = clamp_i16(x + (int32_t)sprite->bitmap->width);
+        state->y1 = clamp_i16(y + (int32_t)sprite->bitmap->height);
+        dirty_state_add(tracker, state);
+    } else {
+        state->x0 = state->y0 = state->x1 = state->y1 = 0;
+    }
+
+    bool isDrawn = dirty_state_is_drawn(state);
+    if (isDrawn && !wasDrawn) {
+        tracker->drawnSprites++;
+    } else if (!isDrawn && wasDrawn) {
+        tracker->drawnSprites--;
+    }
+    if (transform) transform->renderDirty = false;
+}
+
+uint32_t sprite_system_render_dirty(Scene* scene, DirtyRectTracker* tracker) {
+    Framebuffer* target = framebuffer_get_render_target();
+    ObjectPool* pool = component_registry_get_pool(COMPONENT_TYPE_SPRITE);
+    if (!scene || !tracker || !target || !pool) return 0;
+    if (dirty_rect_tracker_reserve_sprites(tracker, pool->capacity) != DIRTY_RECT_OK) return 0;
+
+    // Collect changed rectangles; unchanged sprites cost one flag check
+    dirty_rect_tracker_begin(tracker);
+    uint32_t visitedDrawn = 0;
+    for (uint32_t i = 0; i < scene->spriteCount; i++) {
+        Component* component = scene->spriteComponents[i];
+        if (!component || !sprite_component_is_sprite(component)) continue;
+
+        DirtySpriteState* state = &tracker->sprites[object_pool_get_object_index(pool, component)];
+        sprite_track_dirty(tracker, state, (SpriteComponent*)component);
+        if (dirty_state_is_drawn(state)) visitedDrawn++;
+    }
+
+    // Sprites drawn last pass that were not visited were removed
+    if (visitedDrawn != tracker->drawnSprites) {
+        for (uint32_t slot = 0; slot < tracker->spriteCapacity; slot++) {
+            DirtySpriteState* state = &tracker->sprites[slot];
+            if (state->lastSeen != tracker->pass && dirty_state_is_drawn(state)) {
+                dirty_state_add(tracker, state);
+                state->x0 = state->y0 = state->x1 = state->y1 = 0;
+                tracker->drawnSprites--;
+            }
         }
     }
-    
-    // Phase 2: Broad-phase collision detection (will be implemented in Phase 5)
-    // This would involve:
-    // - Spatial partitioning updates
-    // - AABB collision checks
-    // - Narrow-phase collision detection
-    
-    // Phase 3: Collision resolution (will be implemented in Phase 5)
-    // This would handle:
-    // - Collision response
-    // - Trigger events
-    // - Physics integration
+
+    uint32_t regionCount = dirty_rect_tracker_build_regions(tracker);
+    if (regionCount == 0) return 0;
+    if (render_queue_reserve(&g_spriteQueue, scene->spriteCount ? scene->spriteCount : 1) != RENDER_QUEUE_OK) {
+        return 0;
+    }
+
+    // Clear and redraw each region through a view; every sprite overlapping
+    // it is drawn again, clipped to the region
+    uint32_t drawn = 0;
+    for (uint32_t r = 0; r < regionCount; r++) {
+        const DirtyRegion* region = &tracker->regions[r];
+        int32_t regionX = (int32_t)region->wordStart * BITMAP_WORD_BITS;
+        Framebuffer view;
+        if (framebuffer_init_view(&view, target, (uint32_t)regionX, region->y0,
+                                  (uint32_t)(region->wordEnd - region->wordStart) * BITMAP_WORD_BITS,
+                                  (uint32_t)(region->y1 - region->y0)) != FRAMEBUFFER_OK) {
+            continue;
+        }
+        framebuffer_clear(&view, tracker->background);
+
+        int32_t regionX1 = regionX + (int32_t)view.width;
+        render_queue_clear(&g_spriteQueue);
+        for (uint32_t i = 0; i < scene->spriteCount; i++) {
+            Component* component = scene->spriteComponents[i];
+            if (!component || !sprite_component_is_sprite(component)) continue;
+
+            const DirtySpriteState* state = &tracker->sprites[object_pool_get_object_index(pool, component)];
+            if (!dirty_state_is_drawn(state) || state->x0 >= regionX1 || state->x1 <= regionX ||
+                state->y0 >= (int32_t)region->y1 || state->y1 <= (int32_t)region->y0) {
+                continue;
+            }
+            sprite_submit(component, regionX, region->y0, (int32_t)view.width, (int32_t)view.height);
+        }
+        sprite_queue_draw(&view, false);
+        drawn += g_spriteQueue.count;
+    }
+    return drawn;
+}
+
+void sprite_system_shutdown(void) {
+    render_queue_destroy(&g_spriteQueue);
+    spatial_query_destroy(g_cullQuery);
+    g_cullQuery = NULL;
+    g_bandRenderer = NULL;
+}
+
+void sprite_system_set_sprite_cache(SpriteCache* cache) {
+    render_queue_set_sprite_cache(&g_spriteQueue, cache);
+}
+
+void sprite_system_set_band_renderer(BandRenderer* renderer) {
+    g_bandRenderer = renderer;
+}
+
+const RenderQueue* sprite_system_get_render_queue(void) {
+    return &g_spriteQueue;
+}
+
+void rigidbody_system_update_batch(Component** components, uint32_t count, float deltaTime) {
+    if (!components || count == 0 || !components[0] || !components[0]->gameObject) return;
+
+    // Integration runs over the body store; the batch only names the scene.
+    // The fixed pass calls this once per fixed step, so step exactly once.
+    rigidbody_system_step(components[0]->gameObject->scene, deltaTime);
+}
+
+void collision_system_update_batch(Component** components, uint32_t count, float deltaTime) {
+    (void)deltaTime;
+    if (!components || count == 0 || !components[0] || !components[0]->gameObject) return;
+
+    // Bounds, broad and narrow phase run over the collider store; the
+    // batch only names the scene. Contacts and events are left for
+    // gameplay code, once per fixed step.
+    collision_system_update(components[0]->gameObject->scene);
 }
 
 void register_default_systems(Scene* scene) {
     if (!scene) return;
     
-    // Register transform system with highest priority (0)
+    // Register rigid body system with highest priority (0), first, in the fixed pass
+    // Bodies move their transforms before the transform system resolves them
+    scene_register_component_system(scene, COMPONENT_TYPE_RIGIDBODY,
+                                   rigidbody_system_update_batch, NULL, 0);
+    scene_set_component_system_passes(scene, COMPONENT_TYPE_RIGIDBODY, SYSTEM_PASS_FIXED);
+    
+    // Register transform system with highest priority (0), in both passes
     // Transforms need to be updated before other components that depend on position
     scene_register_component_system(scene, COMPONENT_TYPE_TRANSFORM,
                                    transform_system_update_batch, NULL, 0);
+    scene_set_component_system_passes(scene, COMPONENT_TYPE_TRANSFORM, SYSTEM_PASS_BOTH);
+    
+    // Register animation system with medium priority (1), ahead of sprites
+    // Frame changes swap sprite bitmaps before the sprite system sees them;
+    // per frame only, since fixed steps would add their time a second time
+    scene_register_component_system(scene, COMPONENT_TYPE_ANIMATION,
+                                   animation_system_update_batch, NULL, 1);
     
     // Register sprite system with medium priority (1)
     // Sprites depend on transform data for positioning
     scene_register_component_system(scene, COMPONENT_TYPE_SPRITE,
                                    sprite_system_update_batch, sprite_system_render_batch, 1);
     
-    // Register collision system with lower priority (2)
-    // Collision detection can happen after transforms are updated
+    // Register particle system with medium priority (1), after sprites
+    // Emitters spawn at their moved transforms and draw over the sprites;
+    // per frame only, so particles spawn and age with the frame time once
+    scene_register_component_system(scene, COMPONENT_TYPE_PARTICLES,
+                                   particle_system_update_batch, particle_system_render_batch, 1);
+    
+    // Register collision system with lower priority (2), in the fixed pass
+    // Collision detection can happen after transforms are updated; once per
+    // physics step, so enter events are not consumed by a second detection
     scene_register_component_system(scene, COMPONENT_TYPE_COLLISION,
                                    collision_system_update_batch, NULL, 2);
+    scene_set_component_system_passes(scene, COMPONENT_TYPE_COLLISION, SYSTEM_PASS_FIXED);
 }
\ No newline at end of file
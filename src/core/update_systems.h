@@ -3,15 +3,50 @@
 
 #include "component.h"
 #include "scene.h"
+#include "../systems/spatial_grid.h"
 
 // Transform system
 void transform_system_update_batch(Component** components, uint32_t count, float deltaTime);
 
 // Sprite system  
 void sprite_system_update_batch(Component** components, uint32_t count, float deltaTime);
-void sprite_system_render_batch(Component** components, uint32_t count);
+void sprite_system_render_batch(Component** components, uint32_t count);  // Draws into the render target
+void sprite_system_shutdown(void);                                          // Frees the render queue
 
-// Collision system
+// Draws the scene's sprites as seen by the camera. With a grid that has
+// enableFrustumCulling set, only sprites found by a rectangle query around
+// the camera are visited; otherwise every scene sprite is tested. Sprites
+// must be in the grid to be found. Returns the number of sprites drawn.
+struct RenderCamera;
+uint32_t sprite_system_render_culled(Scene* scene, SpatialGrid* grid, const struct RenderCamera* camera);
+
+// Redraws only what changed since the last call: the old and new bounds of
+// sprites whose transform, bitmap or visibility changed and of removed
+// sprites (screen space, no camera). Dirty regions are cleared to the
+// tracker's background and every sprite overlapping them is drawn again;
+// the tracker's row flags then say which rows to transfer. Returns the
+// number of sprite blits, 0 for a static frame.
+struct DirtyRectTracker;
+uint32_t sprite_system_render_dirty(Scene* scene, struct DirtyRectTracker* tracker);
+
+// Draw small sprites through pre-shifted copies (NULL to stop; not owned,
+// cleared again by sprite_system_shutdown)
+struct SpriteCache;
+void sprite_system_set_sprite_cache(struct SpriteCache* cache);
+
+// Rasterize whole-screen sprite passes in parallel bands (NULL to stop;
+// not owned, cleared again by sprite_system_shutdown). Output is unchanged.
+struct BandRenderer;
+void sprite_system_set_band_renderer(struct BandRenderer* renderer);
+
+// Last frame's sorted sprite commands and batches (for tests and stats)
+struct RenderQueue;
+const struct RenderQueue* sprite_system_get_render_queue(void);
+
+// Rigid body system (fixed pass, one step of deltaTime; see rigidbody_system.h)
+void rigidbody_system_update_batch(Component** components, uint32_t count, float deltaTime);
+
+// Collision system (fixed pass, once per step; see collision_system.h)
 void collision_system_update_batch(Component** components, uint32_t count, float deltaTime);
 
 // System registration helper
@@ -0,0 +1,279 @@
+#include "atlas.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Skyline segment: word columns [x, x + width) are filled up to row y
+typedef struct SkylineNode {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+} SkylineNode;
+
+// Nodes tile the page's columns left to right, so a page never needs more
+// than one node per column (plus one while placing)
+typedef struct SkylinePage {
+    SkylineNode* nodes;
+    uint32_t count;
+} SkylinePage;
+
+typedef struct PackOrder {
+    uint32_t height;
+    uint32_t columns;
+    uint32_t index;
+} PackOrder;
+
+// Page ids are global so frames from different atlases never share a batch
+static uint16_t g_nextAtlasId = 1;
+
+static uint32_t rect_columns(uint32_t width) {
+    // Data words plus the empty guard column after them
+    return (width + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS + 1;
+}
+
+// Tallest first, then widest; the index keeps the order total
+static int compare_pack_order(const void* a, const void* b) {
+    const PackOrder* left = a;
+    const PackOrder* right = b;
+    if (left->height != right->height) return left->height > right->height ? -1 : 1;
+    if (left->columns != right->columns) return left->columns > right->columns ? -1 : 1;
+    return left->index < right->index ? -1 : left->index > right->index;
+}
+
+// Lowest row at which a rectangle starting at node i fits, or UINT32_MAX
+static uint32_t skyline_fit(const SkylinePage* page, uint32_t i, uint32_t columns, uint32_t height,
+                            uint32_t pageColumns, uint32_t pageHeight) {
+    const SkylineNode* nodes = page->nodes;
+    if (nodes[i].x + columns > pageColumns) {
+        return UINT32_MAX;
+    }
+
+    uint32_t y = 0;
+    uint32_t remaining = columns;
+    for (uint32_t j = i; remaining > 0 && j < page->count; j++) {
+        if (nodes[j].y > y) y = nodes[j].y;
+        if (y + height > pageHeight) {
+            return UINT32_MAX;
+        }
+        remaining = nodes[j].width >= remaining ? 0 : remaining - nodes[j].width;
+    }
+    return y;
+}
+
+static void skyline_place(SkylinePage* page, uint32_t i, uint32_t top, uint32_t columns) {
+    SkylineNode* nodes = page->nodes;
+    memmove(&nodes[i + 1], &nodes[i], (page->count - i) * sizeof(SkylineNode));
+    nodes[i].y = top;
+    nodes[i].width = columns;
+    page->count++;
+
+    // Trim or drop the segments the new one covers
+    uint32_t end = nodes[i].x + columns;
+    while (i + 1 < page->count && nodes[i + 1].x < end) {
+        SkylineNode* next = &nodes[i + 1];
+        uint32_t covered = end - next->x;
+        if (next->width > covered) {
+            next->x += covered;
+            next->width -= covered;
+            break;
+        }
+        memmove(next, next + 1, (page->count - i - 2) * sizeof(SkylineNode));
+        page->count--;
+    }
+
+    // Merge neighbours of equal height
+    for (uint32_t j = 0; j + 1 < page->count;) {
+        if (nodes[j].y == nodes[j + 1].y) {
+            nodes[j].width += nodes[j + 1].width;
+            memmove(&nodes[j + 1], &nodes[j + 2], (page->count - j - 2) * sizeof(SkylineNode));
+            page->count--;
+        } else {
+            j++;
+        }
+    }
+}
+
+static bool skyline_add_page(SkylinePage** pages, uint32_t* pageCount, uint32_t* pageCapacity, uint32_t pageColumns) {
+    if (*pageCount == *pageCapacity) {
+        uint32_t capacity = *pageCapacity ? *pageCapacity * 2 : 4;
+        SkylinePage* grown = realloc(*pages, capacity * sizeof(SkylinePage));
+        if (!grown) return false;
+        *pages = grown;
+        *pageCapacity = capacity;
+    }
+
+    SkylinePage* page = &(*pages)[*pageCount];
+    page->nodes = malloc((pageColumns + 1) * sizeof(SkylineNode));
+    if (!page->nodes) return false;
+    page->nodes[0] = (SkylineNode){0, 0, pageColumns};
+    page->count = 1;
+    (*pageCount)++;
+    return true;
+}
+
+AtlasResult atlas_pack(const AtlasRect* rects, uint32_t count, uint32_t pageWidth, uint32_t pageHeight,
+                       AtlasPlacement* placements, uint32_t* pageCount) {
+    if (!rects || !placements || !pageCount) {
+        return ATLAS_ERROR_NULL_POINTER;
+    }
+    if (pageWidth == 0 || pageHeight == 0 || pageWidth > BITMAP_MAX_SIZE || pageHeight > BITMAP_MAX_SIZE) {
+        return ATLAS_ERROR_INVALID_SIZE;
+    }
+
+    // The page's own row guard word serves as the last column's guard
+    uint32_t pageColumns = rect_columns(pageWidth);
+    PackOrder* order = malloc((count ? count : 1) * sizeof(PackOrder));
+    if (!order) {
+        return ATLAS_ERROR_OUT_OF_MEMORY;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (rects[i].width == 0 || rects[i].height == 0) {
+            free(order);
+            return ATLAS_ERROR_INVALID_SIZE;
+        }
+        order[i] = (PackOrder){rects[i].height, rect_columns(rects[i].width), i};
+        if (order[i].columns > pageColumns || order[i].height > pageHeight) {
+            free(order);
+            return ATLAS_ERROR_TOO_LARGE;
+        }
+    }
+    qsort(order, count, sizeof(PackOrder), compare_pack_order);
+
+    SkylinePage* pages = NULL;
+    uint32_t usedPages = 0;
+    uint32_t pageCapacity = 0;
+    AtlasResult result = ATLAS_OK;
+
+    for (uint32_t n = 0; n < count && result == ATLAS_OK; n++) {
+        const PackOrder* rect = &order[n];
+
+        // First page with room; within it the lowest top edge, then leftmost
+        uint32_t bestPage = UINT32_MAX, bestNode = 0, bestY = UINT32_MAX;
+        for (uint32_t p = 0; p < usedPages && bestPage == UINT32_MAX; p++) {
+            for (uint32_t i = 0; i < pages[p].count; i++) {
+                uint32_t y = skyline_fit(&pages[p], i, rect->columns, rect->height, pageColumns, pageHeight);
+                if (y < bestY) {
+                    bestY = y;
+                    bestNode = i;
+                    bestPage = p;
+                }
+            }
+        }
+        if (bestPage == UINT32_MAX) {
+            if (!skyline_add_page(&pages, &usedPages, &pageCapacity, pageColumns)) {
+                result = ATLAS_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            bestPage = usedPages - 1;
+            bestNode = 0;
+            bestY = 0;
+        }
+
+        SkylinePage* page = &pages[bestPage];
+        AtlasPlacement* placement = &placements[rect->index];
+        placement->page = (uint16_t)bestPage;
+        placement->x = (uint16_t)(page->nodes[bestNode].x * BITMAP_WORD_BITS);
+        placement->y = (uint16_t)bestY;
+        skyline_place(page, bestNode, bestY + rect->height, rect->columns);
+    }
+
+    for (uint32_t p = 0; p < usedPages; p++) {
+        free(pages[p].nodes);
+    }
+    free(pages);
+    free(order);
+    *pageCount = result == ATLAS_OK ? usedPages : 0;
+    return result;
+}
+
+// Sprite atlas
+AtlasResult sprite_atlas_build(SpriteAtlas* atlas, const Bitmap* const* sources, uint32_t count,
+                               uint32_t pageWidth, uint32_t pageHeight) {
+    if (!atlas || !sources) {
+        return ATLAS_ERROR_NULL_POINTER;
+    }
+    memset(atlas, 0, sizeof(SpriteAtlas));
+    for (uint32_t i = 0; i < count; i++) {
+        if (!sources[i] || !sources[i]->storage) {
+            return ATLAS_ERROR_NULL_POINTER;
+        }
+    }
+
+    AtlasRect* rects = malloc((count ? count : 1) * sizeof(AtlasRect));
+    atlas->placements = malloc((count ? count : 1) * sizeof(AtlasPlacement));
+    atlas->frames = calloc(count ? count : 1, sizeof(Bitmap));
+    if (!rects || !atlas->placements || !atlas->frames) {
+        free(rects);
+        sprite_atlas_destroy(atlas);
+        return ATLAS_ERROR_OUT_OF_MEMORY;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        rects[i] = (AtlasRect){(uint16_t)sources[i]->width, (uint16_t)sources[i]->height};
+    }
+
+    uint32_t pageCount = 0;
+    AtlasResult result = atlas_pack(rects, count, pageWidth, pageHeight, atlas->placements, &pageCount);
+    free(rects);
+    if (result != ATLAS_OK) {
+        sprite_atlas_destroy(atlas);
+        return result;
+    }
+
+    atlas->pages = calloc(pageCount ? pageCount : 1, sizeof(Bitmap));
+    if (!atlas->pages) {
+        sprite_atlas_destroy(atlas);
+        return ATLAS_ERROR_OUT_OF_MEMORY;
+    }
+    for (uint32_t p = 0; p < pageCount; p++) {
+        if (bitmap_init(&atlas->pages[p], pageWidth, pageHeight) != BITMAP_OK) {
+            sprite_atlas_destroy(atlas);
+            return ATLAS_ERROR_OUT_OF_MEMORY;
+        }
+        atlas->pageCount++;
+        atlas->pages[p].atlasId = g_nextAtlasId++;
+        if (g_nextAtlasId == 0) g_nextAtlasId = 1;
+    }
+
+    // Each frame is a view with the page's stride; the words around it
+    // stay zero because the packer leaves them empty
+    for (uint32_t i = 0; i < count; i++) {
+        const Bitmap* source = sources[i];
+        const AtlasPlacement* placement = &atlas->placements[i];
+        Bitmap* page = &atlas->pages[placement->page];
+        Bitmap* frame = &atlas->frames[i];
+        size_t offset = (size_t)placement->y * page->stride + placement->x / BITMAP_WORD_BITS;
+
+        frame->pixels = page->pixels + offset;
+        frame->mask = page->mask + offset;
+        frame->storage = page->storage;
+        frame->width = source->width;
+        frame->height = source->height;
+        frame->wordsPerRow = source->wordsPerRow;
+        frame->stride = page->stride;
+        frame->atlasId = page->atlasId;
+
+        for (uint32_t y = 0; y < source->height; y++) {
+            memcpy(frame->pixels + (size_t)y * frame->stride, bitmap_row_pixels(source, y),
+                   source->wordsPerRow * sizeof(uint64_t));
+            memcpy(frame->mask + (size_t)y * frame->stride, bitmap_row_mask(source, y),
+                   source->wordsPerRow * sizeof(uint64_t));
+        }
+        atlas->frameCount++;
+    }
+    return ATLAS_OK;
+}
+
+void sprite_atlas_destroy(SpriteAtlas* atlas) {
+    if (!atlas) return;
+
+    for (uint32_t p = 0; p < atlas->pageCount; p++) {
+        bitmap_destroy(&atlas->pages[p]);
+    }
+    free(atlas->pages);
+    free(atlas->frames);
+    free(atlas->placements);
+    memset(atlas, 0, sizeof(SpriteAtlas));
+}
+
+const Bitmap* sprite_atlas_get_frame(const SpriteAtlas* atlas, uint32_t index) {
+    return atlas && index < atlas->frameCount ? &atlas->frames[index] : NULL;
+}
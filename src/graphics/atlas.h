@@ -0,0 +1,81 @@
+/**
+ * @file atlas.h
+ * @brief Skyline atlas packer and shared sprite pages
+ *
+ * Packs sprite frames into a few large page bitmaps so that draws from one
+ * page share an atlasId and batch together in the render queue.
+ *
+ * atlas_pack() only computes placements, so asset tools can run it offline
+ * and ship the result; sprite_atlas_build() runs it at load time and copies
+ * the frames into freshly allocated pages.
+ *
+ * Packing uses the skyline bottom-left heuristic in units of 64-pixel words:
+ * each page keeps the height of its filled area per word column, and every
+ * rectangle (tallest first) goes where its top edge ends up lowest. Frames
+ * are word-aligned and followed by one empty word column, which is exactly
+ * the zero guard word the blit kernels expect around a bitmap row (see
+ * bitmap.h). A frame is therefore a plain Bitmap that points into its page
+ * and blits like any other bitmap, at the cost of up to one word of
+ * horizontal padding per frame.
+ *
+ * Usage Example:
+ * @code
+ * const Bitmap* sources[] = {&walk0, &walk1, &walk2, &jump};
+ * SpriteAtlas atlas;
+ * sprite_atlas_build(&atlas, sources, 4, 256, 256);
+ *
+ * sprite_component_set_bitmap(sprite, sprite_atlas_get_frame(&atlas, 2));
+ *
+ * sprite_atlas_destroy(&atlas);
+ * @endcode
+ */
+
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include "bitmap.h"
+
+// Atlas results
+typedef enum {
+    ATLAS_OK = 0,
+    ATLAS_ERROR_NULL_POINTER,
+    ATLAS_ERROR_INVALID_SIZE,              // Zero-sized rectangle or page
+    ATLAS_ERROR_TOO_LARGE,                 // A rectangle does not fit on an empty page
+    ATLAS_ERROR_OUT_OF_MEMORY
+} AtlasResult;
+
+// Input size in pixels
+typedef struct AtlasRect {
+    uint16_t width;
+    uint16_t height;
+} AtlasRect;
+
+// Output position in pixels; x is always a multiple of 64
+typedef struct AtlasPlacement {
+    uint16_t page;
+    uint16_t x;
+    uint16_t y;
+} AtlasPlacement;
+
+typedef struct SpriteAtlas {
+    Bitmap* pages;                 // Owned; each page has its own atlasId
+    Bitmap* frames;                // Views into the pages, in input order (never destroy these)
+    AtlasPlacement* placements;
+    uint32_t pageCount;
+    uint32_t frameCount;
+} SpriteAtlas;
+
+// Packs count rectangles into as few pageWidth x pageHeight pages as the
+// heuristic finds. placements[i] receives rectangle i's position. The
+// result only depends on the input, so offline and load-time runs agree.
+AtlasResult atlas_pack(const AtlasRect* rects, uint32_t count, uint32_t pageWidth, uint32_t pageHeight,
+                       AtlasPlacement* placements, uint32_t* pageCount);
+
+// Load-time build: packs and copies the sources (which may be destroyed
+// afterwards) into new pages
+AtlasResult sprite_atlas_build(SpriteAtlas* atlas, const Bitmap* const* sources, uint32_t count,
+                               uint32_t pageWidth, uint32_t pageHeight);
+void sprite_atlas_destroy(SpriteAtlas* atlas);
+const Bitmap* sprite_atlas_get_frame(const SpriteAtlas* atlas, uint32_t index);
+
+#endif // ATLAS_H
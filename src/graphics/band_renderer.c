@@ -0,0 +1,317 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include "band_renderer.h"
+#include "../core/memory_budget.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Worker threads (Playdate builds are single-threaded)
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(BAND_RENDERER_NO_THREADS)
+    #include <pthread.h>
+    #define BAND_RENDERER_HAS_THREADS 1
+#else
+    #define BAND_RENDERER_HAS_THREADS 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define BAND_ATOMIC_INCREMENT(ptr) __sync_fetch_and_add((ptr), 1)
+#else
+    #define BAND_ATOMIC_INCREMENT(ptr) ((*(ptr))++)
+#endif
+
+#define BAND_RENDERER_MAX_ENTRIES (1u << 24)
+
+// What every thread drawing a frame reads; only nextBand is written
+typedef struct BandFrame {
+    const BandRenderer* renderer;
+    Framebuffer* target;
+    uint32_t nextBand;
+} BandFrame;
+
+struct BandWorkers {
+    BandFrame frame;
+#if BAND_RENDERER_HAS_THREADS
+    pthread_t threads[BAND_RENDERER_MAX_THREADS];
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;           // A new frame or quit
+    pthread_cond_t idle;           // The last worker finished its frame
+    uint32_t generation;           // Frames started
+    uint32_t busy;                 // Workers still drawing the current frame
+    bool quit;
+#endif
+};
+
+static size_t band_entry_bytes(uint32_t capacity) {
+    return (size_t)capacity * (sizeof(BlitDraw) + sizeof(uint8_t));
+}
+
+// Drawing (runs on any thread; a band touches only its own rows)
+static void band_draw(const BandRenderer* renderer, Framebuffer* target, uint32_t band) {
+    const BandBin* bin = &renderer->bins[band];
+    if (bin->count == 0) return;
+
+    uint32_t y0 = band * renderer->bandHeight;
+    uint32_t height = target->height - y0 < renderer->bandHeight ? target->height - y0 : renderer->bandHeight;
+    Framebuffer view;
+    if (framebuffer_init_view(&view, target, 0, y0, target->width, height) != FRAMEBUFFER_OK) return;
+
+    // Runs of one draw mode go through the batch blit
+    const BlitDraw* draws = renderer->draws + bin->start;
+    const uint8_t* modes = renderer->modes + bin->start;
+    for (uint32_t i = 0; i < bin->count;) {
+        uint32_t end = i + 1;
+        while (end < bin->count && modes[end] == modes[i]) end++;
+        framebuffer_blit_batch(&view, draws + i, end - i, (BlitMode)modes[i]);
+        i = end;
+    }
+}
+
+static void band_draw_frame(BandFrame* frame) {
+    for (;;) {
+        uint32_t band = BAND_ATOMIC_INCREMENT(&frame->nextBand);
+        if (band >= frame->renderer->bandCount) return;
+        band_draw(frame->renderer, frame->target, band);
+    }
+}
+
+#if BAND_RENDERER_HAS_THREADS
+static void* band_worker_main(void* arg) {
+    struct BandWorkers* workers = arg;
+    uint32_t seen = 0;
+
+    pthread_mutex_lock(&workers->mutex);
+    for (;;) {
+        while (workers->generation == seen && !workers->quit) {
+            pthread_cond_wait(&workers->wake, &workers->mutex);
+        }
+        if (workers->quit) break;
+        seen = workers->generation;
+        pthread_mutex_unlock(&workers->mutex);
+
+        band_draw_frame(&workers->frame);
+
+        pthread_mutex_lock(&workers->mutex);
+        if (--workers->busy == 0) {
+            pthread_cond_signal(&workers->idle);
+        }
+    }
+    pthread_mutex_unlock(&workers->mutex);
+    return NULL;
+}
+
+static void band_workers_stop(struct BandWorkers* workers, uint32_t started) {
+    pthread_mutex_lock(&workers->mutex);
+    workers->quit = true;
+    pthread_cond_broadcast(&workers->wake);
+    pthread_mutex_unlock(&workers->mutex);
+    for (uint32_t i = 0; i < started; i++) {
+        pthread_join(workers->threads[i], NULL);
+    }
+    pthread_cond_destroy(&workers->idle);
+    pthread_cond_destroy(&workers->wake);
+    pthread_mutex_destroy(&workers->mutex);
+}
+
+static BandRendererResult band_workers_start(BandRenderer* renderer) {
+    struct BandWorkers* workers = calloc(1, sizeof(struct BandWorkers));
+    if (!workers) {
+        return BAND_RENDERER_ERROR_OUT_OF_MEMORY;
+    }
+    if (pthread_mutex_init(&workers->mutex, NULL) != 0) {
+        free(workers);
+        return BAND_RENDERER_ERROR_THREAD;
+    }
+    pthread_cond_init(&workers->wake, NULL);
+    pthread_cond_init(&workers->idle, NULL);
+
+    for (uint32_t i = 0; i < renderer->threadCount; i++) {
+        if (pthread_create(&workers->threads[i], NULL, band_worker_main, workers) != 0) {
+            band_workers_stop(workers, i);
+            free(workers);
+            return BAND_RENDERER_ERROR_THREAD;
+        }
+    }
+    renderer->workers = workers;
+    return BAND_RENDERER_OK;
+}
+#endif
+
+// Lifecycle
+BandRendererResult band_renderer_init(BandRenderer* renderer, uint32_t bandCount, uint32_t threadCount) {
+    if (!renderer) {
+        return BAND_RENDERER_ERROR_NULL_POINTER;
+    }
+    if (bandCount == 0 || bandCount > BAND_RENDERER_MAX_BANDS || threadCount > BAND_RENDERER_MAX_THREADS) {
+        return BAND_RENDERER_ERROR_INVALID_COUNT;
+    }
+
+    memset(renderer, 0, sizeof(BandRenderer));
+    renderer->maxBands = bandCount;
+    renderer->threadCount = BAND_RENDERER_HAS_THREADS ? threadCount : 0;
+#if BAND_RENDERER_HAS_THREADS
+    if (renderer->threadCount > 0) {
+        BandRendererResult result = band_workers_start(renderer);
+        if (result != BAND_RENDERER_OK) {
+            memset(renderer, 0, sizeof(BandRenderer));
+            return result;
+        }
+    }
+#endif
+    return BAND_RENDERER_OK;
+}
+
+void band_renderer_destroy(BandRenderer* renderer) {
+    if (!renderer) return;
+
+#if BAND_RENDERER_HAS_THREADS
+    if (renderer->workers) {
+        band_workers_stop(renderer->workers, renderer->threadCount);
+        free(renderer->workers);
+    }
+#endif
+    if (renderer->draws) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)band_entry_bytes(renderer->entryCapacity));
+        free(renderer->draws);
+    }
+    memset(renderer, 0, sizeof(BandRenderer));
+}
+
+bool band_renderer_threads_supported(void) {
+    return BAND_RENDERER_HAS_THREADS;
+}
+
+// Binning
+static BandRendererResult band_reserve_entries(BandRenderer* renderer, uint32_t count) {
+    if (count <= renderer->entryCapacity) {
+        return BAND_RENDERER_OK;
+    }
+    if (count > BAND_RENDERER_MAX_ENTRIES) {
+        return BAND_RENDERER_ERROR_INVALID_COUNT;
+    }
+
+    uint32_t capacity = renderer->entryCapacity ? renderer->entryCapacity : 256;
+    while (capacity < count) capacity *= 2;
+
+    size_t bytes = band_entry_bytes(capacity);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return BAND_RENDERER_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* storage = malloc(bytes);
+    if (!storage) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes);
+        return BAND_RENDERER_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (renderer->draws) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)band_entry_bytes(renderer->entryCapacity));
+        free(renderer->draws);
+    }
+    renderer->draws = (BlitDraw*)storage;
+    renderer->modes = storage + (size_t)capacity * sizeof(BlitDraw);
+    renderer->entryCapacity = capacity;
+    return BAND_RENDERER_OK;
+}
+
+// Bands [first, last] covered by a draw's rows; false if it misses the framebuffer
+static inline bool band_range(const BandRenderer* renderer, const BlitDraw* draw, uint32_t height,
+                              uint32_t* first, uint32_t* last) {
+    if (!draw->bitmap) return false;
+    int32_t y0 = draw->y;
+    int32_t y1 = draw->y + (int32_t)draw->bitmap->height;
+    if (y0 < 0) y0 = 0;
+    if (y1 > (int32_t)height) y1 = (int32_t)height;
+    if (y0 >= y1) return false;
+
+    *first = (uint32_t)y0 / renderer->bandHeight;
+    *last = (uint32_t)(y1 - 1) / renderer->bandHeight;
+    return true;
+}
+
+// Two passes over the sorted draws: count per band, then place. Draws are
+// visited in sort order, so every bin stays in sort order.
+static BandRendererResult band_bin_queue(BandRenderer* renderer, const RenderQueue* queue, uint32_t height) {
+    uint32_t rows = (height + renderer->maxBands - 1) / renderer->maxBands;
+    renderer->bandHeight = (rows + BAND_RENDERER_ROW_ALIGN - 1) / BAND_RENDERER_ROW_ALIGN * BAND_RENDERER_ROW_ALIGN;
+    renderer->bandCount = (height + renderer->bandHeight - 1) / renderer->bandHeight;
+
+    BandBin* bins = renderer->bins;
+    memset(bins, 0, sizeof(renderer->bins));
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < queue->count; i++) {
+        uint32_t first, last;
+        if (!band_range(renderer, &queue->sorted[i], height, &first, &last)) continue;
+        for (uint32_t band = first; band <= last; band++) {
+            bins[band].count++;
+        }
+        total += last - first + 1;
+    }
+
+    BandRendererResult result = band_reserve_entries(renderer, total);
+    if (result != BAND_RENDERER_OK) {
+        renderer->bandCount = 0;
+        return result;
+    }
+
+    uint32_t offset = 0;
+    for (uint32_t band = 0; band < renderer->bandCount; band++) {
+        bins[band].start = offset;
+        offset += bins[band].count;
+        bins[band].count = 0;
+    }
+
+    for (uint32_t b = 0; b < queue->batchCount; b++) {
+        const RenderBatch* batch = &queue->batches[b];
+        for (uint32_t i = batch->start; i < batch->start + batch->count; i++) {
+            const BlitDraw* draw = &queue->sorted[i];
+            uint32_t first, last;
+            if (!band_range(renderer, draw, height, &first, &last)) continue;
+            for (uint32_t band = first; band <= last; band++) {
+                uint32_t entry = bins[band].start + bins[band].count++;
+                renderer->draws[entry] = *draw;
+                renderer->draws[entry].y -= (int32_t)(band * renderer->bandHeight);
+                renderer->modes[entry] = batch->mode;
+            }
+        }
+    }
+    return BAND_RENDERER_OK;
+}
+
+// Per frame
+BandRendererResult band_renderer_execute(BandRenderer* renderer, RenderQueue* queue, Framebuffer* framebuffer) {
+    if (!renderer || !queue || !queue->histograms || !framebuffer || !framebuffer->words) {
+        return BAND_RENDERER_ERROR_NULL_POINTER;
+    }
+
+    render_queue_sort(queue);
+    BandRendererResult result = band_bin_queue(renderer, queue, framebuffer->height);
+    if (result != BAND_RENDERER_OK || queue->count == 0) {
+        return result;
+    }
+
+#if BAND_RENDERER_HAS_THREADS
+    struct BandWorkers* workers = renderer->workers;
+    if (workers) {
+        // The mutex hand-off publishes the bins to the workers; the caller
+        // draws bands as well and then waits for the stragglers
+        pthread_mutex_lock(&workers->mutex);
+        workers->frame = (BandFrame){renderer, framebuffer, 0};
+        workers->busy = renderer->threadCount;
+        workers->generation++;
+        pthread_cond_broadcast(&workers->wake);
+        pthread_mutex_unlock(&workers->mutex);
+
+        band_draw_frame(&workers->frame);
+
+        pthread_mutex_lock(&workers->mutex);
+        while (workers->busy > 0) {
+            pthread_cond_wait(&workers->idle, &workers->mutex);
+        }
+        pthread_mutex_unlock(&workers->mutex);
+        return BAND_RENDERER_OK;
+    }
+#endif
+
+    BandFrame frame = {renderer, framebuffer, 0};
+    band_draw_frame(&frame);
+    return BAND_RENDERER_OK;
+}
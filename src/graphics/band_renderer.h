@@ -0,0 +1,85 @@
+/**
+ * @file band_renderer.h
+ * @brief Sorted render commands rasterized in horizontal bands, in parallel
+ *
+ * Splits the framebuffer into horizontal bands and bins a sorted render
+ * queue's draws by band: every draw goes into each band its rows overlap,
+ * in sort order. Each band is then drawn through a framebuffer view (see
+ * framebuffer_init_view()), which clips the draws to the band's rows.
+ *
+ * A band owns its rows outright, so bands are rasterized on worker threads
+ * without any locking; workers take the next undrawn band with an atomic
+ * counter, and the calling thread draws bands too. Within a band draws run
+ * in queue order, so the result is pixel-identical to render_queue_execute()
+ * for any band or thread count. Band heights are whole multiples of 8 rows,
+ * which puts band boundaries on 64-byte multiples of the framebuffer for
+ * any row stride.
+ *
+ * Threads need POSIX threads; other builds (e.g. the Playdate itself)
+ * clamp the worker count to 0 and draw every band on the calling thread.
+ * The queue's sprite cache is not used: it is not thread-safe.
+ *
+ * Bin storage grows to the largest frame seen and is charged to
+ * MEMORY_SUBSYSTEM_SCENE.
+ *
+ * Usage Example:
+ * @code
+ * BandRenderer bands;
+ * band_renderer_init(&bands, 8, 3);               // 8 bands, 3 workers plus the caller
+ * sprite_system_set_band_renderer(&bands);        // Or band_renderer_execute() directly
+ *
+ * band_renderer_destroy(&bands);
+ * @endcode
+ */
+
+#ifndef BAND_RENDERER_H
+#define BAND_RENDERER_H
+
+#include "render_queue.h"
+
+#define BAND_RENDERER_MAX_BANDS 64
+#define BAND_RENDERER_MAX_THREADS 31
+#define BAND_RENDERER_ROW_ALIGN 8
+
+// Band renderer results
+typedef enum {
+    BAND_RENDERER_OK = 0,
+    BAND_RENDERER_ERROR_NULL_POINTER,
+    BAND_RENDERER_ERROR_INVALID_COUNT,
+    BAND_RENDERER_ERROR_OUT_OF_MEMORY,
+    BAND_RENDERER_ERROR_BUDGET_EXCEEDED,
+    BAND_RENDERER_ERROR_THREAD
+} BandRendererResult;
+
+// One band's draws: entries [start, start + count)
+typedef struct BandBin {
+    uint32_t start;
+    uint32_t count;
+} BandBin;
+
+struct BandWorkers;
+
+typedef struct BandRenderer {
+    BandBin bins[BAND_RENDERER_MAX_BANDS];
+    BlitDraw* draws;               // Binned draws, band by band; y relative to the band
+    uint8_t* modes;                // BlitMode per binned draw
+    uint32_t entryCapacity;
+    uint32_t maxBands;             // Requested bands (fewer when the framebuffer is short)
+    uint32_t bandCount;            // Bands of the last frame
+    uint32_t bandHeight;           // Rows per band of the last frame (the last may be shorter)
+    uint32_t threadCount;          // Worker threads besides the caller
+    struct BandWorkers* workers;   // NULL when threadCount is 0
+} BandRenderer;
+
+// Lifecycle. Worker threads start here and wait for frames.
+BandRendererResult band_renderer_init(BandRenderer* renderer, uint32_t bandCount, uint32_t threadCount);
+void band_renderer_destroy(BandRenderer* renderer);
+
+// Draws the queue (sorting it first if needed), returning once every band
+// is done. Nothing is drawn if bin storage cannot grow.
+BandRendererResult band_renderer_execute(BandRenderer* renderer, RenderQueue* queue, Framebuffer* framebuffer);
+
+// Whether this build can run worker threads
+bool band_renderer_threads_supported(void);
+
+#endif // BAND_RENDERER_H
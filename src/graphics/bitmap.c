@@ -0,0 +1,105 @@
+#include "bitmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Plane layout: [guard][row 0][guard][row 1]...[row h-1][guard]
+static size_t plane_words(uint32_t height, uint32_t stride) {
+    return 1 + (size_t)height * stride;
+}
+
+static uint64_t last_word_mask(uint32_t width) {
+    uint32_t bits = width % BITMAP_WORD_BITS;
+    return bits ? (UINT64_C(1) << bits) - 1 : ~UINT64_C(0);
+}
+
+static inline bool in_bounds(const Bitmap* bitmap, int32_t x, int32_t y) {
+    return bitmap && x >= 0 && y >= 0 && (uint32_t)x < bitmap->width && (uint32_t)y < bitmap->height;
+}
+
+BitmapResult bitmap_init(Bitmap* bitmap, uint32_t width, uint32_t height) {
+    if (!bitmap) {
+        return BITMAP_ERROR_NULL_POINTER;
+    }
+    if (width == 0 || height == 0 || width > BITMAP_MAX_SIZE || height > BITMAP_MAX_SIZE) {
+        return BITMAP_ERROR_INVALID_SIZE;
+    }
+
+    uint32_t wordsPerRow = (width + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS;
+    uint32_t stride = wordsPerRow + 1;
+    size_t planeWords = plane_words(height, stride);
+
+    uint64_t* storage = calloc(planeWords * 2, sizeof(uint64_t));
+    if (!storage) {
+        return BITMAP_ERROR_OUT_OF_MEMORY;
+    }
+
+    bitmap->storage = storage;
+    bitmap->pixels = storage + 1;
+    bitmap->mask = storage + planeWords + 1;
+    bitmap->width = width;
+    bitmap->height = height;
+    bitmap->wordsPerRow = wordsPerRow;
+    bitmap->stride = stride;
+    bitmap->atlasId = 0;
+    return BITMAP_OK;
+}
+
+void bitmap_destroy(Bitmap* bitmap) {
+    if (bitmap) {
+        free(bitmap->storage);
+        memset(bitmap, 0, sizeof(Bitmap));
+    }
+}
+
+void bitmap_set_pixel(Bitmap* bitmap, int32_t x, int32_t y, BitmapColor color) {
+    if (!in_bounds(bitmap, x, y)) return;
+
+    size_t word = (size_t)y * bitmap->stride + (uint32_t)x / BITMAP_WORD_BITS;
+    uint64_t bit = UINT64_C(1) << ((uint32_t)x % BITMAP_WORD_BITS);
+    bitmap->mask[word] |= bit;
+    if (color == BITMAP_COLOR_WHITE) {
+        bitmap->pixels[word] |= bit;
+    } else {
+        bitmap->pixels[word] &= ~bit;
+    }
+}
+
+void bitmap_clear_pixel(Bitmap* bitmap, int32_t x, int32_t y) {
+    if (!in_bounds(bitmap, x, y)) return;
+
+    // Transparent pixels keep 0 in both planes so blits never leak them
+    size_t word = (size_t)y * bitmap->stride + (uint32_t)x / BITMAP_WORD_BITS;
+    uint64_t bit = UINT64_C(1) << ((uint32_t)x % BITMAP_WORD_BITS);
+    bitmap->mask[word] &= ~bit;
+    bitmap->pixels[word] &= ~bit;
+}
+
+BitmapColor bitmap_get_pixel(const Bitmap* bitmap, int32_t x, int32_t y) {
+    if (!in_bounds(bitmap, x, y)) return BITMAP_COLOR_BLACK;
+
+    size_t word = (size_t)y * bitmap->stride + (uint32_t)x / BITMAP_WORD_BITS;
+    return (bitmap->pixels[word] >> ((uint32_t)x % BITMAP_WORD_BITS)) & 1 ? BITMAP_COLOR_WHITE
+                                                                             : BITMAP_COLOR_BLACK;
+}
+
+bool bitmap_is_opaque(const Bitmap* bitmap, int32_t x, int32_t y) {
+    if (!in_bounds(bitmap, x, y)) return false;
+
+    size_t word = (size_t)y * bitmap->stride + (uint32_t)x / BITMAP_WORD_BITS;
+    return (bitmap->mask[word] >> ((uint32_t)x % BITMAP_WORD_BITS)) & 1;
+}
+
+void bitmap_fill(Bitmap* bitmap, BitmapColor color) {
+    if (!bitmap || !bitmap->storage) return;
+
+    uint64_t lastMask = last_word_mask(bitmap->width);
+    for (uint32_t y = 0; y < bitmap->height; y++) {
+        uint64_t* pixels = bitmap->pixels + (size_t)y * bitmap->stride;
+        uint64_t* mask = bitmap->mask + (size_t)y * bitmap->stride;
+        for (uint32_t w = 0; w < bitmap->wordsPerRow; w++) {
+            uint64_t valid = w + 1 == bitmap->wordsPerRow ? lastMask : ~UINT64_C(0);
+            mask[w] = valid;
+            pixels[w] = color == BITMAP_COLOR_WHITE ? valid : 0;
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file bitmap.h
+ * @brief 1-bit bitmaps with a per-pixel opacity mask
+ *
+ * Pixels are bit-packed into 64-bit words, least significant bit first, so
+ * pixel x of a row lives in word x / 64 at bit x % 64. That order makes an
+ * arbitrary horizontal shift a plain pair of word shifts on little-endian
+ * hosts (both the Playdate's Cortex-M7 and x86/ARM servers); conversion to
+ * the display's MSB-first byte order happens only on export.
+ *
+ * Every bitmap carries a mask plane (1 = opaque). Bits past the bitmap width
+ * are always 0 in both planes, and rows are separated by a zero guard word,
+ * so blitters may read one word before and after any row.
+ *
+ * Usage Example:
+ * @code
+ * Bitmap ship;
+ * bitmap_init(&ship, 16, 16);
+ * bitmap_fill(&ship, BITMAP_COLOR_BLACK);          // Opaque black square
+ * bitmap_set_pixel(&ship, 8, 8, BITMAP_COLOR_WHITE);
+ * bitmap_clear_pixel(&ship, 0, 0);                  // Transparent corner
+ * framebuffer_blit(&framebuffer, &ship, 100, 50);
+ * bitmap_destroy(&ship);
+ * @endcode
+ */
+
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define BITMAP_WORD_BITS 64
+#define BITMAP_MAX_SIZE 4096               // Width and height limit
+
+// Pixel colors (Playdate convention: set bits are white)
+typedef enum {
+    BITMAP_COLOR_BLACK = 0,
+    BITMAP_COLOR_WHITE = 1
+} BitmapColor;
+
+// Bitmap results
+typedef enum {
+    BITMAP_OK = 0,
+    BITMAP_ERROR_NULL_POINTER,
+    BITMAP_ERROR_INVALID_SIZE,
+    BITMAP_ERROR_OUT_OF_MEMORY
+} BitmapResult;
+
+typedef struct Bitmap {
+    uint64_t* pixels;              // First word of row 0
+    uint64_t* mask;                // First word of row 0, 1 = opaque
+    uint64_t* storage;             // Both planes, one allocation
+    uint32_t width;
+    uint32_t height;
+    uint32_t wordsPerRow;          // Pixel words per row
+    uint32_t stride;               // Words between rows (wordsPerRow + guard word)
+    uint16_t atlasId;              // Atlas page holding the image, 0 = standalone (render batching key)
+} Bitmap;
+
+// Lifecycle (a new bitmap is fully transparent)
+BitmapResult bitmap_init(Bitmap* bitmap, uint32_t width, uint32_t height);
+void bitmap_destroy(Bitmap* bitmap);
+
+// Pixel access (out-of-range coordinates are ignored / read as transparent black)
+void bitmap_set_pixel(Bitmap* bitmap, int32_t x, int32_t y, BitmapColor color);  // Also makes it opaque
+void bitmap_clear_pixel(Bitmap* bitmap, int32_t x, int32_t y);                   // Makes it transparent
+BitmapColor bitmap_get_pixel(const Bitmap* bitmap, int32_t x, int32_t y);
+bool bitmap_is_opaque(const Bitmap* bitmap, int32_t x, int32_t y);
+void bitmap_fill(Bitmap* bitmap, BitmapColor color);                              // Fully opaque
+
+// Row access for blitters
+static inline const uint64_t* bitmap_row_pixels(const Bitmap* bitmap, uint32_t y) {
+    return bitmap->pixels + (size_t)y * bitmap->stride;
+}
+
+static inline const uint64_t* bitmap_row_mask(const Bitmap* bitmap, uint32_t y) {
+    return bitmap->mask + (size_t)y * bitmap->stride;
+}
+
+#endif // BITMAP_H
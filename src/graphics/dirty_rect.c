@@ -0,0 +1,179 @@
+#include "dirty_rect.h"
+#include "../core/memory_budget.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Row spans and regions share one allocation
+static size_t dirty_rect_row_bytes(uint32_t height) {
+    return (size_t)height * (2 * sizeof(uint16_t) + sizeof(DirtyRegion));
+}
+
+static DirtyRectResult dirty_rect_alloc(size_t bytes, void** out) {
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return DIRTY_RECT_ERROR_BUDGET_EXCEEDED;
+    }
+    *out = calloc(1, bytes);
+    if (!*out) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes);
+        return DIRTY_RECT_ERROR_OUT_OF_MEMORY;
+    }
+    return DIRTY_RECT_OK;
+}
+
+// Lifecycle
+DirtyRectResult dirty_rect_tracker_init(DirtyRectTracker* tracker, uint32_t width, uint32_t height) {
+    if (!tracker) {
+        return DIRTY_RECT_ERROR_NULL_POINTER;
+    }
+    if (width == 0 || height == 0 || width > BITMAP_MAX_SIZE || height > BITMAP_MAX_SIZE) {
+        return DIRTY_RECT_ERROR_INVALID_SIZE;
+    }
+
+    void* storage = NULL;
+    DirtyRectResult result = dirty_rect_alloc(dirty_rect_row_bytes(height), &storage);
+    if (result != DIRTY_RECT_OK) {
+        return result;
+    }
+
+    memset(tracker, 0, sizeof(DirtyRectTracker));
+    tracker->regions = storage;
+    tracker->rowStart = (uint16_t*)(tracker->regions + height);
+    tracker->rowEnd = tracker->rowStart + height;
+    tracker->width = width;
+    tracker->height = height;
+    tracker->wordsPerRow = (width + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS;
+    tracker->background = BITMAP_COLOR_WHITE;
+    tracker->fullRedraw = true;
+    return DIRTY_RECT_OK;
+}
+
+void dirty_rect_tracker_destroy(DirtyRectTracker* tracker) {
+    if (!tracker || !tracker->regions) return;
+
+    memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)dirty_rect_row_bytes(tracker->height));
+    free(tracker->regions);
+    if (tracker->sprites) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)(tracker->spriteCapacity * sizeof(DirtySpriteState)));
+        free(tracker->sprites);
+    }
+    memset(tracker, 0, sizeof(DirtyRectTracker));
+}
+
+DirtyRectResult dirty_rect_tracker_reserve_sprites(DirtyRectTracker* tracker, uint32_t capacity) {
+    if (!tracker || !tracker->regions) {
+        return DIRTY_RECT_ERROR_NULL_POINTER;
+    }
+    if (capacity <= tracker->spriteCapacity) {
+        return DIRTY_RECT_OK;
+    }
+
+    void* storage = NULL;
+    DirtyRectResult result = dirty_rect_alloc((size_t)capacity * sizeof(DirtySpriteState), &storage);
+    if (result != DIRTY_RECT_OK) {
+        return result;
+    }
+    if (tracker->sprites) {
+        memcpy(storage, tracker->sprites, tracker->spriteCapacity * sizeof(DirtySpriteState));
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)(tracker->spriteCapacity * sizeof(DirtySpriteState)));
+        free(tracker->sprites);
+    }
+    tracker->sprites = storage;
+    tracker->spriteCapacity = capacity;
+    tracker->fullRedraw = true;
+    return DIRTY_RECT_OK;
+}
+
+void dirty_rect_tracker_invalidate(DirtyRectTracker* tracker) {
+    if (tracker) tracker->fullRedraw = true;
+}
+
+// Per pass
+void dirty_rect_tracker_begin(DirtyRectTracker* tracker) {
+    if (!tracker || !tracker->regions) return;
+
+    // Clean rows have an empty span at the far end, so the first add sets both bounds
+    for (uint32_t y = 0; y < tracker->height; y++) {
+        tracker->rowStart[y] = (uint16_t)tracker->wordsPerRow;
+        tracker->rowEnd[y] = 0;
+    }
+    tracker->regionCount = 0;
+    tracker->dirtyRows = 0;
+    tracker->pass++;
+
+    if (tracker->fullRedraw) {
+        tracker->fullRedraw = false;
+        dirty_rect_tracker_add(tracker, 0, 0, (int32_t)tracker->width, (int32_t)tracker->height);
+    }
+}
+
+void dirty_rect_tracker_add(DirtyRectTracker* tracker, int32_t x, int32_t y, int32_t width, int32_t height) {
+    if (!tracker || !tracker->regions || width <= 0 || height <= 0) return;
+
+    int32_t x0 = x < 0 ? 0 : x;
+    int32_t y0 = y < 0 ? 0 : y;
+    int64_t x1 = (int64_t)x + width;
+    int64_t y1 = (int64_t)y + height;
+    if (x1 > (int64_t)tracker->width) x1 = tracker->width;
+    if (y1 > (int64_t)tracker->height) y1 = tracker->height;
+    if ((int64_t)x0 >= x1 || (int64_t)y0 >= y1) return;
+
+    // Widen to whole words: redraws write whole destination words anyway
+    uint16_t wordStart = (uint16_t)((uint32_t)x0 / BITMAP_WORD_BITS);
+    uint16_t wordEnd = (uint16_t)(((uint32_t)x1 + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS);
+    for (int32_t row = y0; row < (int32_t)y1; row++) {
+        if (wordStart < tracker->rowStart[row]) tracker->rowStart[row] = wordStart;
+        if (wordEnd > tracker->rowEnd[row]) tracker->rowEnd[row] = wordEnd;
+    }
+}
+
+uint32_t dirty_rect_tracker_build_regions(DirtyRectTracker* tracker) {
+    if (!tracker || !tracker->regions) return 0;
+
+    tracker->regionCount = 0;
+    tracker->dirtyRows = 0;
+    DirtyRegion* open = NULL;
+    for (uint32_t y = 0; y < tracker->height; y++) {
+        uint16_t start = tracker->rowStart[y];
+        uint16_t end = tracker->rowEnd[y];
+        if (start >= end) {
+            open = NULL;
+            continue;
+        }
+        tracker->dirtyRows++;
+
+        // Extend the region above when this row has the same span
+        if (open && open->wordStart == start && open->wordEnd == end) {
+            open->y1 = (uint16_t)(y + 1);
+            continue;
+        }
+        open = &tracker->regions[tracker->regionCount++];
+        open->y0 = (uint16_t)y;
+        open->y1 = (uint16_t)(y + 1);
+        open->wordStart = start;
+        open->wordEnd = end;
+    }
+    return tracker->regionCount;
+}
+
+// Transfer
+bool dirty_rect_tracker_is_row_dirty(const DirtyRectTracker* tracker, uint32_t y) {
+    return tracker && tracker->regions && y < tracker->height && tracker->rowStart[y] < tracker->rowEnd[y];
+}
+
+uint32_t dirty_rect_tracker_export_rows(const DirtyRectTracker* tracker, const Framebuffer* framebuffer,
+                                        uint8_t* out, uint32_t rowBytes) {
+    if (!tracker || !framebuffer || !out) return 0;
+
+    uint32_t rows = tracker->height < framebuffer->height ? tracker->height : framebuffer->height;
+    uint32_t exported = 0;
+    for (uint32_t y = 0; y < rows; y++) {
+        if (!dirty_rect_tracker_is_row_dirty(tracker, y)) continue;
+
+        Framebuffer row;
+        if (framebuffer_init_view(&row, framebuffer, 0, y, framebuffer->width, 1) == FRAMEBUFFER_OK) {
+            framebuffer_export_rows(&row, out + (size_t)y * rowBytes, rowBytes);
+            exported++;
+        }
+    }
+    return exported;
+}
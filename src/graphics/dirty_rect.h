@@ -0,0 +1,110 @@
+/**
+ * @file dirty_rect.h
+ * @brief Dirty-region tracking so unchanged parts of the screen are not redrawn
+ *
+ * Each pass, the sprite system adds the screen rectangles that changed: the
+ * old and new bounds of every sprite whose transform, bitmap or visibility
+ * changed, and the old bounds of sprites that went away. Rectangles are
+ * accumulated as one span of 64-pixel words per row, the framebuffer's own
+ * granularity, so adding a rectangle is a min/max per row and overlapping
+ * rectangles merge for free.
+ *
+ * Building regions walks the rows once and collapses consecutive rows with
+ * the same span into one rectangle. Each region is then cleared and redrawn
+ * through a framebuffer view; rows that no region touched keep last frame's
+ * pixels. The same row flags drive the display transfer: only dirty rows
+ * are exported.
+ *
+ * A static screen adds no rectangles, builds no regions and redraws and
+ * transfers nothing.
+ *
+ * Per-sprite state (bounds drawn last pass) is kept in a table indexed by
+ * the sprite's slot in its component pool. Storage is charged to
+ * MEMORY_SUBSYSTEM_SCENE.
+ *
+ * Usage Example:
+ * @code
+ * DirtyRectTracker tracker;
+ * dirty_rect_tracker_init(&tracker, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+ *
+ * // Each frame
+ * sprite_system_render_dirty(scene, &tracker);
+ * uint32_t rows = dirty_rect_tracker_export_rows(&tracker, &framebuffer, display, FRAMEBUFFER_ROW_BYTES);
+ *
+ * dirty_rect_tracker_destroy(&tracker);
+ * @endcode
+ */
+
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include "framebuffer.h"
+
+// Rows [y0, y1) and framebuffer words [wordStart, wordEnd) to redraw
+typedef struct DirtyRegion {
+    uint16_t y0;
+    uint16_t y1;
+    uint16_t wordStart;
+    uint16_t wordEnd;
+} DirtyRegion;
+
+// What one sprite slot drew last pass, in screen pixels (x1/y1 exclusive)
+typedef struct DirtySpriteState {
+    int16_t x0, y0, x1, y1;
+    uint32_t componentId;          // Detects a slot reused by another sprite
+    uint32_t lastSeen;             // Pass in which the sprite was last visited
+} DirtySpriteState;
+
+// Dirty rect results
+typedef enum {
+    DIRTY_RECT_OK = 0,
+    DIRTY_RECT_ERROR_NULL_POINTER,
+    DIRTY_RECT_ERROR_INVALID_SIZE,
+    DIRTY_RECT_ERROR_OUT_OF_MEMORY,
+    DIRTY_RECT_ERROR_BUDGET_EXCEEDED
+} DirtyRectResult;
+
+typedef struct DirtyRectTracker {
+    uint16_t* rowStart;            // First dirty word per row (== rowEnd when clean)
+    uint16_t* rowEnd;              // One past the last dirty word
+    DirtyRegion* regions;          // Up to one per row
+    DirtySpriteState* sprites;     // Indexed by sprite pool slot
+    uint32_t width;
+    uint32_t height;
+    uint32_t wordsPerRow;
+    uint32_t regionCount;
+    uint32_t dirtyRows;            // Rows with a dirty span after build_regions
+    uint32_t spriteCapacity;
+    uint32_t drawnSprites;         // Slots with non-empty bounds
+    uint32_t pass;
+    BitmapColor background;        // Regions are cleared to this before redrawing
+    bool fullRedraw;               // Next pass redraws everything (set by init and invalidate)
+} DirtyRectTracker;
+
+// Lifecycle
+DirtyRectResult dirty_rect_tracker_init(DirtyRectTracker* tracker, uint32_t width, uint32_t height);
+void dirty_rect_tracker_destroy(DirtyRectTracker* tracker);
+
+// Grows the per-sprite table to cover pool slots [0, capacity); growing
+// forgets nothing but forces a full redraw
+DirtyRectResult dirty_rect_tracker_reserve_sprites(DirtyRectTracker* tracker, uint32_t capacity);
+
+// Marks the whole screen dirty at the next begin (e.g. after the
+// framebuffer was drawn over by something else)
+void dirty_rect_tracker_invalidate(DirtyRectTracker* tracker);
+
+// Per pass: begin clears last pass's spans, add accumulates clipped
+// rectangles, build_regions merges rows and returns the region count
+void dirty_rect_tracker_begin(DirtyRectTracker* tracker);
+void dirty_rect_tracker_add(DirtyRectTracker* tracker, int32_t x, int32_t y, int32_t width, int32_t height);
+uint32_t dirty_rect_tracker_build_regions(DirtyRectTracker* tracker);
+
+// Transfer
+bool dirty_rect_tracker_is_row_dirty(const DirtyRectTracker* tracker, uint32_t y);
+
+// Writes the dirty rows of the framebuffer in display format to
+// out + y * rowBytes, leaving clean rows untouched; returns the row count
+uint32_t dirty_rect_tracker_export_rows(const DirtyRectTracker* tracker, const Framebuffer* framebuffer,
+                                        uint8_t* out, uint32_t rowBytes);
+
+#endif // DIRTY_RECT_H
@@ -0,0 +1,473 @@
+#include "dither.h"
+#include "../core/memory_budget.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define DITHER_HAS_SIMD 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define DITHER_HAS_SIMD 1
+#else
+    #define DITHER_HAS_SIMD 0
+#endif
+
+#define DITHER_CACHE_MAX_CAPACITY (1u << 16)
+#define DITHER_CACHE_EMPTY UINT32_MAX
+#define DITHER_ALPHA_THRESHOLD 128
+#define DITHER_DIFFUSION_THRESHOLD 128
+#define DITHER_MAX_PERIOD 8
+#define DITHER_STACK_WIDTH 512             // Error rows up to this width live on the stack
+
+// Threshold matrices; entry b becomes (b * 256 + 128) / n^2, so 0 stays
+// black and 255 white
+static const uint8_t g_bayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+static const uint8_t g_bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21}
+};
+
+// Per-word threshold rows. SSE2 only compares signed bytes; flipping the
+// top bit of both sides turns that into an unsigned compare, so the SIMD
+// kernel gets pre-flipped thresholds there.
+typedef struct ThresholdRows {
+    uint8_t rows[DITHER_MAX_PERIOD][BITMAP_WORD_BITS];
+    uint32_t period;
+} ThresholdRows;
+
+static uint8_t threshold_bias(DitherKernel kernel) {
+#if defined(__SSE2__)
+    return kernel == DITHER_KERNEL_SIMD ? 0x80 : 0;
+#else
+    (void)kernel;
+    return 0;
+#endif
+}
+
+// Both matrix periods divide 64, so one word's worth of thresholds repeats
+static void threshold_rows_bayer(ThresholdRows* thresholds, DitherMethod method, DitherKernel kernel) {
+    uint8_t bias = threshold_bias(kernel);
+    thresholds->period = method == DITHER_BAYER_4X4 ? 4 : 8;
+    for (uint32_t y = 0; y < thresholds->period; y++) {
+        for (uint32_t b = 0; b < BITMAP_WORD_BITS; b++) {
+            uint8_t value = method == DITHER_BAYER_4X4 ? (uint8_t)(g_bayer4[y][b % 4] * 16 + 8)
+                                                       : (uint8_t)(g_bayer8[y][b % 8] * 4 + 2);
+            thresholds->rows[y][b] = value ^ bias;
+        }
+    }
+}
+
+// Opaque where alpha >= 128, i.e. alpha > 127
+static void threshold_rows_alpha(ThresholdRows* thresholds, DitherKernel kernel) {
+    thresholds->period = 1;
+    memset(thresholds->rows[0], (DITHER_ALPHA_THRESHOLD - 1) ^ threshold_bias(kernel), BITMAP_WORD_BITS);
+}
+
+// Bit b of the word is set when values[b] > thresholds[b]
+static inline uint64_t pack_greater_scalar(const uint8_t* values, const uint8_t* thresholds) {
+    uint64_t word = 0;
+    for (uint32_t b = 0; b < BITMAP_WORD_BITS; b++) {
+        word |= (uint64_t)(values[b] > thresholds[b]) << b;
+    }
+    return word;
+}
+
+#if DITHER_HAS_SIMD
+#if defined(__SSE2__)
+static inline uint64_t pack_greater_simd(const uint8_t* values, const uint8_t* thresholds) {
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    uint64_t word = 0;
+    for (uint32_t k = 0; k < BITMAP_WORD_BITS; k += 16) {
+        __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(values + k)), bias);
+        __m128i t = _mm_loadu_si128((const __m128i*)(thresholds + k));
+        word |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(v, t)) << k;
+    }
+    return word;
+}
+#else
+// NEON has no movemask: weight each lane by its bit and add pairwise
+static inline uint64_t pack_greater_simd(const uint8_t* values, const uint8_t* thresholds) {
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t weight = vld1q_u8(weights);
+    uint64_t word = 0;
+    for (uint32_t k = 0; k < BITMAP_WORD_BITS; k += 16) {
+        uint8x16_t bits = vandq_u8(vcgtq_u8(vld1q_u8(values + k), vld1q_u8(thresholds + k)), weight);
+        uint8x8_t sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+        sum = vpadd_u8(sum, sum);
+        sum = vpadd_u8(sum, sum);
+        word |= ((uint64_t)vget_lane_u8(sum, 0) | (uint64_t)vget_lane_u8(sum, 1) << 8) << k;
+    }
+    return word;
+}
+#endif
+#endif
+
+static inline uint64_t pack_greater(const uint8_t* values, const uint8_t* thresholds, DitherKernel kernel) {
+#if DITHER_HAS_SIMD
+    if (kernel == DITHER_KERNEL_SIMD) {
+        return pack_greater_simd(values, thresholds);
+    }
+#else
+    (void)kernel;
+#endif
+    return pack_greater_scalar(values, thresholds);
+}
+
+// One comparison per pixel, 64 pixels per word. The partial last word
+// reads a zero-padded copy and is masked, so bits past the width stay 0.
+static void pack_plane(const uint8_t* values, uint32_t width, uint32_t height, uint32_t stride,
+                       const ThresholdRows* thresholds, DitherKernel kernel, uint64_t* out, uint32_t outStride) {
+    uint32_t fullWords = width / BITMAP_WORD_BITS;
+    uint32_t tail = width % BITMAP_WORD_BITS;
+
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t* row = values + (size_t)y * stride;
+        const uint8_t* threshold = thresholds->rows[y % thresholds->period];
+        uint64_t* words = out + (size_t)y * outStride;
+
+        for (uint32_t w = 0; w < fullWords; w++) {
+            words[w] = pack_greater(row + w * BITMAP_WORD_BITS, threshold, kernel);
+        }
+        if (tail) {
+            uint8_t padded[BITMAP_WORD_BITS] = {0};
+            memcpy(padded, row + fullWords * BITMAP_WORD_BITS, tail);
+            words[fullWords] = pack_greater(padded, threshold, kernel) & ((UINT64_C(1) << tail) - 1);
+        }
+    }
+}
+
+// Error diffusion. Errors are kept in units of 1/16 (Floyd-Steinberg) or
+// 1/8 (Atkinson) of a gray level, so spreading them is plain adds and the
+// only division is one per pixel when the accumulated error is read.
+// Errors headed right stay in registers, each error-row entry is written
+// once per row with everything it receives from the current row, and the
+// quantisation is branch-free, so the loop has no data-dependent branches
+// and no store-to-load chains. Accumulated errors stay well inside 16 bits.
+
+static inline bool diffuse_quantise(int32_t value, int32_t* error) {
+    bool white = value >= DITHER_DIFFUSION_THRESHOLD;
+    *error = value - (255 & -(int32_t)white);
+    return white;
+}
+
+// 7/16 right; 3/16, 5/16 and 1/16 below-left, below and below-right. Two
+// rows: the one being read and the one below, which is rewritten entirely.
+static void diffuse_floyd_steinberg(const GrayImage* image, int16_t* errors, Bitmap* out) {
+    const uint32_t width = image->width;
+    int16_t* current = errors + 1;                     // One column of padding on each side
+    int16_t* below = errors + 1 + (width + 2);
+
+    for (uint32_t y = 0; y < image->height; y++) {
+        const uint8_t* gray = image->pixels + (size_t)y * image->stride;
+        uint64_t* words = out->pixels + (size_t)y * out->stride;
+        int32_t right = 0;                             // 7e(x - 1)
+        int32_t belowHere = 0;                         // 5e(x - 1) + e(x - 2), for below[x - 1]
+        int32_t belowNext = 0;                         // e(x - 1), for below[x]
+
+        for (uint32_t base = 0; base < width; base += BITMAP_WORD_BITS) {
+            uint32_t end = width - base < BITMAP_WORD_BITS ? width : base + BITMAP_WORD_BITS;
+            uint64_t word = 0;
+            for (uint32_t x = base; x < end; x++) {
+                int32_t error;
+                bool white = diffuse_quantise((int32_t)gray[x] + (current[x] + right) / 16, &error);
+                word |= (uint64_t)white << (x - base);
+
+                below[(int32_t)x - 1] = (int16_t)(belowHere + 3 * error);
+                belowHere = belowNext + 5 * error;
+                belowNext = error;
+                right = 7 * error;
+            }
+            words[base / BITMAP_WORD_BITS] = word;
+        }
+        below[width - 1] = (int16_t)belowHere;
+
+        int16_t* spent = current;
+        current = below;
+        below = spent;
+    }
+}
+
+// 1/8 to x + 1 and x + 2, to x - 1, x and x + 1 below, and to x two rows
+// below; the remaining 2/8 is dropped. The row below already holds what
+// the previous row sent two rows down, so it is added to; the row two
+// below is fresh and written.
+static void diffuse_atkinson(const GrayImage* image, int16_t* errors, Bitmap* out) {
+    const uint32_t width = image->width;
+    int16_t* rows[3] = {errors + 1, errors + 1 + (width + 2), errors + 1 + 2 * (width + 2)};
+
+    for (uint32_t y = 0; y < image->height; y++) {
+        int16_t* current = rows[0];
+        int16_t* below = rows[1];
+        int16_t* twoBelow = rows[2];
+        const uint8_t* gray = image->pixels + (size_t)y * image->stride;
+        uint64_t* words = out->pixels + (size_t)y * out->stride;
+        int32_t previous = 0;                          // e(x - 1)
+        int32_t beforePrevious = 0;                    // e(x - 2)
+        twoBelow[-1] = 0;                              // Padding; below[-1] only collects
+
+        for (uint32_t base = 0; base < width; base += BITMAP_WORD_BITS) {
+            uint32_t end = width - base < BITMAP_WORD_BITS ? width : base + BITMAP_WORD_BITS;
+            uint64_t word = 0;
+            for (uint32_t x = base; x < end; x++) {
+                int32_t error;
+                bool white = diffuse_quantise((int32_t)gray[x] + (current[x] + previous + beforePrevious) / 8, &error);
+                word |= (uint64_t)white << (x - base);
+
+                below[(int32_t)x - 1] = (int16_t)(below[(int32_t)x - 1] + beforePrevious + previous + error);
+                twoBelow[x] = (int16_t)error;
+                beforePrevious = previous;
+                previous = error;
+            }
+            words[base / BITMAP_WORD_BITS] = word;
+        }
+        below[width - 1] = (int16_t)(below[width - 1] + beforePrevious + previous);
+
+        rows[0] = below;
+        rows[1] = twoBelow;
+        rows[2] = current;
+    }
+}
+
+// Conversion
+bool dither_kernel_is_supported(DitherKernel kernel) {
+    switch (kernel) {
+        case DITHER_KERNEL_SCALAR:
+            return true;
+        case DITHER_KERNEL_SIMD:
+            return DITHER_HAS_SIMD;
+        default:
+            return false;
+    }
+}
+
+DitherKernel dither_kernel_best(void) {
+    return DITHER_HAS_SIMD ? DITHER_KERNEL_SIMD : DITHER_KERNEL_SCALAR;
+}
+
+static DitherResult dither_validate(const GrayImage* image, DitherMethod method) {
+    if (!image || !image->pixels) {
+        return DITHER_ERROR_NULL_POINTER;
+    }
+    if (image->width == 0 || image->height == 0 || image->stride < image->width ||
+        image->width > BITMAP_MAX_SIZE || image->height > BITMAP_MAX_SIZE) {
+        return DITHER_ERROR_INVALID_SIZE;
+    }
+    if ((unsigned)method >= DITHER_METHOD_COUNT) {
+        return DITHER_ERROR_INVALID_METHOD;
+    }
+    return DITHER_OK;
+}
+
+DitherResult dither_convert(const GrayImage* image, DitherMethod method, DitherKernel kernel, Bitmap* out) {
+    DitherResult result = dither_validate(image, method);
+    if (result != DITHER_OK) {
+        return result;
+    }
+    if (!out || !out->pixels) {
+        return DITHER_ERROR_NULL_POINTER;
+    }
+    if (out->width != image->width || out->height != image->height) {
+        return DITHER_ERROR_INVALID_SIZE;
+    }
+    if (!dither_kernel_is_supported(kernel)) {
+        return DITHER_ERROR_UNSUPPORTED;
+    }
+
+    ThresholdRows thresholds;
+    if (method == DITHER_FLOYD_STEINBERG || method == DITHER_ATKINSON) {
+        int16_t stackRows[3 * (DITHER_STACK_WIDTH + 2)];
+        size_t count = 3 * ((size_t)image->width + 2);
+        int16_t* errors = stackRows;
+        if (image->width > DITHER_STACK_WIDTH) {
+            errors = malloc(count * sizeof(int16_t));
+            if (!errors) {
+                return DITHER_ERROR_OUT_OF_MEMORY;
+            }
+        }
+        memset(errors, 0, count * sizeof(int16_t));
+        if (method == DITHER_ATKINSON) {
+            diffuse_atkinson(image, errors, out);
+        } else {
+            diffuse_floyd_steinberg(image, errors, out);
+        }
+        if (errors != stackRows) {
+            free(errors);
+        }
+    } else {
+        threshold_rows_bayer(&thresholds, method, kernel);
+        pack_plane(image->pixels, image->width, image->height, image->stride, &thresholds, kernel,
+                   out->pixels, out->stride);
+    }
+
+    if (image->alpha) {
+        threshold_rows_alpha(&thresholds, kernel);
+        pack_plane(image->alpha, image->width, image->height, image->stride, &thresholds, kernel,
+                   out->mask, out->stride);
+        for (uint32_t y = 0; y < out->height; y++) {
+            uint64_t* pixels = out->pixels + (size_t)y * out->stride;
+            const uint64_t* mask = bitmap_row_mask(out, y);
+            for (uint32_t w = 0; w < out->wordsPerRow; w++) {
+                pixels[w] &= mask[w];
+            }
+        }
+    } else {
+        uint64_t lastWord = out->width % BITMAP_WORD_BITS ? (UINT64_C(1) << (out->width % BITMAP_WORD_BITS)) - 1
+                                                          : ~UINT64_C(0);
+        for (uint32_t y = 0; y < out->height; y++) {
+            uint64_t* mask = out->mask + (size_t)y * out->stride;
+            memset(mask, 0xFF, (out->wordsPerRow - 1) * sizeof(uint64_t));
+            mask[out->wordsPerRow - 1] = lastWord;
+        }
+    }
+    return DITHER_OK;
+}
+
+DitherResult dither_image(const GrayImage* image, DitherMethod method, Bitmap* out) {
+    DitherResult result = dither_validate(image, method);
+    if (result != DITHER_OK) {
+        return result;
+    }
+    if (!out) {
+        return DITHER_ERROR_NULL_POINTER;
+    }
+    if (bitmap_init(out, image->width, image->height) != BITMAP_OK) {
+        return DITHER_ERROR_OUT_OF_MEMORY;
+    }
+    result = dither_convert(image, method, dither_kernel_best(), out);
+    if (result != DITHER_OK) {
+        bitmap_destroy(out);
+    }
+    return result;
+}
+
+// Asset cache
+uint64_t dither_asset_key(const char* name) {
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    for (const unsigned char* c = (const unsigned char*)name; c && *c; c++) {
+        hash ^= *c;
+        hash *= UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+static size_t dither_cache_table_bytes(uint32_t capacity, uint32_t tableSize) {
+    return (size_t)capacity * sizeof(DitherCacheEntry) + (size_t)tableSize * sizeof(uint32_t);
+}
+
+static uint32_t bitmap_bytes(const Bitmap* bitmap) {
+    return (uint32_t)((1 + (size_t)bitmap->height * bitmap->stride) * 2 * sizeof(uint64_t));
+}
+
+static uint32_t dither_cache_slot(const DitherCache* cache, uint64_t key, DitherMethod method) {
+    uint64_t value = (key ^ (uint64_t)method) * UINT64_C(0x9E3779B97F4A7C15);
+    uint32_t mask = cache->tableSize - 1;
+    for (uint32_t slot = (uint32_t)(value >> 32) & mask;; slot = (slot + 1) & mask) {
+        uint32_t index = cache->table[slot];
+        if (index == DITHER_CACHE_EMPTY ||
+            (cache->entries[index].key == key && cache->entries[index].method == (uint8_t)method)) {
+            return slot;
+        }
+    }
+}
+
+DitherResult dither_cache_init(DitherCache* cache, uint32_t capacity) {
+    if (!cache) {
+        return DITHER_ERROR_NULL_POINTER;
+    }
+    if (capacity == 0 || capacity > DITHER_CACHE_MAX_CAPACITY) {
+        return DITHER_ERROR_INVALID_SIZE;
+    }
+
+    uint32_t tableSize = 4;
+    while (tableSize < capacity * 2) tableSize *= 2;
+    size_t bytes = dither_cache_table_bytes(capacity, tableSize);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return DITHER_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* storage = calloc(1, bytes);
+    if (!storage) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes);
+        return DITHER_ERROR_OUT_OF_MEMORY;
+    }
+
+    memset(cache, 0, sizeof(DitherCache));
+    cache->entries = (DitherCacheEntry*)storage;
+    cache->table = (uint32_t*)(storage + (size_t)capacity * sizeof(DitherCacheEntry));
+    cache->capacity = capacity;
+    cache->tableSize = tableSize;
+    for (uint32_t i = 0; i < tableSize; i++) {
+        cache->table[i] = DITHER_CACHE_EMPTY;
+    }
+    return DITHER_OK;
+}
+
+void dither_cache_destroy(DitherCache* cache) {
+    if (!cache || !cache->entries) return;
+
+    for (uint32_t i = 0; i < cache->count; i++) {
+        DitherCacheEntry* entry = &cache->entries[i];
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, entry->bytes);
+        bitmap_destroy(&entry->bitmap);
+    }
+    memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)dither_cache_table_bytes(cache->capacity, cache->tableSize));
+    free(cache->entries);
+    memset(cache, 0, sizeof(DitherCache));
+}
+
+DitherResult dither_cache_get(DitherCache* cache, uint64_t assetKey, DitherMethod method,
+                              const GrayImage* image, const Bitmap** out) {
+    if (!cache || !cache->entries || !out) {
+        return DITHER_ERROR_NULL_POINTER;
+    }
+    *out = NULL;
+    if ((unsigned)method >= DITHER_METHOD_COUNT) {
+        return DITHER_ERROR_INVALID_METHOD;
+    }
+
+    uint32_t slot = dither_cache_slot(cache, assetKey, method);
+    if (cache->table[slot] != DITHER_CACHE_EMPTY) {
+        cache->hits++;
+        *out = &cache->entries[cache->table[slot]].bitmap;
+        return DITHER_OK;
+    }
+    if (!image) {
+        return DITHER_ERROR_NULL_POINTER;
+    }
+    if (cache->count == cache->capacity) {
+        return DITHER_ERROR_FULL;
+    }
+
+    // Entries fill in order and are never removed, so addresses stay put
+    DitherCacheEntry* entry = &cache->entries[cache->count];
+    DitherResult result = dither_image(image, method, &entry->bitmap);
+    if (result != DITHER_OK) {
+        return result;
+    }
+    uint32_t bytes = bitmap_bytes(&entry->bitmap);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, bytes) != MEMORY_BUDGET_OK) {
+        bitmap_destroy(&entry->bitmap);
+        return DITHER_ERROR_BUDGET_EXCEEDED;
+    }
+
+    entry->key = assetKey;
+    entry->method = (uint8_t)method;
+    entry->bytes = bytes;
+    cache->table[slot] = cache->count++;
+    cache->usedBytes += bytes;
+    cache->conversions++;
+    *out = &entry->bitmap;
+    return DITHER_OK;
+}
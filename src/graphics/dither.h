@@ -0,0 +1,130 @@
+/**
+ * @file dither.h
+ * @brief Grayscale to 1-bit conversion with ordered and error-diffusion dithering
+ *
+ * Art is authored as 8-bit grayscale (0 = black, 255 = white) with an
+ * optional 8-bit alpha channel and converted at load time into Bitmaps the
+ * blitters draw directly (see bitmap.h). Rows are packed straight into the
+ * LSB-first 64-bit words; no per-pixel bitmap_set_pixel() calls.
+ *
+ * Methods:
+ *
+ * - DITHER_BAYER_4X4 / DITHER_BAYER_8X8: ordered dithering. A pixel is white
+ *   when its value exceeds the threshold matrix entry at (x mod n, y mod n).
+ *   Every pixel is independent, so the SIMD kernel compares 16 pixels per
+ *   instruction (SSE2/NEON) and packs the results with a movemask.
+ * - DITHER_FLOYD_STEINBERG: error diffusion (7/16, 3/16, 5/16, 1/16).
+ * - DITHER_ATKINSON: error diffusion of 1/8 to six neighbours, dropping the
+ *   other 2/8 for the Mac-style higher contrast.
+ *
+ * Error diffusion is sequential by nature; its path works in integers on
+ * three rolling 16-bit error rows and stores each output word once, but
+ * has no SIMD kernel. Alpha is thresholded at 128 into the mask plane; transparent
+ * pixels are stored black.
+ *
+ * DitherCache keeps one converted bitmap per (asset, method) so streaming
+ * loads convert each asset only once. Converted bitmaps are owned by the
+ * cache, stay at the same address until it is destroyed, and are charged
+ * to MEMORY_SUBSYSTEM_SCENE.
+ *
+ * Usage Example:
+ * @code
+ * GrayImage image = {gray, alpha, width, height, width};
+ * Bitmap bitmap;
+ * dither_image(&image, DITHER_BAYER_8X8, &bitmap);   // Caller owns bitmap
+ *
+ * DitherCache cache;
+ * dither_cache_init(&cache, 256);
+ * const Bitmap* sprite = NULL;
+ * dither_cache_get(&cache, dither_asset_key("ship.png"), DITHER_ATKINSON, &image, &sprite);
+ * dither_cache_destroy(&cache);
+ * @endcode
+ */
+
+#ifndef DITHER_H
+#define DITHER_H
+
+#include "bitmap.h"
+
+// Dithering methods
+typedef enum {
+    DITHER_BAYER_4X4 = 0,
+    DITHER_BAYER_8X8,
+    DITHER_FLOYD_STEINBERG,
+    DITHER_ATKINSON,
+    DITHER_METHOD_COUNT
+} DitherMethod;
+
+// Ordered dithering kernels (identical output)
+typedef enum {
+    DITHER_KERNEL_SCALAR = 0,
+    DITHER_KERNEL_SIMD,                    // SSE2 or NEON, when compiled in
+    DITHER_KERNEL_COUNT
+} DitherKernel;
+
+// Dither results
+typedef enum {
+    DITHER_OK = 0,
+    DITHER_ERROR_NULL_POINTER,
+    DITHER_ERROR_INVALID_SIZE,
+    DITHER_ERROR_INVALID_METHOD,
+    DITHER_ERROR_UNSUPPORTED,              // Kernel not available in this build
+    DITHER_ERROR_OUT_OF_MEMORY,
+    DITHER_ERROR_BUDGET_EXCEEDED,
+    DITHER_ERROR_FULL
+} DitherResult;
+
+// 8-bit source image; rows are stride bytes apart
+typedef struct GrayImage {
+    const uint8_t* pixels;         // 0 = black, 255 = white
+    const uint8_t* alpha;          // Same layout as pixels, NULL = fully opaque
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+} GrayImage;
+
+// One converted asset
+typedef struct DitherCacheEntry {
+    uint64_t key;
+    Bitmap bitmap;
+    uint32_t bytes;                // Charged to the scene budget
+    uint8_t method;                // DitherMethod
+} DitherCacheEntry;
+
+typedef struct DitherCache {
+    DitherCacheEntry* entries;     // Fixed; entry addresses never change
+    uint32_t* table;               // Open addressing: entry index or UINT32_MAX
+    uint32_t capacity;
+    uint32_t tableSize;            // Power of two, at least twice the capacity
+    uint32_t count;
+    size_t usedBytes;              // Converted bitmaps
+
+    // Statistics
+    uint64_t hits;
+    uint64_t conversions;
+} DitherCache;
+
+// Converts into a new bitmap the caller destroys
+DitherResult dither_image(const GrayImage* image, DitherMethod method, Bitmap* out);
+
+// Converts into an existing bitmap (or atlas frame) of the image's size,
+// overwriting both planes. Does not allocate for images up to 512 pixels wide.
+DitherResult dither_convert(const GrayImage* image, DitherMethod method, DitherKernel kernel, Bitmap* out);
+
+bool dither_kernel_is_supported(DitherKernel kernel);
+DitherKernel dither_kernel_best(void);
+
+// Asset cache
+DitherResult dither_cache_init(DitherCache* cache, uint32_t capacity);
+void dither_cache_destroy(DitherCache* cache);
+
+// The asset's bitmap for this method, converting image on the first
+// request. image may be NULL to only look up (DITHER_ERROR_NULL_POINTER
+// on a miss). Entries live until the cache is destroyed.
+DitherResult dither_cache_get(DitherCache* cache, uint64_t assetKey, DitherMethod method,
+                              const GrayImage* image, const Bitmap** out);
+
+// Stable 64-bit key for an asset name (FNV-1a)
+uint64_t dither_asset_key(const char* name);
+
+#endif // DITHER_H
@@ -0,0 +1,533 @@
+#include "framebuffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define FRAMEBUFFER_HAS_SIMD 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define FRAMEBUFFER_HAS_SIMD 1
+#else
+    #define FRAMEBUFFER_HAS_SIMD 0
+#endif
+
+// The 32-bit kernel and pre-shifted blits view 64-bit rows as smaller
+// units, which keeps the LSB-first pixel order only on little-endian hosts
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define FRAMEBUFFER_LITTLE_ENDIAN 0
+#else
+    #define FRAMEBUFFER_LITTLE_ENDIAN 1
+#endif
+#define FRAMEBUFFER_HAS_SCALAR32 FRAMEBUFFER_LITTLE_ENDIAN
+
+#if defined(__GNUC__) || defined(__clang__)
+typedef uint32_t __attribute__((__may_alias__)) Word32;
+#else
+typedef uint32_t Word32;
+#endif
+
+static Framebuffer* g_renderTarget = NULL;
+
+static inline int32_t floor_div(int32_t value, int32_t divisor) {
+    return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+static uint64_t valid_bits_mask(uint32_t width, uint32_t wordBits) {
+    uint32_t bits = width % wordBits;
+    return bits ? (UINT64_C(1) << bits) - 1 : (wordBits == 64 ? ~UINT64_C(0) : (UINT64_C(1) << wordBits) - 1);
+}
+
+// Lifecycle
+FramebufferResult framebuffer_init(Framebuffer* framebuffer, uint32_t width, uint32_t height) {
+    if (!framebuffer) {
+        return FRAMEBUFFER_ERROR_NULL_POINTER;
+    }
+    if (width == 0 || height == 0 || width > BITMAP_MAX_SIZE || height > BITMAP_MAX_SIZE) {
+        return FRAMEBUFFER_ERROR_INVALID_SIZE;
+    }
+
+    uint32_t wordsPerRow = (width + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS;
+    uint64_t* words = calloc((size_t)wordsPerRow * height, sizeof(uint64_t));
+    if (!words) {
+        return FRAMEBUFFER_ERROR_OUT_OF_MEMORY;
+    }
+
+    framebuffer->words = words;
+    framebuffer->width = width;
+    framebuffer->height = height;
+    framebuffer->wordsPerRow = wordsPerRow;
+    framebuffer->stride = wordsPerRow;
+    framebuffer->lastWordMask = valid_bits_mask(width, 64);
+    framebuffer->kernel = blit_kernel_best();
+    return FRAMEBUFFER_OK;
+}
+
+FramebufferResult framebuffer_init_view(Framebuffer* view, const Framebuffer* parent,
+                                        uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    if (!view || !parent || !parent->words) {
+        return FRAMEBUFFER_ERROR_NULL_POINTER;
+    }
+    if (x % BITMAP_WORD_BITS != 0 || width == 0 || height == 0 ||
+        x >= parent->width || y >= parent->height || height > parent->height - y) {
+        return FRAMEBUFFER_ERROR_INVALID_SIZE;
+    }
+
+    // Whole words: the width is rounded up and clipped to the parent
+    uint32_t firstWord = x / BITMAP_WORD_BITS;
+    uint32_t wordCount = (width + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS;
+    if (wordCount > parent->wordsPerRow - firstWord) {
+        wordCount = parent->wordsPerRow - firstWord;
+    }
+    bool reachesEdge = firstWord + wordCount == parent->wordsPerRow;
+
+    view->words = parent->words + (size_t)y * parent->stride + firstWord;
+    view->width = reachesEdge ? parent->width - x : wordCount * BITMAP_WORD_BITS;
+    view->height = height;
+    view->wordsPerRow = wordCount;
+    view->stride = parent->stride;
+    view->lastWordMask = reachesEdge ? parent->lastWordMask : ~UINT64_C(0);
+    view->kernel = parent->kernel;
+    return FRAMEBUFFER_OK;
+}
+
+void framebuffer_destroy(Framebuffer* framebuffer) {
+    if (!framebuffer) return;
+
+    if (g_renderTarget == framebuffer) {
+        g_renderTarget = NULL;
+    }
+    free(framebuffer->words);
+    memset(framebuffer, 0, sizeof(Framebuffer));
+}
+
+// Drawing
+void framebuffer_clear(Framebuffer* framebuffer, BitmapColor color) {
+    if (!framebuffer || !framebuffer->words) return;
+
+    if (color == BITMAP_COLOR_BLACK && framebuffer->stride == framebuffer->wordsPerRow) {
+        memset(framebuffer->words, 0, (size_t)framebuffer->wordsPerRow * framebuffer->height * sizeof(uint64_t));
+        return;
+    }
+
+    // Padding bits past the width stay 0 so hashes and exports only see pixels
+    uint64_t fill = color == BITMAP_COLOR_WHITE ? ~UINT64_C(0) : 0;
+    for (uint32_t y = 0; y < framebuffer->height; y++) {
+        uint64_t* row = framebuffer->words + (size_t)y * framebuffer->stride;
+        for (uint32_t w = 0; w + 1 < framebuffer->wordsPerRow; w++) {
+            row[w] = fill;
+        }
+        row[framebuffer->wordsPerRow - 1] = fill & framebuffer->lastWordMask;
+    }
+}
+
+static inline bool framebuffer_in_bounds(const Framebuffer* framebuffer, int32_t x, int32_t y) {
+    return framebuffer && framebuffer->words && x >= 0 && y >= 0 &&
+           (uint32_t)x < framebuffer->width && (uint32_t)y < framebuffer->height;
+}
+
+void framebuffer_set_pixel(Framebuffer* framebuffer, int32_t x, int32_t y, BitmapColor color) {
+    if (!framebuffer_in_bounds(framebuffer, x, y)) return;
+
+    uint64_t* word = &framebuffer->words[(size_t)y * framebuffer->stride + (uint32_t)x / BITMAP_WORD_BITS];
+    uint64_t bit = UINT64_C(1) << ((uint32_t)x % BITMAP_WORD_BITS);
+    *word = color == BITMAP_COLOR_WHITE ? (*word | bit) : (*word & ~bit);
+}
+
+BitmapColor framebuffer_get_pixel(const Framebuffer* framebuffer, int32_t x, int32_t y) {
+    if (!framebuffer_in_bounds(framebuffer, x, y)) return BITMAP_COLOR_BLACK;
+
+    uint64_t word = framebuffer->words[(size_t)y * framebuffer->stride + (uint32_t)x / BITMAP_WORD_BITS];
+    return (word >> ((uint32_t)x % BITMAP_WORD_BITS)) & 1 ? BITMAP_COLOR_WHITE : BITMAP_COLOR_BLACK;
+}
+
+// Horizontal placement of a blit in destination words of one width.
+// Output word j (jStart <= j < jEnd) lands in destination word firstWord + j;
+// when hasEdge is set, word jEnd - 1 is the partially visible last word.
+typedef struct BlitSpan {
+    int32_t firstWord;
+    uint32_t shift;
+    int32_t jStart;
+    int32_t jEnd;
+    bool hasEdge;
+} BlitSpan;
+
+static bool compute_span(BlitSpan* span, int32_t x, uint32_t wordBits, uint32_t srcWords,
+                         uint32_t dstWords, bool partialLastWord) {
+    span->firstWord = floor_div(x, (int32_t)wordBits);
+    span->shift = (uint32_t)(x - span->firstWord * (int32_t)wordBits);
+
+    // A shifted row spills into one extra destination word
+    int32_t outWords = (int32_t)srcWords + (span->shift ? 1 : 0);
+    span->jStart = span->firstWord < 0 ? -span->firstWord : 0;
+    span->jEnd = (int32_t)dstWords - span->firstWord;
+    if (span->jEnd > outWords) span->jEnd = outWords;
+    span->hasEdge = partialLastWord && span->firstWord + span->jEnd == (int32_t)dstWords;
+    return span->jStart < span->jEnd;
+}
+
+// Scalar 64-bit kernel
+static inline void blit_word64(uint64_t* dst, const uint64_t* src, const uint64_t* mask, int32_t j,
+                               uint32_t shift, uint64_t clip, uint64_t invert) {
+    uint64_t pixels = src[j] ^ invert;
+    uint64_t opaque = mask[j];
+    if (shift) {
+        pixels = (pixels << shift) | ((src[j - 1] ^ invert) >> (64 - shift));
+        opaque = (opaque << shift) | (mask[j - 1] >> (64 - shift));
+    }
+    opaque &= clip;
+    dst[j] = (dst[j] & ~opaque) | (pixels & opaque);
+}
+
+static void blit_rows_scalar64(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y,
+                               uint32_t rowStart, uint32_t rowEnd, uint64_t invert) {
+    BlitSpan span;
+    if (!compute_span(&span, x, 64, bitmap->wordsPerRow, framebuffer->wordsPerRow,
+                      framebuffer->lastWordMask != ~UINT64_C(0))) {
+        return;
+    }
+    int32_t bodyEnd = span.hasEdge ? span.jEnd - 1 : span.jEnd;
+
+    for (uint32_t row = rowStart; row < rowEnd; row++) {
+        const uint64_t* src = bitmap_row_pixels(bitmap, row);
+        const uint64_t* mask = bitmap_row_mask(bitmap, row);
+        uint64_t* dst = framebuffer->words + (size_t)(y + (int32_t)row) * framebuffer->stride + span.firstWord;
+
+        for (int32_t j = span.jStart; j < bodyEnd; j++) {
+            blit_word64(dst, src, mask, j, span.shift, ~UINT64_C(0), invert);
+        }
+        if (span.hasEdge) {
+            blit_word64(dst, src, mask, bodyEnd, span.shift, framebuffer->lastWordMask, invert);
+        }
+    }
+}
+
+// Scalar 32-bit kernel (same rows viewed as 32-bit words)
+static inline void blit_word32(Word32* dst, const Word32* src, const Word32* mask, int32_t j,
+                               uint32_t shift, uint32_t clip, uint32_t invert) {
+    uint32_t pixels = src[j] ^ invert;
+    uint32_t opaque = mask[j];
+    if (shift) {
+        pixels = (pixels << shift) | ((src[j - 1] ^ invert) >> (32 - shift));
+        opaque = (opaque << shift) | (mask[j - 1] >> (32 - shift));
+    }
+    opaque &= clip;
+    dst[j] = (dst[j] & ~opaque) | (pixels & opaque);
+}
+
+static void blit_rows_scalar32(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y,
+                               uint32_t rowStart, uint32_t rowEnd, uint64_t invert) {
+    uint32_t dstWords = (framebuffer->width + 31) / 32;
+    uint32_t edgeMask = (uint32_t)valid_bits_mask(framebuffer->width, 32);
+
+    BlitSpan span;
+    if (!compute_span(&span, x, 32, bitmap->wordsPerRow * 2, dstWords, edgeMask != UINT32_MAX)) {
+        return;
+    }
+    int32_t bodyEnd = span.hasEdge ? span.jEnd - 1 : span.jEnd;
+
+    for (uint32_t row = rowStart; row < rowEnd; row++) {
+        const Word32* src = (const Word32*)bitmap_row_pixels(bitmap, row);
+        const Word32* mask = (const Word32*)bitmap_row_mask(bitmap, row);
+        Word32* dst = (Word32*)(framebuffer->words + (size_t)(y + (int32_t)row) * framebuffer->stride) +
+                      span.firstWord;
+
+        for (int32_t j = span.jStart; j < bodyEnd; j++) {
+            blit_word32(dst, src, mask, j, span.shift, UINT32_MAX, (uint32_t)invert);
+        }
+        if (span.hasEdge) {
+            blit_word32(dst, src, mask, bodyEnd, span.shift, edgeMask, (uint32_t)invert);
+        }
+    }
+}
+
+// SIMD kernel: two 64-bit words per operation, the shift is the same for both lanes
+#if FRAMEBUFFER_HAS_SIMD
+static void blit_rows_simd(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y,
+                           uint32_t rowStart, uint32_t rowEnd, uint64_t invert) {
+    BlitSpan span;
+    if (!compute_span(&span, x, 64, bitmap->wordsPerRow, framebuffer->wordsPerRow,
+                      framebuffer->lastWordMask != ~UINT64_C(0))) {
+        return;
+    }
+    int32_t bodyEnd = span.hasEdge ? span.jEnd - 1 : span.jEnd;
+
+#if defined(__SSE2__)
+    // A right shift by 64 yields 0, so shift == 0 needs no special case
+    __m128i shiftLeft = _mm_cvtsi32_si128((int)span.shift);
+    __m128i shiftRight = _mm_cvtsi32_si128((int)(64 - span.shift));
+    __m128i flip = _mm_set1_epi64x((long long)invert);
+#else
+    int64x2_t shiftLeft = vdupq_n_s64((int64_t)span.shift);
+    int64x2_t shiftRight = vdupq_n_s64((int64_t)span.shift - 64);
+    uint64x2_t flip = vdupq_n_u64(invert);
+#endif
+
+    for (uint32_t row = rowStart; row < rowEnd; row++) {
+        const uint64_t* src = bitmap_row_pixels(bitmap, row);
+        const uint64_t* mask = bitmap_row_mask(bitmap, row);
+        uint64_t* dst = framebuffer->words + (size_t)(y + (int32_t)row) * framebuffer->stride + span.firstWord;
+
+        // src[j - 1] and src[j + 1] stay inside the row's guard words
+        int32_t j = span.jStart;
+        for (; j + 2 <= bodyEnd; j += 2) {
+#if defined(__SSE2__)
+            __m128i pixels = _mm_or_si128(
+                _mm_sll_epi64(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(src + j)), flip), shiftLeft),
+                _mm_srl_epi64(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(src + j - 1)), flip), shiftRight));
+            __m128i opaque = _mm_or_si128(_mm_sll_epi64(_mm_loadu_si128((const __m128i*)(mask + j)), shiftLeft),
+                                          _mm_srl_epi64(_mm_loadu_si128((const __m128i*)(mask + j - 1)), shiftRight));
+            __m128i target = _mm_loadu_si128((const __m128i*)(dst + j));
+            target = _mm_or_si128(_mm_andnot_si128(opaque, target), _mm_and_si128(pixels, opaque));
+            _mm_storeu_si128((__m128i*)(dst + j), target);
+#else
+            uint64x2_t pixels = vorrq_u64(vshlq_u64(veorq_u64(vld1q_u64(src + j), flip), shiftLeft),
+                                          vshlq_u64(veorq_u64(vld1q_u64(src + j - 1), flip), shiftRight));
+            uint64x2_t opaque = vorrq_u64(vshlq_u64(vld1q_u64(mask + j), shiftLeft),
+                                          vshlq_u64(vld1q_u64(mask + j - 1), shiftRight));
+            vst1q_u64(dst + j, vbslq_u64(opaque, pixels, vld1q_u64(dst + j)));
+#endif
+        }
+        for (; j < bodyEnd; j++) {
+            blit_word64(dst, src, mask, j, span.shift, ~UINT64_C(0), invert);
+        }
+        if (span.hasEdge) {
+            blit_word64(dst, src, mask, bodyEnd, span.shift, framebuffer->lastWordMask, invert);
+        }
+    }
+}
+#endif
+
+typedef void (*BlitRowsFn)(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y,
+                           uint32_t rowStart, uint32_t rowEnd, uint64_t invert);
+
+static BlitRowsFn blit_rows_for_kernel(BlitKernel kernel) {
+    switch (kernel) {
+#if FRAMEBUFFER_HAS_SIMD
+        case BLIT_KERNEL_SIMD:
+            return blit_rows_simd;
+#endif
+        case BLIT_KERNEL_SCALAR32:
+            return blit_rows_scalar32;
+        default:
+            return blit_rows_scalar64;
+    }
+}
+
+// Vertical clipping: rows [rowStart, rowEnd) of the bitmap are visible
+static inline void blit_clipped(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y,
+                                BlitRowsFn blitRows, uint64_t invert) {
+    if (!bitmap || !bitmap->storage) return;
+    if (x >= (int32_t)framebuffer->width || y >= (int32_t)framebuffer->height ||
+        x + (int32_t)bitmap->width <= 0 || y + (int32_t)bitmap->height <= 0) {
+        return;
+    }
+    uint32_t rowStart = y < 0 ? (uint32_t)-y : 0;
+    uint32_t rowEnd = bitmap->height;
+    if (y + (int32_t)rowEnd > (int32_t)framebuffer->height) {
+        rowEnd = (uint32_t)((int32_t)framebuffer->height - y);
+    }
+    blitRows(framebuffer, bitmap, x, y, rowStart, rowEnd, invert);
+}
+
+static inline uint64_t blit_mode_invert(BlitMode mode) {
+    return mode == BLIT_MODE_INVERTED ? ~UINT64_C(0) : 0;
+}
+
+void framebuffer_blit(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y) {
+    framebuffer_blit_mode(framebuffer, bitmap, x, y, BLIT_MODE_COPY);
+}
+
+void framebuffer_blit_mode(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y, BlitMode mode) {
+    if (!framebuffer || !framebuffer->words) return;
+
+    blit_clipped(framebuffer, bitmap, x, y, blit_rows_for_kernel(framebuffer->kernel), blit_mode_invert(mode));
+}
+
+void framebuffer_blit_batch(Framebuffer* framebuffer, const BlitDraw* draws, uint32_t count, BlitMode mode) {
+    if (!framebuffer || !framebuffer->words || !draws) return;
+
+    // Kernel and mode are resolved once; the loop only clips and draws
+    BlitRowsFn blitRows = blit_rows_for_kernel(framebuffer->kernel);
+    uint64_t invert = blit_mode_invert(mode);
+    for (uint32_t i = 0; i < count; i++) {
+        blit_clipped(framebuffer, draws[i].bitmap, draws[i].x, draws[i].y, blitRows, invert);
+    }
+}
+
+// Pre-shifted blit: on a little-endian host pixel x of a row lives in byte
+// x / 8, so a bitmap already shifted by x % 8 lands with unaligned 8-byte
+// loads and stores and no shifting at all
+static inline uint64_t load_bytes64(const void* address) {
+    uint64_t value;
+    memcpy(&value, address, sizeof(value));
+    return value;
+}
+
+static inline void blit_bytes64(uint8_t* dst, const uint8_t* src, const uint8_t* mask,
+                                uint32_t shift, uint64_t invert) {
+    uint64_t pixels = (load_bytes64(src) ^ invert) << shift;
+    uint64_t opaque = load_bytes64(mask) << shift;
+    uint64_t target = load_bytes64(dst);
+    target = (target & ~opaque) | (pixels & opaque);
+    memcpy(dst, &target, sizeof(target));
+}
+
+bool framebuffer_blit_preshifted(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y, BlitMode mode) {
+    if (!FRAMEBUFFER_LITTLE_ENDIAN || !framebuffer || !framebuffer->words || !bitmap || !bitmap->storage) {
+        return false;
+    }
+    if (x < 0 || x % 8 != 0 || (uint32_t)x + bitmap->width > framebuffer->width) {
+        return false;
+    }
+    if (y >= (int32_t)framebuffer->height || y + (int32_t)bitmap->height <= 0) {
+        return true;
+    }
+    uint32_t rowStart = y < 0 ? (uint32_t)-y : 0;
+    uint32_t rowEnd = bitmap->height;
+    if (y + (int32_t)rowEnd > (int32_t)framebuffer->height) {
+        rowEnd = (uint32_t)((int32_t)framebuffer->height - y);
+    }
+
+    uint64_t invert = blit_mode_invert(mode);
+    uint32_t byteStart = (uint32_t)x / 8;
+    uint32_t spriteBytes = (bitmap->width + 7) / 8;
+    uint32_t rowBytes = framebuffer->wordsPerRow * (uint32_t)sizeof(uint64_t);
+
+    for (uint32_t row = rowStart; row < rowEnd; row++) {
+        const uint8_t* src = (const uint8_t*)bitmap_row_pixels(bitmap, row);
+        const uint8_t* mask = (const uint8_t*)bitmap_row_mask(bitmap, row);
+        uint8_t* dst = (uint8_t*)(framebuffer->words + (size_t)(y + (int32_t)row) * framebuffer->stride);
+
+        uint32_t k = 0;
+        for (; k + 8 <= spriteBytes; k += 8) {
+            blit_bytes64(dst + byteStart + k, src + k, mask + k, 0, invert);
+        }
+        if (k < spriteBytes) {
+            // Source bytes past the width are transparent (guard word included).
+            // Near the row end the store backs up so it never leaves the row.
+            uint32_t at = byteStart + k;
+            uint32_t back = at + 8 > rowBytes ? at + 8 - rowBytes : 0;
+            blit_bytes64(dst + at - back, src + k, mask + k, back * 8, invert);
+        }
+    }
+    return true;
+}
+
+// Kernel selection
+bool blit_kernel_is_supported(BlitKernel kernel) {
+    switch (kernel) {
+        case BLIT_KERNEL_SCALAR32: return FRAMEBUFFER_HAS_SCALAR32;
+        case BLIT_KERNEL_SCALAR64: return true;
+        case BLIT_KERNEL_SIMD: return FRAMEBUFFER_HAS_SIMD;
+        default: return false;
+    }
+}
+
+BlitKernel blit_kernel_best(void) {
+    return FRAMEBUFFER_HAS_SIMD ? BLIT_KERNEL_SIMD : BLIT_KERNEL_SCALAR64;
+}
+
+FramebufferResult framebuffer_set_blit_kernel(Framebuffer* framebuffer, BlitKernel kernel) {
+    if (!framebuffer) {
+        return FRAMEBUFFER_ERROR_NULL_POINTER;
+    }
+    if (!blit_kernel_is_supported(kernel)) {
+        return FRAMEBUFFER_ERROR_UNSUPPORTED;
+    }
+    framebuffer->kernel = kernel;
+    return FRAMEBUFFER_OK;
+}
+
+const char* blit_kernel_to_string(BlitKernel kernel) {
+    switch (kernel) {
+        case BLIT_KERNEL_SCALAR32: return "scalar32";
+        case BLIT_KERNEL_SCALAR64: return "scalar64";
+#if defined(__SSE2__)
+        case BLIT_KERNEL_SIMD: return "sse2";
+#elif FRAMEBUFFER_HAS_SIMD
+        case BLIT_KERNEL_SIMD: return "neon";
+#else
+        case BLIT_KERNEL_SIMD: return "simd";
+#endif
+        default: return "unknown";
+    }
+}
+
+// Output
+static inline uint8_t reverse_bits(uint8_t value) {
+    value = (uint8_t)((value & 0xF0) >> 4 | (value & 0x0F) << 4);
+    value = (uint8_t)((value & 0xCC) >> 2 | (value & 0x33) << 2);
+    value = (uint8_t)((value & 0xAA) >> 1 | (value & 0x55) << 1);
+    return value;
+}
+
+// Display byte b of a row: pixels 8b..8b+7, first pixel in the most significant bit
+static inline uint8_t display_byte(const uint64_t* row, uint32_t byteIndex) {
+    uint8_t lsbFirst = (uint8_t)(row[byteIndex / 8] >> ((byteIndex % 8) * 8));
+    return reverse_bits(lsbFirst);
+}
+
+void framebuffer_export_rows(const Framebuffer* framebuffer, uint8_t* out, uint32_t rowBytes) {
+    if (!framebuffer || !framebuffer->words || !out) return;
+
+    uint32_t pixelBytes = (framebuffer->width + 7) / 8;
+    for (uint32_t y = 0; y < framebuffer->height; y++) {
+        const uint64_t* row = framebuffer->words + (size_t)y * framebuffer->stride;
+        uint8_t* dst = out + (size_t)y * rowBytes;
+        for (uint32_t b = 0; b < rowBytes; b++) {
+            dst[b] = b < pixelBytes ? display_byte(row, b) : 0;
+        }
+    }
+}
+
+bool framebuffer_write_pbm(const Framebuffer* framebuffer, FILE* out) {
+    if (!framebuffer || !framebuffer->words || !out) return false;
+
+    // PBM: 1 = black, rows padded to whole bytes with zero bits
+    uint32_t pixelBytes = (framebuffer->width + 7) / 8;
+    uint32_t tailBits = framebuffer->width % 8;
+    uint8_t tailMask = tailBits ? (uint8_t)(0xFF << (8 - tailBits)) : 0xFF;
+
+    if (fprintf(out, "P4\n%u %u\n", framebuffer->width, framebuffer->height) < 0) {
+        return false;
+    }
+    for (uint32_t y = 0; y < framebuffer->height; y++) {
+        const uint64_t* row = framebuffer->words + (size_t)y * framebuffer->stride;
+        for (uint32_t b = 0; b < pixelBytes; b++) {
+            uint8_t value = (uint8_t)~display_byte(row, b);
+            if (b + 1 == pixelBytes) value &= tailMask;
+            if (fputc(value, out) == EOF) return false;
+        }
+    }
+    return true;
+}
+
+uint64_t framebuffer_hash(const Framebuffer* framebuffer) {
+    uint64_t hash = UINT64_C(14695981039346656037);
+    if (!framebuffer || !framebuffer->words) return hash;
+
+    for (uint32_t y = 0; y < framebuffer->height; y++) {
+        const uint64_t* row = framebuffer->words + (size_t)y * framebuffer->stride;
+        for (uint32_t w = 0; w < framebuffer->wordsPerRow; w++) {
+            uint64_t word = row[w];
+            if (w + 1 == framebuffer->wordsPerRow) {
+                word &= framebuffer->lastWordMask;
+            }
+            for (uint32_t b = 0; b < 8; b++) {
+                hash ^= (word >> (b * 8)) & 0xFF;
+                hash *= UINT64_C(1099511628211);
+            }
+        }
+    }
+    return hash;
+}
+
+// Render target
+void framebuffer_set_render_target(Framebuffer* framebuffer) {
+    g_renderTarget = framebuffer;
+}
+
+Framebuffer* framebuffer_get_render_target(void) {
+    return g_renderTarget;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file framebuffer.h
+ * @brief Headless 1-bit software framebuffer with masked word blits
+ *
+ * Renders the Playdate's 400x240 1-bit display in memory, e.g. to record
+ * spectator replays on servers. Rows use the same LSB-first 64-bit word
+ * layout as Bitmap (see bitmap.h); framebuffer_export_rows() converts to the
+ * display's 52-byte MSB-first rows and framebuffer_write_pbm() to a PBM file.
+ *
+ * framebuffer_blit() draws a masked bitmap at any integer position, clipped
+ * to the framebuffer. The horizontal shift is applied to whole words:
+ * destination word j is (src[j] << s) | (src[j - 1] >> (W - s)), then merged
+ * as (dst & ~mask) | (src & mask). Three kernels implement that loop:
+ *
+ * - BLIT_KERNEL_SCALAR32: 32-bit words, the Cortex-M7's native width
+ * - BLIT_KERNEL_SCALAR64: 64-bit words
+ * - BLIT_KERNEL_SIMD:     two 64-bit words per SSE2/NEON operation
+ *
+ * All kernels produce identical pixels; new framebuffers use the fastest
+ * one the build supports. BLIT_MODE_INVERTED flips the source pixels on the
+ * way through the same loop. framebuffer_blit_batch() resolves kernel and
+ * mode once for a whole list of draws, which is how the render queue
+ * (render_queue.h) executes its batches.
+ *
+ * Usage Example:
+ * @code
+ * Framebuffer framebuffer;
+ * framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+ * framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+ * framebuffer_blit(&framebuffer, &shipBitmap, shipX, shipY);
+ *
+ * uint8_t display[FRAMEBUFFER_HEIGHT * FRAMEBUFFER_ROW_BYTES];
+ * framebuffer_export_rows(&framebuffer, display, FRAMEBUFFER_ROW_BYTES);
+ * framebuffer_destroy(&framebuffer);
+ * @endcode
+ */
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "bitmap.h"
+#include <stdio.h>
+
+// Playdate display
+#define FRAMEBUFFER_WIDTH 400
+#define FRAMEBUFFER_HEIGHT 240
+#define FRAMEBUFFER_ROW_BYTES 52           // Display row stride (MSB-first bytes)
+
+// Blit kernels (identical output, different word width)
+typedef enum {
+    BLIT_KERNEL_SCALAR32 = 0,
+    BLIT_KERNEL_SCALAR64,
+    BLIT_KERNEL_SIMD,                      // SSE2 or NEON, when compiled in
+    BLIT_KERNEL_COUNT
+} BlitKernel;
+
+// Draw modes (Playdate kDrawModeCopy / kDrawModeInverted)
+typedef enum {
+    BLIT_MODE_COPY = 0,
+    BLIT_MODE_INVERTED,                    // Opaque pixels drawn with colors flipped
+    BLIT_MODE_COUNT
+} BlitMode;
+
+// Framebuffer results
+typedef enum {
+    FRAMEBUFFER_OK = 0,
+    FRAMEBUFFER_ERROR_NULL_POINTER,
+    FRAMEBUFFER_ERROR_INVALID_SIZE,
+    FRAMEBUFFER_ERROR_OUT_OF_MEMORY,
+    FRAMEBUFFER_ERROR_UNSUPPORTED          // Kernel not available in this build
+} FramebufferResult;
+
+typedef struct Framebuffer {
+    uint64_t* words;               // height * wordsPerRow, LSB-first
+    uint32_t width;
+    uint32_t height;
+    uint32_t wordsPerRow;
+    uint32_t stride;               // Words between rows (wordsPerRow unless this is a view)
+    uint64_t lastWordMask;         // Valid bits of each row's last word
+    BlitKernel kernel;
+} Framebuffer;
+
+// One bitmap placement for framebuffer_blit_batch()
+typedef struct BlitDraw {
+    const Bitmap* bitmap;
+    int32_t x;
+    int32_t y;
+} BlitDraw;
+
+// Lifecycle
+FramebufferResult framebuffer_init(Framebuffer* framebuffer, uint32_t width, uint32_t height);
+void framebuffer_destroy(Framebuffer* framebuffer);
+
+// A window onto another framebuffer's pixels, e.g. to redraw one dirty
+// region: drawing is clipped to it and coordinates are relative to (x, y).
+// x must be a multiple of 64; the width is rounded up to whole words.
+// Views own nothing and are never destroyed.
+FramebufferResult framebuffer_init_view(Framebuffer* view, const Framebuffer* parent,
+                                        uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+// Drawing
+void framebuffer_clear(Framebuffer* framebuffer, BitmapColor color);
+void framebuffer_set_pixel(Framebuffer* framebuffer, int32_t x, int32_t y, BitmapColor color);
+BitmapColor framebuffer_get_pixel(const Framebuffer* framebuffer, int32_t x, int32_t y);
+void framebuffer_blit(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y);
+void framebuffer_blit_mode(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y, BlitMode mode);
+void framebuffer_blit_batch(Framebuffer* framebuffer, const BlitDraw* draws, uint32_t count, BlitMode mode);
+
+// Draws a bitmap already shifted right by the sub-byte part of its position
+// (see sprite_cache.h) at byte-aligned x, without any shifting. Returns
+// false, drawing nothing, if x is not a multiple of 8, the bitmap crosses
+// the left or right edge, or the host is big-endian.
+bool framebuffer_blit_preshifted(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y, BlitMode mode);
+
+// Kernel selection
+FramebufferResult framebuffer_set_blit_kernel(Framebuffer* framebuffer, BlitKernel kernel);
+bool blit_kernel_is_supported(BlitKernel kernel);
+BlitKernel blit_kernel_best(void);
+const char* blit_kernel_to_string(BlitKernel kernel);
+
+// Output
+void framebuffer_export_rows(const Framebuffer* framebuffer, uint8_t* out, uint32_t rowBytes);
+bool framebuffer_write_pbm(const Framebuffer* framebuffer, FILE* out);
+uint64_t framebuffer_hash(const Framebuffer* framebuffer);   // FNV-1a over visible pixels
+
+// Render target used by component render callbacks (NULL = rendering disabled)
+void framebuffer_set_render_target(Framebuffer* framebuffer);
+Framebuffer* framebuffer_get_render_target(void);
+
+#endif // FRAMEBUFFER_H
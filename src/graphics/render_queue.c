@@ -0,0 +1,201 @@
+#include "render_queue.h"
+#include "sprite_cache.h"
+#include "../core/memory_budget.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define RENDER_QUEUE_KEY_BYTES 8
+#define RENDER_QUEUE_MAX_CAPACITY (1u << 20)
+
+// All arrays share one allocation; the histograms come first for alignment
+static size_t render_queue_bytes(uint32_t capacity) {
+    return RENDER_QUEUE_KEY_BYTES * 256 * sizeof(uint32_t) +
+           (size_t)capacity * (2 * sizeof(RenderCommand) + 2 * sizeof(BlitDraw) + sizeof(RenderBatch));
+}
+
+// Lifecycle
+RenderQueueResult render_queue_init(RenderQueue* queue, uint32_t capacity) {
+    if (!queue) {
+        return RENDER_QUEUE_ERROR_NULL_POINTER;
+    }
+    if (capacity == 0 || capacity > RENDER_QUEUE_MAX_CAPACITY) {
+        return RENDER_QUEUE_ERROR_INVALID_CAPACITY;
+    }
+
+    size_t bytes = render_queue_bytes(capacity);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return RENDER_QUEUE_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* storage = malloc(bytes);
+    if (!storage) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes);
+        return RENDER_QUEUE_ERROR_OUT_OF_MEMORY;
+    }
+
+    memset(queue, 0, sizeof(RenderQueue));
+    queue->histograms = (uint32_t (*)[256])storage;
+    queue->commands = (RenderCommand*)(storage + RENDER_QUEUE_KEY_BYTES * 256 * sizeof(uint32_t));
+    queue->scratch = queue->commands + capacity;
+    queue->draws = (BlitDraw*)(queue->scratch + capacity);
+    queue->sorted = queue->draws + capacity;
+    queue->batches = (RenderBatch*)(queue->sorted + capacity);
+    queue->capacity = capacity;
+    queue->isSorted = true;
+    return RENDER_QUEUE_OK;
+}
+
+RenderQueueResult render_queue_reserve(RenderQueue* queue, uint32_t capacity) {
+    if (!queue) {
+        return RENDER_QUEUE_ERROR_NULL_POINTER;
+    }
+    if (queue->histograms && capacity <= queue->capacity) {
+        return RENDER_QUEUE_OK;
+    }
+
+    // Grow geometrically so a slowly rising sprite count reallocates rarely
+    uint32_t newCapacity = queue->capacity ? queue->capacity : 64;
+    while (newCapacity < capacity && newCapacity < RENDER_QUEUE_MAX_CAPACITY) {
+        newCapacity *= 2;
+    }
+
+    RenderQueue grown;
+    RenderQueueResult result = render_queue_init(&grown, newCapacity);
+    if (result != RENDER_QUEUE_OK) {
+        return result;
+    }
+    grown.spriteCache = queue->spriteCache;
+    render_queue_destroy(queue);
+    *queue = grown;
+    return RENDER_QUEUE_OK;
+}
+
+void render_queue_destroy(RenderQueue* queue) {
+    if (!queue || !queue->histograms) return;
+
+    memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)render_queue_bytes(queue->capacity));
+    free(queue->histograms);
+    memset(queue, 0, sizeof(RenderQueue));
+}
+
+// Per frame
+void render_queue_clear(RenderQueue* queue) {
+    if (!queue) return;
+
+    queue->count = 0;
+    queue->batchCount = 0;
+    queue->isSorted = true;
+}
+
+RenderQueueResult render_queue_submit(RenderQueue* queue, uint64_t key, const Bitmap* bitmap, int32_t x, int32_t y) {
+    if (!queue || !queue->histograms) {
+        return RENDER_QUEUE_ERROR_NULL_POINTER;
+    }
+    if (queue->count >= queue->capacity) {
+        return RENDER_QUEUE_ERROR_FULL;
+    }
+
+    uint32_t index = queue->count++;
+    queue->commands[index].key = key;
+    queue->commands[index].index = index;
+    queue->commands[index].padding = 0;
+    queue->draws[index].bitmap = bitmap;
+    queue->draws[index].x = x;
+    queue->draws[index].y = y;
+    queue->isSorted = false;
+    return RENDER_QUEUE_OK;
+}
+
+// LSD radix sort, one byte per pass. All histograms are built in a single
+// read of the keys; a byte where every key falls in one bucket is skipped.
+static void render_queue_radix_sort(RenderQueue* queue) {
+    uint32_t count = queue->count;
+    uint32_t (*histograms)[256] = queue->histograms;
+    memset(histograms, 0, RENDER_QUEUE_KEY_BYTES * 256 * sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t key = queue->commands[i].key;
+        for (uint32_t b = 0; b < RENDER_QUEUE_KEY_BYTES; b++) {
+            histograms[b][(key >> (b * 8)) & 0xFF]++;
+        }
+    }
+
+    RenderCommand* src = queue->commands;
+    RenderCommand* dst = queue->scratch;
+    queue->radixPasses = 0;
+
+    for (uint32_t b = 0; b < RENDER_QUEUE_KEY_BYTES; b++) {
+        uint32_t* histogram = histograms[b];
+        if (histogram[(src[0].key >> (b * 8)) & 0xFF] == count) {
+            continue;
+        }
+
+        // Exclusive prefix sum turns counts into bucket offsets
+        uint32_t offset = 0;
+        for (uint32_t d = 0; d < 256; d++) {
+            uint32_t bucket = histogram[d];
+            histogram[d] = offset;
+            offset += bucket;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            dst[histogram[(src[i].key >> (b * 8)) & 0xFF]++] = src[i];
+        }
+
+        RenderCommand* swap = src;
+        src = dst;
+        dst = swap;
+        queue->radixPasses++;
+    }
+
+    // An odd number of passes leaves the result in the scratch buffer
+    if (src != queue->commands) {
+        memcpy(queue->commands, src, count * sizeof(RenderCommand));
+    }
+}
+
+void render_queue_sort(RenderQueue* queue) {
+    if (!queue || !queue->histograms || queue->isSorted) return;
+
+    uint32_t count = queue->count;
+    queue->batchCount = 0;
+    if (count > 0) {
+        render_queue_radix_sort(queue);
+    }
+
+    // Gather draws into sorted order and cut batches where atlas or mode change
+    uint64_t batchState = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const RenderCommand* command = &queue->commands[i];
+        queue->sorted[i] = queue->draws[command->index];
+
+        uint64_t state = command->key & RENDER_KEY_STATE_MASK;
+        if (queue->batchCount == 0 || state != batchState) {
+            RenderBatch* batch = &queue->batches[queue->batchCount++];
+            batch->start = i;
+            batch->count = 0;
+            batch->atlasId = (uint16_t)(command->key >> RENDER_KEY_ATLAS_SHIFT);
+            batch->mode = (uint8_t)(command->key >> RENDER_KEY_MODE_SHIFT);
+            batchState = state;
+        }
+        queue->batches[queue->batchCount - 1].count++;
+    }
+    queue->isSorted = true;
+}
+
+void render_queue_execute(RenderQueue* queue, Framebuffer* framebuffer) {
+    if (!queue || !queue->histograms || !framebuffer) return;
+
+    render_queue_sort(queue);
+    for (uint32_t b = 0; b < queue->batchCount; b++) {
+        const RenderBatch* batch = &queue->batches[b];
+        if (queue->spriteCache) {
+            sprite_cache_blit_batch(queue->spriteCache, framebuffer, queue->sorted + batch->start, batch->count,
+                                    (BlitMode)batch->mode);
+        } else {
+            framebuffer_blit_batch(framebuffer, queue->sorted + batch->start, batch->count, (BlitMode)batch->mode);
+        }
+    }
+}
+
+void render_queue_set_sprite_cache(RenderQueue* queue, SpriteCache* cache) {
+    if (queue) queue->spriteCache = cache;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file render_queue.h
+ * @brief Radix-sorted render commands executed in state batches
+ *
+ * Each frame the sprite pass submits one command per visible sprite: a
+ * 64-bit sort key plus the index of its draw (bitmap and position). Sorting
+ * is an LSD radix sort over the key bytes, so it is O(n) and stable: equal
+ * keys keep submission order. Byte positions where every key has the same
+ * value (e.g. a single atlas) are detected from the histograms and skipped.
+ *
+ * Key layout, most significant first:
+ *
+ *   | layer 8 | z 16 | atlas 16 | mode 8 | y 16 |
+ *
+ * After sorting, the draws are gathered into draw order and split into
+ * batches of consecutive commands that share atlas and draw mode. Execution
+ * hands each batch to framebuffer_blit_batch(), which resolves blit kernel
+ * and mode once, so the inner draw loop never checks for state changes.
+ *
+ * Storage is allocated up front (charged to MEMORY_SUBSYSTEM_SCENE);
+ * building and executing a frame does not allocate.
+ *
+ * Usage Example:
+ * @code
+ * RenderQueue queue;
+ * render_queue_init(&queue, 1024);
+ *
+ * render_queue_clear(&queue);
+ * render_queue_submit(&queue, render_key_make(layer, z, bitmap->atlasId, BLIT_MODE_COPY, y), bitmap, x, y);
+ * render_queue_sort(&queue);
+ * render_queue_execute(&queue, &framebuffer);
+ *
+ * render_queue_destroy(&queue);
+ * @endcode
+ */
+
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include "framebuffer.h"
+
+// Sort key fields
+#define RENDER_KEY_LAYER_SHIFT 56
+#define RENDER_KEY_Z_SHIFT 40
+#define RENDER_KEY_ATLAS_SHIFT 24
+#define RENDER_KEY_MODE_SHIFT 16
+#define RENDER_KEY_Y_SHIFT 0
+#define RENDER_KEY_Y_BIAS 32768            // Screen y is signed; biased into 16 bits
+#define RENDER_KEY_STATE_MASK (UINT64_C(0xFFFFFF) << RENDER_KEY_MODE_SHIFT)   // Atlas and mode
+
+// World-space view; (x, y) maps to framebuffer pixel (0, 0)
+typedef struct RenderCamera {
+    float x;
+    float y;
+    float width;
+    float height;
+} RenderCamera;
+
+// Render queue results
+typedef enum {
+    RENDER_QUEUE_OK = 0,
+    RENDER_QUEUE_ERROR_NULL_POINTER,
+    RENDER_QUEUE_ERROR_INVALID_CAPACITY,
+    RENDER_QUEUE_ERROR_OUT_OF_MEMORY,
+    RENDER_QUEUE_ERROR_BUDGET_EXCEEDED,
+    RENDER_QUEUE_ERROR_FULL
+} RenderQueueResult;
+
+// Sort key plus the index of its draw (16 bytes)
+typedef struct RenderCommand {
+    uint64_t key;
+    uint32_t index;
+    uint32_t padding;
+} RenderCommand;
+
+// Consecutive sorted draws sharing atlas and draw mode
+typedef struct RenderBatch {
+    uint32_t start;
+    uint32_t count;
+    uint16_t atlasId;
+    uint8_t mode;                          // BlitMode
+} RenderBatch;
+
+typedef struct RenderQueue {
+    RenderCommand* commands;       // Submission order; sorted in place by render_queue_sort()
+    RenderCommand* scratch;        // Radix sort ping-pong buffer
+    BlitDraw* draws;               // Indexed by RenderCommand.index
+    BlitDraw* sorted;              // Draw order, filled by render_queue_sort()
+    RenderBatch* batches;
+    uint32_t (*histograms)[256];   // One per key byte
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t batchCount;
+    uint32_t radixPasses;          // Passes the last sort actually ran (0-8)
+    bool isSorted;                 // sorted and batches match the submitted commands
+    struct SpriteCache* spriteCache;   // Optional pre-shifted copies for execute (not owned)
+} RenderQueue;
+
+// Lifecycle
+RenderQueueResult render_queue_init(RenderQueue* queue, uint32_t capacity);
+RenderQueueResult render_queue_reserve(RenderQueue* queue, uint32_t capacity);   // Grows, keeps nothing
+void render_queue_destroy(RenderQueue* queue);
+
+// Per frame
+void render_queue_clear(RenderQueue* queue);
+RenderQueueResult render_queue_submit(RenderQueue* queue, uint64_t key, const Bitmap* bitmap, int32_t x, int32_t y);
+void render_queue_sort(RenderQueue* queue);
+void render_queue_execute(RenderQueue* queue, Framebuffer* framebuffer);   // Sorts first if needed
+
+// Execute draws small sprites through the cache's pre-shifted copies (NULL to stop)
+struct SpriteCache;
+void render_queue_set_sprite_cache(RenderQueue* queue, struct SpriteCache* cache);
+
+// Key construction
+static inline uint64_t render_key_make(uint8_t layer, uint16_t z, uint16_t atlasId, BlitMode mode, int32_t y) {
+    int32_t biased = y + RENDER_KEY_Y_BIAS;
+    uint16_t sortY = biased < 0 ? 0 : biased > UINT16_MAX ? UINT16_MAX : (uint16_t)biased;
+    return (uint64_t)layer << RENDER_KEY_LAYER_SHIFT |
+           (uint64_t)z << RENDER_KEY_Z_SHIFT |
+           (uint64_t)atlasId << RENDER_KEY_ATLAS_SHIFT |
+           (uint64_t)(uint8_t)mode << RENDER_KEY_MODE_SHIFT |
+           (uint64_t)sortY << RENDER_KEY_Y_SHIFT;
+}
+
+#endif // RENDER_QUEUE_H
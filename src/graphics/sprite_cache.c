@@ -0,0 +1,275 @@
+#include "sprite_cache.h"
+#include "../core/memory_budget.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SPRITE_CACHE_MAX_CAPACITY (1u << 16)
+
+// Entries and hash table share one allocation
+static size_t sprite_cache_table_bytes(uint32_t capacity, uint32_t tableSize) {
+    return (size_t)capacity * sizeof(SpriteCacheEntry) + (size_t)tableSize * sizeof(uint32_t);
+}
+
+static uint32_t hash_slot(const SpriteCache* cache, const Bitmap* source) {
+    uint64_t value = (uint64_t)(uintptr_t)source;
+    value ^= value >> 17;
+    return (uint32_t)((value * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & (cache->tableSize - 1);
+}
+
+// Lifecycle
+SpriteCacheResult sprite_cache_init(SpriteCache* cache, uint32_t capacity, size_t budgetBytes) {
+    if (!cache) {
+        return SPRITE_CACHE_ERROR_NULL_POINTER;
+    }
+    if (capacity == 0 || capacity > SPRITE_CACHE_MAX_CAPACITY) {
+        return SPRITE_CACHE_ERROR_INVALID_CAPACITY;
+    }
+
+    uint32_t tableSize = 4;
+    while (tableSize < capacity * 2) tableSize *= 2;
+    size_t bytes = sprite_cache_table_bytes(capacity, tableSize);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes) != MEMORY_BUDGET_OK) {
+        return SPRITE_CACHE_ERROR_BUDGET_EXCEEDED;
+    }
+    uint8_t* storage = calloc(1, bytes);
+    if (!storage) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)bytes);
+        return SPRITE_CACHE_ERROR_OUT_OF_MEMORY;
+    }
+
+    memset(cache, 0, sizeof(SpriteCache));
+    cache->entries = (SpriteCacheEntry*)storage;
+    cache->table = (uint32_t*)(storage + (size_t)capacity * sizeof(SpriteCacheEntry));
+    cache->capacity = capacity;
+    cache->tableSize = tableSize;
+    cache->budgetBytes = budgetBytes;
+    sprite_cache_clear(cache);
+    return SPRITE_CACHE_OK;
+}
+
+static void entry_release_copies(SpriteCache* cache, SpriteCacheEntry* entry) {
+    for (uint32_t s = 1; s < SPRITE_CACHE_SHIFTS; s++) {
+        bitmap_destroy(&entry->shifted[s]);
+    }
+    if (entry->bytes) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, entry->bytes);
+        cache->usedBytes -= entry->bytes;
+        entry->bytes = 0;
+    }
+}
+
+void sprite_cache_destroy(SpriteCache* cache) {
+    if (!cache || !cache->entries) return;
+
+    sprite_cache_clear(cache);
+    memory_budget_release(MEMORY_SUBSYSTEM_SCENE, (uint32_t)sprite_cache_table_bytes(cache->capacity, cache->tableSize));
+    free(cache->entries);
+    memset(cache, 0, sizeof(SpriteCache));
+}
+
+void sprite_cache_clear(SpriteCache* cache) {
+    if (!cache || !cache->entries) return;
+
+    for (uint32_t i = 0; i < cache->capacity; i++) {
+        SpriteCacheEntry* entry = &cache->entries[i];
+        if (entry->source) {
+            entry_release_copies(cache, entry);
+        }
+        memset(entry, 0, sizeof(SpriteCacheEntry));
+        entry->prev = SPRITE_CACHE_NONE;
+        entry->next = i + 1 < cache->capacity ? i + 1 : SPRITE_CACHE_NONE;
+    }
+    for (uint32_t i = 0; i < cache->tableSize; i++) {
+        cache->table[i] = SPRITE_CACHE_NONE;
+    }
+    cache->count = 0;
+    cache->head = SPRITE_CACHE_NONE;
+    cache->tail = SPRITE_CACHE_NONE;
+    cache->freeHead = 0;
+}
+
+// Hash table (linear probing)
+static uint32_t table_find(const SpriteCache* cache, const Bitmap* source) {
+    uint32_t mask = cache->tableSize - 1;
+    for (uint32_t slot = hash_slot(cache, source);; slot = (slot + 1) & mask) {
+        uint32_t index = cache->table[slot];
+        if (index == SPRITE_CACHE_NONE || cache->entries[index].source == source) {
+            return slot;
+        }
+    }
+}
+
+// Backward-shift deletion keeps every probe chain unbroken without tombstones
+static void table_remove(SpriteCache* cache, uint32_t slot) {
+    uint32_t mask = cache->tableSize - 1;
+    cache->table[slot] = SPRITE_CACHE_NONE;
+    for (uint32_t next = (slot + 1) & mask; cache->table[next] != SPRITE_CACHE_NONE; next = (next + 1) & mask) {
+        uint32_t home = hash_slot(cache, cache->entries[cache->table[next]].source);
+        bool movable = slot <= next ? (home <= slot || home > next) : (home <= slot && home > next);
+        if (movable) {
+            cache->table[slot] = cache->table[next];
+            cache->table[next] = SPRITE_CACHE_NONE;
+            slot = next;
+        }
+    }
+}
+
+// LRU list
+static void lru_unlink(SpriteCache* cache, uint32_t index) {
+    SpriteCacheEntry* entry = &cache->entries[index];
+    if (entry->prev != SPRITE_CACHE_NONE) cache->entries[entry->prev].next = entry->next;
+    else cache->head = entry->next;
+    if (entry->next != SPRITE_CACHE_NONE) cache->entries[entry->next].prev = entry->prev;
+    else cache->tail = entry->prev;
+    entry->prev = entry->next = SPRITE_CACHE_NONE;
+}
+
+static void lru_push_front(SpriteCache* cache, uint32_t index) {
+    SpriteCacheEntry* entry = &cache->entries[index];
+    entry->prev = SPRITE_CACHE_NONE;
+    entry->next = cache->head;
+    if (cache->head != SPRITE_CACHE_NONE) cache->entries[cache->head].prev = index;
+    cache->head = index;
+    if (cache->tail == SPRITE_CACHE_NONE) cache->tail = index;
+}
+
+static void entry_evict(SpriteCache* cache, uint32_t index) {
+    SpriteCacheEntry* entry = &cache->entries[index];
+    entry_release_copies(cache, entry);
+    table_remove(cache, table_find(cache, entry->source));
+    lru_unlink(cache, index);
+    memset(entry, 0, sizeof(SpriteCacheEntry));
+    entry->prev = SPRITE_CACHE_NONE;
+    entry->next = cache->freeHead;
+    cache->freeHead = index;
+    cache->count--;
+}
+
+static uint32_t entry_acquire(SpriteCache* cache, const Bitmap* source, uint32_t slot) {
+    if (cache->freeHead == SPRITE_CACHE_NONE) {
+        entry_evict(cache, cache->tail);
+        cache->evictions++;
+        slot = table_find(cache, source);   // Deletion may have moved the probe chain
+    }
+
+    uint32_t index = cache->freeHead;
+    SpriteCacheEntry* entry = &cache->entries[index];
+    cache->freeHead = entry->next;
+    entry->source = source;
+    entry->sourceStorage = source->storage;
+    cache->table[slot] = index;
+    lru_push_front(cache, index);
+    cache->count++;
+    return index;
+}
+
+static bool build_shifted(const Bitmap* source, uint32_t shift, Bitmap* copy) {
+    if (bitmap_init(copy, source->width + shift, source->height) != BITMAP_OK) {
+        return false;
+    }
+    copy->atlasId = source->atlasId;
+
+    // Word j takes its high bits from source word j and its low bits from
+    // word j - 1; the guard words make both ends read zeros
+    for (uint32_t y = 0; y < source->height; y++) {
+        const uint64_t* planes[2] = {bitmap_row_pixels(source, y), bitmap_row_mask(source, y)};
+        uint64_t* out[2] = {copy->pixels + (size_t)y * copy->stride, copy->mask + (size_t)y * copy->stride};
+        for (int p = 0; p < 2; p++) {
+            for (uint32_t j = 0; j < copy->wordsPerRow; j++) {
+                uint64_t word = j < source->wordsPerRow ? planes[p][j] : 0;
+                out[p][j] = (word << shift) | (planes[p][(int32_t)j - 1] >> (BITMAP_WORD_BITS - shift));
+            }
+        }
+    }
+    return true;
+}
+
+// Lookup
+const Bitmap* sprite_cache_get(SpriteCache* cache, const Bitmap* source, uint32_t shift) {
+    if (!cache || !cache->entries || !source || !source->storage || shift >= SPRITE_CACHE_SHIFTS ||
+        source->width > SPRITE_CACHE_MAX_WIDTH) {
+        return NULL;
+    }
+    if (shift == 0) {
+        cache->hits++;
+        return source;
+    }
+
+    uint32_t slot = table_find(cache, source);
+    uint32_t index = cache->table[slot];
+    if (index == SPRITE_CACHE_NONE) {
+        index = entry_acquire(cache, source, slot);
+    } else {
+        lru_unlink(cache, index);
+        lru_push_front(cache, index);
+    }
+
+    SpriteCacheEntry* entry = &cache->entries[index];
+    if (entry->sourceStorage != source->storage) {
+        entry_release_copies(cache, entry);
+        entry->sourceStorage = source->storage;
+    }
+    if (entry->shifted[shift].storage) {
+        cache->hits++;
+        return &entry->shifted[shift];
+    }
+
+    // Both planes as laid out by bitmap_init(); make room oldest first,
+    // never evicting the entry being filled
+    uint32_t width = source->width + shift;
+    uint32_t stride = (width + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS + 1;
+    uint32_t bytes = (uint32_t)((1 + (size_t)source->height * stride) * 2 * sizeof(uint64_t));
+    while (cache->usedBytes + bytes > cache->budgetBytes && cache->tail != index) {
+        entry_evict(cache, cache->tail);
+        cache->evictions++;
+    }
+    if (cache->usedBytes + bytes > cache->budgetBytes) {
+        return NULL;
+    }
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SCENE, bytes) != MEMORY_BUDGET_OK) {
+        return NULL;
+    }
+    Bitmap* copy = &entry->shifted[shift];
+    if (!build_shifted(source, shift, copy)) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SCENE, bytes);
+        return NULL;
+    }
+    entry->bytes += bytes;
+    cache->usedBytes += bytes;
+    cache->misses++;
+    return copy;
+}
+
+void sprite_cache_invalidate(SpriteCache* cache, const Bitmap* source) {
+    if (!cache || !cache->entries || !source) return;
+
+    uint32_t index = cache->table[table_find(cache, source)];
+    if (index != SPRITE_CACHE_NONE) {
+        entry_evict(cache, index);
+    }
+}
+
+// Drawing
+void sprite_cache_blit(SpriteCache* cache, Framebuffer* framebuffer, const Bitmap* bitmap,
+                       int32_t x, int32_t y, BlitMode mode) {
+    if (!framebuffer || !bitmap) return;
+    if (y >= (int32_t)framebuffer->height || y + (int32_t)bitmap->height <= 0) return;
+
+    if (cache && x >= 0 && (uint32_t)x + bitmap->width <= framebuffer->width) {
+        const Bitmap* copy = sprite_cache_get(cache, bitmap, (uint32_t)x % 8);
+        if (copy && framebuffer_blit_preshifted(framebuffer, copy, x & ~7, y, mode)) {
+            return;
+        }
+    }
+    if (cache) cache->bypasses++;
+    framebuffer_blit_mode(framebuffer, bitmap, x, y, mode);
+}
+
+void sprite_cache_blit_batch(SpriteCache* cache, Framebuffer* framebuffer, const BlitDraw* draws,
+                             uint32_t count, BlitMode mode) {
+    if (!draws) return;
+
+    for (uint32_t i = 0; i < count; i++) {
+        sprite_cache_blit(cache, framebuffer, draws[i].bitmap, draws[i].x, draws[i].y, mode);
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file sprite_cache.h
+ * @brief LRU cache of pre-shifted sprite copies
+ *
+ * A blit at an arbitrary x shifts every source word by x % 64 on the way
+ * to the framebuffer (see framebuffer.h). For small sprites drawn every
+ * frame the cache trades memory for that work: it keeps up to
+ * SPRITE_CACHE_SHIFTS copies of a sprite, copy s shifted right by s pixels,
+ * so a draw at x picks copy x % 8 and stores it at byte x / 8 with no
+ * shifting (framebuffer_blit_preshifted()). Copy 0 is the sprite itself.
+ *
+ * Copies are built on first use and entries are evicted least recently
+ * used first, whenever the entry table is full or a new copy would exceed
+ * the byte budget. Memory is also charged to MEMORY_SUBSYSTEM_SCENE.
+ *
+ * Only sprites up to SPRITE_CACHE_MAX_WIDTH pixels wide are cached, and
+ * only draws fully inside the framebuffer horizontally use the copies;
+ * everything else goes through the regular blit kernel.
+ *
+ * Entries are keyed by bitmap address. Call sprite_cache_invalidate()
+ * after changing a cached bitmap's pixels or before destroying it.
+ *
+ * Usage Example:
+ * @code
+ * SpriteCache cache;
+ * sprite_cache_init(&cache, 64, 64 * 1024);
+ * render_queue_set_sprite_cache(&queue, &cache);   // Or sprite_cache_blit() directly
+ *
+ * sprite_cache_destroy(&cache);
+ * @endcode
+ */
+
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include "framebuffer.h"
+
+#define SPRITE_CACHE_SHIFTS 8
+#define SPRITE_CACHE_MAX_WIDTH 64
+#define SPRITE_CACHE_NONE UINT32_MAX
+
+// Sprite cache results
+typedef enum {
+    SPRITE_CACHE_OK = 0,
+    SPRITE_CACHE_ERROR_NULL_POINTER,
+    SPRITE_CACHE_ERROR_INVALID_CAPACITY,
+    SPRITE_CACHE_ERROR_OUT_OF_MEMORY,
+    SPRITE_CACHE_ERROR_BUDGET_EXCEEDED
+} SpriteCacheResult;
+
+typedef struct SpriteCacheEntry {
+    const Bitmap* source;                  // NULL = free entry
+    const uint64_t* sourceStorage;         // Catches a bitmap re-initialised at the same address
+    Bitmap shifted[SPRITE_CACHE_SHIFTS];   // shifted[s] for s > 0 once built
+    uint32_t bytes;                        // Storage of the built copies
+    uint32_t prev;                         // LRU list, most recent first
+    uint32_t next;
+} SpriteCacheEntry;
+
+typedef struct SpriteCache {
+    SpriteCacheEntry* entries;
+    uint32_t* table;               // Open addressing: entry index or SPRITE_CACHE_NONE
+    uint32_t capacity;             // Entries
+    uint32_t tableSize;            // Power of two, at least twice the capacity
+    uint32_t count;
+    uint32_t head;                 // Most recently used
+    uint32_t tail;                 // Least recently used
+    uint32_t freeHead;             // Free entries, linked through next
+    size_t budgetBytes;
+    size_t usedBytes;
+
+    // Statistics
+    uint64_t hits;
+    uint64_t misses;               // Copies built
+    uint64_t evictions;
+    uint64_t bypasses;             // Draws that used the regular kernel
+} SpriteCache;
+
+// Lifecycle
+SpriteCacheResult sprite_cache_init(SpriteCache* cache, uint32_t capacity, size_t budgetBytes);
+void sprite_cache_destroy(SpriteCache* cache);
+
+// Copy of source shifted right by shift (0-7) pixels, built on a miss;
+// NULL if the sprite is too wide or the copy does not fit the budget
+const Bitmap* sprite_cache_get(SpriteCache* cache, const Bitmap* source, uint32_t shift);
+void sprite_cache_invalidate(SpriteCache* cache, const Bitmap* source);
+void sprite_cache_clear(SpriteCache* cache);
+
+// Draws through a cached copy when possible, else with the regular kernel
+void sprite_cache_blit(SpriteCache* cache, Framebuffer* framebuffer, const Bitmap* bitmap,
+                       int32_t x, int32_t y, BlitMode mode);
+void sprite_cache_blit_batch(SpriteCache* cache, Framebuffer* framebuffer, const BlitDraw* draws,
+                             uint32_t count, BlitMode mode);
+
+#endif // SPRITE_CACHE_H
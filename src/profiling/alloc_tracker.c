@@ -0,0 +1,218 @@
+#include "alloc_tracker.h"
+#include "profiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+// Atomics (Playdate builds are single-threaded)
+#if defined(__GNUC__) || defined(__clang__)
+    #define ALLOC_ATOMIC_ADD(ptr, value) __sync_fetch_and_add((ptr), (value))
+    #define ALLOC_ATOMIC_CLAIM(ptr, expected, desired) \
+        __sync_val_compare_and_swap((ptr), (expected), (desired))
+    #define ALLOC_MEMORY_BARRIER() __sync_synchronize()
+#else
+    #define ALLOC_ATOMIC_ADD(ptr, value) ((*(ptr)) += (value))
+    #define ALLOC_ATOMIC_CLAIM(ptr, expected, desired) \
+        (*(ptr) == (expected) ? (*(ptr) = (desired), (expected)) : *(ptr))
+    #define ALLOC_MEMORY_BARRIER()
+#endif
+
+typedef struct AllocTracker {
+    AllocTrackerReport report;
+    volatile uint32_t armed;
+} AllocTracker;
+
+static AllocTracker g_tracker = {0};
+
+bool alloc_event_is_allocation(AllocEventType type) {
+    return type != ALLOC_EVENT_FREE && type < ALLOC_EVENT_COUNT;
+}
+
+static bool event_violates_policy(AllocEventType type, uint32_t policy) {
+    if (type == ALLOC_EVENT_POOL_ALLOC) {
+        return (policy & ALLOC_TRACK_POOL) != 0;
+    }
+    return alloc_event_is_allocation(type) && (policy & ALLOC_TRACK_HEAP) != 0;
+}
+
+// Finds or claims the site for a zone; zone name pointers are compared, which
+// matches how the profiler identifies zones
+static AllocSite* find_site(AllocTrackerReport* report, const char* zone) {
+    for (uint32_t i = 0; i < ALLOC_TRACKER_MAX_SITES; i++) {
+        AllocSite* site = &report->sites[i];
+        if (site->zone == zone) {
+            return site;
+        }
+        if (!site->zone) {
+            const char* previous = ALLOC_ATOMIC_CLAIM(&site->zone, (const char*)NULL, zone);
+            if (!previous) {
+                ALLOC_ATOMIC_ADD(&report->siteCount, 1);
+                return site;
+            }
+            if (previous == zone) {
+                return site;        // Another thread claimed it for the same zone
+            }
+        }
+    }
+    return NULL;
+}
+
+// Called from inside the allocator: must not allocate, lock or print
+static void record_event(AllocEventType type, uint64_t bytes) {
+    AllocTrackerReport* report = &g_tracker.report;
+
+    const char* zone = profiler_get_current_zone();
+    if (!zone) {
+        zone = report->scope ? report->scope : ALLOC_TRACKER_UNATTRIBUTED;
+    }
+
+    ALLOC_ATOMIC_ADD(&report->counts[type], 1);
+    ALLOC_ATOMIC_ADD(&report->bytes, bytes);
+    if (event_violates_policy(type, report->policy)) {
+        ALLOC_ATOMIC_ADD(&report->violations, 1);
+    }
+
+    AllocSite* site = find_site(report, zone);
+    if (!site) {
+        ALLOC_ATOMIC_ADD(&report->droppedSites, 1);
+        return;
+    }
+    ALLOC_ATOMIC_ADD(&site->counts[type], 1);
+    ALLOC_ATOMIC_ADD(&site->bytes, bytes);
+}
+
+// Arming
+AllocTrackerResult alloc_tracker_begin(const char* scope, uint32_t policy) {
+    if (g_tracker.armed) {
+        return ALLOC_TRACKER_ERROR_ALREADY_ARMED;
+    }
+
+    memset(&g_tracker.report, 0, sizeof(AllocTrackerReport));
+    g_tracker.report.scope = scope;
+    g_tracker.report.policy = policy;
+
+    ALLOC_MEMORY_BARRIER();
+    g_tracker.armed = 1;
+    return ALLOC_TRACKER_OK;
+}
+
+uint32_t alloc_tracker_end(AllocTrackerReport* report) {
+    if (!g_tracker.armed) {
+        if (report) memset(report, 0, sizeof(AllocTrackerReport));
+        return 0;
+    }
+
+    g_tracker.armed = 0;
+    ALLOC_MEMORY_BARRIER();
+
+    if (report) {
+        memcpy(report, &g_tracker.report, sizeof(AllocTrackerReport));
+    }
+    return g_tracker.report.violations;
+}
+
+bool alloc_tracker_is_armed(void) {
+    return g_tracker.armed != 0;
+}
+
+bool alloc_tracker_heap_available(void) {
+    return ENABLE_ALLOC_TRACKING != 0;
+}
+
+void alloc_tracker_record_pool_alloc(uint32_t elementSize) {
+    if (g_tracker.armed) {
+        record_event(ALLOC_EVENT_POOL_ALLOC, elementSize);
+    }
+}
+
+// Heap interposition: these definitions take precedence over the libc ones
+// for the whole process and forward to glibc's internal entry points
+#if ENABLE_ALLOC_TRACKING
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void* __libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    void* ptr = __libc_malloc(size);
+    if (g_tracker.armed) record_event(ALLOC_EVENT_MALLOC, size);
+    return ptr;
+}
+
+void* calloc(size_t count, size_t size) {
+    void* ptr = __libc_calloc(count, size);
+    if (g_tracker.armed) record_event(ALLOC_EVENT_CALLOC, (uint64_t)count * size);
+    return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+    void* result = __libc_realloc(ptr, size);
+    if (g_tracker.armed) record_event(ALLOC_EVENT_REALLOC, size);
+    return result;
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    void* ptr = __libc_memalign(alignment, size);
+    if (g_tracker.armed) record_event(ALLOC_EVENT_ALIGNED, size);
+    return ptr;
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+
+    void* ptr = __libc_memalign(alignment, size);
+    if (g_tracker.armed) record_event(ALLOC_EVENT_ALIGNED, size);
+    if (!ptr) {
+        return ENOMEM;
+    }
+    *out = ptr;
+    return 0;
+}
+
+void free(void* ptr) {
+    if (ptr && g_tracker.armed) record_event(ALLOC_EVENT_FREE, 0);
+    __libc_free(ptr);
+}
+#endif
+
+// Reporting
+const char* alloc_event_type_to_string(AllocEventType type) {
+    switch (type) {
+        case ALLOC_EVENT_MALLOC: return "malloc";
+        case ALLOC_EVENT_CALLOC: return "calloc";
+        case ALLOC_EVENT_REALLOC: return "realloc";
+        case ALLOC_EVENT_ALIGNED: return "aligned_alloc";
+        case ALLOC_EVENT_FREE: return "free";
+        case ALLOC_EVENT_POOL_ALLOC: return "pool_alloc";
+        default: return "unknown";
+    }
+}
+
+void alloc_tracker_print_report(const AllocTrackerReport* report, FILE* out) {
+    if (!report || !out) return;
+
+    fprintf(out, "=== Allocation Report: %s ===\n", report->scope ? report->scope : "unnamed");
+    fprintf(out, "Violations: %u (%llu bytes requested)\n", report->violations,
+            (unsigned long long)report->bytes);
+
+    for (uint32_t i = 0; i < ALLOC_TRACKER_MAX_SITES; i++) {
+        const AllocSite* site = &report->sites[i];
+        if (!site->zone) continue;
+
+        fprintf(out, "  %-32s", site->zone);
+        for (int type = 0; type < ALLOC_EVENT_COUNT; type++) {
+            if (site->counts[type] > 0) {
+                fprintf(out, " %s=%u", alloc_event_type_to_string((AllocEventType)type),
+                        site->counts[type]);
+            }
+        }
+        fprintf(out, " (%llu bytes)\n", (unsigned long long)site->bytes);
+    }
+
+    if (report->droppedSites > 0) {
+        fprintf(out, "  %u event(s) from untracked zones\n", report->droppedSites);
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file alloc_tracker.h
+ * @brief Allocation tracking for zero-allocation-per-frame verification
+ *
+ * Steady-state frames must not touch the heap. The tracker interposes
+ * malloc, calloc, realloc, aligned_alloc, posix_memalign and free (glibc
+ * builds forward to the __libc_* entry points) and is notified by every
+ * object_pool_alloc. While armed, each event is counted and attributed to
+ * the innermost open profiler zone of the allocating thread - the system
+ * zone inside scene_update in DEBUG builds - or to the scope passed to
+ * alloc_tracker_begin() when no zone is open (release builds).
+ *
+ * Recording is lock-free and never allocates; nothing is printed until the
+ * owner calls alloc_tracker_end() and inspects the report. Events the
+ * policy forbids are counted as violations, so callers can assert on them
+ * (SceneManager's allocation check) or fail a benchmark run.
+ *
+ * Interposing replaces the allocator for the whole process, so it is an
+ * instrumentation build only: off by default, compiled in with
+ * -DENABLE_ALLOC_TRACKING=1 (the profiling tests and benchmark targets do
+ * this) and only where the libc exposes its internal entry points (glibc,
+ * not under ASan). Without it only pool allocations are seen.
+ *
+ * Usage Example:
+ * @code
+ * alloc_tracker_begin("frame", ALLOC_TRACK_HEAP);
+ * scene_update(scene, dt);
+ *
+ * AllocTrackerReport report;
+ * if (alloc_tracker_end(&report) > 0) {
+ *     alloc_tracker_print_report(&report, stdout);
+ * }
+ * @endcode
+ */
+
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+// Heap interposition configuration (instrumentation builds only)
+#ifndef ENABLE_ALLOC_TRACKING
+    #define ENABLE_ALLOC_TRACKING 0
+#endif
+#if ENABLE_ALLOC_TRACKING && (!defined(__GLIBC__) || defined(__SANITIZE_ADDRESS__))
+    #undef ENABLE_ALLOC_TRACKING
+    #define ENABLE_ALLOC_TRACKING 0
+#endif
+
+#define ALLOC_TRACKER_MAX_SITES 32
+#define ALLOC_TRACKER_UNATTRIBUTED "(unattributed)"
+
+// Policy bits: which events count as violations while armed
+#define ALLOC_TRACK_HEAP 0x1u              // malloc/calloc/realloc/aligned allocations
+#define ALLOC_TRACK_POOL 0x2u              // object_pool_alloc
+#define ALLOC_TRACK_ALL (ALLOC_TRACK_HEAP | ALLOC_TRACK_POOL)
+
+// Tracked events
+typedef enum {
+    ALLOC_EVENT_MALLOC = 0,
+    ALLOC_EVENT_CALLOC,
+    ALLOC_EVENT_REALLOC,
+    ALLOC_EVENT_ALIGNED,
+    ALLOC_EVENT_FREE,
+    ALLOC_EVENT_POOL_ALLOC,
+    ALLOC_EVENT_COUNT
+} AllocEventType;
+
+// Events attributed to one zone
+typedef struct AllocSite {
+    const char* zone;
+    uint32_t counts[ALLOC_EVENT_COUNT];
+    uint64_t bytes;                        // Requested bytes (allocations only)
+} AllocSite;
+
+// Everything recorded between alloc_tracker_begin() and alloc_tracker_end()
+typedef struct AllocTrackerReport {
+    const char* scope;
+    uint32_t policy;
+    uint32_t counts[ALLOC_EVENT_COUNT];
+    uint64_t bytes;
+    uint32_t violations;                   // Events forbidden by the policy
+    uint32_t siteCount;
+    uint32_t droppedSites;                 // Zones past ALLOC_TRACKER_MAX_SITES
+    AllocSite sites[ALLOC_TRACKER_MAX_SITES];
+} AllocTrackerReport;
+
+// Tracker results
+typedef enum {
+    ALLOC_TRACKER_OK = 0,
+    ALLOC_TRACKER_ERROR_ALREADY_ARMED
+} AllocTrackerResult;
+
+// Arming (one tracking scope at a time, events from every thread are counted)
+AllocTrackerResult alloc_tracker_begin(const char* scope, uint32_t policy);
+uint32_t alloc_tracker_end(AllocTrackerReport* report);     // Returns violations, report optional
+bool alloc_tracker_is_armed(void);
+bool alloc_tracker_heap_available(void);                     // Heap functions interposed
+
+// Pool hook (called by object_pool_alloc)
+void alloc_tracker_record_pool_alloc(uint32_t elementSize);
+
+// Reporting
+bool alloc_event_is_allocation(AllocEventType type);
+const char* alloc_event_type_to_string(AllocEventType type);
+void alloc_tracker_print_report(const AllocTrackerReport* report, FILE* out);
+
+#endif // ALLOC_TRACKER_H
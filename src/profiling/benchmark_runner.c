@@ -0,0 +1,271 @@
+#define _GNU_SOURCE
+
+#include "benchmark_runner.h"
+#include "profiler.h"
+#include "alloc_tracker.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+void benchmark_config_default(BenchmarkConfig* config) {
+    if (!config) return;
+
+    config->warmupRuns = BENCHMARK_DEFAULT_WARMUP_RUNS;
+    config->measuredRuns = BENCHMARK_DEFAULT_MEASURED_RUNS;
+    config->cpu = 0;
+    config->allocPolicy = 0;
+}
+
+bool benchmark_pin_cpu(int cpu) {
+    if (cpu < 0) {
+        return false;
+    }
+
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t lhs = *(const uint64_t*)a;
+    uint64_t rhs = *(const uint64_t*)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+void benchmark_summarize(uint64_t* samplesNs, uint32_t count, uint64_t operations,
+                         BenchmarkResult* result) {
+    if (!samplesNs || !result || count == 0) return;
+
+    qsort(samplesNs, count, sizeof(uint64_t), compare_u64);
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        sum += (double)samplesNs[i];
+    }
+    double mean = sum / count;
+
+    double variance = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double diff = (double)samplesNs[i] - mean;
+        variance += diff * diff;
+    }
+    variance = count > 1 ? variance / (count - 1) : 0.0;
+
+    // Nearest-rank percentiles, median averages the middle pair
+    uint32_t p95Index = (uint32_t)ceil(0.95 * count) - 1;
+    uint32_t p99Index = (uint32_t)ceil(0.99 * count) - 1;
+    double median = (count & 1) ? (double)samplesNs[count / 2] :
+                    ((double)samplesNs[count / 2 - 1] + (double)samplesNs[count / 2]) / 2.0;
+
+    result->runs = count;
+    result->operations = operations;
+    result->minNs = (double)samplesNs[0];
+    result->maxNs = (double)samplesNs[count - 1];
+    result->meanNs = mean;
+    result->medianNs = median;
+    result->p95Ns = (double)samplesNs[p95Index];
+    result->p99Ns = (double)samplesNs[p99Index];
+    result->stddevNs = sqrt(variance);
+    result->nsPerOp = operations > 0 ? median / (double)operations : median;
+}
+
+BenchmarkResultCode benchmark_run(const BenchmarkCase* benchmarkCase, const BenchmarkConfig* config,
+                                  BenchmarkResult* result) {
+    if (!benchmarkCase || !benchmarkCase->setup || !benchmarkCase->run || !config || !result) {
+        return BENCHMARK_ERROR_NULL_POINTER;
+    }
+
+    memset(result, 0, sizeof(BenchmarkResult));
+    strncpy(result->name, benchmarkCase->name ? benchmarkCase->name : "unnamed",
+            sizeof(result->name) - 1);
+    result->param = benchmarkCase->param;
+
+    uint32_t runs = config->measuredRuns;
+    if (runs == 0) runs = 1;
+    if (runs > BENCHMARK_MAX_RUNS) runs = BENCHMARK_MAX_RUNS;
+
+    uint64_t* samples = malloc(runs * sizeof(uint64_t));
+    if (!samples) {
+        return BENCHMARK_ERROR_OUT_OF_MEMORY;
+    }
+
+    void* context = benchmarkCase->setup(benchmarkCase->param);
+    if (!context) {
+        free(samples);
+        return BENCHMARK_ERROR_SETUP_FAILED;
+    }
+
+    for (uint32_t i = 0; i < config->warmupRuns; i++) {
+        if (benchmarkCase->reset) benchmarkCase->reset(context);
+        benchmarkCase->run(context, benchmarkCase->param);
+    }
+
+    uint64_t operations = 0;
+    uint64_t allocations = 0;
+    for (uint32_t i = 0; i < runs; i++) {
+        if (benchmarkCase->reset) benchmarkCase->reset(context);
+
+        bool tracking = config->allocPolicy != 0 &&
+                        alloc_tracker_begin(result->name, config->allocPolicy) == ALLOC_TRACKER_OK;
+        uint64_t start = profiler_get_time_ns();
+        operations = benchmarkCase->run(context, benchmarkCase->param);
+        samples[i] = profiler_get_time_ns() - start;
+        if (tracking) {
+            allocations += alloc_tracker_end(NULL);
+        }
+    }
+
+    if (benchmarkCase->teardown) {
+        benchmarkCase->teardown(context);
+    }
+
+    benchmark_summarize(samples, runs, operations, result);
+    result->allocations = allocations;
+    free(samples);
+    return BENCHMARK_OK;
+}
+
+BenchmarkResultCode benchmark_write_json(const BenchmarkResult* results, uint32_t count,
+                                         const BenchmarkConfig* config, FILE* out) {
+    if (!results || !config || !out) {
+        return BENCHMARK_ERROR_NULL_POINTER;
+    }
+
+    fprintf(out, "{\"schema\":1,\"config\":{\"warmup_runs\":%u,\"measured_runs\":%u,\"cpu\":%d},\n",
+            config->warmupRuns, config->measuredRuns, config->cpu);
+    fprintf(out, "\"results\":[\n");
+
+    // One result per line: benchmark_load_baseline relies on this layout
+    for (uint32_t i = 0; i < count; i++) {
+        const BenchmarkResult* r = &results[i];
+        fprintf(out, "{\"name\":\"%s\",\"param\":%u,\"runs\":%u,\"ops\":%llu,"
+                     "\"min_ns\":%.1f,\"median_ns\":%.1f,\"mean_ns\":%.1f,\"p95_ns\":%.1f,"
+                     "\"p99_ns\":%.1f,\"max_ns\":%.1f,\"stddev_ns\":%.1f,\"ns_per_op\":%.4f,"
+                     "\"allocs\":%llu}%s\n",
+                r->name, r->param, r->runs, (unsigned long long)r->operations,
+                r->minNs, r->medianNs, r->meanNs, r->p95Ns, r->p99Ns, r->maxNs, r->stddevNs, r->nsPerOp,
+                (unsigned long long)r->allocations, i + 1 < count ? "," : "");
+    }
+
+    fprintf(out, "]}\n");
+    return ferror(out) ? BENCHMARK_ERROR_IO : BENCHMARK_OK;
+}
+
+static bool read_json_number(const char* line, const char* key, double* value) {
+    const char* field = strstr(line, key);
+    if (!field) {
+        return false;
+    }
+
+    char* end = NULL;
+    *value = strtod(field + strlen(key), &end);
+    return end != field + strlen(key);
+}
+
+BenchmarkResultCode benchmark_load_baseline(FILE* in, BenchmarkResult* results, uint32_t capacity,
+                                            uint32_t* count) {
+    if (!in || !results || !count) {
+        return BENCHMARK_ERROR_NULL_POINTER;
+    }
+
+    *count = 0;
+    char line[512];
+    bool sawResults = false;
+    while (fgets(line, sizeof(line), in)) {
+        if (strstr(line, "\"results\":[")) {
+            sawResults = true;
+            continue;
+        }
+
+        const char* start = strstr(line, "{\"name\":\"");
+        if (!sawResults || !start || *count >= capacity) {
+            continue;
+        }
+
+        BenchmarkResult* r = &results[*count];
+        memset(r, 0, sizeof(BenchmarkResult));
+
+        double param, runs, operations;
+        if (sscanf(start, "{\"name\":\"%63[^\"]\"", r->name) != 1 ||
+            !read_json_number(start, "\"param\":", &param) ||
+            !read_json_number(start, "\"runs\":", &runs) ||
+            !read_json_number(start, "\"ops\":", &operations) ||
+            !read_json_number(start, "\"median_ns\":", &r->medianNs) ||
+            !read_json_number(start, "\"ns_per_op\":", &r->nsPerOp)) {
+            return BENCHMARK_ERROR_PARSE;
+        }
+
+        read_json_number(start, "\"min_ns\":", &r->minNs);
+        read_json_number(start, "\"mean_ns\":", &r->meanNs);
+        read_json_number(start, "\"p95_ns\":", &r->p95Ns);
+        read_json_number(start, "\"p99_ns\":", &r->p99Ns);
+        read_json_number(start, "\"max_ns\":", &r->maxNs);
+        read_json_number(start, "\"stddev_ns\":", &r->stddevNs);
+        double allocations = 0.0;
+        read_json_number(start, "\"allocs\":", &allocations);
+        r->allocations = (uint64_t)allocations;
+        r->param = (uint32_t)param;
+        r->runs = (uint32_t)runs;
+        r->operations = (uint64_t)operations;
+        (*count)++;
+    }
+
+    return sawResults ? BENCHMARK_OK : BENCHMARK_ERROR_PARSE;
+}
+
+static const BenchmarkResult* find_result(const BenchmarkResult* results, uint32_t count,
+                                          const char* name, uint32_t param) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (results[i].param == param && strcmp(results[i].name, name) == 0) {
+            return &results[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t benchmark_compare(const BenchmarkResult* current, uint32_t currentCount,
+                           const BenchmarkResult* baseline, uint32_t baselineCount,
+                           double thresholdPercent, FILE* report) {
+    if (!current || !baseline) {
+        return 0;
+    }
+
+    uint32_t regressions = 0;
+    for (uint32_t i = 0; i < currentCount; i++) {
+        const BenchmarkResult* now = &current[i];
+        const BenchmarkResult* before = find_result(baseline, baselineCount, now->name, now->param);
+
+        if (!before || before->nsPerOp <= 0.0) {
+            if (report) {
+                fprintf(report, "  NEW        %-32s %8u %12.2f ns/op\n",
+                        now->name, now->param, now->nsPerOp);
+            }
+            continue;
+        }
+
+        double change = (now->nsPerOp - before->nsPerOp) / before->nsPerOp * 100.0;
+        const char* verdict = "ok";
+        if (change > thresholdPercent) {
+            verdict = "REGRESSION";
+            regressions++;
+        } else if (change < -thresholdPercent) {
+            verdict = "faster";
+        }
+
+        if (report) {
+            fprintf(report, "  %-10s %-32s %8u %12.2f -> %12.2f ns/op (%+.1f%%)\n",
+                    verdict, now->name, now->param, before->nsPerOp, now->nsPerOp, change);
+        }
+    }
+
+    return regressions;
+}
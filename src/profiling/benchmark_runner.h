@@ -0,0 +1,115 @@
+/**
+ * @file benchmark_runner.h
+ * @brief Shared benchmark harness with statistics, JSON output and baselines
+ *
+ * A benchmark case is a setup/run/teardown triple plus an integer parameter
+ * (object count, density, ...). The runner pins the process to one CPU,
+ * executes untimed warmup runs, then times each measured run individually
+ * with the monotonic clock and reduces the samples to min/median/mean/p95/
+ * p99/max/stddev. Results can be written as JSON and later loaded back as a
+ * baseline; benchmark_compare() flags cases whose median time per operation
+ * grew past a threshold.
+ *
+ * With a non-zero allocPolicy every measured run is wrapped in an allocation
+ * tracking scope (see alloc_tracker.h) and the offending events are counted
+ * in BenchmarkResult.allocations, so suites can fail on steady-state
+ * allocation.
+ *
+ * Usage Example:
+ * @code
+ * BenchmarkConfig config;
+ * benchmark_config_default(&config);
+ * benchmark_pin_cpu(config.cpu);
+ *
+ * BenchmarkResult result;
+ * benchmark_run(&poolCase, &config, &result);
+ * benchmark_write_json(&result, 1, &config, stdout);
+ * @endcode
+ */
+
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define BENCHMARK_NAME_LENGTH 64
+#define BENCHMARK_MAX_RUNS 1024
+#define BENCHMARK_DEFAULT_WARMUP_RUNS 3
+#define BENCHMARK_DEFAULT_MEASURED_RUNS 15
+#define BENCHMARK_DEFAULT_THRESHOLD_PERCENT 10.0
+
+// Case callbacks. setup returns the context passed to the others (NULL = failure),
+// run returns the number of operations it performed
+typedef void* (*BenchmarkSetupFn)(uint32_t param);
+typedef void (*BenchmarkResetFn)(void* context);           // Untimed, before every run
+typedef uint64_t (*BenchmarkRunFn)(void* context, uint32_t param);
+typedef void (*BenchmarkTeardownFn)(void* context);
+
+typedef struct BenchmarkCase {
+    const char* name;
+    BenchmarkSetupFn setup;
+    BenchmarkResetFn reset;        // Optional
+    BenchmarkRunFn run;
+    BenchmarkTeardownFn teardown;  // Optional
+    uint32_t param;
+} BenchmarkCase;
+
+typedef struct BenchmarkConfig {
+    uint32_t warmupRuns;
+    uint32_t measuredRuns;         // Clamped to BENCHMARK_MAX_RUNS
+    int cpu;                       // CPU to pin to, -1 to leave affinity alone
+    uint32_t allocPolicy;          // ALLOC_TRACK_* bits checked per measured run, 0 = off
+} BenchmarkConfig;
+
+// Summary of one case (times are per run unless noted)
+typedef struct BenchmarkResult {
+    char name[BENCHMARK_NAME_LENGTH];
+    uint32_t param;
+    uint32_t runs;
+    uint64_t operations;           // Operations per run
+    double minNs;
+    double medianNs;
+    double meanNs;
+    double p95Ns;
+    double p99Ns;
+    double maxNs;
+    double stddevNs;
+    double nsPerOp;                // medianNs / operations
+    uint64_t allocations;          // Policy violations over all measured runs
+} BenchmarkResult;
+
+// Benchmark results
+typedef enum {
+    BENCHMARK_OK = 0,
+    BENCHMARK_ERROR_NULL_POINTER,
+    BENCHMARK_ERROR_OUT_OF_MEMORY,
+    BENCHMARK_ERROR_SETUP_FAILED,
+    BENCHMARK_ERROR_IO,
+    BENCHMARK_ERROR_PARSE
+} BenchmarkResultCode;
+
+// Configuration
+void benchmark_config_default(BenchmarkConfig* config);
+bool benchmark_pin_cpu(int cpu);
+
+// Execution
+BenchmarkResultCode benchmark_run(const BenchmarkCase* benchmarkCase, const BenchmarkConfig* config,
+                                  BenchmarkResult* result);
+void benchmark_summarize(uint64_t* samplesNs, uint32_t count, uint64_t operations,
+                         BenchmarkResult* result);
+
+// JSON output and baselines
+BenchmarkResultCode benchmark_write_json(const BenchmarkResult* results, uint32_t count,
+                                         const BenchmarkConfig* config, FILE* out);
+BenchmarkResultCode benchmark_load_baseline(FILE* in, BenchmarkResult* results, uint32_t capacity,
+                                            uint32_t* count);
+
+// Regression check: returns the number of cases slower than the baseline by more
+// than thresholdPercent (median ns per op); a report line per case goes to report
+uint32_t benchmark_compare(const BenchmarkResult* current, uint32_t currentCount,
+                           const BenchmarkResult* baseline, uint32_t baselineCount,
+                           double thresholdPercent, FILE* report);
+
+#endif // BENCHMARK_RUNNER_H
@@ -0,0 +1,217 @@
+#include "frame_timing.h"
+#include <string.h>
+
+static inline uint32_t highest_bit(uint32_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - (uint32_t)__builtin_clz(value);
+#else
+    uint32_t bit = 0;
+    while (value >>= 1) {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+uint32_t frame_histogram_bucket_index(uint32_t valueNs) {
+    if (valueNs < FRAME_HISTOGRAM_SUB_BUCKETS) {
+        return valueNs;
+    }
+
+    uint32_t exponent = highest_bit(valueNs);
+    uint32_t shift = exponent - FRAME_HISTOGRAM_SUB_BUCKET_BITS;
+    uint32_t subBucket = (valueNs >> shift) - FRAME_HISTOGRAM_SUB_BUCKETS;
+    return (shift + 1) * FRAME_HISTOGRAM_SUB_BUCKETS + subBucket;
+}
+
+uint32_t frame_histogram_bucket_lower_bound(uint32_t bucket) {
+    if (bucket < FRAME_HISTOGRAM_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    uint32_t shift = bucket / FRAME_HISTOGRAM_SUB_BUCKETS - 1;
+    uint32_t subBucket = bucket % FRAME_HISTOGRAM_SUB_BUCKETS;
+    return (FRAME_HISTOGRAM_SUB_BUCKETS + subBucket) << shift;
+}
+
+uint32_t frame_histogram_bucket_upper_bound(uint32_t bucket) {
+    if (bucket < FRAME_HISTOGRAM_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    uint32_t shift = bucket / FRAME_HISTOGRAM_SUB_BUCKETS - 1;
+    return frame_histogram_bucket_lower_bound(bucket) + ((1u << shift) - 1);
+}
+
+// Representative value of the bucket holding the given rank, clamped to the exact max
+static uint32_t histogram_value_at_percentile(const FrameHistogram* histogram, float percentile,
+                                              uint32_t maxNs) {
+    if (histogram->totalCount == 0) {
+        return 0;
+    }
+
+    uint32_t rank = (uint32_t)(percentile / 100.0f * histogram->totalCount + 0.999f);
+    if (rank == 0) rank = 1;
+
+    uint32_t cumulative = 0;
+    for (uint32_t bucket = 0; bucket < FRAME_HISTOGRAM_BUCKETS; bucket++) {
+        cumulative += histogram->counts[bucket];
+        if (cumulative >= rank) {
+            uint32_t lower = frame_histogram_bucket_lower_bound(bucket);
+            uint32_t upper = frame_histogram_bucket_upper_bound(bucket);
+            uint32_t middle = lower + (upper - lower) / 2;
+            return middle < maxNs ? middle : maxNs;
+        }
+    }
+    return maxNs;
+}
+
+void frame_time_recorder_reset(FrameTimeRecorder* recorder) {
+    if (recorder) {
+        memset(recorder, 0, sizeof(FrameTimeRecorder));
+    }
+}
+
+void frame_time_recorder_record(FrameTimeRecorder* recorder, FrameMetric metric, uint64_t elapsedNs) {
+    if (!recorder || metric >= FRAME_METRIC_COUNT) return;
+
+    FrameMetricRecorder* metricRecorder = &recorder->metrics[metric];
+    uint32_t sample = elapsedNs > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsedNs;
+    uint32_t bucket = frame_histogram_bucket_index(sample);
+
+    // Lifetime histogram
+    metricRecorder->lifetime.counts[bucket]++;
+    metricRecorder->lifetime.totalCount++;
+    if (sample > metricRecorder->lifetime.maxNs) {
+        metricRecorder->lifetime.maxNs = sample;
+    }
+
+    // Sliding window: evict the sample being overwritten
+    FrameHistogram* window = &metricRecorder->window;
+    if (window->totalCount == FRAME_TIMING_WINDOW) {
+        uint32_t evicted = metricRecorder->windowSamples[metricRecorder->windowCursor];
+        window->counts[frame_histogram_bucket_index(evicted)]--;
+        window->totalCount--;
+    }
+
+    metricRecorder->windowSamples[metricRecorder->windowCursor] = sample;
+    metricRecorder->windowCursor = (metricRecorder->windowCursor + 1) % FRAME_TIMING_WINDOW;
+    window->counts[bucket]++;
+    window->totalCount++;
+
+    if (metric == FRAME_METRIC_UPDATE) {
+        recorder->frameCount++;
+    }
+}
+
+void frame_time_recorder_record_fixed_steps(FrameTimeRecorder* recorder, uint32_t stepsRun,
+                                            uint32_t stepsDropped) {
+    if (!recorder) return;
+
+    recorder->fixedStepsRun += stepsRun;
+    if (stepsRun > 1) {
+        recorder->mergedFixedSteps += stepsRun - 1;
+    }
+    recorder->droppedFixedSteps += stepsDropped;
+}
+
+bool frame_time_recorder_get_percentiles(const FrameTimeRecorder* recorder, FrameMetric metric,
+                                         bool windowOnly, FramePercentiles* percentiles) {
+    if (!recorder || !percentiles || metric >= FRAME_METRIC_COUNT) {
+        return false;
+    }
+
+    const FrameMetricRecorder* metricRecorder = &recorder->metrics[metric];
+    const FrameHistogram* histogram = windowOnly ? &metricRecorder->window : &metricRecorder->lifetime;
+
+    uint32_t maxNs = metricRecorder->lifetime.maxNs;
+    if (windowOnly) {
+        maxNs = 0;
+        for (uint32_t i = 0; i < histogram->totalCount; i++) {
+            if (metricRecorder->windowSamples[i] > maxNs) {
+                maxNs = metricRecorder->windowSamples[i];
+            }
+        }
+    }
+
+    percentiles->sampleCount = histogram->totalCount;
+    percentiles->p50Us = histogram_value_at_percentile(histogram, 50.0f, maxNs) / 1000.0f;
+    percentiles->p95Us = histogram_value_at_percentile(histogram, 95.0f, maxNs) / 1000.0f;
+    percentiles->p99Us = histogram_value_at_percentile(histogram, 99.0f, maxNs) / 1000.0f;
+    percentiles->maxUs = maxNs / 1000.0f;
+    return true;
+}
+
+const char* frame_metric_to_string(FrameMetric metric) {
+    switch (metric) {
+        case FRAME_METRIC_UPDATE: return "update";
+        case FRAME_METRIC_FIXED_STEP: return "fixed_step";
+        case FRAME_METRIC_RENDER: return "render";
+        default: return "unknown";
+    }
+}
+
+static void write_json_percentiles(FILE* out, const FramePercentiles* percentiles) {
+    fprintf(out, "{\"samples\":%u,\"p50_us\":%.3f,\"p95_us\":%.3f,\"p99_us\":%.3f,\"max_us\":%.3f}",
+            percentiles->sampleCount, percentiles->p50Us, percentiles->p95Us,
+            percentiles->p99Us, percentiles->maxUs);
+}
+
+bool frame_time_recorder_write_json(const FrameTimeRecorder* recorder, FILE* out) {
+    if (!recorder || !out) {
+        return false;
+    }
+
+    fprintf(out, "{\"frames\":%u,\"fixed_steps\":{\"run\":%u,\"merged\":%u,\"dropped\":%u},\"metrics\":{",
+            recorder->frameCount, recorder->fixedStepsRun,
+            recorder->mergedFixedSteps, recorder->droppedFixedSteps);
+
+    for (uint32_t m = 0; m < FRAME_METRIC_COUNT; m++) {
+        FramePercentiles lifetime, window;
+        frame_time_recorder_get_percentiles(recorder, (FrameMetric)m, false, &lifetime);
+        frame_time_recorder_get_percentiles(recorder, (FrameMetric)m, true, &window);
+
+        fprintf(out, "%s\"%s\":{\"lifetime\":", m == 0 ? "" : ",", frame_metric_to_string((FrameMetric)m));
+        write_json_percentiles(out, &lifetime);
+        fprintf(out, ",\"window\":");
+        write_json_percentiles(out, &window);
+
+        // Non-empty lifetime buckets as [lower_ns, upper_ns, count]
+        fprintf(out, ",\"histogram\":[");
+        const FrameHistogram* histogram = &recorder->metrics[m].lifetime;
+        bool first = true;
+        for (uint32_t bucket = 0; bucket < FRAME_HISTOGRAM_BUCKETS; bucket++) {
+            if (histogram->counts[bucket] == 0) continue;
+            fprintf(out, "%s[%u,%u,%u]", first ? "" : ",",
+                    frame_histogram_bucket_lower_bound(bucket),
+                    frame_histogram_bucket_upper_bound(bucket),
+                    histogram->counts[bucket]);
+            first = false;
+        }
+        fprintf(out, "]}");
+    }
+
+    fprintf(out, "}}\n");
+    return ferror(out) == 0;
+}
+
+bool frame_time_recorder_write_csv(const FrameTimeRecorder* recorder, FILE* out) {
+    if (!recorder || !out) {
+        return false;
+    }
+
+    fprintf(out, "metric,scope,samples,p50_us,p95_us,p99_us,max_us,fixed_steps_run,fixed_steps_merged,fixed_steps_dropped\n");
+    for (uint32_t m = 0; m < FRAME_METRIC_COUNT; m++) {
+        for (int scope = 0; scope < 2; scope++) {
+            FramePercentiles percentiles;
+            frame_time_recorder_get_percentiles(recorder, (FrameMetric)m, scope == 1, &percentiles);
+            fprintf(out, "%s,%s,%u,%.3f,%.3f,%.3f,%.3f,%u,%u,%u\n",
+                    frame_metric_to_string((FrameMetric)m), scope == 1 ? "window" : "lifetime",
+                    percentiles.sampleCount, percentiles.p50Us, percentiles.p95Us,
+                    percentiles.p99Us, percentiles.maxUs,
+                    recorder->fixedStepsRun, recorder->mergedFixedSteps, recorder->droppedFixedSteps);
+        }
+    }
+
+    return ferror(out) == 0;
+}
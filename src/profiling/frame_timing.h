@@ -0,0 +1,87 @@
+/**
+ * @file frame_timing.h
+ * @brief Fixed-memory frame-time recorder with log-bucket histograms
+ *
+ * Samples are binned HDR-style: values below 16 ns map to their own bucket,
+ * larger values use 16 linear sub-buckets per power of two, which bounds the
+ * relative error of any reported percentile to ~6%. Each metric keeps a
+ * lifetime histogram plus a sliding-window histogram over the last
+ * FRAME_TIMING_WINDOW samples, so tail latency can be read both for the whole
+ * run and for "right now" without allocating.
+ */
+
+#ifndef FRAME_TIMING_H
+#define FRAME_TIMING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define FRAME_HISTOGRAM_SUB_BUCKET_BITS 4
+#define FRAME_HISTOGRAM_SUB_BUCKETS (1u << FRAME_HISTOGRAM_SUB_BUCKET_BITS)
+#define FRAME_HISTOGRAM_BUCKETS ((32 - FRAME_HISTOGRAM_SUB_BUCKET_BITS + 1) * FRAME_HISTOGRAM_SUB_BUCKETS)
+#define FRAME_TIMING_WINDOW 256         // Samples in the sliding window
+
+// Recorded frame phases
+typedef enum {
+    FRAME_METRIC_UPDATE = 0,            // Whole scene_manager_update call
+    FRAME_METRIC_FIXED_STEP,            // Each individual fixed step
+    FRAME_METRIC_RENDER,                // Whole scene_manager_render call
+    FRAME_METRIC_COUNT
+} FrameMetric;
+
+// Log-bucket histogram of nanosecond samples
+typedef struct FrameHistogram {
+    uint32_t counts[FRAME_HISTOGRAM_BUCKETS];
+    uint32_t totalCount;
+    uint32_t maxNs;                     // Exact maximum (lifetime histograms only)
+} FrameHistogram;
+
+// Lifetime + sliding window for one metric
+typedef struct FrameMetricRecorder {
+    FrameHistogram lifetime;
+    FrameHistogram window;
+    uint32_t windowSamples[FRAME_TIMING_WINDOW];  // Raw samples for eviction and exact max
+    uint32_t windowCursor;
+} FrameMetricRecorder;
+
+typedef struct FrameTimeRecorder {
+    FrameMetricRecorder metrics[FRAME_METRIC_COUNT];
+    uint32_t frameCount;                // scene_manager_update calls recorded
+    uint32_t fixedStepsRun;             // Fixed steps executed
+    uint32_t mergedFixedSteps;          // Extra steps run to catch up within one frame
+    uint32_t droppedFixedSteps;         // Steps discarded by the per-frame cap
+} FrameTimeRecorder;
+
+// Percentile summary (microseconds)
+typedef struct FramePercentiles {
+    uint32_t sampleCount;
+    float p50Us;
+    float p95Us;
+    float p99Us;
+    float maxUs;
+} FramePercentiles;
+
+// Recorder lifecycle
+void frame_time_recorder_reset(FrameTimeRecorder* recorder);
+
+// Recording
+void frame_time_recorder_record(FrameTimeRecorder* recorder, FrameMetric metric, uint64_t elapsedNs);
+void frame_time_recorder_record_fixed_steps(FrameTimeRecorder* recorder, uint32_t stepsRun,
+                                            uint32_t stepsDropped);
+
+// Queries
+bool frame_time_recorder_get_percentiles(const FrameTimeRecorder* recorder, FrameMetric metric,
+                                         bool windowOnly, FramePercentiles* percentiles);
+const char* frame_metric_to_string(FrameMetric metric);
+
+// Export
+bool frame_time_recorder_write_json(const FrameTimeRecorder* recorder, FILE* out);
+bool frame_time_recorder_write_csv(const FrameTimeRecorder* recorder, FILE* out);
+
+// Histogram helpers (exposed for testing)
+uint32_t frame_histogram_bucket_index(uint32_t valueNs);
+uint32_t frame_histogram_bucket_lower_bound(uint32_t bucket);
+uint32_t frame_histogram_bucket_upper_bound(uint32_t bucket);
+
+#endif // FRAME_TIMING_H
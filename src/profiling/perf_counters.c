@@ -0,0 +1,197 @@
+#define _GNU_SOURCE
+
+#include "perf_counters.h"
+#include <string.h>
+
+#if ENABLE_PERF_COUNTERS && defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define PERF_COUNTERS_SUPPORTED 1
+#else
+    #define PERF_COUNTERS_SUPPORTED 0
+#endif
+
+#if PERF_COUNTERS_SUPPORTED
+// Group read layout for PERF_FORMAT_GROUP | TOTAL_TIME_ENABLED | TOTAL_TIME_RUNNING
+typedef struct PerfGroupReadFormat {
+    uint64_t count;
+    uint64_t timeEnabled;
+    uint64_t timeRunning;
+    uint64_t values[PERF_COUNTER_COUNT];
+} PerfGroupReadFormat;
+
+static void describe_counter(PerfCounterType type, struct perf_event_attr* attr) {
+    switch (type) {
+        case PERF_COUNTER_CYCLES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PERF_COUNTER_INSTRUCTIONS:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PERF_COUNTER_L1D_MISSES:
+            attr->type = PERF_TYPE_HW_CACHE;
+            attr->config = PERF_COUNT_HW_CACHE_L1D |
+                           (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case PERF_COUNTER_LLC_MISSES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PERF_COUNTER_BRANCH_MISSES:
+        default:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+    }
+}
+
+static int open_counter(PerfCounterType type, int groupFd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    describe_counter(type, &attr);
+    attr.disabled = groupFd == -1 ? 1 : 0;     // Leader starts the whole group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP |
+                       PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+#endif
+
+PerfCounterResult perf_counter_group_open(PerfCounterGroup* group) {
+    if (!group) {
+        return PERF_COUNTERS_ERROR_NULL_POINTER;
+    }
+
+    memset(group, 0, sizeof(PerfCounterGroup));
+    group->leaderFd = -1;
+    for (uint32_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        group->fds[i] = -1;
+    }
+
+#if PERF_COUNTERS_SUPPORTED
+    // First counter that opens becomes the leader, the rest join its group
+    for (uint32_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        int fd = open_counter((PerfCounterType)i, group->leaderFd);
+        if (fd < 0) {
+            continue;
+        }
+
+        if (group->leaderFd == -1) {
+            group->leaderFd = fd;
+        }
+        group->fds[i] = fd;
+        group->readOrder[group->openCount++] = (uint8_t)i;
+        group->validMask |= 1u << i;
+    }
+
+    if (group->leaderFd == -1) {
+        return PERF_COUNTERS_ERROR_UNAVAILABLE;
+    }
+
+    ioctl(group->leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group->leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return PERF_COUNTERS_OK;
+#else
+    return PERF_COUNTERS_ERROR_UNAVAILABLE;
+#endif
+}
+
+void perf_counter_group_close(PerfCounterGroup* group) {
+    if (!group) return;
+
+#if PERF_COUNTERS_SUPPORTED
+    for (uint32_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (group->fds[i] >= 0 && group->fds[i] != group->leaderFd) {
+            close(group->fds[i]);
+        }
+    }
+    if (group->leaderFd >= 0) {
+        close(group->leaderFd);
+    }
+#endif
+
+    memset(group, 0, sizeof(PerfCounterGroup));
+    group->leaderFd = -1;
+    for (uint32_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        group->fds[i] = -1;
+    }
+}
+
+bool perf_counter_group_is_open(const PerfCounterGroup* group) {
+    return group && group->leaderFd >= 0;
+}
+
+PerfCounterResult perf_counter_group_read(const PerfCounterGroup* group, PerfCounterSample* sample) {
+    if (!group || !sample) {
+        return PERF_COUNTERS_ERROR_NULL_POINTER;
+    }
+
+    memset(sample, 0, sizeof(PerfCounterSample));
+    if (group->leaderFd < 0) {
+        return PERF_COUNTERS_ERROR_UNAVAILABLE;
+    }
+
+#if PERF_COUNTERS_SUPPORTED
+    PerfGroupReadFormat data;
+    ssize_t expected = (ssize_t)(3 + group->openCount) * (ssize_t)sizeof(uint64_t);
+    if (read(group->leaderFd, &data, sizeof(data)) < expected || data.count != group->openCount) {
+        return PERF_COUNTERS_ERROR_READ_FAILED;
+    }
+
+    // Scale up if the kernel multiplexed the group off the PMU part of the time
+    double scale = 1.0;
+    if (data.timeRunning > 0 && data.timeRunning < data.timeEnabled) {
+        scale = (double)data.timeEnabled / (double)data.timeRunning;
+    }
+
+    for (uint32_t slot = 0; slot < group->openCount; slot++) {
+        uint64_t value = data.values[slot];
+        sample->values[group->readOrder[slot]] = scale == 1.0 ? value : (uint64_t)(value * scale);
+    }
+    sample->validMask = group->validMask;
+    return PERF_COUNTERS_OK;
+#else
+    return PERF_COUNTERS_ERROR_UNAVAILABLE;
+#endif
+}
+
+void perf_counter_sample_delta(const PerfCounterSample* start, const PerfCounterSample* end,
+                               PerfCounterSample* delta) {
+    if (!start || !end || !delta) return;
+
+    delta->validMask = start->validMask & end->validMask;
+    delta->padding = 0;
+    for (uint32_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        // Scaling can make a multiplexed counter step backwards; clamp to zero
+        delta->values[i] = end->values[i] > start->values[i] ? end->values[i] - start->values[i] : 0;
+    }
+}
+
+void perf_counter_sample_accumulate(PerfCounterSample* total, const PerfCounterSample* sample) {
+    if (!total || !sample) return;
+
+    for (uint32_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        total->values[i] += sample->values[i];
+    }
+    total->validMask |= sample->validMask;
+}
+
+const char* perf_counter_type_to_string(PerfCounterType type) {
+    switch (type) {
+        case PERF_COUNTER_CYCLES: return "cycles";
+        case PERF_COUNTER_INSTRUCTIONS: return "instructions";
+        case PERF_COUNTER_L1D_MISSES: return "l1d_misses";
+        case PERF_COUNTER_LLC_MISSES: return "llc_misses";
+        case PERF_COUNTER_BRANCH_MISSES: return "branch_misses";
+        default: return "unknown";
+    }
+}
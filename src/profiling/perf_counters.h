@@ -0,0 +1,79 @@
+/**
+ * @file perf_counters.h
+ * @brief Optional Linux perf_event hardware counters for profiler zones
+ *
+ * A PerfCounterGroup opens cycles, instructions, L1D read misses, LLC misses
+ * and branch misses as one perf_event group for the calling thread, so a
+ * single read() returns a consistent snapshot of all of them. Counters the
+ * kernel or hypervisor refuses are skipped individually; when none can be
+ * opened (no PMU, perf_event_paranoid, non-Linux or Playdate builds) every
+ * call becomes a cheap no-op and callers fall back to wall time.
+ *
+ * Counts are for the calling thread only and are scaled when the kernel
+ * multiplexes the group with other events.
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Counter support configuration
+#ifndef ENABLE_PERF_COUNTERS
+    #ifdef __linux__
+        #define ENABLE_PERF_COUNTERS 1
+    #else
+        #define ENABLE_PERF_COUNTERS 0
+    #endif
+#endif
+
+// Hardware events recorded per group
+typedef enum {
+    PERF_COUNTER_CYCLES = 0,
+    PERF_COUNTER_INSTRUCTIONS,
+    PERF_COUNTER_L1D_MISSES,
+    PERF_COUNTER_LLC_MISSES,
+    PERF_COUNTER_BRANCH_MISSES,
+    PERF_COUNTER_COUNT
+} PerfCounterType;
+
+// Snapshot or delta of all counters (48 bytes)
+typedef struct PerfCounterSample {
+    uint64_t values[PERF_COUNTER_COUNT];  // Indexed by PerfCounterType
+    uint32_t validMask;                   // Bit per counter that was actually measured
+    uint32_t padding;
+} PerfCounterSample;
+
+// Per-thread counter group
+typedef struct PerfCounterGroup {
+    int leaderFd;                         // -1 when the group is closed
+    int fds[PERF_COUNTER_COUNT];          // -1 for counters that failed to open
+    uint8_t readOrder[PERF_COUNTER_COUNT];// Group read slot -> PerfCounterType
+    uint32_t openCount;
+    uint32_t validMask;
+} PerfCounterGroup;
+
+// Counter results
+typedef enum {
+    PERF_COUNTERS_OK = 0,
+    PERF_COUNTERS_ERROR_NULL_POINTER,
+    PERF_COUNTERS_ERROR_UNAVAILABLE,      // No counter could be opened
+    PERF_COUNTERS_ERROR_READ_FAILED
+} PerfCounterResult;
+
+// Group lifecycle (counts the calling thread)
+PerfCounterResult perf_counter_group_open(PerfCounterGroup* group);
+void perf_counter_group_close(PerfCounterGroup* group);
+bool perf_counter_group_is_open(const PerfCounterGroup* group);
+
+// Sampling
+PerfCounterResult perf_counter_group_read(const PerfCounterGroup* group, PerfCounterSample* sample);
+void perf_counter_sample_delta(const PerfCounterSample* start, const PerfCounterSample* end,
+                               PerfCounterSample* delta);
+void perf_counter_sample_accumulate(PerfCounterSample* total, const PerfCounterSample* sample);
+
+// Utility
+const char* perf_counter_type_to_string(PerfCounterType type);
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,448 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "profiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Thread-local storage and atomics (Playdate builds are single-threaded)
+#if defined(__GNUC__) || defined(__clang__)
+    #define PROFILER_THREAD_LOCAL __thread
+    #define PROFILER_ATOMIC_INCREMENT(ptr) __sync_fetch_and_add((ptr), 1)
+#else
+    #define PROFILER_THREAD_LOCAL
+    #define PROFILER_ATOMIC_INCREMENT(ptr) ((*(ptr))++)
+#endif
+
+typedef struct Profiler {
+    ProfilerThreadBuffer threads[PROFILER_MAX_THREADS];
+    uint32_t threadCount;
+    uint32_t eventsPerThread;
+    uint32_t generation;           // Bumped on every init to invalidate stale TLS
+    uint64_t epochNs;              // Timestamps are stored relative to this
+    bool initialized;
+    bool enabled;
+} Profiler;
+
+static Profiler g_profiler = {0};
+static PROFILER_THREAD_LOCAL ProfilerThreadBuffer* t_threadBuffer = NULL;
+static PROFILER_THREAD_LOCAL uint32_t t_generation = 0;
+
+uint64_t profiler_get_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+#if ENABLE_PROFILER
+static uint32_t round_up_power_of_two(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value && result < 0x80000000u) {
+        result <<= 1;
+    }
+    return result;
+}
+#endif
+
+static inline ProfilerThreadBuffer* get_thread_buffer(void) {
+    if (t_generation != g_profiler.generation) {
+        return NULL; // Registered against a previous profiler session
+    }
+    return t_threadBuffer;
+}
+
+ProfilerResult profiler_init(uint32_t eventsPerThread) {
+#if ENABLE_PROFILER
+    if (eventsPerThread == 0) {
+        return PROFILER_ERROR_INVALID_CAPACITY;
+    }
+
+    if (g_profiler.initialized) {
+        profiler_shutdown();
+    }
+
+    uint32_t generation = g_profiler.generation + 1;
+    memset(&g_profiler, 0, sizeof(Profiler));
+    g_profiler.generation = generation;
+    g_profiler.eventsPerThread = round_up_power_of_two(eventsPerThread);
+    g_profiler.epochNs = profiler_get_time_ns();
+    g_profiler.initialized = true;
+    g_profiler.enabled = true;
+
+    ProfilerResult result = profiler_register_thread("main");
+    if (result != PROFILER_OK) {
+        g_profiler.initialized = false;
+        g_profiler.enabled = false;
+    }
+    return result;
+#else
+    (void)eventsPerThread;
+    return PROFILER_ERROR_DISABLED;
+#endif
+}
+
+void profiler_shutdown(void) {
+    for (uint32_t i = 0; i < PROFILER_MAX_THREADS; i++) {
+        ProfilerThreadBuffer* buffer = &g_profiler.threads[i];
+        if (buffer->counters) {
+            perf_counter_group_close(&buffer->counterGroup);
+            free(buffer->counters);
+            buffer->counters = NULL;
+        }
+        free(buffer->events);
+        buffer->events = NULL;
+    }
+
+    uint32_t generation = g_profiler.generation;
+    memset(&g_profiler, 0, sizeof(Profiler));
+    g_profiler.generation = generation + 1;
+}
+
+void profiler_reset(void) {
+    uint32_t count = g_profiler.threadCount < PROFILER_MAX_THREADS ?
+                     g_profiler.threadCount : PROFILER_MAX_THREADS;
+    for (uint32_t i = 0; i < count; i++) {
+        ProfilerThreadBuffer* buffer = &g_profiler.threads[i];
+        buffer->writeIndex = 0;
+        buffer->droppedZones = 0;
+    }
+    g_profiler.epochNs = profiler_get_time_ns();
+}
+
+void profiler_set_enabled(bool enabled) {
+    g_profiler.enabled = enabled && g_profiler.initialized;
+}
+
+bool profiler_is_enabled(void) {
+    return g_profiler.enabled;
+}
+
+ProfilerResult profiler_register_thread(const char* name) {
+#if ENABLE_PROFILER
+    if (!g_profiler.initialized) {
+        return PROFILER_ERROR_NOT_INITIALIZED;
+    }
+
+    if (get_thread_buffer()) {
+        return PROFILER_ERROR_ALREADY_REGISTERED;
+    }
+
+    uint32_t slot = PROFILER_ATOMIC_INCREMENT(&g_profiler.threadCount);
+    if (slot >= PROFILER_MAX_THREADS) {
+        return PROFILER_ERROR_TOO_MANY_THREADS;
+    }
+
+    ProfilerThreadBuffer* buffer = &g_profiler.threads[slot];
+    buffer->events = malloc(g_profiler.eventsPerThread * sizeof(ProfilerEvent));
+    if (!buffer->events) {
+        return PROFILER_ERROR_OUT_OF_MEMORY;
+    }
+
+    buffer->capacity = g_profiler.eventsPerThread;
+    buffer->writeIndex = 0;
+    buffer->depth = 0;
+    buffer->droppedZones = 0;
+    buffer->threadIndex = slot;
+    buffer->counters = NULL;
+    buffer->countedZoneMask = 0;
+    strncpy(buffer->name, name ? name : "worker", sizeof(buffer->name) - 1);
+    buffer->name[sizeof(buffer->name) - 1] = '\0';
+
+    t_threadBuffer = buffer;
+    t_generation = g_profiler.generation;
+    return PROFILER_OK;
+#else
+    (void)name;
+    return PROFILER_ERROR_DISABLED;
+#endif
+}
+
+ProfilerResult profiler_enable_thread_counters(void) {
+#if ENABLE_PROFILER
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    if (!buffer) {
+        return PROFILER_ERROR_NOT_INITIALIZED;
+    }
+
+    if (buffer->counters) {
+        return PROFILER_OK;
+    }
+
+    if (perf_counter_group_open(&buffer->counterGroup) != PERF_COUNTERS_OK) {
+        perf_counter_group_close(&buffer->counterGroup);
+        return PROFILER_ERROR_COUNTERS_UNAVAILABLE;
+    }
+
+    buffer->counters = calloc(buffer->capacity, sizeof(PerfCounterSample));
+    if (!buffer->counters) {
+        perf_counter_group_close(&buffer->counterGroup);
+        return PROFILER_ERROR_OUT_OF_MEMORY;
+    }
+
+    buffer->countedZoneMask = 0;
+    return PROFILER_OK;
+#else
+    return PROFILER_ERROR_DISABLED;
+#endif
+}
+
+void profiler_disable_thread_counters(void) {
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    if (!buffer || !buffer->counters) return;
+
+    // Events recorded with counters lose them along with the parallel ring
+    uint32_t count = profiler_get_event_count(buffer);
+    for (uint32_t i = 0; i < count; i++) {
+        buffer->events[(buffer->writeIndex - count + i) & (buffer->capacity - 1)].flags = 0;
+    }
+
+    perf_counter_group_close(&buffer->counterGroup);
+    free(buffer->counters);
+    buffer->counters = NULL;
+    buffer->countedZoneMask = 0;
+}
+
+bool profiler_thread_counters_enabled(void) {
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    return buffer && buffer->counters;
+}
+
+#if ENABLE_PROFILER
+// Pushes a zone; returns its depth, or -1 if nothing was recorded
+static inline int push_zone(ProfilerThreadBuffer* buffer, const char* name) {
+    uint32_t depth = buffer->depth++;
+    if (depth >= PROFILER_MAX_ZONE_DEPTH) {
+        buffer->droppedZones++;
+        return -1;
+    }
+
+    buffer->zoneName[depth] = name;
+    buffer->countedZoneMask &= ~(1u << depth);
+    buffer->zoneStart[depth] = profiler_get_time_ns();
+    return (int)depth;
+}
+#endif
+
+void profiler_zone_begin(const char* name) {
+#if ENABLE_PROFILER
+    if (!g_profiler.enabled) return;
+
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    if (!buffer) return;
+
+    push_zone(buffer, name);
+#else
+    (void)name;
+#endif
+}
+
+void profiler_zone_begin_counted(const char* name) {
+#if ENABLE_PROFILER
+    if (!g_profiler.enabled) return;
+
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    if (!buffer) return;
+
+    int depth = push_zone(buffer, name);
+    if (depth < 0 || !buffer->counters) return;
+
+    // Snapshot last so the read syscall is not charged to the zone
+    if (perf_counter_group_read(&buffer->counterGroup, &buffer->zoneCounters[depth]) == PERF_COUNTERS_OK) {
+        buffer->countedZoneMask |= 1u << depth;
+    }
+#else
+    (void)name;
+#endif
+}
+
+void profiler_zone_end(void) {
+#if ENABLE_PROFILER
+    // Not gated on enabled so zones opened before a disable still close
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    if (!buffer || buffer->depth == 0) return;
+
+    uint32_t depth = --buffer->depth;
+    if (depth >= PROFILER_MAX_ZONE_DEPTH) {
+        return; // Matching begin was dropped
+    }
+
+    // Counters are read first, mirroring the begin order
+    uint32_t slot = buffer->writeIndex & (buffer->capacity - 1);
+    uint32_t flags = 0;
+    if ((buffer->countedZoneMask & (1u << depth)) && buffer->counters) {
+        PerfCounterSample end;
+        if (perf_counter_group_read(&buffer->counterGroup, &end) == PERF_COUNTERS_OK) {
+            perf_counter_sample_delta(&buffer->zoneCounters[depth], &end, &buffer->counters[slot]);
+            flags |= PROFILER_EVENT_HAS_COUNTERS;
+        }
+    }
+
+    uint64_t endNs = profiler_get_time_ns();
+    uint64_t startNs = buffer->zoneStart[depth];
+
+    ProfilerEvent* event = &buffer->events[slot];
+    event->name = buffer->zoneName[depth];
+    event->startNs = startNs - g_profiler.epochNs;
+    event->durationNs = endNs - startNs;
+    event->depth = depth;
+    event->flags = flags;
+    buffer->writeIndex++;
+#endif
+}
+
+const char* profiler_get_current_zone(void) {
+    ProfilerThreadBuffer* buffer = get_thread_buffer();
+    if (!buffer || buffer->depth == 0) {
+        return NULL;
+    }
+
+    uint32_t depth = buffer->depth - 1;
+    return depth < PROFILER_MAX_ZONE_DEPTH ? buffer->zoneName[depth] : NULL;
+}
+
+uint32_t profiler_get_thread_count(void) {
+    return g_profiler.threadCount < PROFILER_MAX_THREADS ?
+           g_profiler.threadCount : PROFILER_MAX_THREADS;
+}
+
+const ProfilerThreadBuffer* profiler_get_thread_buffer(uint32_t threadIndex) {
+    if (threadIndex >= profiler_get_thread_count()) {
+        return NULL;
+    }
+
+    const ProfilerThreadBuffer* buffer = &g_profiler.threads[threadIndex];
+    return buffer->events ? buffer : NULL;
+}
+
+uint32_t profiler_get_event_count(const ProfilerThreadBuffer* buffer) {
+    if (!buffer) return 0;
+    return buffer->writeIndex < buffer->capacity ? buffer->writeIndex : buffer->capacity;
+}
+
+const ProfilerEvent* profiler_get_event(const ProfilerThreadBuffer* buffer, uint32_t index) {
+    uint32_t count = profiler_get_event_count(buffer);
+    if (index >= count) {
+        return NULL;
+    }
+
+    // Index 0 is the oldest event still held by the ring
+    uint32_t first = buffer->writeIndex - count;
+    return &buffer->events[(first + index) & (buffer->capacity - 1)];
+}
+
+const PerfCounterSample* profiler_get_event_counters(const ProfilerThreadBuffer* buffer, uint32_t index) {
+    const ProfilerEvent* event = profiler_get_event(buffer, index);
+    if (!event || !(event->flags & PROFILER_EVENT_HAS_COUNTERS) || !buffer->counters) {
+        return NULL;
+    }
+
+    uint32_t first = buffer->writeIndex - profiler_get_event_count(buffer);
+    return &buffer->counters[(first + index) & (buffer->capacity - 1)];
+}
+
+uint32_t profiler_sum_zone_counters(const char* name, PerfCounterSample* total) {
+    if (!name || !total) {
+        return 0;
+    }
+
+    memset(total, 0, sizeof(PerfCounterSample));
+    uint32_t zones = 0;
+    for (uint32_t t = 0; t < profiler_get_thread_count(); t++) {
+        const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(t);
+        uint32_t count = profiler_get_event_count(buffer);
+        for (uint32_t i = 0; i < count; i++) {
+            const ProfilerEvent* event = profiler_get_event(buffer, i);
+            if (strcmp(event->name, name) != 0) continue;
+
+            const PerfCounterSample* counters = profiler_get_event_counters(buffer, i);
+            if (counters) {
+                perf_counter_sample_accumulate(total, counters);
+                zones++;
+            }
+        }
+    }
+    return zones;
+}
+
+static void write_json_string(FILE* out, const char* text) {
+    fputc('"', out);
+    for (const char* c = text ? text : "unnamed"; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', out);
+            fputc(*c, out);
+        } else if ((unsigned char)*c < 0x20) {
+            fprintf(out, "\\u%04x", (unsigned char)*c);
+        } else {
+            fputc(*c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+ProfilerResult profiler_write_chrome_trace(FILE* out) {
+    if (!out) {
+        return PROFILER_ERROR_IO;
+    }
+
+    if (!g_profiler.initialized) {
+        return PROFILER_ERROR_NOT_INITIALIZED;
+    }
+
+    // Buffers are read without synchronization: export while workers are idle
+    fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    bool first = true;
+    for (uint32_t t = 0; t < profiler_get_thread_count(); t++) {
+        const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(t);
+        if (!buffer) continue;
+
+        fprintf(out, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                first ? "" : ",", buffer->threadIndex);
+        write_json_string(out, buffer->name);
+        fprintf(out, "}}");
+        first = false;
+
+        uint32_t count = profiler_get_event_count(buffer);
+        for (uint32_t i = 0; i < count; i++) {
+            const ProfilerEvent* event = profiler_get_event(buffer, i);
+            fprintf(out, ",\n{\"name\":");
+            write_json_string(out, event->name);
+            fprintf(out, ",\"cat\":\"engine\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                         "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u",
+                    buffer->threadIndex,
+                    event->startNs / 1000.0, event->durationNs / 1000.0,
+                    event->depth);
+
+            const PerfCounterSample* counters = profiler_get_event_counters(buffer, i);
+            if (counters) {
+                for (uint32_t c = 0; c < PERF_COUNTER_COUNT; c++) {
+                    if (counters->validMask & (1u << c)) {
+                        fprintf(out, ",\"%s\":%llu", perf_counter_type_to_string((PerfCounterType)c),
+                                (unsigned long long)counters->values[c]);
+                    }
+                }
+            }
+            fprintf(out, "}}");
+        }
+    }
+
+    fprintf(out, "\n]}\n");
+    return ferror(out) ? PROFILER_ERROR_IO : PROFILER_OK;
+}
+
+ProfilerResult profiler_export_chrome_trace(const char* path) {
+    if (!path) {
+        return PROFILER_ERROR_IO;
+    }
+
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        return PROFILER_ERROR_IO;
+    }
+
+    ProfilerResult result = profiler_write_chrome_trace(out);
+    if (fclose(out) != 0 && result == PROFILER_OK) {
+        result = PROFILER_ERROR_IO;
+    }
+    return result;
+}
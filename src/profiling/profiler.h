@@ -0,0 +1,148 @@
+/**
+ * @file profiler.h
+ * @brief Hierarchical zone profiler with per-thread ring buffers
+ *
+ * Zones are recorded as complete events (name, start, duration, depth) into a
+ * fixed-size ring buffer owned by the thread that opened them, so recording
+ * never takes a lock and never allocates. The buffers can be exported as
+ * Chrome trace_event JSON and loaded in chrome://tracing or Perfetto.
+ *
+ * Counted zones additionally capture hardware counter deltas (cycles,
+ * instructions, cache and branch misses, see perf_counters.h) for threads
+ * that called profiler_enable_thread_counters(); elsewhere they behave like
+ * plain zones.
+ *
+ * Zone macros compile to nothing unless ENABLE_PROFILER is non-zero (the
+ * default for DEBUG builds). profiler_get_time_ns() is always available since
+ * the scene timing statistics rely on it in every build.
+ *
+ * Usage Example:
+ * @code
+ * profiler_init(PROFILER_DEFAULT_EVENT_CAPACITY);
+ *
+ * PROFILER_ZONE_BEGIN("frame");
+ * scene_manager_update(manager, dt);
+ * scene_manager_render(manager);
+ * PROFILER_ZONE_END();
+ *
+ * profiler_export_chrome_trace("frame_trace.json");
+ * profiler_shutdown();
+ * @endcode
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "perf_counters.h"
+
+// Profiler configuration
+#ifndef ENABLE_PROFILER
+    #ifdef DEBUG
+        #define ENABLE_PROFILER 1
+    #else
+        #define ENABLE_PROFILER 0
+    #endif
+#endif
+
+#define PROFILER_MAX_THREADS 8
+#define PROFILER_MAX_ZONE_DEPTH 32
+#define PROFILER_DEFAULT_EVENT_CAPACITY 16384  // Events per thread (power of 2)
+#define PROFILER_THREAD_NAME_LENGTH 32
+
+// ProfilerEvent flags
+#define PROFILER_EVENT_HAS_COUNTERS 0x1u
+
+// Completed zone record (32 bytes)
+typedef struct ProfilerEvent {
+    const char* name;              // 8 bytes - zone name (must outlive the profiler)
+    uint64_t startNs;              // 8 bytes - start time relative to profiler_init
+    uint64_t durationNs;           // 8 bytes - zone duration
+    uint32_t depth;                // 4 bytes - nesting depth (0 = outermost)
+    uint32_t flags;                // 4 bytes - PROFILER_EVENT_* bits
+} ProfilerEvent;
+
+// Per-thread recording state, written only by its owning thread
+typedef struct ProfilerThreadBuffer {
+    ProfilerEvent* events;                              // Ring buffer storage
+    uint32_t capacity;                                  // Ring size (power of 2)
+    uint32_t writeIndex;                                // Total events written
+    uint32_t depth;                                     // Current open zone count
+    uint32_t droppedZones;                              // Zones past max depth
+    uint64_t zoneStart[PROFILER_MAX_ZONE_DEPTH];        // Open zone start times
+    const char* zoneName[PROFILER_MAX_ZONE_DEPTH];      // Open zone names
+    uint32_t threadIndex;                               // Slot in the profiler
+    char name[PROFILER_THREAD_NAME_LENGTH];             // Thread name for export
+
+    // Hardware counters (counters == NULL unless enabled for this thread)
+    PerfCounterSample* counters;                        // Parallel to events
+    PerfCounterGroup counterGroup;
+    PerfCounterSample zoneCounters[PROFILER_MAX_ZONE_DEPTH];  // Open zone snapshots
+    uint32_t countedZoneMask;                           // Bit per depth with a snapshot
+} ProfilerThreadBuffer;
+
+// Profiler results
+typedef enum {
+    PROFILER_OK = 0,
+    PROFILER_ERROR_NOT_INITIALIZED,
+    PROFILER_ERROR_OUT_OF_MEMORY,
+    PROFILER_ERROR_INVALID_CAPACITY,
+    PROFILER_ERROR_TOO_MANY_THREADS,
+    PROFILER_ERROR_ALREADY_REGISTERED,
+    PROFILER_ERROR_IO,
+    PROFILER_ERROR_DISABLED,
+    PROFILER_ERROR_COUNTERS_UNAVAILABLE
+} ProfilerResult;
+
+// Clock (always available)
+uint64_t profiler_get_time_ns(void);
+
+// Profiler lifecycle
+ProfilerResult profiler_init(uint32_t eventsPerThread);
+void profiler_shutdown(void);
+void profiler_reset(void);
+void profiler_set_enabled(bool enabled);
+bool profiler_is_enabled(void);
+
+// Thread registration (the thread calling profiler_init is registered as "main")
+ProfilerResult profiler_register_thread(const char* name);
+
+// Hardware counters for the calling thread (optional, Linux perf_event)
+ProfilerResult profiler_enable_thread_counters(void);
+void profiler_disable_thread_counters(void);
+bool profiler_thread_counters_enabled(void);
+
+// Zone recording (prefer the PROFILER_ZONE_* macros)
+void profiler_zone_begin(const char* name);
+void profiler_zone_begin_counted(const char* name);
+void profiler_zone_end(void);
+const char* profiler_get_current_zone(void);
+
+// Data access
+uint32_t profiler_get_thread_count(void);
+const ProfilerThreadBuffer* profiler_get_thread_buffer(uint32_t threadIndex);
+uint32_t profiler_get_event_count(const ProfilerThreadBuffer* buffer);
+const ProfilerEvent* profiler_get_event(const ProfilerThreadBuffer* buffer, uint32_t index);
+const PerfCounterSample* profiler_get_event_counters(const ProfilerThreadBuffer* buffer, uint32_t index);
+uint32_t profiler_sum_zone_counters(const char* name, PerfCounterSample* total);
+
+// Chrome trace_event export
+ProfilerResult profiler_write_chrome_trace(FILE* out);
+ProfilerResult profiler_export_chrome_trace(const char* path);
+
+// Zone macros - compiled out entirely in release builds
+#if ENABLE_PROFILER
+    #define PROFILER_ZONE_BEGIN(name) profiler_zone_begin(name)
+    #define PROFILER_COUNTED_ZONE_BEGIN(name) profiler_zone_begin_counted(name)
+    #define PROFILER_ZONE_END() profiler_zone_end()
+    #define PROFILER_FUNCTION_BEGIN() profiler_zone_begin(__func__)
+#else
+    #define PROFILER_ZONE_BEGIN(name) ((void)0)
+    #define PROFILER_COUNTED_ZONE_BEGIN(name) ((void)0)
+    #define PROFILER_ZONE_END() ((void)0)
+    #define PROFILER_FUNCTION_BEGIN() ((void)0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,1145 @@
+#include "collision_system.h"
+#include "../core/memory_budget.h"
+#include "../core/scene.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define COLLISION_HAS_SIMD 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define COLLISION_HAS_SIMD 1
+#else
+    #define COLLISION_HAS_SIMD 0
+#endif
+
+#define COLLISION_LANES 4
+#define COLLISION_MIN_CELLS 256            // Grid cells allowed regardless of collider count
+#define COLLISION_CELLS_PER_COLLIDER 4
+#define COLLISION_RANGE_STRIDE 5           // minX, minY, maxX, maxY cell, layer bucket
+
+// A growable scratch array charged to the spatial budget
+typedef struct CollisionBuffer {
+    void* data;
+    uint32_t capacity;             // Elements
+} CollisionBuffer;
+
+// Where a continuous collider's shape centre was at the previous update
+typedef struct CollisionSweep {
+    uint32_t index;                // Store index
+    float fromX;
+    float fromY;
+} CollisionSweep;
+
+// Contact events of one scene, and the keys they were found against
+typedef struct CollisionSceneEvents {
+    uint32_t sceneId;              // SCENE_INVALID_ID when unused
+    uint32_t lastUse;              // Update stamp, to reuse the stalest entry
+    CollisionBuffer previousKeys;  // uint64_t sorted keys of the scene's last contacts
+    CollisionBuffer enters;        // CollisionContact
+    CollisionBuffer stays;         // CollisionContact
+    CollisionBuffer exits;         // CollisionExit
+    uint32_t previousKeyCount;
+    uint32_t enterCount;
+    uint32_t stayCount;
+    uint32_t exitCount;
+} CollisionSceneEvents;
+
+// Per-frame working set, kept between frames to avoid reallocating
+static struct {
+    CollisionBuffer active;        // uint32_t store index per enabled collider
+    CollisionBuffer cellRange;     // int32_t[5] first/last cell and layer bucket per active collider
+    CollisionBuffer cellStart;     // uint32_t per (cell, layer bucket) + 1 (prefix sums)
+    CollisionBuffer entries;       // uint32_t active index per (collider, cell)
+    CollisionBuffer pairA;         // uint32_t store index
+    CollisionBuffer pairB;
+    CollisionBuffer contacts;      // CollisionContact
+    CollisionBuffer sweeps;        // CollisionSweep per continuous collider
+    CollisionBuffer sweepHits;     // CollisionSweepHit
+    CollisionBuffer visited;       // uint32_t sweep stamp per active collider
+    CollisionBuffer pairKeys;      // uint64_t component id pair per contact, sorted
+    CollisionBuffer pairOrder;     // uint32_t contact index per sorted key
+    CollisionBuffer sortKeys;      // uint64_t radix sort scratch
+    CollisionBuffer sortOrder;     // uint32_t radix sort scratch
+    CollisionBuffer liveIds;       // uint64_t component id and store index, sorted
+    CollisionSceneEvents scenes[COLLISION_MAX_SCENES];
+    CollisionSceneEvents* lastEvents;  // Scene of the last update, NULL for none
+    uint32_t updateStamp;
+    uint32_t bytes;
+    uint32_t contactCount;
+    uint32_t sweepHitCount;
+    CollisionStats stats;
+    float cellSize;
+    uint8_t kernel;
+    bool kernelChosen;
+} g_collision = { .cellSize = COLLISION_DEFAULT_CELL_SIZE };
+
+// Scratch buffers
+
+// Grows geometrically; contents are not preserved unless keep is set
+static bool buffer_reserve(CollisionBuffer* buffer, uint32_t count, size_t elementSize, bool keep) {
+    if (count <= buffer->capacity) {
+        return true;
+    }
+
+    uint32_t capacity = buffer->capacity ? buffer->capacity : 64;
+    while (capacity < count) {
+        capacity = capacity > UINT32_MAX / 2 ? count : capacity * 2;
+    }
+    size_t oldBytes = buffer->capacity * elementSize;
+    size_t bytes = capacity * elementSize;
+    if (bytes > UINT32_MAX ||
+        memory_budget_reserve(MEMORY_SUBSYSTEM_SPATIAL, (uint32_t)(bytes - oldBytes)) != MEMORY_BUDGET_OK) {
+        return false;
+    }
+
+    void* data = keep ? realloc(buffer->data, bytes) : malloc(bytes);
+    if (!data) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, (uint32_t)(bytes - oldBytes));
+        return false;
+    }
+    if (!keep) {
+        free(buffer->data);
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    g_collision.bytes += (uint32_t)(bytes - oldBytes);
+    return true;
+}
+
+static void buffer_free(CollisionBuffer* buffer) {
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->capacity = 0;
+}
+
+void collision_system_shutdown(void) {
+    buffer_free(&g_collision.active);
+    buffer_free(&g_collision.cellRange);
+    buffer_free(&g_collision.cellStart);
+    buffer_free(&g_collision.entries);
+    buffer_free(&g_collision.pairA);
+    buffer_free(&g_collision.pairB);
+    buffer_free(&g_collision.contacts);
+    buffer_free(&g_collision.sweeps);
+    buffer_free(&g_collision.sweepHits);
+    buffer_free(&g_collision.visited);
+    buffer_free(&g_collision.pairKeys);
+    buffer_free(&g_collision.pairOrder);
+    buffer_free(&g_collision.sortKeys);
+    buffer_free(&g_collision.sortOrder);
+    buffer_free(&g_collision.liveIds);
+    for (uint32_t i = 0; i < COLLISION_MAX_SCENES; i++) {
+        CollisionSceneEvents* events = &g_collision.scenes[i];
+        buffer_free(&events->previousKeys);
+        buffer_free(&events->enters);
+        buffer_free(&events->stays);
+        buffer_free(&events->exits);
+    }
+    memset(g_collision.scenes, 0, sizeof(g_collision.scenes));
+    g_collision.lastEvents = NULL;
+    g_collision.updateStamp = 0;
+    memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, g_collision.bytes);
+    g_collision.bytes = 0;
+    g_collision.contactCount = 0;
+    g_collision.sweepHitCount = 0;
+    memset(&g_collision.stats, 0, sizeof(CollisionStats));
+}
+
+// Kernels
+
+bool collision_kernel_is_supported(CollisionKernel kernel) {
+    switch (kernel) {
+        case COLLISION_KERNEL_SCALAR: return true;
+        case COLLISION_KERNEL_SIMD: return COLLISION_HAS_SIMD;
+        default: return false;
+    }
+}
+
+CollisionKernel collision_kernel_best(void) {
+    return COLLISION_HAS_SIMD ? COLLISION_KERNEL_SIMD : COLLISION_KERNEL_SCALAR;
+}
+
+CollisionResult collision_system_set_kernel(CollisionKernel kernel) {
+    if (!collision_kernel_is_supported(kernel)) {
+        return COLLISION_ERROR_UNSUPPORTED;
+    }
+    g_collision.kernel = (uint8_t)kernel;
+    g_collision.kernelChosen = true;
+    return COLLISION_OK;
+}
+
+CollisionKernel collision_system_get_kernel(void) {
+    return g_collision.kernelChosen ? (CollisionKernel)g_collision.kernel : collision_kernel_best();
+}
+
+CollisionResult collision_system_set_cell_size(float cellSize) {
+    if (!(cellSize > 0.0f) || !isfinite(cellSize)) {
+        return COLLISION_ERROR_INVALID_SHAPE;
+    }
+    g_collision.cellSize = cellSize;
+    return COLLISION_OK;
+}
+
+// Narrow phase. With the gap between the core boxes per axis
+//     g = max(aMin - bMax, bMin - aMax)
+// the cores overlap when both gaps are negative; otherwise their distance
+// is |(max(gx, 0), max(gy, 0))|, and the colliders overlap when it is below
+// the sum of the radii.
+
+static void write_contact(const CollisionColliders* store, uint32_t a, uint32_t b, float gapX, float gapY) {
+    float radius = store->radius[a] + store->radius[b];
+    float signX = (store->minX[b] + store->maxX[b]) >= (store->minX[a] + store->maxX[a]) ? 1.0f : -1.0f;
+    float signY = (store->minY[b] + store->maxY[b]) >= (store->minY[a] + store->maxY[a]) ? 1.0f : -1.0f;
+
+    CollisionContact* contact = (CollisionContact*)g_collision.contacts.data + g_collision.contactCount++;
+    contact->a = store->owners[a];
+    contact->b = store->owners[b];
+
+    float dx = gapX > 0.0f ? gapX : 0.0f;
+    float dy = gapY > 0.0f ? gapY : 0.0f;
+    float distance = sqrtf(dx * dx + dy * dy);
+    if (distance > 0.0f) {
+        // Rounded corners: push apart along the line between the cores
+        contact->normalX = signX * dx / distance;
+        contact->normalY = signY * dy / distance;
+        contact->depth = radius - distance;
+    } else if (gapX >= gapY) {
+        // Cores overlap or touch: push out along the shallower axis
+        contact->normalX = signX;
+        contact->normalY = 0.0f;
+        contact->depth = radius - gapX;
+    } else {
+        contact->normalX = 0.0f;
+        contact->normalY = signY;
+        contact->depth = radius - gapY;
+    }
+}
+
+static inline float pair_gap_x(const CollisionColliders* store, uint32_t a, uint32_t b) {
+    return fmaxf(store->minX[a] - store->maxX[b], store->minX[b] - store->maxX[a]);
+}
+
+static inline float pair_gap_y(const CollisionColliders* store, uint32_t a, uint32_t b) {
+    return fmaxf(store->minY[a] - store->maxY[b], store->minY[b] - store->maxY[a]);
+}
+
+static void narrow_phase_scalar(const CollisionColliders* store, const uint32_t* pairA, const uint32_t* pairB,
+                                uint32_t start, uint32_t count) {
+    for (uint32_t i = start; i < count; i++) {
+        uint32_t a = pairA[i], b = pairB[i];
+        float gapX = pair_gap_x(store, a, b);
+        float gapY = pair_gap_y(store, a, b);
+        float radius = store->radius[a] + store->radius[b];
+        float dx = gapX > 0.0f ? gapX : 0.0f;
+        float dy = gapY > 0.0f ? gapY : 0.0f;
+        if ((gapX < 0.0f && gapY < 0.0f) || dx * dx + dy * dy < radius * radius) {
+            write_contact(store, a, b, gapX, gapY);
+        }
+    }
+}
+
+#if defined(__SSE2__)
+static inline __m128 select_ps(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Whole groups of four; the remainder goes to the scalar kernel. Bounds
+// are gathered lane by lane, then the test and the contacts (the same
+// operations as write_contact()) are computed for all four pairs. Every
+// lane is written at the cursor, which only hits advance, so the contact
+// buffer fills without a branch per pair.
+static uint32_t narrow_phase_simd(const CollisionColliders* store, const uint32_t* pairA, const uint32_t* pairB,
+                                  uint32_t count) {
+    uint32_t groups = count & ~(uint32_t)(COLLISION_LANES - 1);
+    CollisionContact* contacts = g_collision.contacts.data;
+    uint32_t contactCount = g_collision.contactCount;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    float normalX[COLLISION_LANES], normalY[COLLISION_LANES], depth[COLLISION_LANES];
+
+    for (uint32_t i = 0; i < groups; i += COLLISION_LANES) {
+        const uint32_t* a = pairA + i;
+        const uint32_t* b = pairB + i;
+        #define GATHER(array, index) _mm_setr_ps(store->array[index[0]], store->array[index[1]], \
+                                                 store->array[index[2]], store->array[index[3]])
+        __m128 aMinX = GATHER(minX, a), aMaxX = GATHER(maxX, a), bMinX = GATHER(minX, b), bMaxX = GATHER(maxX, b);
+        __m128 aMinY = GATHER(minY, a), aMaxY = GATHER(maxY, a), bMinY = GATHER(minY, b), bMaxY = GATHER(maxY, b);
+        __m128 r = _mm_add_ps(GATHER(radius, a), GATHER(radius, b));
+        #undef GATHER
+        __m128 gx = _mm_max_ps(_mm_sub_ps(aMinX, bMaxX), _mm_sub_ps(bMinX, aMaxX));
+        __m128 gy = _mm_max_ps(_mm_sub_ps(aMinY, bMaxY), _mm_sub_ps(bMinY, aMaxY));
+        __m128 dx = _mm_max_ps(gx, zero);
+        __m128 dy = _mm_max_ps(gy, zero);
+        __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 cores = _mm_and_ps(_mm_cmplt_ps(gx, zero), _mm_cmplt_ps(gy, zero));
+        int mask = _mm_movemask_ps(_mm_or_ps(cores, _mm_cmplt_ps(distanceSquared, _mm_mul_ps(r, r))));
+        if (!mask) continue;
+
+        __m128 signX = select_ps(_mm_cmpge_ps(_mm_add_ps(bMinX, bMaxX), _mm_add_ps(aMinX, aMaxX)), one, minusOne);
+        __m128 signY = select_ps(_mm_cmpge_ps(_mm_add_ps(bMinY, bMaxY), _mm_add_ps(aMinY, aMaxY)), one, minusOne);
+        __m128 distance = _mm_sqrt_ps(distanceSquared);
+        __m128 rounded = _mm_cmpgt_ps(distance, zero);
+        __m128 axisX = _mm_cmpge_ps(gx, gy);
+        __m128 nx = select_ps(rounded, _mm_div_ps(_mm_mul_ps(signX, dx), distance), _mm_and_ps(axisX, signX));
+        __m128 ny = select_ps(rounded, _mm_div_ps(_mm_mul_ps(signY, dy), distance), _mm_andnot_ps(axisX, signY));
+        __m128 d = _mm_sub_ps(r, select_ps(rounded, distance, select_ps(axisX, gx, gy)));
+        _mm_storeu_ps(normalX, nx);
+        _mm_storeu_ps(normalY, ny);
+        _mm_storeu_ps(depth, d);
+
+        for (uint32_t lane = 0; lane < COLLISION_LANES; lane++) {
+            CollisionContact* contact = &contacts[contactCount];
+            contact->a = store->owners[a[lane]];
+            contact->b = store->owners[b[lane]];
+            contact->normalX = normalX[lane];
+            contact->normalY = normalY[lane];
+            contact->depth = depth[lane];
+            contactCount += (uint32_t)(mask >> lane) & 1;
+        }
+    }
+    g_collision.contactCount = contactCount;
+    return groups;
+}
+#elif COLLISION_HAS_SIMD
+// Whole groups of four; the remainder goes to the scalar kernel. The test
+// is branch-free and only the hits reach write_contact().
+static uint32_t narrow_phase_simd(const CollisionColliders* store, const uint32_t* pairA, const uint32_t* pairB,
+                                  uint32_t count) {
+    uint32_t groups = count & ~(uint32_t)(COLLISION_LANES - 1);
+    float gapX[COLLISION_LANES], gapY[COLLISION_LANES];
+
+    for (uint32_t i = 0; i < groups; i += COLLISION_LANES) {
+        const uint32_t* a = pairA + i;
+        const uint32_t* b = pairB + i;
+        float lanes[10][COLLISION_LANES];
+        for (uint32_t lane = 0; lane < COLLISION_LANES; lane++) {
+            lanes[0][lane] = store->minX[a[lane]]; lanes[1][lane] = store->maxX[a[lane]];
+            lanes[2][lane] = store->minY[a[lane]]; lanes[3][lane] = store->maxY[a[lane]];
+            lanes[4][lane] = store->minX[b[lane]]; lanes[5][lane] = store->maxX[b[lane]];
+            lanes[6][lane] = store->minY[b[lane]]; lanes[7][lane] = store->maxY[b[lane]];
+            lanes[8][lane] = store->radius[a[lane]]; lanes[9][lane] = store->radius[b[lane]];
+        }
+        float32x4_t zero = vdupq_n_f32(0.0f);
+        float32x4_t gx = vmaxq_f32(vsubq_f32(vld1q_f32(lanes[0]), vld1q_f32(lanes[5])),
+                                   vsubq_f32(vld1q_f32(lanes[4]), vld1q_f32(lanes[1])));
+        float32x4_t gy = vmaxq_f32(vsubq_f32(vld1q_f32(lanes[2]), vld1q_f32(lanes[7])),
+                                   vsubq_f32(vld1q_f32(lanes[6]), vld1q_f32(lanes[3])));
+        float32x4_t r = vaddq_f32(vld1q_f32(lanes[8]), vld1q_f32(lanes[9]));
+        float32x4_t dx = vmaxq_f32(gx, zero);
+        float32x4_t dy = vmaxq_f32(gy, zero);
+        uint32x4_t cores = vandq_u32(vcltq_f32(gx, zero), vcltq_f32(gy, zero));
+        uint32x4_t rounded = vcltq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(r, r));
+        uint32x4_t hits = vorrq_u32(cores, rounded);
+        int mask = (int)((vgetq_lane_u32(hits, 0) & 1) | (vgetq_lane_u32(hits, 1) & 2) |
+                         (vgetq_lane_u32(hits, 2) & 4) | (vgetq_lane_u32(hits, 3) & 8));
+        if (!mask) continue;
+        vst1q_f32(gapX, gx);
+        vst1q_f32(gapY, gy);
+        for (uint32_t lane = 0; lane < COLLISION_LANES; lane++) {
+            if (mask & (1 << lane)) {
+                write_contact(store, a[lane], b[lane], gapX[lane], gapY[lane]);
+            }
+        }
+    }
+    return groups;
+}
+#endif
+
+// Contacts never outnumber pairs, so the buffer is sized once per phase
+static uint32_t narrow_phase(const uint32_t* pairA, const uint32_t* pairB, uint32_t pairCount) {
+    g_collision.contactCount = 0;
+    if (pairCount == 0) {
+        return 0;
+    }
+    if (!buffer_reserve(&g_collision.contacts, pairCount, sizeof(CollisionContact), false)) {
+        g_collision.stats.droppedPairs += pairCount;
+        return 0;
+    }
+
+    const CollisionColliders* store = collision_colliders_get();
+    uint32_t done = 0;
+#if COLLISION_HAS_SIMD
+    if (collision_system_get_kernel() == COLLISION_KERNEL_SIMD) {
+        done = narrow_phase_simd(store, pairA, pairB, pairCount);
+    }
+#endif
+    narrow_phase_scalar(store, pairA, pairB, done, pairCount);
+    return g_collision.contactCount;
+}
+
+uint32_t collision_system_test_pairs(const uint32_t* pairA, const uint32_t* pairB, uint32_t pairCount) {
+    memset(&g_collision.stats, 0, sizeof(CollisionStats));
+    if (!pairA || !pairB) {
+        g_collision.contactCount = 0;
+        return 0;
+    }
+
+    const CollisionColliders* store = collision_colliders_get();
+    for (uint32_t i = 0; i < pairCount; i++) {
+        if (pairA[i] >= store->count || pairB[i] >= store->count) {
+            g_collision.contactCount = 0;
+            return 0;
+        }
+    }
+    g_collision.stats.candidatePairs = pairCount;
+    g_collision.stats.contacts = narrow_phase(pairA, pairB, pairCount);
+    return g_collision.stats.contacts;
+}
+
+// Broad phase
+
+// Cell coordinate clamped to the grid; NaN lands in cell 0
+static inline int32_t cell_coord(float value, float origin, float inverseCell, int32_t last) {
+    float cell = (value - origin) * inverseCell;
+    if (!(cell > 0.0f)) return 0;
+    if (cell >= (float)last) return last;
+    return (int32_t)cell;
+}
+
+// Layer buckets. Colliders are grouped by their lowest layer bit; a bucket
+// pair is visited only when the union of one bucket's layers meets the
+// union of the other's masks both ways, so "bullets hit enemies only"
+// never looks at bullet/bullet or bullet/player pairs.
+typedef struct CollisionBuckets {
+    uint32_t count;
+    uint8_t index[32];             // Lowest layer bit -> bucket
+    uint32_t layer[32];            // Union of the bucket's layers
+    uint32_t mask[32];             // Union of the bucket's masks
+    bool interact[32][32];
+} CollisionBuckets;
+
+// The grid as the broad phase left it, for the sweeps
+static struct {
+    CollisionBuckets buckets;
+    float originX;
+    float originY;
+    float inverseCell;             // 0 when everything is in one cell
+    int32_t width;
+    int32_t height;
+    bool valid;
+} g_grid;
+
+static void buckets_build(CollisionBuckets* buckets, const CollisionColliders* store,
+                          const uint32_t* active, uint32_t activeCount) {
+    buckets->count = 0;
+    memset(buckets->index, 0xFF, sizeof(buckets->index));
+    for (uint32_t k = 0; k < activeCount; k++) {
+        uint32_t i = active[k];
+        uint32_t bit = (uint32_t)__builtin_ctz(store->layer[i]);
+        if (buckets->index[bit] == 0xFF) {
+            buckets->index[bit] = (uint8_t)buckets->count;
+            buckets->layer[buckets->count] = 0;
+            buckets->mask[buckets->count] = 0;
+            buckets->count++;
+        }
+        uint8_t bucket = buckets->index[bit];
+        buckets->layer[bucket] |= store->layer[i];
+        buckets->mask[bucket] |= store->mask[i];
+    }
+    for (uint32_t i = 0; i < buckets->count; i++) {
+        for (uint32_t j = 0; j < buckets->count; j++) {
+            buckets->interact[i][j] = collision_layers_interact(buckets->layer[i], buckets->mask[i],
+                                                                buckets->layer[j], buckets->mask[j]);
+        }
+    }
+}
+
+// Every collider goes into each cell its bounds touch, sorted by cell and
+// then by layer bucket. A pair sharing several cells is emitted only from
+// the first cell both cover, the one at (max of their first columns, max of
+// their first rows). Pairs of colliders whose layers and masks do not
+// interact are never emitted.
+static uint32_t broad_phase(const CollisionColliders* store, const uint32_t* active, uint32_t activeCount,
+                            const CollisionSweep* sweeps, uint32_t sweepCount) {
+    g_grid.valid = false;
+    float worldMinX = INFINITY, worldMinY = INFINITY, worldMaxX = -INFINITY, worldMaxY = -INFINITY;
+    for (uint32_t k = 0; k < activeCount; k++) {
+        uint32_t i = active[k];
+        float r = store->radius[i];
+        worldMinX = fminf(worldMinX, store->minX[i] - r);
+        worldMinY = fminf(worldMinY, store->minY[i] - r);
+        worldMaxX = fmaxf(worldMaxX, store->maxX[i] + r);
+        worldMaxY = fmaxf(worldMaxY, store->maxY[i] + r);
+    }
+
+    // The grid also covers where the swept colliders came from
+    for (uint32_t s = 0; s < sweepCount; s++) {
+        uint32_t i = sweeps[s].index;
+        float halfWidth = (store->maxX[i] - store->minX[i]) * 0.5f + store->radius[i];
+        float halfHeight = (store->maxY[i] - store->minY[i]) * 0.5f + store->radius[i];
+        worldMinX = fminf(worldMinX, sweeps[s].fromX - halfWidth);
+        worldMinY = fminf(worldMinY, sweeps[s].fromY - halfHeight);
+        worldMaxX = fmaxf(worldMaxX, sweeps[s].fromX + halfWidth);
+        worldMaxY = fmaxf(worldMaxY, sweeps[s].fromY + halfHeight);
+    }
+
+    CollisionBuckets* buckets = &g_grid.buckets;
+    buckets_build(buckets, store, active, activeCount);
+    uint32_t bucketCount = buckets->count;
+    g_collision.stats.layerBuckets = bucketCount;
+
+    // Keep the grid in proportion to the collider count
+    float cellSize = g_collision.cellSize;
+    float limit = (float)(activeCount * COLLISION_CELLS_PER_COLLIDER > COLLISION_MIN_CELLS ?
+                          activeCount * COLLISION_CELLS_PER_COLLIDER : COLLISION_MIN_CELLS);
+    float columns = (worldMaxX - worldMinX) / cellSize + 1.0f;
+    float rows = (worldMaxY - worldMinY) / cellSize + 1.0f;
+    if (!(columns * rows <= limit)) {
+        cellSize *= sqrtf(columns * rows / limit);
+        columns = (worldMaxX - worldMinX) / cellSize + 1.0f;
+        rows = (worldMaxY - worldMinY) / cellSize + 1.0f;
+    }
+    float inverseCell = 1.0f / cellSize;
+    if (!isfinite(columns * rows) || !isfinite(inverseCell)) {
+        columns = rows = 1.0f;             // Unbounded positions: one cell
+        inverseCell = 0.0f;
+    }
+    int32_t gridWidth = (int32_t)columns;
+    int32_t gridHeight = (int32_t)rows;
+    uint32_t cellCount = (uint32_t)gridWidth * (uint32_t)gridHeight;
+    uint32_t slotCount = cellCount * bucketCount;      // One list per (cell, bucket)
+    g_collision.stats.cells = cellCount;
+
+    if (!buffer_reserve(&g_collision.cellRange, activeCount * COLLISION_RANGE_STRIDE, sizeof(int32_t), false) ||
+        !buffer_reserve(&g_collision.cellStart, slotCount + 1, sizeof(uint32_t), false)) {
+        return 0;
+    }
+    int32_t* range = g_collision.cellRange.data;
+    uint32_t* cellStart = g_collision.cellStart.data;
+    memset(cellStart, 0, (slotCount + 1) * sizeof(uint32_t));
+
+    // Count entries per (cell, bucket)
+    uint64_t entryCount = 0;
+    for (uint32_t k = 0; k < activeCount; k++) {
+        uint32_t i = active[k];
+        float r = store->radius[i];
+        int32_t* cells = range + k * COLLISION_RANGE_STRIDE;
+        cells[0] = cell_coord(store->minX[i] - r, worldMinX, inverseCell, gridWidth - 1);
+        cells[1] = cell_coord(store->minY[i] - r, worldMinY, inverseCell, gridHeight - 1);
+        cells[2] = cell_coord(store->maxX[i] + r, worldMinX, inverseCell, gridWidth - 1);
+        cells[3] = cell_coord(store->maxY[i] + r, worldMinY, inverseCell, gridHeight - 1);
+        cells[4] = buckets->index[__builtin_ctz(store->layer[i])];
+        for (int32_t cy = cells[1]; cy <= cells[3]; cy++) {
+            for (int32_t cx = cells[0]; cx <= cells[2]; cx++) {
+                cellStart[(uint32_t)(cy * gridWidth + cx) * bucketCount + (uint32_t)cells[4] + 1]++;
+            }
+        }
+        entryCount += (uint64_t)(cells[2] - cells[0] + 1) * (uint64_t)(cells[3] - cells[1] + 1);
+    }
+    if (entryCount > UINT32_MAX ||
+        !buffer_reserve(&g_collision.entries, (uint32_t)entryCount, sizeof(uint32_t), false)) {
+        return 0;
+    }
+
+    // Prefix sums, then fill; cellStart[s + 1] is the fill cursor of list s
+    // and ends as its end
+    for (uint32_t c = 1; c <= slotCount; c++) {
+        cellStart[c] += cellStart[c - 1];
+    }
+    uint32_t* entries = g_collision.entries.data;
+    for (uint32_t c = slotCount; c > 0; c--) {
+        cellStart[c] = cellStart[c - 1];
+    }
+    for (uint32_t k = 0; k < activeCount; k++) {
+        const int32_t* cells = range + k * COLLISION_RANGE_STRIDE;
+        for (int32_t cy = cells[1]; cy <= cells[3]; cy++) {
+            for (int32_t cx = cells[0]; cx <= cells[2]; cx++) {
+                entries[cellStart[(uint32_t)(cy * gridWidth + cx) * bucketCount + (uint32_t)cells[4] + 1]++] = k;
+            }
+        }
+    }
+    g_grid.originX = worldMinX;
+    g_grid.originY = worldMinY;
+    g_grid.inverseCell = inverseCell;
+    g_grid.width = gridWidth;
+    g_grid.height = gridHeight;
+    g_grid.valid = true;
+
+    uint32_t pairCount = 0;
+    for (uint32_t c = 0; c < cellCount; c++) {
+        const uint32_t* lists = cellStart + c * bucketCount;       // lists[b] .. lists[b + 1]
+        uint32_t total = lists[bucketCount] - lists[0];
+        if (total < 2) continue;
+
+        // Room for every pair in the cell up front, so the loop only stores
+        uint64_t need = pairCount + (uint64_t)total * (total - 1) / 2;
+        uint32_t limit = need < COLLISION_MAX_PAIRS ? (uint32_t)need : COLLISION_MAX_PAIRS;
+        if (!buffer_reserve(&g_collision.pairA, limit, sizeof(uint32_t), true) ||
+            !buffer_reserve(&g_collision.pairB, limit, sizeof(uint32_t), true)) {
+            limit = g_collision.pairA.capacity < g_collision.pairB.capacity ?
+                    g_collision.pairA.capacity : g_collision.pairB.capacity;
+        }
+        uint32_t* pairA = g_collision.pairA.data;
+        uint32_t* pairB = g_collision.pairB.data;
+
+        int32_t cx = (int32_t)(c % (uint32_t)gridWidth);
+        int32_t cy = (int32_t)(c / (uint32_t)gridWidth);
+        for (uint32_t bi = 0; bi < bucketCount; bi++) {
+            if (lists[bi] == lists[bi + 1]) continue;
+            for (uint32_t bj = bi; bj < bucketCount; bj++) {
+                if (!buckets->interact[bi][bj] || lists[bj] == lists[bj + 1]) continue;
+
+                for (uint32_t e = lists[bi]; e < lists[bi + 1]; e++) {
+                    const int32_t* first = range + entries[e] * COLLISION_RANGE_STRIDE;
+                    uint32_t a = active[entries[e]];
+                    for (uint32_t f = bi == bj ? e + 1 : lists[bj]; f < lists[bj + 1]; f++) {
+                        const int32_t* second = range + entries[f] * COLLISION_RANGE_STRIDE;
+                        int32_t ownerX = first[0] > second[0] ? first[0] : second[0];
+                        int32_t ownerY = first[1] > second[1] ? first[1] : second[1];
+                        uint32_t b = active[entries[f]];
+                        if (ownerX != cx || ownerY != cy ||
+                            !collision_layers_interact(store->layer[a], store->mask[a], store->layer[b], store->mask[b])) {
+                            continue;
+                        }
+                        if (pairCount >= limit) {
+                            g_collision.stats.droppedPairs++;
+                            continue;
+                        }
+                        // Earlier collider first, whichever bucket it came from
+                        pairA[pairCount] = a < b ? a : b;
+                        pairB[pairCount++] = a < b ? b : a;
+                    }
+                }
+            }
+        }
+    }
+    return pairCount;
+}
+
+// Continuous collision. A box of half extents (hx, hy) and radius ra
+// moving against a core box with radius rb is a point moving against that
+// core box grown by (hx, hy), rounded by ra + rb.
+
+// Time of impact of the point p + t * d, t in [0, 1], against the rounded
+// box; false when it misses or starts inside. The normal points from the
+// point towards the box.
+static bool sweep_rounded_box(float px, float py, float dx, float dy, float minX, float minY,
+                              float maxX, float maxY, float radius, float* time, float* normalX, float* normalY) {
+    float gapX = fmaxf(minX - px, px - maxX);
+    float gapY = fmaxf(minY - py, py - maxY);
+    float outX = fmaxf(gapX, 0.0f), outY = fmaxf(gapY, 0.0f);
+    if ((gapX < 0.0f && gapY < 0.0f) || outX * outX + outY * outY < radius * radius ||
+        (dx == 0.0f && dy == 0.0f)) {
+        return false;
+    }
+
+    // Slabs of the box grown by the radius; touching is not a hit
+    const float p[2] = { px, py }, d[2] = { dx, dy };
+    const float lo[2] = { minX - radius, minY - radius }, hi[2] = { maxX + radius, maxY + radius };
+    float enter = 0.0f, exit = 1.0f;
+    int axis = -1;
+    for (int a = 0; a < 2; a++) {
+        if (d[a] == 0.0f) {
+            if (p[a] <= lo[a] || p[a] >= hi[a]) return false;
+            continue;
+        }
+        float inverse = 1.0f / d[a];
+        float t0 = (lo[a] - p[a]) * inverse, t1 = (hi[a] - p[a]) * inverse;
+        if (t0 > t1) { float swap = t0; t0 = t1; t1 = swap; }
+        if (t0 > enter) { enter = t0; axis = a; }
+        exit = fminf(exit, t1);
+        if (enter >= exit) return false;
+    }
+
+    // Entered through a face, level with the core box
+    float hitX = px + dx * enter, hitY = py + dy * enter;
+    bool besideX = hitX >= minX && hitX <= maxX, besideY = hitY >= minY && hitY <= maxY;
+    if ((axis == 0 && besideY) || (axis == 1 && besideX)) {
+        *time = enter;
+        *normalX = axis == 0 ? (dx > 0.0f ? 1.0f : -1.0f) : 0.0f;
+        *normalY = axis == 1 ? (dy > 0.0f ? 1.0f : -1.0f) : 0.0f;
+        return true;
+    }
+
+    // Otherwise through a corner region: the circle around the core corner
+    float cornerX = hitX < minX ? minX : maxX, cornerY = hitY < minY ? minY : maxY;
+    float mx = px - cornerX, my = py - cornerY;
+    float b = mx * dx + my * dy;
+    float c = mx * mx + my * my - radius * radius;
+    float a = dx * dx + dy * dy;
+    float discriminant = b * b - a * c;
+    if (b >= 0.0f || discriminant <= 0.0f) return false;
+    float t = (-b - sqrtf(discriminant)) / a;
+    if (t < 0.0f || t > 1.0f) return false;
+
+    float nx = cornerX - (px + dx * t), ny = cornerY - (py + dy * t);
+    float length = sqrtf(nx * nx + ny * ny);
+    *time = t;
+    *normalX = length > 0.0f ? nx / length : 0.0f;
+    *normalY = length > 0.0f ? ny / length : 0.0f;
+    return true;
+}
+
+// One continuous collider's motion, worked out once per sweep
+typedef struct CollisionSweepQuery {
+    uint32_t index;                // Mover's store index
+    uint32_t bucket;
+    float fromX, fromY;            // Shape centre at the previous update
+    float dx, dy;                  // Motion of the centre
+    float halfWidth, halfHeight;   // Mover's core box half extents
+    float radius;
+    float minX, minY, maxX, maxY;  // Everything the mover's shape passes over
+} CollisionSweepQuery;
+
+// Tests one cell's colliders against the mover, keeping the earliest hit
+static void sweep_cell(const CollisionColliders* store, const uint32_t* active, const CollisionSweepQuery* query,
+                       uint32_t cell, uint32_t stamp, CollisionSweepHit* best) {
+    const uint32_t* cellStart = g_collision.cellStart.data;
+    const uint32_t* entries = g_collision.entries.data;
+    uint32_t* visited = g_collision.visited.data;
+    const CollisionBuckets* buckets = &g_grid.buckets;
+    const uint32_t* lists = cellStart + cell * buckets->count;
+    uint32_t i = query->index;
+
+    for (uint32_t bucket = 0; bucket < buckets->count; bucket++) {
+        if (!buckets->interact[query->bucket][bucket]) continue;
+
+        for (uint32_t e = lists[bucket]; e < lists[bucket + 1]; e++) {
+            uint32_t k = entries[e];
+            uint32_t j = active[k];
+            if (visited[k] == stamp || j == i) continue;
+            visited[k] = stamp;
+
+            // Targets clear of the swept box cannot be reached
+            float radius = query->radius + store->radius[j];
+            if (store->minX[j] - radius >= query->maxX || store->maxX[j] + radius <= query->minX ||
+                store->minY[j] - radius >= query->maxY || store->maxY[j] + radius <= query->minY ||
+                !collision_layers_interact(store->layer[i], store->mask[i], store->layer[j], store->mask[j])) {
+                continue;
+            }
+
+            float time, normalX, normalY;
+            if (sweep_rounded_box(query->fromX, query->fromY, query->dx, query->dy,
+                                  store->minX[j] - query->halfWidth, store->minY[j] - query->halfHeight,
+                                  store->maxX[j] + query->halfWidth, store->maxY[j] + query->halfHeight,
+                                  radius, &time, &normalX, &normalY) &&
+                time < best->time) {
+                best->target = store->owners[j];
+                best->time = time;
+                best->x = query->fromX + query->dx * time;
+                best->y = query->fromY + query->dy * time;
+                best->normalX = normalX;
+                best->normalY = normalY;
+            }
+        }
+    }
+}
+
+// Walks each mover's centre through the grid cell by cell (a DDA over the
+// motion segment). For each stretch of the segment inside one cell, the
+// cells the mover's shape covers along that stretch are tested; the walk
+// stops once a hit comes before the next stretch.
+static void sweep_phase(const CollisionColliders* store, const uint32_t* active, uint32_t activeCount,
+                        const CollisionSweep* sweeps, uint32_t sweepCount) {
+    if (!g_grid.valid || sweepCount == 0 ||
+        !buffer_reserve(&g_collision.sweepHits, sweepCount, sizeof(CollisionSweepHit), false) ||
+        !buffer_reserve(&g_collision.visited, activeCount, sizeof(uint32_t), false)) {
+        return;
+    }
+    memset(g_collision.visited.data, 0, activeCount * sizeof(uint32_t));
+    CollisionSweepHit* hits = g_collision.sweepHits.data;
+    const float originX = g_grid.originX, originY = g_grid.originY, inverseCell = g_grid.inverseCell;
+    const int32_t lastX = g_grid.width - 1, lastY = g_grid.height - 1;
+
+    for (uint32_t s = 0; s < sweepCount; s++) {
+        const CollisionSweep* sweep = &sweeps[s];
+        uint32_t i = sweep->index;
+        CollisionSweepQuery query;
+        query.index = i;
+        query.bucket = g_grid.buckets.index[__builtin_ctz(store->layer[i])];
+        query.fromX = sweep->fromX;
+        query.fromY = sweep->fromY;
+        query.halfWidth = (store->maxX[i] - store->minX[i]) * 0.5f;
+        query.halfHeight = (store->maxY[i] - store->minY[i]) * 0.5f;
+        query.radius = store->radius[i];
+        query.dx = (store->minX[i] + query.halfWidth) - sweep->fromX;
+        query.dy = (store->minY[i] + query.halfHeight) - sweep->fromY;
+        float reachX = query.halfWidth + query.radius, reachY = query.halfHeight + query.radius;
+        query.minX = fminf(sweep->fromX, sweep->fromX + query.dx) - reachX;
+        query.maxX = fmaxf(sweep->fromX, sweep->fromX + query.dx) + reachX;
+        query.minY = fminf(sweep->fromY, sweep->fromY + query.dy) - reachY;
+        query.maxY = fmaxf(sweep->fromY, sweep->fromY + query.dy) + reachY;
+        float dx = query.dx, dy = query.dy;
+
+        float fromCellX = (sweep->fromX - originX) * inverseCell;
+        float fromCellY = (sweep->fromY - originY) * inverseCell;
+        int32_t cx = cell_coord(sweep->fromX, originX, inverseCell, lastX);
+        int32_t cy = cell_coord(sweep->fromY, originY, inverseCell, lastY);
+        int32_t endX = cell_coord(sweep->fromX + dx, originX, inverseCell, lastX);
+        int32_t endY = cell_coord(sweep->fromY + dy, originY, inverseCell, lastY);
+        int32_t stepX = endX > cx ? 1 : endX < cx ? -1 : 0;
+        int32_t stepY = endY > cy ? 1 : endY < cy ? -1 : 0;
+        float deltaX = stepX ? 1.0f / fabsf(dx * inverseCell) : INFINITY;
+        float deltaY = stepY ? 1.0f / fabsf(dy * inverseCell) : INFINITY;
+        float nextX = stepX > 0 ? ((float)(cx + 1) - fromCellX) * deltaX :
+                      stepX < 0 ? (fromCellX - (float)cx) * deltaX : INFINITY;
+        float nextY = stepY > 0 ? ((float)(cy + 1) - fromCellY) * deltaY :
+                      stepY < 0 ? (fromCellY - (float)cy) * deltaY : INFINITY;
+
+        CollisionSweepHit best = { store->owners[i], NULL, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        uint32_t stamp = s + 1;
+        float start = 0.0f;
+        for (int32_t steps = 0; steps <= g_grid.width + g_grid.height; steps++) {
+            bool last = cx == endX && cy == endY;
+            float end = last ? 1.0f : fminf(fminf(nextX, nextY), 1.0f);
+
+            // Cells under the mover's shape while its centre covers [start, end]
+            float x0 = sweep->fromX + dx * start, x1 = sweep->fromX + dx * end;
+            float y0 = sweep->fromY + dy * start, y1 = sweep->fromY + dy * end;
+            int32_t cellX0 = cell_coord(fminf(x0, x1) - reachX, originX, inverseCell, lastX);
+            int32_t cellX1 = cell_coord(fmaxf(x0, x1) + reachX, originX, inverseCell, lastX);
+            int32_t cellY0 = cell_coord(fminf(y0, y1) - reachY, originY, inverseCell, lastY);
+            int32_t cellY1 = cell_coord(fmaxf(y0, y1) + reachY, originY, inverseCell, lastY);
+            for (int32_t y = cellY0; y <= cellY1; y++) {
+                for (int32_t x = cellX0; x <= cellX1; x++) {
+                    sweep_cell(store, active, &query, (uint32_t)(y * g_grid.width + x), stamp, &best);
+                }
+            }
+            if (last || best.time <= end) break;
+
+            start = end;
+            if (nextX < nextY) {
+                cx += stepX;
+                nextX += deltaX;
+            } else {
+                cy += stepY;
+                nextY += deltaY;
+            }
+            if (cx < 0 || cx > lastX || cy < 0 || cy > lastY) break;
+        }
+        if (best.target) {
+            hits[g_collision.sweepHitCount++] = best;
+        }
+    }
+}
+
+// Contact events
+
+// LSD radix sort, one byte per pass, skipping bytes that are the same in
+// every key (component ids rarely use all 32 bits). Values, when given,
+// move with their keys. The result ends up in keys and values.
+static void radix_sort(uint64_t* keys, uint32_t* values, uint64_t* keyScratch, uint32_t* valueScratch,
+                       uint32_t count) {
+    uint64_t differing = 0;
+    for (uint32_t i = 1; i < count; i++) {
+        differing |= keys[i] ^ keys[0];
+    }
+
+    uint64_t* from = keys;
+    uint64_t* to = keyScratch;
+    uint32_t* valuesFrom = values;
+    uint32_t* valuesTo = valueScratch;
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        if (((differing >> shift) & 0xFF) == 0) continue;
+
+        uint32_t offsets[256] = { 0 };
+        for (uint32_t i = 0; i < count; i++) {
+            offsets[(from[i] >> shift) & 0xFF]++;
+        }
+        uint32_t sum = 0;
+        for (uint32_t digit = 0; digit < 256; digit++) {
+            uint32_t digitCount = offsets[digit];
+            offsets[digit] = sum;
+            sum += digitCount;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t slot = offsets[(from[i] >> shift) & 0xFF]++;
+            to[slot] = from[i];
+            if (values) {
+                valuesTo[slot] = valuesFrom[i];
+            }
+        }
+
+        uint64_t* swapKeys = from; from = to; to = swapKeys;
+        uint32_t* swapValues = valuesFrom; valuesFrom = valuesTo; valuesTo = swapValues;
+    }
+    if (from != keys) {
+        memcpy(keys, from, count * sizeof(uint64_t));
+        if (values) {
+            memcpy(values, valuesFrom, count * sizeof(uint32_t));
+        }
+    }
+}
+
+// Lower id in the high half, so keys sort by their first collider
+static inline uint64_t pair_key(uint32_t idA, uint32_t idB) {
+    return idA < idB ? (uint64_t)idA << 32 | idB : (uint64_t)idB << 32 | idA;
+}
+
+// The contact with a as the lower component id
+static inline CollisionContact oriented_contact(const CollisionContact* contact) {
+    CollisionContact event = *contact;
+    if (contact->a->base.id > contact->b->base.id) {
+        event.a = contact->b;
+        event.b = contact->a;
+        event.normalX = -contact->normalX;
+        event.normalY = -contact->normalY;
+    }
+    return event;
+}
+
+// Collider with a component id, or NULL when it is no longer in the store
+static CollisionComponent* find_live_collider(const CollisionColliders* store, const uint64_t* liveIds,
+                                              uint32_t id) {
+    uint32_t low = 0, high = store->count;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        if ((uint32_t)(liveIds[middle] >> 32) < id) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low < store->count && (uint32_t)(liveIds[low] >> 32) == id) {
+        return store->owners[(uint32_t)liveIds[low]];
+    }
+    return NULL;
+}
+
+// Event state of a scene; past COLLISION_MAX_SCENES the least recently
+// updated scene's entry is reused, its buffers kept and its keys forgotten
+static CollisionSceneEvents* scene_events(const struct Scene* scene) {
+    CollisionSceneEvents* stalest = &g_collision.scenes[0];
+    uint32_t stamp = ++g_collision.updateStamp;
+    for (uint32_t i = 0; i < COLLISION_MAX_SCENES; i++) {
+        CollisionSceneEvents* events = &g_collision.scenes[i];
+        if (events->sceneId == scene->id) {
+            events->lastUse = stamp;
+            return events;
+        }
+        if (events->lastUse < stalest->lastUse) {
+            stalest = events;
+        }
+    }
+    stalest->sceneId = scene->id;
+    stalest->lastUse = stamp;
+    stalest->previousKeyCount = 0;
+    return stalest;
+}
+
+// Sorts this update's contact keys and merges them with the scene's
+// previous ones: keys only here are enters, keys in both are stays, keys
+// only in the previous list are exits
+static void event_phase(const CollisionColliders* store, CollisionSceneEvents* events) {
+    uint32_t contactCount = g_collision.contactCount;
+    uint32_t previousCount = events->previousKeyCount;
+    uint32_t scratchCount = contactCount > store->count ? contactCount : store->count;
+    uint32_t exitCapacity = contactCount > previousCount ? contactCount : previousCount;   // Also next update's
+    events->enterCount = events->stayCount = events->exitCount = 0;
+    // The key buffers trade places at the end, so both hold this update's count
+    if (!buffer_reserve(&g_collision.pairKeys, contactCount, sizeof(uint64_t), false) ||
+        !buffer_reserve(&events->previousKeys, contactCount, sizeof(uint64_t), true) ||
+        !buffer_reserve(&g_collision.pairOrder, contactCount, sizeof(uint32_t), false) ||
+        !buffer_reserve(&g_collision.sortKeys, scratchCount, sizeof(uint64_t), false) ||
+        !buffer_reserve(&g_collision.sortOrder, contactCount, sizeof(uint32_t), false) ||
+        !buffer_reserve(&events->enters, contactCount, sizeof(CollisionContact), false) ||
+        !buffer_reserve(&events->stays, contactCount, sizeof(CollisionContact), false) ||
+        !buffer_reserve(&events->exits, exitCapacity, sizeof(CollisionExit), false)) {
+        events->previousKeyCount = 0;          // Out of memory: start over without exits
+        return;
+    }
+
+    const CollisionContact* contacts = g_collision.contacts.data;
+    uint64_t* keys = g_collision.pairKeys.data;
+    uint32_t* order = g_collision.pairOrder.data;
+    for (uint32_t c = 0; c < contactCount; c++) {
+        keys[c] = pair_key(contacts[c].a->base.id, contacts[c].b->base.id);
+        order[c] = c;
+    }
+    radix_sort(keys, order, g_collision.sortKeys.data, g_collision.sortOrder.data, contactCount);
+
+    // UINT64_MAX past the end: no pair has it, the lower id being smaller
+    const uint64_t* previous = events->previousKeys.data;
+    CollisionContact* enters = events->enters.data;
+    CollisionContact* stays = events->stays.data;
+    CollisionExit* exits = events->exits.data;
+    uint32_t enterCount = 0, stayCount = 0, exitCount = 0;
+    uint32_t c = 0, p = 0;
+    while (c < contactCount || p < previousCount) {
+        uint64_t current = c < contactCount ? keys[c] : UINT64_MAX;
+        uint64_t before = p < previousCount ? previous[p] : UINT64_MAX;
+        if (current < before) {
+            enters[enterCount++] = oriented_contact(&contacts[order[c++]]);
+        } else if (current == before) {
+            stays[stayCount++] = oriented_contact(&contacts[order[c++]]);
+            p++;
+        } else {
+            CollisionExit* exit = &exits[exitCount++];
+            exit->idA = (uint32_t)(before >> 32);
+            exit->idB = (uint32_t)before;
+            p++;
+        }
+    }
+
+    // Exits only have ids; look the colliders up among the live ones
+    if (exitCount > 0) {
+        if (buffer_reserve(&g_collision.liveIds, store->count, sizeof(uint64_t), false)) {
+            uint64_t* liveIds = g_collision.liveIds.data;
+            for (uint32_t i = 0; i < store->count; i++) {
+                liveIds[i] = (uint64_t)store->owners[i]->base.id << 32 | i;
+            }
+            radix_sort(liveIds, NULL, g_collision.sortKeys.data, NULL, store->count);
+            for (uint32_t e = 0; e < exitCount; e++) {
+                exits[e].a = find_live_collider(store, liveIds, exits[e].idA);
+                exits[e].b = find_live_collider(store, liveIds, exits[e].idB);
+            }
+        } else {
+            for (uint32_t e = 0; e < exitCount; e++) {
+                exits[e].a = exits[e].b = NULL;
+            }
+        }
+    }
+
+    // This update's keys become the scene's previous ones
+    CollisionBuffer swap = events->previousKeys;
+    events->previousKeys = g_collision.pairKeys;
+    g_collision.pairKeys = swap;
+    events->previousKeyCount = contactCount;
+    events->enterCount = enterCount;
+    events->stayCount = stayCount;
+    events->exitCount = exitCount;
+}
+
+// Contacts and sweep hits of one scene
+static void detect(CollisionColliders* store, struct Scene* scene) {
+    if (!scene || store->count == 0 ||
+        !buffer_reserve(&g_collision.active, store->count, sizeof(uint32_t), false)) {
+        return;
+    }
+
+    // Refresh the scene's colliders from their transforms; those with no
+    // layer or no mask collide with nothing and stay out of the grid.
+    // Continuous colliders placed by an earlier refresh remember where they
+    // were first.
+    uint32_t* active = g_collision.active.data;
+    uint32_t activeCount = 0, sweepCount = 0;
+    for (uint32_t i = 0; i < store->count; i++) {
+        if (store->scenes[i] != scene) continue;
+
+        bool collides = store->layer[i] && store->mask[i];
+        if (collides && store->continuous[i] && store->placed[i] &&
+            buffer_reserve(&g_collision.sweeps, sweepCount + 1, sizeof(CollisionSweep), true)) {
+            CollisionSweep* sweep = (CollisionSweep*)g_collision.sweeps.data + sweepCount++;
+            sweep->index = i;
+            sweep->fromX = (store->minX[i] + store->maxX[i]) * 0.5f;
+            sweep->fromY = (store->minY[i] + store->maxY[i]) * 0.5f;
+        }
+        collision_colliders_refresh(i);
+        store->placed[i] = 1;
+        if (collides) {
+            active[activeCount++] = i;
+        }
+    }
+    g_collision.stats.colliders = activeCount;
+    if (activeCount < 2) {
+        return;
+    }
+
+    const CollisionSweep* sweeps = g_collision.sweeps.data;
+    uint32_t pairCount = broad_phase(store, active, activeCount, sweeps, sweepCount);
+    g_collision.stats.candidatePairs = pairCount;
+    g_collision.stats.contacts = narrow_phase(g_collision.pairA.data, g_collision.pairB.data, pairCount);
+    sweep_phase(store, active, activeCount, sweeps, sweepCount);
+    g_collision.stats.sweeps = sweepCount;
+    g_collision.stats.sweepHits = g_collision.sweepHitCount;
+}
+
+uint32_t collision_system_update(struct Scene* scene) {
+    memset(&g_collision.stats, 0, sizeof(CollisionStats));
+    g_collision.contactCount = 0;
+    g_collision.sweepHitCount = 0;
+
+    g_collision.lastEvents = NULL;
+    if (!scene) {
+        return 0;
+    }
+
+    CollisionColliders* store = collision_colliders_get();
+    detect(store, scene);
+    CollisionSceneEvents* events = scene_events(scene);
+    event_phase(store, events);
+    g_collision.lastEvents = events;
+    g_collision.stats.enters = events->enterCount;
+    g_collision.stats.stays = events->stayCount;
+    g_collision.stats.exits = events->exitCount;
+    return g_collision.stats.contacts;
+}
+
+const CollisionSweepHit* collision_system_get_sweep_hits(uint32_t* count) {
+    if (count) {
+        *count = g_collision.sweepHitCount;
+    }
+    return g_collision.sweepHitCount ? g_collision.sweepHits.data : NULL;
+}
+
+const CollisionContact* collision_system_get_contacts(uint32_t* count) {
+    if (count) {
+        *count = g_collision.contactCount;
+    }
+    return g_collision.contactCount ? g_collision.contacts.data : NULL;
+}
+
+// Events of the scene whose entry is given (NULL for none)
+static void fill_events(const CollisionSceneEvents* entry, CollisionEvents* events) {
+    memset(events, 0, sizeof(CollisionEvents));
+    if (!entry) return;
+
+    events->enters = entry->enterCount ? entry->enters.data : NULL;
+    events->stays = entry->stayCount ? entry->stays.data : NULL;
+    events->exits = entry->exitCount ? entry->exits.data : NULL;
+    events->enterCount = entry->enterCount;
+    events->stayCount = entry->stayCount;
+    events->exitCount = entry->exitCount;
+}
+
+bool collision_system_get_scene_events(const struct Scene* scene, CollisionEvents* events) {
+    if (!events) return false;
+
+    fill_events(NULL, events);
+    if (!scene) return false;
+
+    for (uint32_t i = 0; i < COLLISION_MAX_SCENES; i++) {
+        if (g_collision.scenes[i].sceneId == scene->id) {
+            fill_events(&g_collision.scenes[i], events);
+            return true;
+        }
+    }
+    return false;
+}
+
+const CollisionContact* collision_system_get_enter_events(uint32_t* count) {
+    CollisionEvents events;
+    fill_events(g_collision.lastEvents, &events);
+    if (count) {
+        *count = events.enterCount;
+    }
+    return events.enters;
+}
+
+const CollisionContact* collision_system_get_stay_events(uint32_t* count) {
+    CollisionEvents events;
+    fill_events(g_collision.lastEvents, &events);
+    if (count) {
+        *count = events.stayCount;
+    }
+    return events.stays;
+}
+
+const CollisionExit* collision_system_get_exit_events(uint32_t* count) {
+    CollisionEvents events;
+    fill_events(g_collision.lastEvents, &events);
+    if (count) {
+        *count = events.exitCount;
+    }
+    return events.exits;
+}
+
+void collision_system_get_stats(CollisionStats* stats) {
+    if (!stats) return;
+
+    *stats = g_collision.stats;
+}
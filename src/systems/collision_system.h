@@ -0,0 +1,245 @@
+/**
+ * @file collision_system.h
+ * @brief Per-frame collision detection over the collider store
+ *
+ * Each update refreshes the world bounds of a scene's enabled colliders,
+ * finds candidate pairs with a uniform grid rebuilt from scratch (a
+ * counting sort of colliders into cells, no per-object allocation), and
+ * runs the narrow phase over the candidate pairs four at a time (SSE2 or
+ * NEON when available). Overlapping pairs are written to one contiguous
+ * contact buffer that stays valid until the next update.
+ *
+ * Boxes and circles share one test: every collider is a core box plus a
+ * radius (see collision_component.h), and two colliders overlap when the
+ * distance between their core boxes is below the sum of their radii.
+ * Shapes that only touch do not overlap.
+ *
+ * Layer filtering happens in the broad phase: each grid cell keeps one
+ * list per layer bucket (colliders sharing their lowest layer bit), bucket
+ * pairs that cannot interact are skipped whole, and the remaining pairs
+ * are checked against the colliders' own layers and masks before they are
+ * emitted. The narrow phase only sees pairs that may collide.
+ *
+ * Continuous colliders (collision_component_set_continuous()) are also
+ * swept: the mover's centre is walked through the grid from where the
+ * previous update left it to where it is now, the colliders in the cells
+ * its shape passes over are tested for a time of impact in the order they
+ * are reached, and the earliest one is reported as a sweep hit. Only
+ * flagged colliders pay for this, so a coarse fixed step stays safe for
+ * fast bullets without slowing everything else. Targets are taken at
+ * their current positions, and colliders the mover already overlapped
+ * where it started are ignored. A collider that has never been refreshed
+ * (new, not yet updated) is not swept.
+ *
+ * Each update also reports how a scene's contacts changed since that
+ * scene's previous update, as three batches for gameplay code to walk
+ * after the physics step: pairs that started touching (enter), kept
+ * touching (stay) and stopped touching (exit). Pairs are keyed by their
+ * component ids; the keys of this update's contacts are radix sorted and
+ * merged in one linear pass against the scene's previous sorted keys, so
+ * no per-pair callbacks are made and no per-pair state is kept beyond one
+ * key. Every scene keeps its own keys and events, so updating one scene
+ * does not turn another's contacts into exits.
+ *
+ * Usage Example:
+ * @code
+ * collision_system_update(scene);
+ *
+ * uint32_t count;
+ * const CollisionContact* contacts = collision_system_get_contacts(&count);
+ * for (uint32_t i = 0; i < count; i++) {
+ *     // Push contacts[i].b out of contacts[i].a by depth along the normal
+ * }
+ *
+ * const CollisionContact* entered = collision_system_get_enter_events(&count);
+ * for (uint32_t i = 0; i < count; i++) {
+ *     // Play a sound for entered[i].a hitting entered[i].b
+ * }
+ * @endcode
+ *
+ * @note The scene's collision system (update_systems.c) calls
+ *       collision_system_update() once per fixed step, in the scene's fixed
+ *       pass. After scene_manager_update() the events are the last step's;
+ *       a frame that ran no step leaves them as they were.
+ * @note Scratch buffers grow to the largest frame seen and are charged to
+ *       the spatial memory budget
+ */
+
+#ifndef COLLISION_SYSTEM_H
+#define COLLISION_SYSTEM_H
+
+#include "../components/collision_component.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COLLISION_DEFAULT_CELL_SIZE 64.0f   // World units; about the size of a typical collider
+#define COLLISION_MAX_PAIRS (1u << 22)      // Candidate pairs past this are dropped for the frame
+#define COLLISION_MAX_SCENES 16             // Scenes with events; the stalest one's are forgotten
+
+// Narrow-phase kernels (identical contacts)
+typedef enum {
+    COLLISION_KERNEL_SCALAR = 0,
+    COLLISION_KERNEL_SIMD,                  // 4 pairs per step
+    COLLISION_KERNEL_COUNT
+} CollisionKernel;
+
+// One overlapping pair
+typedef struct CollisionContact {
+    CollisionComponent* a;         // From an update: the earlier of the two in the collider store
+    CollisionComponent* b;
+    float normalX;                 // Unit normal pointing from a towards b
+    float normalY;
+    float depth;                   // Distance b must move along the normal to separate
+} CollisionContact;
+
+// First collider a continuous collider hit along its motion
+typedef struct CollisionSweepHit {
+    CollisionComponent* mover;
+    CollisionComponent* target;
+    float time;                    // 0 .. 1 along the motion since the previous update
+    float x;                       // Mover's shape centre at impact
+    float y;
+    float normalX;                 // Unit normal pointing from mover towards target
+    float normalY;
+} CollisionSweepHit;
+
+// A pair that stopped touching. Either collider may have been destroyed
+// since the previous update, in which case its pointer is NULL and only
+// its id remains.
+typedef struct CollisionExit {
+    CollisionComponent* a;         // Lower component id of the two
+    CollisionComponent* b;
+    uint32_t idA;                  // Component ids (base.id)
+    uint32_t idB;
+} CollisionExit;
+
+// One scene's events from its last update; arrays are NULL when empty
+typedef struct CollisionEvents {
+    const CollisionContact* enters;
+    const CollisionContact* stays;
+    const CollisionExit* exits;
+    uint32_t enterCount;
+    uint32_t stayCount;
+    uint32_t exitCount;
+} CollisionEvents;
+
+// Counts from the last update
+typedef struct CollisionStats {
+    uint32_t colliders;            // Enabled colliders in the scene with a layer and a mask
+    uint32_t cells;                // Broad-phase grid cells
+    uint32_t layerBuckets;         // Distinct lowest layer bits
+    uint32_t candidatePairs;       // Pairs sharing a cell whose layers and masks interact
+    uint32_t droppedPairs;         // Past COLLISION_MAX_PAIRS or out of memory
+    uint32_t contacts;
+    uint32_t sweeps;               // Continuous colliders swept
+    uint32_t sweepHits;
+    uint32_t enters;               // Contact events
+    uint32_t stays;
+    uint32_t exits;
+} CollisionStats;
+
+/**
+ * @brief Detect every overlapping pair of enabled colliders in a scene
+ *
+ * @param scene Scene whose colliders are tested (NULL clears the contacts
+ *              and leaves no last events; every scene keeps its own)
+ * @return Number of contacts, also available from collision_system_get_contacts()
+ *
+ * @note Performance: O(n + k) for n colliders and k candidate pairs
+ */
+uint32_t collision_system_update(struct Scene* scene);
+
+/**
+ * @brief Narrow phase alone, over explicit pairs of collider store indices
+ *
+ * Replaces the contact buffer with the overlapping pairs among pairA[i],
+ * pairB[i]. Bounds are used as stored; nothing is refreshed, and layers
+ * are not checked.
+ *
+ * @return Number of contacts
+ */
+uint32_t collision_system_test_pairs(const uint32_t* pairA, const uint32_t* pairB, uint32_t pairCount);
+
+/**
+ * @brief Contacts found by the last update, in a contiguous array
+ *
+ * @param count Output: number of contacts (may be NULL)
+ * @return Contact array, or NULL when there are none
+ */
+const CollisionContact* collision_system_get_contacts(uint32_t* count);
+
+/**
+ * @brief Sweep hits from the last update, one per continuous collider that hit something
+ *
+ * @param count Output: number of hits (may be NULL)
+ * @return Hit array, or NULL when there are none
+ *
+ * @note The mover is not moved back; place it at (x, y) minus its offset to
+ *       stop it at the impact
+ */
+const CollisionSweepHit* collision_system_get_sweep_hits(uint32_t* count);
+
+/**
+ * @brief Contacts from the last update whose pair was not touching at the
+ *        previous update of the same scene
+ *
+ * Same contacts as collision_system_get_contacts(), but oriented so that a
+ * is the collider with the lower component id (the normal still points
+ * from a towards b), and ordered by pair.
+ *
+ * @param count Output: number of events (may be NULL)
+ * @return Event array, or NULL when there are none
+ */
+const CollisionContact* collision_system_get_enter_events(uint32_t* count);
+
+// Contacts from the last update whose pair was already touching; oriented
+// and ordered like the enter events
+const CollisionContact* collision_system_get_stay_events(uint32_t* count);
+
+/**
+ * @brief Pairs touching at the scene's previous update but not at the last one
+ *
+ * A pair exits when its colliders separate, or when either one is
+ * disabled, destroyed, filtered out or moved to another scene.
+ *
+ * @param count Output: number of events (may be NULL)
+ * @return Event array, or NULL when there are none
+ *
+ * @note collision_system_test_pairs() does not produce events, and
+ *       collision_system_shutdown() forgets the previous pairs
+ */
+const CollisionExit* collision_system_get_exit_events(uint32_t* count);
+
+/**
+ * @brief Events of a scene's last update, whichever scene was updated since
+ *
+ * @param scene Scene to look up
+ * @param events Output: the scene's events, all empty when it has none
+ * @return false when the scene has no events kept (never updated, or its
+ *         entry was reused past COLLISION_MAX_SCENES)
+ *
+ * @note Arrays stay valid until that scene's next update, or until its
+ *       entry is reused
+ */
+bool collision_system_get_scene_events(const struct Scene* scene, CollisionEvents* events);
+
+void collision_system_get_stats(CollisionStats* stats);
+
+/**
+ * @brief Set the broad-phase cell size in world units (default COLLISION_DEFAULT_CELL_SIZE)
+ *
+ * @note Cells grow automatically for a frame whose colliders are spread too
+ *       far apart for the grid to stay small
+ */
+CollisionResult collision_system_set_cell_size(float cellSize);
+
+// Kernel selection; the best supported kernel is used by default
+CollisionResult collision_system_set_kernel(CollisionKernel kernel);
+CollisionKernel collision_system_get_kernel(void);
+bool collision_kernel_is_supported(CollisionKernel kernel);
+CollisionKernel collision_kernel_best(void);
+
+// Frees the scratch buffers, contacts and events
+void collision_system_shutdown(void);
+
+#endif // COLLISION_SYSTEM_H
@@ -0,0 +1,382 @@
+#include "rigidbody_system.h"
+#include "../components/transform_component.h"
+#include "../core/game_object.h"
+#include "../core/scene.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define RIGIDBODY_HAS_SIMD 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define RIGIDBODY_HAS_SIMD 1
+#else
+    #define RIGIDBODY_HAS_SIMD 0
+#endif
+
+#define RIGIDBODY_LANES 4
+
+// Time a scene's updates have not stepped yet
+typedef struct RigidBodySceneTime {
+    uint32_t sceneId;              // SCENE_INVALID_ID when unused
+    uint32_t lastUse;              // Update stamp, to reuse the stalest entry
+    float carried;
+} RigidBodySceneTime;
+
+static struct {
+    float fixedStep;
+    RigidBodySceneTime sceneTimes[RIGIDBODY_MAX_SCENES];
+    uint32_t updateStamp;
+    RigidBodyStats stats;
+    uint8_t kernel;
+    bool kernelChosen;
+} g_rigidbody = { .fixedStep = RIGIDBODY_DEFAULT_FIXED_STEP };
+
+void rigidbody_system_shutdown(void) {
+    memset(g_rigidbody.sceneTimes, 0, sizeof(g_rigidbody.sceneTimes));
+    g_rigidbody.updateStamp = 0;
+    g_rigidbody.kernelChosen = false;
+    memset(&g_rigidbody.stats, 0, sizeof(RigidBodyStats));
+}
+
+// Kernels
+
+bool rigidbody_kernel_is_supported(RigidBodyKernel kernel) {
+    switch (kernel) {
+        case RIGIDBODY_KERNEL_SCALAR: return true;
+        case RIGIDBODY_KERNEL_SIMD: return RIGIDBODY_HAS_SIMD;
+        default: return false;
+    }
+}
+
+RigidBodyKernel rigidbody_kernel_best(void) {
+    return RIGIDBODY_HAS_SIMD ? RIGIDBODY_KERNEL_SIMD : RIGIDBODY_KERNEL_SCALAR;
+}
+
+RigidBodyResult rigidbody_system_set_kernel(RigidBodyKernel kernel) {
+    if (!rigidbody_kernel_is_supported(kernel)) {
+        return RIGIDBODY_ERROR_UNSUPPORTED;
+    }
+
+    g_rigidbody.kernel = (uint8_t)kernel;
+    g_rigidbody.kernelChosen = true;
+    return RIGIDBODY_OK;
+}
+
+RigidBodyKernel rigidbody_system_get_kernel(void) {
+    return g_rigidbody.kernelChosen ? (RigidBodyKernel)g_rigidbody.kernel : rigidbody_kernel_best();
+}
+
+RigidBodyResult rigidbody_system_set_fixed_step(float step) {
+    if (!(step > 0.0f) || !isfinite(step)) {
+        return RIGIDBODY_ERROR_INVALID_VALUE;
+    }
+
+    g_rigidbody.fixedStep = step;
+    for (uint32_t i = 0; i < RIGIDBODY_MAX_SCENES; i++) {
+        g_rigidbody.sceneTimes[i].carried = 0.0f;
+    }
+    return RIGIDBODY_OK;
+}
+
+float rigidbody_system_get_fixed_step(void) {
+    return g_rigidbody.fixedStep;
+}
+
+void rigidbody_system_get_stats(RigidBodyStats* stats) {
+    if (!stats) return;
+
+    *stats = g_rigidbody.stats;
+}
+
+// Integration. Both kernels do the same float operations in the same
+// order, for bodies begin .. end - 1:
+//   keep = max(1 - damping * dt, 0)
+//   v = v * keep + (a + force * inverseMass) * dt
+//   step = step + v * dt
+// and clear the forces. Bodies whose step this time is non-zero get their
+// moved bit set.
+
+static inline void mark_moved(uint32_t* moved, uint32_t index, uint32_t lanes) {
+    uint32_t shift = index % 32;
+    moved[index / 32] |= lanes << shift;
+    if (shift > 32 - RIGIDBODY_LANES) {
+        moved[index / 32 + 1] |= lanes >> (32 - shift);
+    }
+}
+
+static void integrate_scalar(RigidBodies* store, uint32_t begin, uint32_t end, float dt) {
+    float* restrict vx = store->vx;
+    float* restrict vy = store->vy;
+    float* restrict forceX = store->forceX;
+    float* restrict forceY = store->forceY;
+    float* restrict stepX = store->stepX;
+    float* restrict stepY = store->stepY;
+
+    for (uint32_t i = begin; i < end; i++) {
+        float keep = fmaxf(1.0f - store->damping[i] * dt, 0.0f);
+        float vxi = vx[i] * keep + (store->ax[i] + forceX[i] * store->inverseMass[i]) * dt;
+        float vyi = vy[i] * keep + (store->ay[i] + forceY[i] * store->inverseMass[i]) * dt;
+        vx[i] = vxi;
+        vy[i] = vyi;
+        forceX[i] = 0.0f;
+        forceY[i] = 0.0f;
+        float dx = vxi * dt, dy = vyi * dt;
+        stepX[i] = stepX[i] + dx;
+        stepY[i] = stepY[i] + dy;
+        if (dx != 0.0f || dy != 0.0f) {
+            mark_moved(store->moved, i, 1u);
+        }
+    }
+}
+
+#if RIGIDBODY_HAS_SIMD
+// Whole groups of four; the remainder goes to the scalar kernel
+static void integrate_simd(RigidBodies* store, uint32_t begin, uint32_t end, float dt) {
+    float* vx = store->vx;
+    float* vy = store->vy;
+    float* forceX = store->forceX;
+    float* forceY = store->forceY;
+    float* stepX = store->stepX;
+    float* stepY = store->stepY;
+    uint32_t i = begin;
+
+#if defined(__SSE2__)
+    const __m128 step = _mm_set1_ps(dt);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + RIGIDBODY_LANES <= end; i += RIGIDBODY_LANES) {
+        __m128 keep = _mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(store->damping + i), step)), zero);
+        __m128 inverseMass = _mm_loadu_ps(store->inverseMass + i);
+        __m128 accelX = _mm_add_ps(_mm_loadu_ps(store->ax + i), _mm_mul_ps(_mm_loadu_ps(forceX + i), inverseMass));
+        __m128 accelY = _mm_add_ps(_mm_loadu_ps(store->ay + i), _mm_mul_ps(_mm_loadu_ps(forceY + i), inverseMass));
+        __m128 vxi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vx + i), keep), _mm_mul_ps(accelX, step));
+        __m128 vyi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), keep), _mm_mul_ps(accelY, step));
+        _mm_storeu_ps(vx + i, vxi);
+        _mm_storeu_ps(vy + i, vyi);
+        _mm_storeu_ps(forceX + i, zero);
+        _mm_storeu_ps(forceY + i, zero);
+        __m128 dx = _mm_mul_ps(vxi, step);
+        __m128 dy = _mm_mul_ps(vyi, step);
+        _mm_storeu_ps(stepX + i, _mm_add_ps(_mm_loadu_ps(stepX + i), dx));
+        _mm_storeu_ps(stepY + i, _mm_add_ps(_mm_loadu_ps(stepY + i), dy));
+        int lanes = _mm_movemask_ps(_mm_or_ps(_mm_cmpneq_ps(dx, zero), _mm_cmpneq_ps(dy, zero)));
+        if (lanes) {
+            mark_moved(store->moved, i, (uint32_t)lanes);
+        }
+    }
+#else
+    const float32x4_t step = vdupq_n_f32(dt);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const uint32x4_t laneBits = { 1u, 2u, 4u, 8u };
+    for (; i + RIGIDBODY_LANES <= end; i += RIGIDBODY_LANES) {
+        float32x4_t keep = vmaxq_f32(vsubq_f32(one, vmulq_f32(vld1q_f32(store->damping + i), step)), zero);
+        float32x4_t inverseMass = vld1q_f32(store->inverseMass + i);
+        float32x4_t accelX = vaddq_f32(vld1q_f32(store->ax + i), vmulq_f32(vld1q_f32(forceX + i), inverseMass));
+        float32x4_t accelY = vaddq_f32(vld1q_f32(store->ay + i), vmulq_f32(vld1q_f32(forceY + i), inverseMass));
+        float32x4_t vxi = vaddq_f32(vmulq_f32(vld1q_f32(vx + i), keep), vmulq_f32(accelX, step));
+        float32x4_t vyi = vaddq_f32(vmulq_f32(vld1q_f32(vy + i), keep), vmulq_f32(accelY, step));
+        vst1q_f32(vx + i, vxi);
+        vst1q_f32(vy + i, vyi);
+        vst1q_f32(forceX + i, zero);
+        vst1q_f32(forceY + i, zero);
+        float32x4_t dx = vmulq_f32(vxi, step);
+        float32x4_t dy = vmulq_f32(vyi, step);
+        vst1q_f32(stepX + i, vaddq_f32(vld1q_f32(stepX + i), dx));
+        vst1q_f32(stepY + i, vaddq_f32(vld1q_f32(stepY + i), dy));
+        // Lanes where both steps compare equal to zero stayed put
+        uint32x4_t still = vandq_u32(vceqq_f32(dx, zero), vceqq_f32(dy, zero));
+        uint32x4_t movedLanes = vbicq_u32(laneBits, still);
+        uint32x2_t pairs = vorr_u32(vget_low_u32(movedLanes), vget_high_u32(movedLanes));
+        uint32_t lanes = vget_lane_u32(pairs, 0) | vget_lane_u32(pairs, 1);
+        if (lanes) {
+            mark_moved(store->moved, i, lanes);
+        }
+    }
+#endif
+
+    integrate_scalar(store, i, end, dt);
+}
+#endif
+
+// Next run of consecutive slots belonging to the scene, from *begin on;
+// false when there is none
+static bool next_run(const RigidBodies* store, const struct Scene* scene, uint32_t* begin, uint32_t* end) {
+    uint32_t i = *begin;
+    while (i < store->count && store->scenes[i] != scene) i++;
+    if (i == store->count) return false;
+
+    uint32_t j = i + 1;
+    while (j < store->count && store->scenes[j] == scene) j++;
+    *begin = i;
+    *end = j;
+    return true;
+}
+
+static void integrate(RigidBodies* store, const struct Scene* scene, float dt) {
+    RigidBodyKernel kernel = rigidbody_system_get_kernel();
+    uint32_t begin = 0, end;
+    while (next_run(store, scene, &begin, &end)) {
+#if RIGIDBODY_HAS_SIMD
+        if (kernel == RIGIDBODY_KERNEL_SIMD) {
+            integrate_simd(store, begin, end, dt);
+        } else
+#endif
+        {
+            (void)kernel;
+            integrate_scalar(store, begin, end, dt);
+        }
+        begin = end;
+    }
+}
+
+// Bits of one moved word that fall in slots begin .. end - 1
+static inline uint32_t run_word_mask(uint32_t word, uint32_t begin, uint32_t end) {
+    uint32_t first = word * 32 < begin ? begin - word * 32 : 0;
+    uint32_t last = end - word * 32 < 32 ? end - word * 32 : 32;
+    uint32_t upper = last == 32 ? ~0u : (1u << last) - 1u;
+    return upper & ~((1u << first) - 1u);
+}
+
+// Clears the scene's displacements and moved bits, counting its bodies.
+// Other scenes keep the bits of their own last update.
+static uint32_t begin_update(RigidBodies* store, const struct Scene* scene) {
+    uint32_t bodies = 0;
+    uint32_t begin = 0, end;
+    while (next_run(store, scene, &begin, &end)) {
+        memset(store->stepX + begin, 0, (end - begin) * sizeof(float));
+        memset(store->stepY + begin, 0, (end - begin) * sizeof(float));
+        for (uint32_t w = begin / 32; w <= (end - 1) / 32; w++) {
+            store->moved[w] &= ~run_word_mask(w, begin, end);
+        }
+        bodies += end - begin;
+        begin = end;
+    }
+    return bodies;
+}
+
+// Translates the transforms of the scene's bodies that moved, one pass
+// over their set bits
+static uint32_t write_back(RigidBodies* store, const struct Scene* scene) {
+    uint32_t moved = 0;
+    uint32_t begin = 0, end;
+    while (next_run(store, scene, &begin, &end)) {
+        for (uint32_t w = begin / 32; w <= (end - 1) / 32; w++) {
+            uint32_t bits = store->moved[w] & run_word_mask(w, begin, end);
+            while (bits) {
+                uint32_t i = w * 32 + (uint32_t)__builtin_ctz(bits);
+                bits &= bits - 1;
+
+                GameObject* gameObject = store->owners[i]->base.gameObject;
+                if (gameObject && gameObject->transform) {
+                    transform_component_translate(gameObject->transform, store->stepX[i], store->stepY[i]);
+                    moved++;
+                }
+            }
+        }
+        begin = end;
+    }
+    return moved;
+}
+
+// The scene's carried time; a scene not seen yet takes the least recently
+// updated entry and starts from nothing
+static float* scene_carried(const struct Scene* scene) {
+    RigidBodySceneTime* stalest = &g_rigidbody.sceneTimes[0];
+    uint32_t stamp = ++g_rigidbody.updateStamp;
+    for (uint32_t i = 0; i < RIGIDBODY_MAX_SCENES; i++) {
+        RigidBodySceneTime* entry = &g_rigidbody.sceneTimes[i];
+        if (entry->sceneId == scene->id) {
+            entry->lastUse = stamp;
+            return &entry->carried;
+        }
+        if (entry->lastUse < stalest->lastUse) {
+            stalest = entry;
+        }
+    }
+    stalest->sceneId = scene->id;
+    stalest->lastUse = stamp;
+    stalest->carried = 0.0f;
+    return &stalest->carried;
+}
+
+uint32_t rigidbody_system_update(struct Scene* scene, float deltaTime) {
+    memset(&g_rigidbody.stats, 0, sizeof(RigidBodyStats));
+    RigidBodies* store = rigidbody_bodies_get();
+    if (!store->owners) {
+        return 0;
+    }
+    if (!scene) {
+        memset(store->moved, 0, (store->count / 32 + 1) * sizeof(uint32_t));
+        return 0;
+    }
+
+    uint32_t steps = 0;
+    float* carried = scene_carried(scene);
+    if (deltaTime > 0.0f) {
+        *carried += deltaTime;
+        while (*carried >= g_rigidbody.fixedStep && steps < RIGIDBODY_MAX_STEPS) {
+            *carried -= g_rigidbody.fixedStep;
+            steps++;
+        }
+        // Too far behind: drop whole steps rather than fall further behind
+        if (*carried >= g_rigidbody.fixedStep) {
+            *carried = fmodf(*carried, g_rigidbody.fixedStep);
+        }
+    }
+
+    g_rigidbody.stats.bodies = begin_update(store, scene);
+    for (uint32_t s = 0; s < steps; s++) {
+        integrate(store, scene, g_rigidbody.fixedStep);
+    }
+    g_rigidbody.stats.steps = steps;
+    g_rigidbody.stats.moved = write_back(store, scene);
+    return steps;
+}
+
+uint32_t rigidbody_system_step(struct Scene* scene, float dt) {
+    memset(&g_rigidbody.stats, 0, sizeof(RigidBodyStats));
+    RigidBodies* store = rigidbody_bodies_get();
+    if (!scene || !store->owners || !(dt > 0.0f)) {
+        return 0;
+    }
+
+    g_rigidbody.stats.bodies = begin_update(store, scene);
+    integrate(store, scene, dt);
+    g_rigidbody.stats.steps = 1;
+    g_rigidbody.stats.moved = write_back(store, scene);
+    return g_rigidbody.stats.moved;
+}
+
+bool rigidbody_system_has_moved(const RigidBodyComponent* body) {
+    const RigidBodies* store = rigidbody_bodies_get();
+    if (!body || body->slot >= store->count || store->owners[body->slot] != body) {
+        return false;
+    }
+    return (store->moved[body->slot / 32] >> (body->slot % 32)) & 1u;
+}
+
+uint32_t rigidbody_system_sync_grid(SpatialGrid* grid) {
+    const RigidBodies* store = rigidbody_bodies_get();
+    if (!grid || !store->owners) {
+        return 0;
+    }
+
+    uint32_t updated = 0;
+    uint32_t words = (store->count + 31) / 32;
+    for (uint32_t w = 0; w < words; w++) {
+        uint32_t bits = store->moved[w];
+        while (bits) {
+            uint32_t i = w * 32 + (uint32_t)__builtin_ctz(bits);
+            bits &= bits - 1;
+
+            GameObject* gameObject = store->owners[i]->base.gameObject;
+            if (gameObject && spatial_grid_update_object(grid, gameObject)) {
+                updated++;
+            }
+        }
+    }
+    return updated;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file rigidbody_system.h
+ * @brief Fixed-step integration of every rigid body in a scene
+ *
+ * Each update advances a scene's bodies in whole fixed steps, carrying the
+ * remaining time to that scene's next update. A step integrates the body store
+ * (see rigidbody_component.h) four bodies at a time (SSE2 or NEON when
+ * available) with semi-implicit Euler: velocity is damped and gains the
+ * acceleration plus force times inverse mass, then the displacement grows
+ * by the new velocity. Forces are cleared after each step.
+ *
+ * Positions are written back once per update, in one pass over the bodies
+ * that moved: their transforms are translated by the displacement and
+ * marked dirty (matrix and render). The same moved bits stay in the store
+ * until the scene's next update, so later systems can touch only what
+ * moved, such as rigidbody_system_sync_grid() for a spatial grid. Bodies
+ * at rest cost the integration and nothing else.
+ *
+ * Usage Example:
+ * @code
+ * RigidBodyComponent* body = rigidbody_component_create(ball);
+ * game_object_add_component(ball, (Component*)body);
+ * rigidbody_component_set_acceleration(body, 0.0f, 400.0f);   // Gravity
+ * rigidbody_component_apply_impulse(body, 120.0f, -200.0f);
+ *
+ * scene_manager_update(manager, deltaTime);  // One rigidbody_system_step() per fixed step
+ * rigidbody_system_sync_grid(grid);          // Moved bodies only
+ * @endcode
+ *
+ * @note The scene's rigid body system (update_systems.c) runs in the fixed
+ *       pass only: scene_fixed_update() calls rigidbody_system_step() with
+ *       the scene manager's fixed step, ahead of the transform system.
+ *       rigidbody_system_update() is for scenes driven without a manager.
+ */
+
+#ifndef RIGIDBODY_SYSTEM_H
+#define RIGIDBODY_SYSTEM_H
+
+#include "../components/rigidbody_component.h"
+#include "spatial_grid.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define RIGIDBODY_DEFAULT_FIXED_STEP (1.0f / 60.0f)   // Seconds
+#define RIGIDBODY_MAX_STEPS 4                         // Per update; time past this is dropped
+#define RIGIDBODY_MAX_SCENES 16                       // Scenes with carried time; the stalest is reset
+
+// Integration kernels (identical results)
+typedef enum {
+    RIGIDBODY_KERNEL_SCALAR = 0,
+    RIGIDBODY_KERNEL_SIMD,                 // 4 bodies per step
+    RIGIDBODY_KERNEL_COUNT
+} RigidBodyKernel;
+
+// Counts from the last update
+typedef struct RigidBodyStats {
+    uint32_t bodies;               // Enabled bodies in the scene
+    uint32_t steps;                // Fixed steps run
+    uint32_t moved;                // Bodies whose transform was moved
+} RigidBodyStats;
+
+/**
+ * @brief Advance a scene's bodies by deltaTime in fixed steps
+ *
+ * @param scene Scene whose enabled bodies move
+ * @param deltaTime Seconds since the last update, added to the carried time
+ * @return Number of fixed steps run (0 when less than a step has built up)
+ */
+uint32_t rigidbody_system_update(struct Scene* scene, float deltaTime);
+
+/**
+ * @brief Advance a scene's bodies by exactly one step of dt, ignoring the fixed step
+ *
+ * Writes positions back and sets the moved bits like an update.
+ *
+ * @return Number of bodies moved
+ */
+uint32_t rigidbody_system_step(struct Scene* scene, float dt);
+
+// Whether the body moved in its scene's last update (also rigidbody_bodies_get()->moved)
+bool rigidbody_system_has_moved(const RigidBodyComponent* body);
+
+/**
+ * @brief Move the bodies that moved in their scene's last update to their new grid cells
+ *
+ * Calls spatial_grid_update_object() for each of them, so moved bodies not
+ * yet in the grid are added. Bodies at rest are not visited.
+ *
+ * @return Number of objects the grid updated
+ */
+uint32_t rigidbody_system_sync_grid(SpatialGrid* grid);
+
+// Fixed step of rigidbody_system_update() in seconds (default
+// RIGIDBODY_DEFAULT_FIXED_STEP); drops every scene's carried time
+RigidBodyResult rigidbody_system_set_fixed_step(float step);
+float rigidbody_system_get_fixed_step(void);
+
+void rigidbody_system_get_stats(RigidBodyStats* stats);
+
+// Kernel selection; the best supported kernel is used by default
+RigidBodyResult rigidbody_system_set_kernel(RigidBodyKernel kernel);
+RigidBodyKernel rigidbody_system_get_kernel(void);
+bool rigidbody_kernel_is_supported(RigidBodyKernel kernel);
+RigidBodyKernel rigidbody_kernel_best(void);
+
+// Resets the carried times, stats and kernel choice
+void rigidbody_system_shutdown(void);
+
+#endif // RIGIDBODY_SYSTEM_H
@@ -1,10 +1,17 @@
 #include "spatial_grid.h"
 #include "../components/transform_component.h"
+#include "../core/memory_budget.h"
+#include "../profiling/profiler.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <assert.h>
 
+// Cell array and lookup table, charged to the spatial budget
+static uint32_t grid_table_bytes(uint32_t totalCells, uint32_t maxObjects) {
+    return totalCells * (uint32_t)sizeof(GridCell) + maxObjects * (uint32_t)sizeof(GridObjectEntry*);
+}
+
 // Grid management
 SpatialGrid* spatial_grid_create(uint32_t cellSize, uint32_t gridWidth, uint32_t gridHeight,
                                float worldOffsetX, float worldOffsetY, uint32_t maxObjects) {
@@ -12,8 +19,14 @@ SpatialGrid* spatial_grid_create(uint32_t cellSize, uint32_t gridWidth, uint32_t
         return NULL;
     }
     
+    uint32_t tableBytes = grid_table_bytes(gridWidth * gridHeight, maxObjects);
+    if (memory_budget_reserve(MEMORY_SUBSYSTEM_SPATIAL, tableBytes) != MEMORY_BUDGET_OK) {
+        return NULL;
+    }
+    
     SpatialGrid* grid = malloc(sizeof(SpatialGrid));
     if (!grid) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, tableBytes);
         return NULL;
     }
     
@@ -36,6 +49,7 @@ SpatialGrid* spatial_grid_create(uint32_t cellSize, uint32_t gridWidth, uint32_t
     uint32_t totalCells = gridWidth * gridHeight;
     grid->cells = calloc(totalCells, sizeof(GridCell));
     if (!grid->cells) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, tableBytes);
         free(grid);
         return NULL;
     }
@@ -46,11 +60,12 @@ SpatialGrid* spatial_grid_create(uint32_t cellSize, uint32_t gridWidth, uint32_t
     }
     
     // Initialize object entry pool
-    PoolResult poolResult = object_pool_init(&grid->entryPool, 
-                                           sizeof(GridObjectEntry),
-                                           maxObjects,
-                                           "SpatialGridEntries");
+    PoolResult poolResult = object_pool_init_for_subsystem(&grid->entryPool, MEMORY_SUBSYSTEM_SPATIAL,
+                                                           sizeof(GridObjectEntry),
+                                                           maxObjects,
+                                                           "SpatialGridEntries");
     if (poolResult != POOL_OK) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, tableBytes);
         free(grid->cells);
         free(grid);
         return NULL;
@@ -59,6 +74,7 @@ SpatialGrid* spatial_grid_create(uint32_t cellSize, uint32_t gridWidth, uint32_t
     // Allocate object lookup table
     grid->objectLookup = calloc(maxObjects, sizeof(GridObjectEntry*));
     if (!grid->objectLookup) {
+        memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, tableBytes);
         object_pool_destroy(&grid->entryPool);
         free(grid->cells);
         free(grid);
@@ -86,11 +102,12 @@ void spatial_grid_destroy(SpatialGrid* grid) {
     object_pool_destroy(&grid->entryPool);
     free(grid->objectLookup);
     free(grid->cells);
+    memory_budget_release(MEMORY_SUBSYSTEM_SPATIAL, grid_table_bytes(totalCells, grid->maxObjects));
     free(grid);
 }
 
 // Object management
-bool spatial_grid_add_object(SpatialGrid* grid, GameObject* gameObject) {
+static bool grid_insert_object(SpatialGrid* grid, GameObject* gameObject) {
     if (!grid || !gameObject || !gameObject->transform) {
         return false;
     }
@@ -150,7 +167,14 @@ bool spatial_grid_add_object(SpatialGrid* grid, GameObject* gameObject) {
     return true;
 }
 
-bool spatial_grid_remove_object(SpatialGrid* grid, GameObject* gameObject) {
+bool spatial_grid_add_object(SpatialGrid* grid, GameObject* gameObject) {
+    PROFILER_ZONE_BEGIN("spatial_grid_add_object");
+    bool added = grid_insert_object(grid, gameObject);
+    PROFILER_ZONE_END();
+    return added;
+}
+
+static bool grid_erase_object(SpatialGrid* grid, GameObject* gameObject) {
     if (!grid || !gameObject) {
         return false;
     }
@@ -201,7 +225,14 @@ bool spatial_grid_remove_object(SpatialGrid* grid, GameObject* gameObject) {
     return true;
 }
 
-bool spatial_grid_update_object(SpatialGrid* grid, GameObject* gameObject) {
+bool spatial_grid_remove_object(SpatialGrid* grid, GameObject* gameObject) {
+    PROFILER_ZONE_BEGIN("spatial_grid_remove_object");
+    bool removed = grid_erase_object(grid, gameObject);
+    PROFILER_ZONE_END();
+    return removed;
+}
+
+static bool grid_move_object(SpatialGrid* grid, GameObject* gameObject) {
     if (!grid || !gameObject || !gameObject->transform) {
         return false;
     }
@@ -219,7 +250,7 @@ bool spatial_grid_update_object(SpatialGrid* grid, GameObject* gameObject) {
     GridObjectEntry* entry = grid->objectLookup[objectId];
     if (!entry) {
         // Object not in grid, try to add it
-        return spatial_grid_add_object(grid, gameObject);
+        return grid_insert_object(grid, gameObject);
     }
     
     // Get new position
@@ -230,7 +261,7 @@ bool spatial_grid_update_object(SpatialGrid* grid, GameObject* gameObject) {
     uint32_t newCellX, newCellY;
     if (!spatial_grid_world_to_cell(grid, x, y, &newCellX, &newCellY)) {
         // Object moved outside grid, remove it
-        return spatial_grid_remove_object(grid, gameObject);
+        return grid_erase_object(grid, gameObject);
     }
     
     // Check if object moved to a different cell
@@ -239,8 +270,15 @@ bool spatial_grid_update_object(SpatialGrid* grid, GameObject* gameObject) {
     }
     
     // Remove from old cell and add to new cell
-    spatial_grid_remove_object(grid, gameObject);
-    return spatial_grid_add_object(grid, gameObject);
+    grid_erase_object(grid, gameObject);
+    return grid_insert_object(grid, gameObject);
+}
+
+bool spatial_grid_update_object(SpatialGrid* grid, GameObject* gameObject) {
+    PROFILER_ZONE_BEGIN("spatial_grid_update_object");
+    bool updated = grid_move_object(grid, gameObject);
+    PROFILER_ZONE_END();
+    return updated;
 }
 
 void spatial_grid_mark_static(SpatialGrid* grid, GameObject* gameObject, bool isStatic) {
@@ -294,6 +332,8 @@ uint32_t spatial_grid_query_circle(SpatialGrid* grid, float centerX, float cente
     query->queryY = centerY;
     query->queryRadius = radius;
     
+    PROFILER_COUNTED_ZONE_BEGIN("spatial_grid_query_circle");
+    
     // Calculate affected cells
     uint32_t minCellX, minCellY, maxCellX, maxCellY;
     float minX = centerX - radius;
@@ -303,6 +343,7 @@ uint32_t spatial_grid_query_circle(SpatialGrid* grid, float centerX, float cente
     
     if (!spatial_grid_world_to_cell(grid, minX, minY, &minCellX, &minCellY) ||
         !spatial_grid_world_to_cell(grid, maxX, maxY, &maxCellX, &maxCellY)) {
+        PROFILER_ZONE_END();
         return 0; // Query outside grid bounds
     }
     
@@ -351,18 +392,79 @@ uint32_t spatial_grid_query_circle(SpatialGrid* grid, float centerX, float cente
     }
     
     grid->queriesPerFrame++;
+    PROFILER_ZONE_END();
     return query->resultCount;
 }
 
 uint32_t spatial_grid_query_rectangle(SpatialGrid* grid, float x, float y, 
                                      float width, float height, SpatialQuery* query) {
-    (void)grid;
-    (void)x;
-    (void)y;
-    (void)width;
-    (void)height;
-    (void)query;
-    return 0;
+    if (!grid || !query || width <= 0 || height <= 0) {
+        return 0;
+    }
+    
+    query->resultCount = 0;
+    query->queryX = x;
+    query->queryY = y;
+    query->queryWidth = width;
+    query->queryHeight = height;
+    
+    // Clamp to the grid; unlike circle queries a partially covered rectangle
+    // (e.g. a camera at the world edge) still searches the overlapping cells
+    float minX = x - grid->offsetX;
+    float minY = y - grid->offsetY;
+    float maxX = minX + width;
+    float maxY = minY + height;
+    if (maxX < 0 || maxY < 0 || minX >= grid->worldWidth || minY >= grid->worldHeight) {
+        return 0;
+    }
+    
+    PROFILER_COUNTED_ZONE_BEGIN("spatial_grid_query_rectangle");
+    
+    uint32_t minCellX = minX > 0 ? (uint32_t)(minX / grid->cellSize) : 0;
+    uint32_t minCellY = minY > 0 ? (uint32_t)(minY / grid->cellSize) : 0;
+    uint32_t maxCellX = maxX < grid->worldWidth ? (uint32_t)(maxX / grid->cellSize) : grid->gridWidth - 1;
+    uint32_t maxCellY = maxY < grid->worldHeight ? (uint32_t)(maxY / grid->cellSize) : grid->gridHeight - 1;
+    
+    float right = x + width;
+    float bottom = y + height;
+    
+    // Iterate through affected cells
+    for (uint32_t cellY = minCellY; cellY <= maxCellY; cellY++) {
+        for (uint32_t cellX = minCellX; cellX <= maxCellX; cellX++) {
+            GridCell* cell = spatial_grid_get_cell(grid, cellX, cellY);
+            if (!cell || cell->objectCount == 0) continue;
+            
+            // Only edge cells can hold objects outside the rectangle
+            bool interior = cellX > minCellX && cellX < maxCellX && cellY > minCellY && cellY < maxCellY;
+            
+            GridObjectEntry* entry = cell->objects;
+            while (entry && query->resultCount < query->maxResults) {
+                GameObject* obj = entry->gameObject;
+                
+                if (!game_object_is_active(obj) || (!query->includeStatic && entry->staticObject)) {
+                    entry = entry->next;
+                    continue;
+                }
+                
+                bool inside = interior;
+                if (!inside) {
+                    float objX, objY;
+                    transform_component_get_position(obj->transform, &objX, &objY);
+                    inside = objX >= x && objX <= right && objY >= y && objY <= bottom;
+                }
+                if (inside) {
+                    query->results[query->resultCount] = obj;
+                    query->resultCount++;
+                }
+                
+                entry = entry->next;
+            }
+        }
+    }
+    
+    grid->queriesPerFrame++;
+    PROFILER_ZONE_END();
+    return query->resultCount;
 }
 
 uint32_t spatial_grid_query_line(SpatialGrid* grid, float x1, float y1, 
@@ -116,7 +116,7 @@ typedef struct SpatialGrid {
     
     // Configuration
     bool enableStaticOptimization;
-    bool enableFrustumCulling;
+    bool enableFrustumCulling;     // Culled render passes query the grid instead of scanning all sprites
     uint32_t maxObjectsPerCell;
     
 } SpatialGrid;
@@ -310,9 +310,12 @@ uint32_t spatial_grid_query_circle(SpatialGrid* grid, float centerX, float cente
  * 
  * @return Number of objects found (0 to query->maxResults)
  * 
- * @note Performance: O(k) where k is objects in affected grid cells
+ * @note Performance: O(k) where k is objects in affected grid cells; objects in
+ *       cells fully inside the rectangle are accepted without a position check
+ * @note Tests object positions only; expand the rectangle by the largest object
+ *       extent to find everything whose bounds overlap it (see sprite_system_render_culled)
+ * @note Rectangles partially outside the grid search the overlapping cells
  * @note Ideal for AABB collision detection, camera frustum culling
- * @note Currently returns stub implementation (0 results) - TODO: implement
  */
 uint32_t spatial_grid_query_rectangle(SpatialGrid* grid, float x, float y, 
                                      float width, float height, SpatialQuery* query);
@@ -1,5 +1,6 @@
 #include "../../src/core/component_registry.h"
 #include "../../src/components/transform_component.h"
+#include "../../src/core/memory_budget.h"
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
@@ -75,6 +76,10 @@ void test_component_type_registration(void) {
     assert(strcmp(info->typeName, "Transform") == 0);
     assert(info->registered == true);
     
+    // Pool name outlives registration and the pool is grouped for telemetry
+    assert(strcmp(info->pool.debugName, "ComponentPool_Transform") == 0);
+    assert(info->pool.subsystem == MEMORY_SUBSYSTEM_COMPONENTS);
+    
     // Test duplicate registration
     result = component_registry_register_type(
         COMPONENT_TYPE_TRANSFORM,
@@ -292,6 +297,25 @@ void test_multiple_type_registration(void) {
     printf("✓ Multiple type registration test passed\n");
 }
 
+void test_component_registration_budget(void) {
+    component_registry_init();
+    memory_budget_reset();
+    
+    // Room for the transform pool only
+    const MemoryBudget* budget = memory_budget_get(MEMORY_SUBSYSTEM_COMPONENTS);
+    memory_budget_set_limits(MEMORY_SUBSYSTEM_COMPONENTS, 0, budget->reservedBytes + 100 * 64);
+    
+    assert(component_registry_register_type(COMPONENT_TYPE_TRANSFORM, 64, 100, &mockVTable, "Transform") == COMPONENT_OK);
+    assert(component_registry_register_type(COMPONENT_TYPE_SPRITE, 64, 1, &mockVTable, "Sprite") ==
+           COMPONENT_ERROR_BUDGET_EXCEEDED);
+    assert(!component_registry_is_type_registered(COMPONENT_TYPE_SPRITE));
+    assert(memory_budget_get_headroom(MEMORY_SUBSYSTEM_COMPONENTS) == 0);
+    
+    memory_budget_reset();
+    component_registry_shutdown();
+    printf("✓ Component registration budget test passed\n");
+}
+
 // Test runner function
 int run_component_registry_tests(void) {
     printf("=== Component Registry Tests ===\n");
@@ -306,6 +330,7 @@ int run_component_registry_tests(void) {
     test_component_registry_queries();
     test_component_registry_stats();
     test_multiple_type_registration();
+    test_component_registration_budget();
     
     printf("Component registry tests completed with %d failures\n", failures);
     return failures;
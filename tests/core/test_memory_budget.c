@@ -0,0 +1,200 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../src/core/memory_budget.h"
+#include "../../src/core/memory_pool.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct EvictionContext {
+    ObjectPool* pool;
+    void* victims[8];
+    uint32_t victimCount;
+    uint32_t calls;
+    uint32_t lastUsedBytes;
+} EvictionContext;
+
+// Degradation callback: frees every object it was told it may evict
+static void evict_on_soft_limit(MemorySubsystem subsystem, uint32_t usedBytes,
+                                uint32_t softLimitBytes, void* userData) {
+    EvictionContext* context = (EvictionContext*)userData;
+    assert(subsystem == MEMORY_SUBSYSTEM_ARENA);
+    assert(usedBytes > softLimitBytes);
+    context->calls++;
+    context->lastUsedBytes = usedBytes;
+    for (uint32_t i = 0; i < context->victimCount; i++) {
+        object_pool_free(context->pool, context->victims[i]);
+    }
+    context->victimCount = 0;
+}
+
+void test_budget_pool_accounting(void) {
+    memory_budget_reset();
+    const MemoryBudget* budget = memory_budget_get(MEMORY_SUBSYSTEM_ARENA);
+    uint32_t baseReserved = budget->reservedBytes;
+    uint32_t baseUsed = budget->usedBytes;
+
+    ObjectPool pool;
+    assert(object_pool_init_for_subsystem(&pool, MEMORY_SUBSYSTEM_ARENA, 32, 10, "BudgetPool") == POOL_OK);
+    assert(pool.subsystem == MEMORY_SUBSYSTEM_ARENA);
+    assert(budget->reservedBytes == baseReserved + 320);   // Whole capacity reserved up front
+    assert(budget->usedBytes == baseUsed);
+
+    void* a = object_pool_alloc(&pool);
+    void* b = object_pool_alloc(&pool);
+    assert(budget->usedBytes == baseUsed + 64);
+    object_pool_free(&pool, a);
+    object_pool_free(&pool, a);                            // Double free is not refunded twice
+    assert(budget->usedBytes == baseUsed + 32);
+
+    // Re-tagging moves both charges
+    object_pool_set_subsystem(&pool, MEMORY_SUBSYSTEM_GENERAL);
+    assert(budget->reservedBytes == baseReserved && budget->usedBytes == baseUsed);
+    object_pool_set_subsystem(&pool, MEMORY_SUBSYSTEM_ARENA);
+    assert(budget->reservedBytes == baseReserved + 320 && budget->usedBytes == baseUsed + 32);
+
+    // Destroying with live objects releases everything
+    (void)b;
+    object_pool_destroy(&pool);
+    assert(budget->reservedBytes == baseReserved && budget->usedBytes == baseUsed);
+    assert(budget->peakReservedBytes >= baseReserved + 320);
+
+    printf("✓ Budget pool accounting test passed\n");
+}
+
+void test_budget_hard_limit(void) {
+    memory_budget_reset();
+    const MemoryBudget* budget = memory_budget_get(MEMORY_SUBSYSTEM_ARENA);
+    uint32_t base = budget->reservedBytes;
+
+    assert(memory_budget_set_limits(MEMORY_SUBSYSTEM_ARENA, 2048, 1024) == MEMORY_BUDGET_ERROR_INVALID_LIMITS);
+    assert(memory_budget_set_limits(MEMORY_SUBSYSTEM_COUNT, 0, 0) == MEMORY_BUDGET_ERROR_INVALID_SUBSYSTEM);
+    assert(memory_budget_set_limits(MEMORY_SUBSYSTEM_ARENA, 0, base + 1024) == MEMORY_BUDGET_OK);
+    assert(memory_budget_get_headroom(MEMORY_SUBSYSTEM_ARENA) == 1024);
+
+    ObjectPool fits, refused;
+    memset(&refused, 0, sizeof(refused));
+    assert(object_pool_init_for_subsystem(&fits, MEMORY_SUBSYSTEM_ARENA, 64, 12, "Fits") == POOL_OK);
+    assert(memory_budget_get_headroom(MEMORY_SUBSYSTEM_ARENA) == 1024 - 768);
+
+    // Refused before any allocation; the pool stays untouched and unregistered
+    assert(object_pool_init_for_subsystem(&refused, MEMORY_SUBSYSTEM_ARENA, 64, 8, "Refused") ==
+           POOL_ERROR_BUDGET_EXCEEDED);
+    assert(refused.memory == NULL);
+    assert(budget->hardLimitFailures == 1);
+    assert(budget->reservedBytes == base + 768);
+
+    // Explicit reservations obey the same limit
+    assert(memory_budget_reserve(MEMORY_SUBSYSTEM_ARENA, 256) == MEMORY_BUDGET_OK);
+    assert(memory_budget_reserve(MEMORY_SUBSYSTEM_ARENA, 1) == MEMORY_BUDGET_ERROR_HARD_LIMIT);
+    assert(memory_budget_get_headroom(MEMORY_SUBSYSTEM_ARENA) == 0);
+    memory_budget_release(MEMORY_SUBSYSTEM_ARENA, 256);
+
+    // Other subsystems are unaffected
+    ObjectPool general;
+    assert(object_pool_init(&general, 64, 64, "General") == POOL_OK);
+    assert(memory_budget_get_headroom(MEMORY_SUBSYSTEM_GENERAL) == UINT32_MAX);
+
+    object_pool_destroy(&general);
+    object_pool_destroy(&fits);
+    object_pool_destroy(&refused);                         // Safe on a refused pool
+    assert(budget->reservedBytes == base);
+    memory_budget_reset();
+    assert(budget->hardLimitBytes == 0 && budget->hardLimitFailures == 0);
+
+    printf("✓ Budget hard limit test passed\n");
+}
+
+void test_budget_soft_limit_callback(void) {
+    memory_budget_reset();
+    const MemoryBudget* budget = memory_budget_get(MEMORY_SUBSYSTEM_ARENA);
+    uint32_t base = budget->usedBytes;
+
+    ObjectPool pool;
+    object_pool_init_for_subsystem(&pool, MEMORY_SUBSYSTEM_ARENA, 16, 16, "SoftPool");
+
+    EvictionContext context = {0};
+    context.pool = &pool;
+    memory_budget_set_limits(MEMORY_SUBSYSTEM_ARENA, base + 4 * 16, 0);
+    memory_budget_set_soft_limit_callback(MEMORY_SUBSYSTEM_ARENA, evict_on_soft_limit, &context);
+
+    // Up to the soft limit: no callback
+    for (int i = 0; i < 4; i++) {
+        context.victims[context.victimCount++] = object_pool_alloc(&pool);
+    }
+    assert(context.calls == 0 && !budget->overSoftLimit);
+
+    // Crossing it degrades once; the callback evicted the four victims
+    void* fifth = object_pool_alloc(&pool);
+    assert(fifth != NULL);
+    assert(context.calls == 1 && context.lastUsedBytes == base + 5 * 16);
+    assert(budget->usedBytes == base + 16 && !budget->overSoftLimit);
+    assert(budget->softLimitCrossings == 1);
+
+    // Staying above the limit does not call again until usage drops below it
+    memory_budget_set_soft_limit_callback(MEMORY_SUBSYSTEM_ARENA, NULL, NULL);
+    void* extra[5];
+    for (int i = 0; i < 5; i++) {
+        extra[i] = object_pool_alloc(&pool);
+    }
+    assert(budget->overSoftLimit && budget->softLimitCrossings == 2);
+    object_pool_alloc(&pool);
+    assert(budget->softLimitCrossings == 2);
+    for (int i = 0; i < 5; i++) {
+        object_pool_free(&pool, extra[i]);
+    }
+    assert(!budget->overSoftLimit);
+
+    object_pool_destroy(&pool);
+    memory_budget_reset();
+    printf("✓ Budget soft limit callback test passed\n");
+}
+
+void test_budget_report(void) {
+    memory_budget_reset();
+    memory_budget_set_limits(MEMORY_SUBSYSTEM_ARENA, 0, 1u << 20);
+
+    ObjectPool pool;
+    object_pool_init_for_subsystem(&pool, MEMORY_SUBSYSTEM_ARENA, 1024, 64, "ReportPool");
+    for (int i = 0; i < 16; i++) {
+        object_pool_alloc(&pool);
+    }
+
+    MemoryBudgetReport report;
+    memory_budget_get_report(&report);
+    const MemoryBudget* arena = &report.subsystems[MEMORY_SUBSYSTEM_ARENA];
+    assert(arena->usedBytes >= 16 * 1024 && arena->reservedBytes >= 64 * 1024);
+    assert(arena->hardLimitBytes == 1u << 20);
+    assert(report.totalReservedBytes >= arena->reservedBytes);
+    assert(report.subsystemsOverSoftLimit == 0);
+
+    char buffer[2048];
+    memset(buffer, 0, sizeof(buffer));
+    FILE* out = fmemopen(buffer, sizeof(buffer), "w");
+    memory_budget_print_report(&report, out);
+    fclose(out);
+    assert(strstr(buffer, "=== Memory Budget Report (KB) ===") != NULL);
+    assert(strstr(buffer, "Arena") && strstr(buffer, "1024.0"));
+
+    object_pool_destroy(&pool);
+    memory_budget_reset();
+    printf("✓ Budget report test passed\n");
+}
+
+int run_memory_budget_tests(void) {
+    printf("Running memory budget tests...\n");
+
+    test_budget_pool_accounting();
+    test_budget_hard_limit();
+    test_budget_soft_limit_callback();
+    test_budget_report();
+
+    printf("All memory budget tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_memory_budget_tests();
+}
+#endif
@@ -214,16 +214,120 @@ void test_error_conditions_debug(void) {
     // Test unregistering NULL pool
     memory_debug_unregister_pool(NULL);
     
-    // Test unregistering unknown pool
+    // Unregistering twice is harmless (destroy unregisters again)
     ObjectPool pool;
     object_pool_init(&pool, sizeof(DebugTestObject), 5, "UnknownPool");
-    memory_debug_unregister_pool(&pool); // Should print warning
+    memory_debug_unregister_pool(&pool);
+    memory_debug_unregister_pool(&pool);
+    assert(memory_debug_get_pool_count() == 0);
     
     object_pool_destroy(&pool);
     memory_debug_shutdown();
     printf("✓ Debug error conditions test passed\n");
 }
 
+void test_automatic_registration(void) {
+    memory_debug_init();
+    
+    // Pools register themselves on init and leave on destroy, with no cap
+    enum { POOL_COUNT = 100 };
+    static ObjectPool pools[POOL_COUNT];
+    for (int i = 0; i < POOL_COUNT; i++) {
+        assert(object_pool_init(&pools[i], 16, 4, "AutoPool") == POOL_OK);
+    }
+    assert(memory_debug_get_pool_count() == POOL_COUNT);
+    assert(memory_debug_get_stats().totalPools == POOL_COUNT);
+    
+    // Manual registration of an already registered pool is a no-op
+    memory_debug_register_pool(&pools[0]);
+    assert(memory_debug_get_pool_count() == POOL_COUNT);
+    
+    // Unlink from the middle, head and tail
+    object_pool_destroy(&pools[50]);
+    object_pool_destroy(&pools[POOL_COUNT - 1]);
+    object_pool_destroy(&pools[0]);
+    assert(memory_debug_get_pool_count() == POOL_COUNT - 3);
+    
+    PoolTelemetry telemetry[POOL_COUNT];
+    assert(memory_debug_get_pool_telemetry(telemetry, POOL_COUNT) == POOL_COUNT - 3);
+    for (int i = 0; i < POOL_COUNT - 3; i++) {
+        assert(telemetry[i].pool != &pools[0] && telemetry[i].pool != &pools[50]);
+    }
+    
+    for (int i = 1; i < POOL_COUNT - 1; i++) {
+        object_pool_destroy(&pools[i]);
+    }
+    assert(memory_debug_get_pool_count() == 0);
+    
+    memory_debug_shutdown();
+    printf("✓ Automatic registration test passed\n");
+}
+
+void test_memory_telemetry(void) {
+    memory_debug_init();
+    
+    ObjectPool scenePool, spatialPool;
+    object_pool_init(&scenePool, 64, 10, "TelemetryScene");
+    object_pool_init(&spatialPool, 32, 20, "TelemetrySpatial");
+    object_pool_set_subsystem(&scenePool, MEMORY_SUBSYSTEM_SCENE);
+    object_pool_set_subsystem(&spatialPool, MEMORY_SUBSYSTEM_SPATIAL);
+    object_pool_set_subsystem(&spatialPool, MEMORY_SUBSYSTEM_COUNT); // Ignored
+    assert(spatialPool.subsystem == MEMORY_SUBSYSTEM_SPATIAL);
+    
+    MemoryTelemetry telemetry;
+    memory_debug_poll(&telemetry);
+    assert(telemetry.intervalSeconds == 0.0f);
+    
+    void* objects[8];
+    for (int i = 0; i < 8; i++) {
+        objects[i] = object_pool_alloc(&spatialPool);
+    }
+    void* sceneObject = object_pool_alloc(&scenePool);
+    for (int i = 0; i < 6; i++) {
+        object_pool_free(&spatialPool, objects[i]);
+    }
+    
+    memory_debug_poll(&telemetry);
+    assert(telemetry.intervalSeconds > 0.0f);
+    assert(telemetry.totals.totalPools == 2);
+    assert(telemetry.totals.totalAllocatedObjects == 3);
+    
+    const SubsystemTelemetry* spatial = &telemetry.subsystems[MEMORY_SUBSYSTEM_SPATIAL];
+    assert(spatial->poolCount == 1);
+    assert(spatial->capacityBytes == 20 * 32);
+    assert(spatial->usedBytes == 2 * 32);
+    assert(spatial->peakBytes == 8 * 32);
+    assert(spatial->highWaterBytes == 2 * 32);  // Polls only saw 0 and 2 objects
+    assert(spatial->allocsPerSecond > 0.0f);
+    assert(telemetry.subsystems[MEMORY_SUBSYSTEM_SCENE].usedBytes == 64);
+    assert(telemetry.subsystems[MEMORY_SUBSYSTEM_GENERAL].poolCount == 0);
+    
+    // High-water persists across polls, the rate only covers the last interval
+    object_pool_free(&spatialPool, objects[6]);
+    object_pool_free(&spatialPool, objects[7]);
+    memory_debug_poll(&telemetry);
+    assert(telemetry.subsystems[MEMORY_SUBSYSTEM_SPATIAL].usedBytes == 0);
+    assert(telemetry.subsystems[MEMORY_SUBSYSTEM_SPATIAL].highWaterBytes == 2 * 32);
+    assert(telemetry.subsystems[MEMORY_SUBSYSTEM_SPATIAL].allocsPerSecond == 0.0f);
+    
+    PoolTelemetry pools[4];
+    uint32_t count = memory_debug_get_pool_telemetry(pools, 4);
+    assert(count == 2);
+    for (uint32_t i = 0; i < count; i++) {
+        if (pools[i].pool == &scenePool) {
+            assert(strcmp(pools[i].name, "TelemetryScene") == 0);
+            assert(pools[i].used == 1 && pools[i].capacity == 10 && pools[i].peak == 1);
+        }
+    }
+    assert(strcmp(memory_subsystem_to_string(MEMORY_SUBSYSTEM_SPATIAL), "Spatial") == 0);
+    
+    object_pool_free(&scenePool, sceneObject);
+    object_pool_destroy(&scenePool);
+    object_pool_destroy(&spatialPool);
+    memory_debug_shutdown();
+    printf("✓ Memory telemetry test passed\n");
+}
+
 int run_memory_debug_tests(void) {
     printf("Running memory debug tests...\n");
     
@@ -234,6 +338,8 @@ int run_memory_debug_tests(void) {
     test_leak_detection();
     test_multiple_pools_tracking();
     test_error_conditions_debug();
+    test_automatic_registration();
+    test_memory_telemetry();
     
     printf("All memory debug tests passed! ✓\n\n");
     return 0;
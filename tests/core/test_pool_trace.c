@@ -0,0 +1,206 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../src/core/memory_pool.h"
+#include "../../src/core/pool_trace.h"
+#include "../../src/profiling/profiler.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TRACE_PERF_ITERATIONS 100000
+#define TRACE_PERF_ROUNDS 5
+#define TRACE_EVENT_BUDGET_NS 5.0
+
+void test_pool_trace_recording(void) {
+    assert(pool_trace_init(0) == POOL_TRACE_ERROR_INVALID_CAPACITY);
+    assert(pool_trace_init(100) == POOL_TRACE_ERROR_INVALID_CAPACITY);
+    assert(pool_trace_init(64) == POOL_TRACE_OK);
+    assert(pool_trace_is_enabled());
+
+    ObjectPool pool;
+    object_pool_init(&pool, 32, 8, "TracePool");
+
+    void* tagged = object_pool_alloc_tagged(&pool, "spawner");
+    void* plain = object_pool_alloc(&pool);
+    object_pool_free(&pool, tagged);
+    object_pool_free(&pool, tagged);            // Double free is not traced
+
+    PoolTraceEvent events[8];
+    assert(pool_trace_get_event_count() == 3);
+    assert(pool_trace_snapshot(events, 8) == 3);
+
+    assert(events[0].type == POOL_TRACE_ALLOC && events[0].pool == &pool);
+    assert(events[0].flags & POOL_TRACE_FLAG_TAG);
+    assert(strcmp((const char*)events[0].caller, "spawner") == 0);
+    assert(events[0].slot == object_pool_get_object_index(&pool, tagged));
+
+    assert(events[1].type == POOL_TRACE_ALLOC && !(events[1].flags & POOL_TRACE_FLAG_TAG));
+    assert(events[1].caller != NULL);           // Return address into this test
+    assert(events[1].slot == object_pool_get_object_index(&pool, plain));
+
+    assert(events[2].type == POOL_TRACE_FREE && events[2].slot == events[0].slot);
+    assert(events[0].ticks <= events[1].ticks && events[1].ticks <= events[2].ticks);
+    assert(pool_trace_ticks_to_ns(events[2].ticks) >= pool_trace_ticks_to_ns(events[0].ticks));
+    assert(pool_trace_ticks_to_ns(events[2].ticks) >= pool_trace_ticks_to_ns(events[1].ticks));
+
+    object_pool_free(&pool, plain);
+    object_pool_destroy(&pool);
+    pool_trace_shutdown();
+    assert(!pool_trace_is_enabled());
+    printf("✓ Pool trace recording test passed\n");
+}
+
+void test_pool_trace_wraparound(void) {
+    pool_trace_init(16);
+
+    ObjectPool pool;
+    object_pool_init(&pool, 16, 4, "WrapPool");
+    for (int i = 0; i < 20; i++) {
+        object_pool_free(&pool, object_pool_alloc(&pool));
+    }
+
+    // 40 events through a 16-entry ring: the newest 16 survive, oldest first
+    PoolTraceEvent events[32];
+    assert(pool_trace_get_event_count() == 40);
+    assert(pool_trace_snapshot(events, 32) == 16);
+    assert(events[0].sequence == 24 && events[15].sequence == 39);
+    assert(events[15].type == POOL_TRACE_FREE);
+
+    // A smaller buffer keeps the most recent events
+    assert(pool_trace_snapshot(events, 4) == 4);
+    assert(events[3].sequence == 39);
+
+    pool_trace_clear();
+    assert(pool_trace_get_event_count() == 0 && pool_trace_snapshot(events, 32) == 0);
+
+    object_pool_destroy(&pool);
+    pool_trace_shutdown();
+    printf("✓ Pool trace wraparound test passed\n");
+}
+
+void test_pool_trace_exhaustion_dump(void) {
+    pool_trace_init(64);
+
+    char buffer[4096];
+    memset(buffer, 0, sizeof(buffer));
+    FILE* out = fmemopen(buffer, sizeof(buffer), "w");
+    pool_trace_set_exhaustion_dump(out);
+
+    ObjectPool pool, other;
+    object_pool_init(&pool, 32, 2, "FullPool");
+    object_pool_init(&other, 32, 2, "OtherPool");
+    object_pool_alloc(&other);
+
+    assert(object_pool_alloc_tagged(&pool, "wave_1") != NULL);
+    assert(object_pool_alloc_tagged(&pool, "wave_2") != NULL);
+    assert(object_pool_alloc_tagged(&pool, "wave_3") == NULL);
+    fflush(out);
+    long dumpedLength = (long)strlen(buffer);
+
+    // Only the exhausted pool's history is dumped
+    assert(strstr(buffer, "# Pool 'FullPool' exhausted (capacity 2)") != NULL);
+    assert(strstr(buffer, "timestamp_ns,event,pool,pool_address,slot,caller") != NULL);
+    assert(strstr(buffer, ",alloc,FullPool,") && strstr(buffer, ",wave_2\n"));
+    assert(strstr(buffer, ",exhausted,FullPool,") && strstr(buffer, ",-,wave_3\n"));
+    assert(strstr(buffer, "OtherPool") == NULL);
+
+    // Further failures of the same pool do not dump again
+    assert(object_pool_alloc(&pool) == NULL);
+    fflush(out);
+    assert((long)strlen(buffer) == dumpedLength);
+    pool_trace_set_exhaustion_dump(NULL);
+    fclose(out);
+
+    // On-demand dump of every pool; destroyed pools lose their name
+    object_pool_destroy(&other);
+    char all[4096];
+    memset(all, 0, sizeof(all));
+    out = fmemopen(all, sizeof(all), "w");
+    pool_trace_dump(out, NULL);
+    fclose(out);
+    assert(strstr(all, ",alloc,destroyed,") != NULL);
+    assert(strstr(all, ",exhausted,FullPool,") != NULL);
+
+    object_pool_destroy(&pool);
+    pool_trace_shutdown();
+    printf("✓ Pool trace exhaustion dump test passed\n");
+}
+
+static double time_alloc_free_pairs(ObjectPool* pool) {
+    uint64_t start = profiler_get_time_ns();
+    for (int i = 0; i < TRACE_PERF_ITERATIONS; i++) {
+        object_pool_free(pool, object_pool_alloc(pool));
+    }
+    return (double)(profiler_get_time_ns() - start) / (TRACE_PERF_ITERATIONS * 2.0);
+}
+
+static double time_tick_reads(void) {
+    volatile uint64_t sink = 0;
+    uint64_t start = profiler_get_time_ns();
+    for (int i = 0; i < TRACE_PERF_ITERATIONS; i++) {
+        sink += pool_trace_read_ticks();
+    }
+    (void)sink;
+    return (double)(profiler_get_time_ns() - start) / TRACE_PERF_ITERATIONS;
+}
+
+static double min_time(double a, double b) {
+    return a < b ? a : b;
+}
+
+void test_pool_trace_overhead(void) {
+    ObjectPool pool;
+    object_pool_init(&pool, 32, 16, "OverheadPool");
+
+    // Fastest of several rounds, so scheduler noise does not count as overhead
+    time_alloc_free_pairs(&pool);                // Warm up
+    double untraced = time_alloc_free_pairs(&pool);
+    pool_trace_init(POOL_TRACE_DEFAULT_CAPACITY);
+    double traced = time_alloc_free_pairs(&pool);
+    double tickRead = time_tick_reads();
+    for (int round = 1; round < TRACE_PERF_ROUNDS; round++) {
+        pool_trace_shutdown();
+        untraced = min_time(untraced, time_alloc_free_pairs(&pool));
+        pool_trace_init(POOL_TRACE_DEFAULT_CAPACITY);
+        traced = min_time(traced, time_alloc_free_pairs(&pool));
+        tickRead = min_time(tickRead, time_tick_reads());
+    }
+    pool_trace_shutdown();
+
+    printf("Pool trace overhead: %.2f ns/op untraced, %.2f ns/op traced (+%.2f ns per event, "
+           "%.2f ns per tick read)\n", untraced, traced, traced - untraced, tickRead);
+
+    // A trapped or virtualized cycle counter alone costs more than the budget
+    if (tickRead > TRACE_EVENT_BUDGET_NS) {
+        printf("✓ Pool trace overhead test skipped (tick counter costs %.2f ns per read)\n", tickRead);
+        object_pool_destroy(&pool);
+        return;
+    }
+    assert(traced - untraced < TRACE_EVENT_BUDGET_NS);
+
+    object_pool_destroy(&pool);
+    printf("✓ Pool trace overhead test passed\n");
+}
+
+int run_pool_trace_tests(void) {
+    printf("Running pool trace tests...\n");
+
+#if ENABLE_POOL_TRACE
+    test_pool_trace_recording();
+    test_pool_trace_wraparound();
+    test_pool_trace_exhaustion_dump();
+    test_pool_trace_overhead();
+#else
+    assert(pool_trace_init(POOL_TRACE_DEFAULT_CAPACITY) == POOL_TRACE_ERROR_DISABLED);
+    printf("✓ Pool trace compiled out\n");
+#endif
+
+    printf("All pool trace tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_pool_trace_tests();
+}
+#endif
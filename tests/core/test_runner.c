@@ -6,6 +6,8 @@
 extern int run_memory_pool_tests(void);
 extern int run_memory_performance_tests(void);
 extern int run_memory_debug_tests(void);
+extern int run_pool_trace_tests(void);
+extern int run_memory_budget_tests(void);
 
 int main(void) {
     printf("=== Playdate Engine Memory Management Test Suite ===\n\n");
@@ -27,6 +29,16 @@ int main(void) {
     printf("============================\n");
     total_failures += run_memory_debug_tests();
     
+    // Run pool trace tests
+    printf("PHASE 4: Pool Trace Tests\n");
+    printf("=========================\n");
+    total_failures += run_pool_trace_tests();
+    
+    // Run memory budget tests
+    printf("PHASE 5: Memory Budget Tests\n");
+    printf("============================\n");
+    total_failures += run_memory_budget_tests();
+    
     // Summary
     printf("=== Test Suite Summary ===\n");
     if (total_failures == 0) {
@@ -3,6 +3,7 @@
 #include "../../src/core/component_registry.h"
 #include "../../src/components/transform_component.h"
 #include "../../src/core/update_systems.h"
+#include "../../src/core/memory_budget.h"
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
@@ -255,6 +256,97 @@ void test_scene_updates(void) {
     printf("✓ Scene updates test passed\n");
 }
 
+static uint32_t g_budgetEvents = 0;
+static ComponentType g_budgetEventType = COMPONENT_TYPE_NONE;
+
+static void slow_transform_batch(Component** components, uint32_t count, float deltaTime) {
+    (void)components;
+    (void)deltaTime;
+    // Burn a little time proportional to the batch so the budget trips
+    volatile uint32_t sink = 0;
+    for (uint32_t i = 0; i < count * 20000; i++) {
+        sink += i;
+    }
+}
+
+static void on_budget_exceeded(Scene* scene, ComponentType type, float elapsedUs,
+                               float budgetUs, void* userData) {
+    (void)scene;
+    assert(elapsedUs > budgetUs);
+    assert(userData == &g_budgetEvents);
+    g_budgetEvents++;
+    g_budgetEventType = type;
+}
+
+void test_scene_system_stats(void) {
+    component_registry_init();
+    transform_component_register();
+    
+    Scene* scene = scene_create("SystemStatsTest", 100);
+    scene_register_component_system(scene, COMPONENT_TYPE_TRANSFORM, slow_transform_batch, NULL, 0);
+    
+    for (int i = 0; i < 4; i++) {
+        game_object_create(scene);
+    }
+    scene_set_state(scene, SCENE_STATE_ACTIVE);
+    
+    // No samples before the first update
+    SystemTimingStats update, render;
+    SceneResult result = scene_get_system_stats(scene, COMPONENT_TYPE_TRANSFORM, &update, &render);
+    assert(result == SCENE_OK);
+    assert(update.callCount == 0 && update.sampleCount == 0);
+    
+    // Fill past the rolling window
+    for (int frame = 0; frame < SYSTEM_STATS_WINDOW + 10; frame++) {
+        scene_update(scene, 0.016f);
+    }
+    
+    result = scene_get_system_stats(scene, COMPONENT_TYPE_TRANSFORM, &update, &render);
+    assert(result == SCENE_OK);
+    assert(update.callCount == SYSTEM_STATS_WINDOW + 10);
+    assert(update.sampleCount == SYSTEM_STATS_WINDOW);
+    assert(update.lastEntityCount == 4);
+    assert(update.lastUs > 0.0f);
+    assert(update.averageUs > 0.0f);
+    assert(update.p95Us <= update.maxUs);
+    assert(update.averageUs <= update.maxUs);
+    assert(update.nsPerEntity > 0.0f);
+    assert(render.callCount == 0); // No render batch registered
+    
+    // Budget events fire on overrun
+    g_budgetEvents = 0;
+    result = scene_set_system_budget(scene, COMPONENT_TYPE_TRANSFORM, 0.001f,
+                                     on_budget_exceeded, &g_budgetEvents);
+    assert(result == SCENE_OK);
+    scene_update(scene, 0.016f);
+    assert(g_budgetEvents == 1);
+    assert(g_budgetEventType == COMPONENT_TYPE_TRANSFORM);
+    assert(scene_get_system_budget_overruns(scene, COMPONENT_TYPE_TRANSFORM) == 1);
+    
+    // A generous budget stays quiet
+    scene_set_system_budget(scene, COMPONENT_TYPE_TRANSFORM, 1.0e9f, on_budget_exceeded, &g_budgetEvents);
+    scene_update(scene, 0.016f);
+    assert(g_budgetEvents == 1);
+    
+    scene_print_stats(scene);
+    
+    // Reset clears samples and overrun counters
+    scene_reset_system_stats(scene);
+    scene_get_system_stats(scene, COMPONENT_TYPE_TRANSFORM, &update, NULL);
+    assert(update.callCount == 0);
+    assert(scene_get_system_budget_overruns(scene, COMPONENT_TYPE_TRANSFORM) == 0);
+    
+    // Error handling
+    assert(scene_get_system_stats(NULL, COMPONENT_TYPE_TRANSFORM, &update, NULL) == SCENE_ERROR_NULL_POINTER);
+    assert(scene_get_system_stats(scene, COMPONENT_TYPE_SPRITE, &update, NULL) == SCENE_ERROR_SYSTEM_NOT_FOUND);
+    assert(scene_set_system_budget(scene, COMPONENT_TYPE_SPRITE, 1.0f, NULL, NULL) == SCENE_ERROR_SYSTEM_NOT_FOUND);
+    assert(scene_get_system_budget_overruns(NULL, COMPONENT_TYPE_TRANSFORM) == 0);
+    
+    scene_destroy(scene);
+    component_registry_shutdown();
+    printf("✓ Scene system stats test passed\n");
+}
+
 void test_scene_resource_access(void) {
     Scene* scene = scene_create("ResourceTest", 10);
     
@@ -316,6 +408,35 @@ void test_scene_capacity_limits(void) {
     printf("✓ Scene capacity limits test passed\n");
 }
 
+void test_scene_memory_budget(void) {
+    memory_budget_reset();
+    const MemoryBudget* budget = memory_budget_get(MEMORY_SUBSYSTEM_SCENE);
+    uint32_t baseReserved = budget->reservedBytes;
+    
+    // A scene charges its pools and arrays to the scene budget
+    Scene* scene = scene_create("BudgetScene", 100);
+    assert(scene != NULL);
+    uint32_t sceneBytes = budget->reservedBytes - baseReserved;
+    assert(sceneBytes >= 100 * sizeof(GameObject));
+    scene_destroy(scene);
+    assert(budget->reservedBytes == baseReserved);
+    
+    // Over the hard limit the scene is refused and nothing stays charged
+    memory_budget_set_limits(MEMORY_SUBSYSTEM_SCENE, 0, baseReserved + sceneBytes - 1);
+    assert(scene_create("TooBig", 100) == NULL);
+    assert(budget->reservedBytes == baseReserved);
+    assert(budget->hardLimitFailures == 1);
+    
+    memory_budget_set_limits(MEMORY_SUBSYSTEM_SCENE, 0, baseReserved + sceneBytes);
+    scene = scene_create("JustFits", 100);
+    assert(scene != NULL);
+    assert(memory_budget_get_headroom(MEMORY_SUBSYSTEM_SCENE) == 0);
+    scene_destroy(scene);
+    
+    memory_budget_reset();
+    printf("✓ Scene memory budget test passed\n");
+}
+
 // Global callback test state
 static bool g_loadCalled = false;
 static bool g_activateCalled = false;
@@ -380,9 +501,11 @@ int run_scene_tests(void) {
     test_scene_gameobject_management();
     test_scene_component_systems();
     test_scene_updates();
+    test_scene_system_stats();
     test_scene_resource_access();
     test_scene_debug_functions();
     test_scene_capacity_limits();
+    test_scene_memory_budget();
     test_scene_lifecycle_callbacks();
     
     printf("All scene tests passed! ✓\n\n");
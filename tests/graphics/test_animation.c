@@ -0,0 +1,302 @@
+#include "../../src/components/animation_component.h"
+#include "../../src/components/sprite_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/memory_budget.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/scene_manager.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_FRAMES 4
+#define TEST_ACTORS 12
+
+static Bitmap g_frames[TEST_FRAMES];
+static const Bitmap* g_framePointers[TEST_FRAMES];
+static const uint16_t g_walkDurations[TEST_FRAMES] = {100, 50, 50, 200};
+static const uint16_t g_shortDurations[2] = {30, 30};
+
+static uint16_t g_walk;                 // Looping, 400 ms
+static uint16_t g_attack;               // Once, 60 ms
+
+// TEST_ACTORS objects with a sprite and an animation each, in an active scene
+static void create_actors(TestScene* test) {
+    test_scene_create(test, "Animation", 32);
+    sprite_component_register();
+    assert(animation_component_register_with_capacity(64) == COMPONENT_OK);
+
+    for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+        assert(bitmap_init(&g_frames[i], 8 + 2 * i, 8) == BITMAP_OK);
+        g_framePointers[i] = &g_frames[i];
+    }
+    AnimationClip walk = {g_framePointers, g_walkDurations, TEST_FRAMES, true};
+    AnimationClip attack = {g_framePointers, g_shortDurations, 2, false};
+    assert(animation_clip_add(&walk, &g_walk) == ANIMATION_OK);
+    assert(animation_clip_add(&attack, &g_attack) == ANIMATION_OK);
+
+    register_default_systems(test->scene);
+    for (uint32_t i = 0; i < TEST_ACTORS; i++) {
+        GameObject* object = test_scene_add(test, 0.0f, 0.0f);
+        game_object_add_component(object, (Component*)sprite_component_create(object));
+        AnimationComponent* animation = animation_component_create(object);
+        assert(animation && animation_component_is_animation((Component*)animation));
+        test_scene_attach(test, (Component*)animation);
+    }
+    scene_rebuild_component_arrays(test->scene);
+    scene_set_state(test->scene, SCENE_STATE_ACTIVE);
+}
+
+static void destroy_actors(TestScene* test) {
+    test_scene_destroy(test);
+    animation_system_shutdown();
+    for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+        bitmap_destroy(&g_frames[i]);
+    }
+}
+
+static AnimationComponent* animation_of(const TestScene* test, uint32_t index) {
+    return (AnimationComponent*)test->components[index];
+}
+
+static SpriteComponent* sprite_of(const TestScene* test, uint32_t index) {
+    return (SpriteComponent*)game_object_get_component(test->objects[index], COMPONENT_TYPE_SPRITE);
+}
+
+static void clear_render_dirty(TestScene* test) {
+    for (uint32_t i = 0; i < TEST_ACTORS; i++) {
+        test->objects[i]->transform->renderDirty = false;
+    }
+}
+
+void test_animation_clips(void) {
+    TestScene test;
+    create_actors(&test);
+
+    uint16_t index = 0;
+    const uint16_t zeroDuration[2] = {100, 0};
+    AnimationClip empty = {g_framePointers, g_walkDurations, 0, true};
+    AnimationClip instant = {g_framePointers, zeroDuration, 2, true};
+    assert(animation_clip_add(NULL, &index) == ANIMATION_ERROR_NULL_POINTER);
+    assert(animation_clip_add(&empty, &index) == ANIMATION_ERROR_INVALID_CLIP);
+    assert(animation_clip_add(&instant, &index) == ANIMATION_ERROR_INVALID_CLIP);
+    assert(animation_clip_get_count() == 2);
+
+    // Clips are shared by index; an instance holds no copy
+    const AnimationClip* walk = animation_clip_get(g_walk);
+    assert(walk && walk->frames == g_framePointers && walk->frameCount == TEST_FRAMES);
+    assert(animation_clip_get(2) == NULL);
+    assert(sizeof(AnimationComponent) == 64);
+
+    // Playing shows the first frame at once
+    assert(animation_component_get_clip(animation_of(&test, 0)) == ANIMATION_CLIP_NONE);
+    animation_component_play(animation_of(&test, 0), g_walk);
+    assert(animation_component_get_clip(animation_of(&test, 0)) == g_walk);
+    assert(sprite_of(&test, 0)->bitmap == &g_frames[0]);
+    animation_component_play(animation_of(&test, 1), 7);              // Unknown clip is ignored
+    assert(animation_component_get_clip(animation_of(&test, 1)) == ANIMATION_CLIP_NONE);
+
+    // Clearing the library stops every instance
+    animation_clips_clear();
+    assert(animation_clip_get_count() == 0);
+    assert(animation_component_get_clip(animation_of(&test, 0)) == ANIMATION_CLIP_NONE);
+
+    destroy_actors(&test);
+    printf("✓ Animation clip library test passed\n");
+}
+
+void test_animation_frame_advance(void) {
+    TestScene test;
+    create_actors(&test);
+    AnimationComponent* walker = animation_of(&test, 0);
+    AnimationComponent* attacker = animation_of(&test, 1);
+    animation_component_play(walker, g_walk);
+
+    // 100 ms on frame 0, then 50, 50, 200 and around again
+    assert(animation_system_update(test.scene, 0.099f) == 0);
+    assert(animation_component_get_frame(walker) == 0);
+    assert(animation_system_update(test.scene, 0.002f) == 1);
+    assert(animation_component_get_frame(walker) == 1 && sprite_of(&test, 0)->bitmap == &g_frames[1]);
+
+    animation_component_play(attacker, g_attack);
+    assert(animation_system_update(test.scene, 0.020f) == 0);
+    assert(animation_system_update(test.scene, 0.015f) == 1);
+    assert(animation_component_get_frame(attacker) == 1 && !animation_component_is_finished(attacker));
+
+    // The non-looping clip holds its last frame and reports finished
+    assert(animation_system_update(test.scene, 0.030f) == 1);      // Only the walker, to frame 2
+    assert(animation_component_get_frame(walker) == 2);
+    assert(animation_component_is_finished(attacker));
+    assert(animation_component_get_frame(attacker) == 1 && sprite_of(&test, 1)->bitmap == &g_frames[1]);
+
+    // Long steps skip whole loops: 1016 ms into frame 2 is 166 ms into frame 3
+    assert(animation_system_update(test.scene, 1.0f) == 1);
+    assert(animation_component_get_frame(walker) == 3 && animation_component_get_frame(attacker) == 1);
+    assert(animation_system_update(test.scene, 0.035f) == 1);
+    assert(animation_component_get_frame(walker) == 0 && sprite_of(&test, 0)->bitmap == &g_frames[0]);
+    assert(!animation_component_is_finished(walker));
+
+    // Stopping keeps the bitmap and freezes the frame
+    animation_component_stop(walker);
+    assert(animation_system_update(test.scene, 1.0f) == 0);
+    assert(sprite_of(&test, 0)->bitmap == &g_frames[0]);
+
+    destroy_actors(&test);
+    printf("✓ Animation frame advance test passed\n");
+}
+
+void test_animation_marks_changed_sprites_only(void) {
+    TestScene test;
+    create_actors(&test);
+
+    // Staggered starts: even actors are 60 ms into frame 0, odd ones just began
+    for (uint32_t i = 0; i < TEST_ACTORS; i += 2) {
+        animation_component_play(animation_of(&test, i), g_walk);
+    }
+    animation_system_update(test.scene, 0.060f);
+    for (uint32_t i = 1; i < TEST_ACTORS; i += 2) {
+        animation_component_play(animation_of(&test, i), g_walk);
+    }
+
+    // The scene's systems run the batch; only the even actors change frame
+    clear_render_dirty(&test);
+    scene_update(test.scene, 0.050f);
+    for (uint32_t i = 0; i < TEST_ACTORS; i++) {
+        bool even = (i % 2) == 0;
+        assert(animation_component_get_frame(animation_of(&test, i)) == (even ? 1 : 0));
+        assert(test.objects[i]->transform->renderDirty == even);
+        assert(sprite_of(&test, i)->bitmap == &g_frames[even ? 1 : 0]);
+    }
+
+    // Frames that don't change leave the sprites clean
+    clear_render_dirty(&test);
+    scene_update(test.scene, 0.010f);
+    for (uint32_t i = 0; i < TEST_ACTORS; i++) {
+        assert(!test.objects[i]->transform->renderDirty);
+    }
+
+    // Disabled instances keep their state but don't advance
+    component_set_enabled((Component*)animation_of(&test, 0), false);
+    assert(animation_system_update(test.scene, 0.045f) == TEST_ACTORS - 1);
+    assert(animation_component_get_frame(animation_of(&test, 0)) == 1);
+    component_set_enabled((Component*)animation_of(&test, 0), true);
+    assert(animation_system_update(test.scene, 0.031f) == 1);
+    assert(animation_component_get_frame(animation_of(&test, 0)) == 2);
+
+    destroy_actors(&test);
+    printf("✓ Animation dirty marking test passed\n");
+}
+
+void test_animation_instance_slots(void) {
+    TestScene test;
+    create_actors(&test);
+    assert(animation_system_get_instance_count() == TEST_ACTORS);
+
+    for (uint32_t i = 0; i < TEST_ACTORS; i++) {
+        animation_component_play(animation_of(&test, i), (i % 3) ? g_walk : g_attack);
+    }
+
+    // Removing instances moves the last one into the hole; state travels with it
+    AnimationComponent* last = animation_of(&test, TEST_ACTORS - 1);
+    game_object_remove_component(test.objects[2], COMPONENT_TYPE_ANIMATION);
+    assert(animation_system_get_instance_count() == TEST_ACTORS - 1);
+    assert(last->slot == 2 && animation_component_get_clip(last) == g_walk);
+    game_object_remove_component(test.objects[0], COMPONENT_TYPE_ANIMATION);
+    game_object_destroy(test.objects[5]);
+    scene_rebuild_component_arrays(test.scene);
+    assert(animation_system_get_instance_count() == TEST_ACTORS - 3);
+
+    for (uint32_t i = 0; i < TEST_ACTORS; i++) {
+        if (i == 0 || i == 2 || i == 5) continue;
+        AnimationComponent* animation = animation_of(&test, i);
+        assert(animation->slot < animation_system_get_instance_count());
+        assert(animation_component_get_clip(animation) == ((i % 3) ? g_walk : g_attack));
+    }
+    assert(animation_system_update(test.scene, 0.101f) == TEST_ACTORS - 3);
+
+    // Instances only advance with their own scene
+    Scene* other = scene_create("Other", 4);
+    GameObject* object = game_object_create(other);
+    SpriteComponent* sprite = sprite_component_create(object);
+    AnimationComponent* animation = animation_component_create(object);
+    game_object_add_component(object, (Component*)sprite);
+    game_object_add_component(object, (Component*)animation);
+    animation_component_play(animation, g_walk);
+    assert(animation_system_update(test.scene, 1.0f) >= 1);
+    assert(animation_component_get_frame(animation) == 0);
+    assert(animation_system_update(other, 0.101f) == 1);
+    assert(animation_component_get_frame(animation) == 1);
+
+    // A destroyed sprite is dropped, and a replacement is found on the object
+    game_object_remove_component(object, COMPONENT_TYPE_SPRITE);
+    assert(animation_system_update(other, 0.101f) == 1);
+    assert(animation_component_get_frame(animation) == 3);
+    SpriteComponent* replacement = sprite_component_create(object);
+    game_object_add_component(object, (Component*)replacement);
+    assert(animation_system_update(other, 0.2f) == 1);
+    assert(animation_component_get_frame(animation) == 0 && replacement->bitmap == &g_frames[0]);
+    scene_destroy(other);
+    assert(animation_system_get_instance_count() == TEST_ACTORS - 3);
+
+    // The state arrays are sized by the pool; nothing is allocated per frame
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_COMPONENTS)->usedBytes;
+    for (uint32_t frame = 0; frame < 100; frame++) {
+        scene_update(test.scene, 1.0f / 60.0f);
+    }
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_COMPONENTS)->usedBytes == before);
+
+    destroy_actors(&test);
+    printf("✓ Animation instance slot test passed\n");
+}
+
+void test_animation_rate_under_scene_manager(void) {
+    TestScene test;
+    create_actors(&test);
+    SceneManager* manager = scene_manager_create();
+    assert(manager && scene_manager_add_scene(manager, test.scene) == SCENE_OK);
+    assert(scene_manager_set_active_scene(manager, test.scene) == SCENE_OK);
+    AnimationComponent* walker = animation_of(&test, 0);
+    animation_component_play(walker, g_walk);
+
+    // 10 ms frames under a 60 Hz fixed step: clips follow the frame time
+    // alone, so the fixed steps in between add nothing
+    for (uint32_t frame = 0; frame < 9; frame++) {
+        scene_manager_update(manager, 0.010f);
+    }
+    assert(animation_component_get_frame(walker) == 0);
+    scene_manager_update(manager, 0.010f);
+    scene_manager_update(manager, 0.010f);
+    assert(animation_component_get_frame(walker) == 1);
+    for (uint32_t frame = 11; frame < 38; frame++) {
+        scene_manager_update(manager, 0.010f);
+    }
+    assert(animation_component_get_frame(walker) == 3);
+
+    scene_manager_remove_scene(manager, test.scene);
+    scene_manager_destroy(manager);
+    scene_set_state(test.scene, SCENE_STATE_INACTIVE);
+    destroy_actors(&test);
+    printf("✓ Animation rate under scene manager test passed\n");
+}
+
+int run_animation_tests(void) {
+    printf("Running animation tests...\n");
+
+    test_animation_clips();
+    test_animation_frame_advance();
+    test_animation_marks_changed_sprites_only();
+    test_animation_instance_slots();
+    test_animation_rate_under_scene_manager();
+
+    printf("All animation tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_animation_tests();
+}
+#endif
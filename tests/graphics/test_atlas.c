@@ -0,0 +1,288 @@
+#include "../../src/graphics/atlas.h"
+#include "../../src/graphics/sprite_cache.h"
+#include "../../src/graphics/render_queue.h"
+#include "../../src/core/memory_budget.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t g_seed = 4242;
+
+// Word columns a placement occupies, including its guard column
+static uint32_t placement_columns(const AtlasRect* rect) {
+    return (rect->width + 63u) / 64u + 1;
+}
+
+void test_atlas_pack(void) {
+    AtlasRect rects[300];
+    AtlasPlacement placements[300];
+    uint32_t pageCount = 0;
+
+    assert(atlas_pack(NULL, 1, 256, 256, placements, &pageCount) == ATLAS_ERROR_NULL_POINTER);
+    rects[0] = (AtlasRect){0, 4};
+    assert(atlas_pack(rects, 1, 256, 256, placements, &pageCount) == ATLAS_ERROR_INVALID_SIZE);
+    rects[0] = (AtlasRect){257, 4};
+    assert(atlas_pack(rects, 1, 256, 256, placements, &pageCount) == ATLAS_ERROR_TOO_LARGE);
+    rects[0] = (AtlasRect){256, 256};
+    assert(atlas_pack(rects, 1, 256, 256, placements, &pageCount) == ATLAS_OK && pageCount == 1);
+
+    uint64_t area = 0;
+    for (uint32_t i = 0; i < 300; i++) {
+        rects[i].width = (uint16_t)(1 + test_random(&g_seed, i % 10 == 0 ? 150 : 40));
+        rects[i].height = (uint16_t)(1 + test_random(&g_seed, 48));
+        area += (uint64_t)rects[i].width * rects[i].height;
+    }
+    assert(atlas_pack(rects, 300, 256, 256, placements, &pageCount) == ATLAS_OK);
+    assert(pageCount >= 1 && pageCount < 300);
+
+    // Inside the page, word-aligned, and no two placements (with guards) overlap
+    for (uint32_t i = 0; i < 300; i++) {
+        const AtlasPlacement* a = &placements[i];
+        uint32_t ax = a->x / 64u;
+        assert(a->page < pageCount && a->x % 64 == 0);
+        assert(ax + placement_columns(&rects[i]) <= 256u / 64u + 1 && a->y + rects[i].height <= 256u);
+        for (uint32_t j = i + 1; j < 300; j++) {
+            const AtlasPlacement* b = &placements[j];
+            uint32_t bx = b->x / 64u;
+            if (a->page != b->page) continue;
+            bool apart = ax + placement_columns(&rects[i]) <= bx || bx + placement_columns(&rects[j]) <= ax ||
+                         a->y + rects[i].height <= b->y || b->y + rects[j].height <= a->y;
+            assert(apart);
+        }
+    }
+
+    // Offline and load-time runs agree
+    AtlasPlacement again[300];
+    uint32_t againCount = 0;
+    atlas_pack(rects, 300, 256, 256, again, &againCount);
+    assert(againCount == pageCount && memcmp(again, placements, sizeof(again)) == 0);
+
+    printf("✓ Atlas pack test passed (%u pages, %.0f%% pixel fill)\n", pageCount,
+           100.0 * (double)area / ((double)pageCount * 256.0 * 256.0));
+}
+
+// A frame blits exactly like the bitmap it was copied from
+void test_sprite_atlas_frames(void) {
+    Bitmap sources[40];
+    const Bitmap* pointers[40];
+    Bitmap copies[40];
+    for (uint32_t i = 0; i < 40; i++) {
+        bitmap_init(&sources[i], 1 + test_random(&g_seed, 130), 1 + test_random(&g_seed, 30));
+        test_fill_random_bitmap(&sources[i], &g_seed);
+        pointers[i] = &sources[i];
+    }
+
+    SpriteAtlas atlas;
+    assert(sprite_atlas_build(&atlas, pointers, 40, 256, 128) == ATLAS_OK);
+    assert(atlas.frameCount == 40 && atlas.pageCount >= 1);
+    assert(sprite_atlas_get_frame(&atlas, 40) == NULL);
+
+    // Keep pixel-identical standalone copies, then drop the sources
+    for (uint32_t i = 0; i < 40; i++) {
+        bitmap_init(&copies[i], sources[i].width, sources[i].height);
+        for (uint32_t y = 0; y < sources[i].height; y++) {
+            for (uint32_t x = 0; x < sources[i].width; x++) {
+                if (bitmap_is_opaque(&sources[i], (int32_t)x, (int32_t)y)) {
+                    bitmap_set_pixel(&copies[i], (int32_t)x, (int32_t)y, bitmap_get_pixel(&sources[i], (int32_t)x, (int32_t)y));
+                }
+            }
+        }
+        bitmap_destroy(&sources[i]);
+    }
+
+    Framebuffer expected, actual;
+    framebuffer_init(&expected, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_init(&actual, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    for (uint32_t kernel = 0; kernel < BLIT_KERNEL_COUNT; kernel++) {
+        if (framebuffer_set_blit_kernel(&actual, (BlitKernel)kernel) != FRAMEBUFFER_OK) continue;
+
+        for (uint32_t i = 0; i < 40; i++) {
+            const Bitmap* frame = sprite_atlas_get_frame(&atlas, i);
+            assert(frame->atlasId == atlas.pages[atlas.placements[i].page].atlasId && frame->atlasId != 0);
+            for (int trial = 0; trial < 6; trial++) {
+                int32_t x = (int32_t)test_random(&g_seed, FRAMEBUFFER_WIDTH + 2 * frame->width) - (int32_t)frame->width;
+                int32_t y = (int32_t)test_random(&g_seed, FRAMEBUFFER_HEIGHT + 2 * frame->height) - (int32_t)frame->height;
+                framebuffer_clear(&expected, BITMAP_COLOR_WHITE);
+                framebuffer_clear(&actual, BITMAP_COLOR_WHITE);
+                framebuffer_blit(&expected, &copies[i], x, y);
+                framebuffer_blit(&actual, frame, x, y);
+                assert(framebuffer_hash(&expected) == framebuffer_hash(&actual));
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < 40; i++) {
+        bitmap_destroy(&copies[i]);
+    }
+    framebuffer_destroy(&expected);
+    framebuffer_destroy(&actual);
+    uint32_t pages = atlas.pageCount;
+    sprite_atlas_destroy(&atlas);
+    assert(atlas.frames == NULL);
+    printf("✓ Sprite atlas frames test passed (40 frames on %u pages)\n", pages);
+}
+
+// Pre-shifted draws must match the regular kernel everywhere, including
+// positions that fall back to it
+void test_preshifted_blits_match_kernel(void) {
+    SpriteCache cache;
+    assert(sprite_cache_init(&cache, 0, 1024) == SPRITE_CACHE_ERROR_INVALID_CAPACITY);
+    assert(sprite_cache_init(&cache, 64, 1 << 20) == SPRITE_CACHE_OK);
+
+    static const uint32_t widths[] = {1, 7, 8, 9, 16, 31, 33, 57, 63, 64, 100};
+    static const uint32_t framebufferWidths[] = {FRAMEBUFFER_WIDTH, 100, 64};
+    uint32_t checked = 0;
+
+    for (uint32_t f = 0; f < 3; f++) {
+        Framebuffer expected, actual;
+        framebuffer_init(&expected, framebufferWidths[f], 40);
+        framebuffer_init(&actual, framebufferWidths[f], 40);
+
+        for (uint32_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+            Bitmap bitmap;
+            bitmap_init(&bitmap, widths[w], 1 + test_random(&g_seed, 20));
+            test_fill_random_bitmap(&bitmap, &g_seed);
+
+            for (int trial = 0; trial < 40; trial++) {
+                int32_t x = (int32_t)test_random(&g_seed, framebufferWidths[f] + bitmap.width) - (int32_t)bitmap.width / 2;
+                int32_t y = (int32_t)test_random(&g_seed, 40 + bitmap.height) - (int32_t)bitmap.height / 2;
+                if (trial == 0) x = (int32_t)framebufferWidths[f] - (int32_t)bitmap.width;   // Flush right
+                BlitMode mode = trial & 1 ? BLIT_MODE_INVERTED : BLIT_MODE_COPY;
+
+                framebuffer_clear(&expected, BITMAP_COLOR_BLACK);
+                framebuffer_clear(&actual, BITMAP_COLOR_BLACK);
+                framebuffer_blit_mode(&expected, &bitmap, x, y, mode);
+                sprite_cache_blit(&cache, &actual, &bitmap, x, y, mode);
+                if (memcmp(expected.words, actual.words, expected.wordsPerRow * 40 * sizeof(uint64_t)) != 0) {
+                    printf("Mismatch: %ux%u at (%d, %d) on width %u\n", bitmap.width, bitmap.height, x, y, framebufferWidths[f]);
+                    assert(0);
+                }
+                checked++;
+            }
+            sprite_cache_invalidate(&cache, &bitmap);
+            bitmap_destroy(&bitmap);
+        }
+        framebuffer_destroy(&expected);
+        framebuffer_destroy(&actual);
+    }
+
+    assert(cache.misses > 0 && cache.bypasses > 0 && cache.count == 0);
+    sprite_cache_destroy(&cache);
+    printf("✓ Pre-shifted blits match kernel test passed (%u blits)\n", checked);
+}
+
+void test_sprite_cache_lru(void) {
+    Bitmap a, b, c, wide;
+    bitmap_init(&a, 16, 16);
+    bitmap_init(&b, 16, 16);
+    bitmap_init(&c, 16, 16);
+    bitmap_init(&wide, SPRITE_CACHE_MAX_WIDTH + 1, 4);
+
+    // 16-pixel copies of 16 rows: (1 + 16 * 2) words * 2 planes * 8 bytes = 528 bytes
+    SpriteCache cache;
+    sprite_cache_init(&cache, 2, 528 * 3);
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+
+    assert(sprite_cache_get(&cache, &a, 0) == &a);                    // Shift 0 is the sprite itself
+    assert(sprite_cache_get(&cache, &wide, 1) == NULL);               // Too wide
+    const Bitmap* a3 = sprite_cache_get(&cache, &a, 3);
+    assert(a3 && a3->width == 19 && cache.misses == 1 && cache.usedBytes == 528);
+    assert(sprite_cache_get(&cache, &a, 3) == a3 && cache.misses == 1);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before + 528);
+
+    // Entry limit: a third sprite evicts the least recently used one (b)
+    sprite_cache_get(&cache, &b, 1);
+    sprite_cache_get(&cache, &a, 3);
+    sprite_cache_get(&cache, &c, 1);
+    assert(cache.count == 2 && cache.evictions == 1);
+    assert(sprite_cache_get(&cache, &a, 3) == a3);
+    size_t misses = cache.misses;
+    sprite_cache_get(&cache, &b, 1);
+    assert(cache.misses == misses + 1);                               // b was rebuilt, c evicted
+
+    // Byte budget: a fourth copy pushes the oldest entry out
+    sprite_cache_get(&cache, &b, 2);
+    sprite_cache_get(&cache, &b, 3);
+    assert(cache.usedBytes <= 528 * 3);
+    assert(cache.entries[cache.head].source == &b);
+
+    // Invalidate and clear release everything
+    sprite_cache_invalidate(&cache, &b);
+    sprite_cache_clear(&cache);
+    assert(cache.count == 0 && cache.usedBytes == 0);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before);
+
+    sprite_cache_destroy(&cache);
+    bitmap_destroy(&a);
+    bitmap_destroy(&b);
+    bitmap_destroy(&c);
+    bitmap_destroy(&wide);
+    printf("✓ Sprite cache LRU test passed\n");
+}
+
+void test_render_queue_with_sprite_cache(void) {
+    RenderQueue queue;
+    render_queue_init(&queue, 512);
+    SpriteCache cache;
+    sprite_cache_init(&cache, 16, 64 * 1024);
+
+    Bitmap sprites[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        bitmap_init(&sprites[i], 8 + i * 10, 12);
+        test_fill_random_bitmap(&sprites[i], &g_seed);
+    }
+
+    Framebuffer plain, cached;
+    framebuffer_init(&plain, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_init(&cached, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    for (int pass = 0; pass < 2; pass++) {
+        Framebuffer* target = pass ? &cached : &plain;
+        render_queue_set_sprite_cache(&queue, pass ? &cache : NULL);
+        framebuffer_clear(target, BITMAP_COLOR_WHITE);
+        render_queue_clear(&queue);
+        g_seed = 99;
+        for (uint32_t i = 0; i < 400; i++) {
+            int32_t x = (int32_t)test_random(&g_seed, FRAMEBUFFER_WIDTH + 40) - 20;
+            int32_t y = (int32_t)test_random(&g_seed, FRAMEBUFFER_HEIGHT + 20) - 10;
+            uint32_t s = test_random(&g_seed, 4);
+            render_queue_submit(&queue, render_key_make(0, 0, 0, (BlitMode)(i % 2), y), &sprites[s], x, y);
+        }
+        render_queue_execute(&queue, target);
+    }
+    assert(framebuffer_hash(&plain) == framebuffer_hash(&cached));
+    assert(cache.hits > cache.misses);
+
+    // Growing the queue keeps the cache
+    render_queue_reserve(&queue, 4096);
+    assert(queue.spriteCache == &cache);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        bitmap_destroy(&sprites[i]);
+    }
+    framebuffer_destroy(&plain);
+    framebuffer_destroy(&cached);
+    sprite_cache_destroy(&cache);
+    render_queue_destroy(&queue);
+    printf("✓ Render queue with sprite cache test passed\n");
+}
+
+int run_atlas_tests(void) {
+    printf("Running atlas and sprite cache tests...\n");
+
+    test_atlas_pack();
+    test_sprite_atlas_frames();
+    test_preshifted_blits_match_kernel();
+    test_sprite_cache_lru();
+    test_render_queue_with_sprite_cache();
+
+    printf("All atlas and sprite cache tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_atlas_tests();
+}
+#endif
@@ -0,0 +1,205 @@
+#include "../../src/graphics/band_renderer.h"
+#include "../../src/components/sprite_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/memory_budget.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint32_t g_seed = 1701;
+
+void test_band_renderer_init(void) {
+    BandRenderer renderer;
+    assert(band_renderer_init(NULL, 4, 0) == BAND_RENDERER_ERROR_NULL_POINTER);
+    assert(band_renderer_init(&renderer, 0, 0) == BAND_RENDERER_ERROR_INVALID_COUNT);
+    assert(band_renderer_init(&renderer, BAND_RENDERER_MAX_BANDS + 1, 0) == BAND_RENDERER_ERROR_INVALID_COUNT);
+    assert(band_renderer_init(&renderer, 4, BAND_RENDERER_MAX_THREADS + 1) == BAND_RENDERER_ERROR_INVALID_COUNT);
+
+    assert(band_renderer_init(&renderer, 4, 2) == BAND_RENDERER_OK);
+    assert(renderer.threadCount == (band_renderer_threads_supported() ? 2u : 0u));
+    assert(band_renderer_execute(&renderer, NULL, NULL) == BAND_RENDERER_ERROR_NULL_POINTER);
+    band_renderer_destroy(&renderer);
+    assert(renderer.workers == NULL && renderer.draws == NULL);
+    band_renderer_destroy(&renderer);
+
+    printf("✓ Band renderer init test passed\n");
+}
+
+// Bands are whole 8-row groups and every draw lands in each band it overlaps
+void test_band_binning(void) {
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    BandRenderer renderer;
+    band_renderer_init(&renderer, 8, 0);
+    RenderQueue queue;
+    render_queue_init(&queue, 16);
+    uint32_t withQueue = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+
+    Bitmap tall, small;
+    bitmap_init(&tall, 10, 100);
+    bitmap_init(&small, 10, 4);
+    bitmap_fill(&tall, BITMAP_COLOR_BLACK);
+    bitmap_fill(&small, BITMAP_COLOR_BLACK);
+
+    render_queue_submit(&queue, render_key_make(0, 0, 0, BLIT_MODE_COPY, 0), &small, 0, 28);   // Band 0 only
+    render_queue_submit(&queue, render_key_make(0, 1, 0, BLIT_MODE_COPY, 0), &small, 0, 29);   // Bands 0 and 1
+    render_queue_submit(&queue, render_key_make(0, 2, 0, BLIT_MODE_COPY, 0), &tall, 20, -50);  // Bands 0 and 1
+    render_queue_submit(&queue, render_key_make(0, 3, 0, BLIT_MODE_COPY, 0), &tall, 40, 100);  // Bands 3 to 6
+    render_queue_submit(&queue, render_key_make(0, 4, 0, BLIT_MODE_COPY, 0), &small, 60, 240); // Below the screen
+    assert(band_renderer_execute(&renderer, &queue, &framebuffer) == BAND_RENDERER_OK);
+
+    // 240 rows in 8 bands of 30 rows round up to 32-row bands
+    assert(renderer.bandHeight == 32 && renderer.bandCount == 8);
+    assert(renderer.bins[0].count == 3 && renderer.bins[1].count == 2 && renderer.bins[2].count == 0);
+    for (uint32_t band = 3; band <= 6; band++) {
+        assert(renderer.bins[band].count == 1);
+    }
+    assert(renderer.bins[7].count == 0);
+
+    // Band 1's copy of the second draw is relative to the band's first row
+    const BlitDraw* draw = &renderer.draws[renderer.bins[1].start];
+    assert(draw->bitmap == &small && draw->y == 29 - 32);
+
+    assert(framebuffer_get_pixel(&framebuffer, 0, 32) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 0, 33) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 20, 49) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 20, 50) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 40, 199) == BITMAP_COLOR_BLACK);
+
+    // A short framebuffer gets fewer bands
+    Framebuffer strip;
+    framebuffer_init(&strip, 64, 20);
+    assert(band_renderer_execute(&renderer, &queue, &strip) == BAND_RENDERER_OK);
+    assert(renderer.bandHeight == 8 && renderer.bandCount == 3);
+
+    framebuffer_destroy(&strip);
+    band_renderer_destroy(&renderer);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == withQueue);
+    render_queue_destroy(&queue);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before);
+    framebuffer_destroy(&framebuffer);
+    bitmap_destroy(&tall);
+    bitmap_destroy(&small);
+    printf("✓ Band binning test passed\n");
+}
+
+// Any band and thread count gives exactly the single-threaded queue's pixels
+void test_bands_match_queue_execute(void) {
+    RenderQueue queue;
+    render_queue_init(&queue, 2048);
+    Bitmap sprites[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        bitmap_init(&sprites[i], 7 + i * 23, 5 + i * 17);
+        test_fill_random_bitmap(&sprites[i], &g_seed);
+    }
+
+    Framebuffer reference, banded;
+    framebuffer_init(&reference, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_init(&banded, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+
+    const uint32_t configs[][2] = {{1, 0}, {3, 0}, {8, 1}, {8, 3}, {30, 4}, {64, 7}};
+    for (uint32_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        BandRenderer renderer;
+        assert(band_renderer_init(&renderer, configs[c][0], configs[c][1]) == BAND_RENDERER_OK);
+
+        for (uint32_t frame = 0; frame < 5; frame++) {
+            render_queue_clear(&queue);
+            uint32_t count = 200 + frame * 350;
+            for (uint32_t i = 0; i < count; i++) {
+                int32_t x = (int32_t)test_random(&g_seed, FRAMEBUFFER_WIDTH + 120) - 60;
+                int32_t y = (int32_t)test_random(&g_seed, FRAMEBUFFER_HEIGHT + 120) - 60;
+                const Bitmap* bitmap = &sprites[test_random(&g_seed, 4)];
+                BlitMode mode = (BlitMode)test_random(&g_seed, 2);
+                render_queue_submit(&queue, render_key_make((uint8_t)test_random(&g_seed, 3), 0, 0, mode, y), bitmap, x, y);
+            }
+
+            framebuffer_clear(&reference, BITMAP_COLOR_WHITE);
+            framebuffer_clear(&banded, BITMAP_COLOR_WHITE);
+            render_queue_execute(&queue, &reference);
+            assert(band_renderer_execute(&renderer, &queue, &banded) == BAND_RENDERER_OK);
+            assert(framebuffer_hash(&reference) == framebuffer_hash(&banded));
+        }
+        band_renderer_destroy(&renderer);
+    }
+
+    for (uint32_t i = 0; i < 4; i++) {
+        bitmap_destroy(&sprites[i]);
+    }
+    framebuffer_destroy(&reference);
+    framebuffer_destroy(&banded);
+    render_queue_destroy(&queue);
+    printf("✓ Bands match queue execute test passed\n");
+}
+
+// The sprite system's whole-screen pass draws through the band renderer
+void test_sprite_system_bands(void) {
+    component_registry_init();
+    transform_component_register();
+    sprite_component_register();
+
+    Scene* scene = scene_create("BandSprites", 200);
+    Bitmap box;
+    bitmap_init(&box, 24, 40);
+    test_fill_random_bitmap(&box, &g_seed);
+    for (uint32_t i = 0; i < 150; i++) {
+        GameObject* object = game_object_create(scene);
+        transform_component_set_position(object->transform, (float)test_random(&g_seed, 440) - 20.0f, (float)test_random(&g_seed, 280) - 20.0f);
+        SpriteComponent* sprite = sprite_component_create(object);
+        sprite_component_set_bitmap(sprite, &box);
+        sprite_component_set_layer(sprite, (uint8_t)(i % 3));
+        game_object_add_component(object, (Component*)sprite);
+    }
+    scene_rebuild_component_arrays(scene);
+
+    Framebuffer reference, banded;
+    framebuffer_init(&reference, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_init(&banded, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_clear(&reference, BITMAP_COLOR_WHITE);
+    framebuffer_clear(&banded, BITMAP_COLOR_WHITE);
+
+    framebuffer_set_render_target(&reference);
+    scene_render_sprites(scene);
+
+    BandRenderer renderer;
+    band_renderer_init(&renderer, 6, 2);
+    sprite_system_set_band_renderer(&renderer);
+    framebuffer_set_render_target(&banded);
+    scene_render_sprites(scene);
+    assert(renderer.bandCount == 6 && renderer.bins[0].count > 0);
+    assert(framebuffer_hash(&reference) == framebuffer_hash(&banded));
+
+    framebuffer_set_render_target(NULL);
+    sprite_system_shutdown();
+    band_renderer_destroy(&renderer);
+    framebuffer_destroy(&reference);
+    framebuffer_destroy(&banded);
+    bitmap_destroy(&box);
+    scene_destroy(scene);
+    component_registry_shutdown();
+    printf("✓ Sprite system band rendering test passed\n");
+}
+
+int run_band_renderer_tests(void) {
+    printf("Running band renderer tests...\n");
+
+    test_band_renderer_init();
+    test_band_binning();
+    test_bands_match_queue_execute();
+    test_sprite_system_bands();
+
+    printf("All band renderer tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_band_renderer_tests();
+}
+#endif
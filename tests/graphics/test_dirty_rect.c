@@ -0,0 +1,222 @@
+#include "../../src/graphics/dirty_rect.h"
+#include "../../src/components/sprite_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint32_t g_seed = 64;
+
+void test_dirty_rect_spans_and_regions(void) {
+    DirtyRectTracker tracker;
+    assert(dirty_rect_tracker_init(NULL, 400, 240) == DIRTY_RECT_ERROR_NULL_POINTER);
+    assert(dirty_rect_tracker_init(&tracker, 0, 240) == DIRTY_RECT_ERROR_INVALID_SIZE);
+    assert(dirty_rect_tracker_init(&tracker, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) == DIRTY_RECT_OK);
+    assert(tracker.wordsPerRow == 7);
+
+    // The first pass redraws the whole screen as one region
+    dirty_rect_tracker_begin(&tracker);
+    assert(dirty_rect_tracker_build_regions(&tracker) == 1);
+    assert(tracker.regions[0].y1 == FRAMEBUFFER_HEIGHT && tracker.regions[0].wordEnd == 7);
+    assert(tracker.dirtyRows == FRAMEBUFFER_HEIGHT);
+
+    // Nothing added: nothing dirty
+    dirty_rect_tracker_begin(&tracker);
+    assert(dirty_rect_tracker_build_regions(&tracker) == 0);
+    assert(!dirty_rect_tracker_is_row_dirty(&tracker, 0));
+
+    // Rectangles widen to words and rows with equal spans merge;
+    // overlapping rectangles split into bands
+    dirty_rect_tracker_begin(&tracker);
+    dirty_rect_tracker_add(&tracker, 70, 10, 10, 20);            // Word 1, rows 10-29
+    dirty_rect_tracker_add(&tracker, 120, 20, 20, 20);           // Words 1-2, rows 20-39
+    dirty_rect_tracker_add(&tracker, -50, -50, 10, 10);          // Off screen
+    dirty_rect_tracker_add(&tracker, 390, 235, 50, 50);          // Clipped to the corner
+    assert(dirty_rect_tracker_build_regions(&tracker) == 3);
+    const DirtyRegion* r = tracker.regions;
+    assert(r[0].y0 == 10 && r[0].y1 == 20 && r[0].wordStart == 1 && r[0].wordEnd == 2);
+    assert(r[1].y0 == 20 && r[1].y1 == 40 && r[1].wordStart == 1 && r[1].wordEnd == 3);
+    assert(r[2].y0 == 235 && r[2].y1 == 240 && r[2].wordStart == 6 && r[2].wordEnd == 7);
+    assert(tracker.dirtyRows == 30 + 5);
+    assert(dirty_rect_tracker_is_row_dirty(&tracker, 39) && !dirty_rect_tracker_is_row_dirty(&tracker, 40));
+
+    dirty_rect_tracker_destroy(&tracker);
+    dirty_rect_tracker_destroy(&tracker);
+    printf("✓ Dirty rect spans and regions test passed\n");
+}
+
+void test_dirty_rect_export_rows(void) {
+    DirtyRectTracker tracker;
+    dirty_rect_tracker_init(&tracker, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    framebuffer_set_pixel(&framebuffer, 0, 5, BITMAP_COLOR_BLACK);
+    framebuffer_set_pixel(&framebuffer, 0, 6, BITMAP_COLOR_BLACK);
+
+    static uint8_t rows[FRAMEBUFFER_HEIGHT * FRAMEBUFFER_ROW_BYTES];
+    memset(rows, 0xAA, sizeof(rows));
+    dirty_rect_tracker_begin(&tracker);                          // Consumes the initial full redraw
+    dirty_rect_tracker_begin(&tracker);
+    dirty_rect_tracker_add(&tracker, 300, 5, 1, 1);
+    dirty_rect_tracker_build_regions(&tracker);
+
+    // Only row 5 is written, all of it
+    assert(dirty_rect_tracker_export_rows(&tracker, &framebuffer, rows, FRAMEBUFFER_ROW_BYTES) == 1);
+    assert(rows[5 * FRAMEBUFFER_ROW_BYTES] == 0x7F && rows[5 * FRAMEBUFFER_ROW_BYTES + 49] == 0xFF);
+    assert(rows[5 * FRAMEBUFFER_ROW_BYTES + 50] == 0);
+    assert(rows[6 * FRAMEBUFFER_ROW_BYTES] == 0xAA && rows[4 * FRAMEBUFFER_ROW_BYTES] == 0xAA);
+
+    framebuffer_destroy(&framebuffer);
+    dirty_rect_tracker_destroy(&tracker);
+    printf("✓ Dirty row export test passed\n");
+}
+
+void test_framebuffer_views(void) {
+    Framebuffer framebuffer, view;
+    framebuffer_init(&framebuffer, 100, 10);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_BLACK);
+
+    assert(framebuffer_init_view(&view, &framebuffer, 10, 0, 10, 10) == FRAMEBUFFER_ERROR_INVALID_SIZE);
+    assert(framebuffer_init_view(&view, &framebuffer, 0, 8, 10, 3) == FRAMEBUFFER_ERROR_INVALID_SIZE);
+
+    // Ends at the parent's right edge: keeps its partial last word
+    assert(framebuffer_init_view(&view, &framebuffer, 64, 2, 500, 3) == FRAMEBUFFER_OK);
+    assert(view.width == 36 && view.stride == framebuffer.wordsPerRow);
+    framebuffer_clear(&view, BITMAP_COLOR_WHITE);
+    framebuffer_set_pixel(&view, 0, 0, BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 64, 2) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 99, 4) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 63, 3) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 70, 5) == BITMAP_COLOR_BLACK);
+    assert((framebuffer.words[3 * framebuffer.wordsPerRow + 1] & ~framebuffer.lastWordMask) == 0);
+
+    // Blits are clipped to the view
+    Bitmap bitmap;
+    bitmap_init(&bitmap, 80, 8);
+    bitmap_fill(&bitmap, BITMAP_COLOR_WHITE);
+    assert(framebuffer_init_view(&view, &framebuffer, 0, 6, 64, 2) == FRAMEBUFFER_OK);
+    framebuffer_blit(&view, &bitmap, -5, -3);
+    assert(framebuffer_get_pixel(&framebuffer, 63, 7) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 64, 7) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 0, 8) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 0, 5) == BITMAP_COLOR_BLACK);
+
+    bitmap_destroy(&bitmap);
+    framebuffer_destroy(&framebuffer);
+    printf("✓ Framebuffer view test passed\n");
+}
+
+// Redrawing only dirty regions must give the same pixels as a full redraw
+void test_dirty_pass_matches_full_redraw(void) {
+    component_registry_init();
+    transform_component_register();
+    sprite_component_register();
+
+    Scene* scene = scene_create("DirtySprites", 100);
+    Framebuffer framebuffer, reference;
+    framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_init(&reference, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    DirtyRectTracker tracker;
+    dirty_rect_tracker_init(&tracker, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+
+    Bitmap box, ring;
+    bitmap_init(&box, 12, 12);
+    bitmap_init(&ring, 30, 20);
+    bitmap_fill(&box, BITMAP_COLOR_BLACK);
+    bitmap_fill(&ring, BITMAP_COLOR_BLACK);
+    for (int32_t y = 4; y < 16; y++) {
+        for (int32_t x = 6; x < 24; x++) {
+            bitmap_clear_pixel(&ring, x, y);
+        }
+    }
+
+    GameObject* objects[60];
+    SpriteComponent* sprites[60];
+    for (uint32_t i = 0; i < 60; i++) {
+        objects[i] = game_object_create(scene);
+        transform_component_set_position(objects[i]->transform, test_random_float(&g_seed, 440.0f) - 20.0f, test_random_float(&g_seed, 280.0f) - 20.0f);
+        sprites[i] = sprite_component_create(objects[i]);
+        sprite_component_set_bitmap(sprites[i], i % 3 ? &box : &ring);
+        sprite_component_set_layer(sprites[i], (uint8_t)(i % 2));
+        game_object_add_component(objects[i], (Component*)sprites[i]);
+    }
+    scene_rebuild_component_arrays(scene);
+
+    for (uint32_t frame = 0; frame < 12; frame++) {
+        // Frame 3 is static; others move, hide, swap or remove a few sprites
+        if (frame != 3 && frame > 0) {
+            for (uint32_t k = 0; k < 4; k++) {
+                uint32_t i = (uint32_t)test_random_float(&g_seed, 60.0f);
+                if (!sprites[i]) continue;
+                transform_component_translate(objects[i]->transform, test_random_float(&g_seed, 40.0f) - 20.0f, test_random_float(&g_seed, 20.0f) - 10.0f);
+            }
+            uint32_t i = frame * 5 % 60;
+            if (sprites[i]) {
+                sprite_component_set_visible(sprites[i], frame % 2 == 0);
+                sprite_component_set_bitmap(sprites[(i + 1) % 60] ? sprites[(i + 1) % 60] : sprites[i], &ring);
+            }
+        }
+        if (frame == 7) {
+            game_object_remove_component(objects[10], COMPONENT_TYPE_SPRITE);
+            sprites[10] = NULL;
+            scene_rebuild_component_arrays(scene);
+        }
+
+        framebuffer_set_render_target(&framebuffer);
+        uint32_t blits = sprite_system_render_dirty(scene, &tracker);
+        if (frame == 3) {
+            assert(blits == 0 && tracker.regionCount == 0 && tracker.dirtyRows == 0);
+        } else {
+            assert(tracker.regionCount > 0);
+        }
+
+        framebuffer_clear(&reference, BITMAP_COLOR_WHITE);
+        framebuffer_set_render_target(&reference);
+        scene_render_sprites(scene);
+        assert(framebuffer_hash(&framebuffer) == framebuffer_hash(&reference));
+    }
+
+    // A single moved sprite dirties only rows covering its old and new bounds
+    transform_component_set_position(objects[20]->transform, 200.0f, 100.0f);
+    framebuffer_set_render_target(&framebuffer);
+    sprite_system_render_dirty(scene, &tracker);
+    transform_component_set_position(objects[20]->transform, 200.0f, 130.0f);
+    sprite_system_render_dirty(scene, &tracker);
+    uint32_t height = sprites[20]->bitmap->height;
+    assert(tracker.dirtyRows == 2 * height);
+    assert(dirty_rect_tracker_is_row_dirty(&tracker, 100) && dirty_rect_tracker_is_row_dirty(&tracker, 130));
+
+    dirty_rect_tracker_destroy(&tracker);
+    framebuffer_destroy(&framebuffer);
+    framebuffer_destroy(&reference);
+    bitmap_destroy(&box);
+    bitmap_destroy(&ring);
+    scene_destroy(scene);
+    sprite_system_shutdown();
+    component_registry_shutdown();
+    printf("✓ Dirty sprite pass matches full redraw test passed\n");
+}
+
+int run_dirty_rect_tests(void) {
+    printf("Running dirty rect tests...\n");
+
+    test_dirty_rect_spans_and_regions();
+    test_dirty_rect_export_rows();
+    test_framebuffer_views();
+    test_dirty_pass_matches_full_redraw();
+
+    printf("All dirty rect tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_dirty_rect_tests();
+}
+#endif
@@ -0,0 +1,240 @@
+#include "../../src/graphics/dither.h"
+#include "../../src/core/memory_budget.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t g_seed = 2718;
+
+static uint32_t count_white(const Bitmap* bitmap) {
+    uint32_t white = 0;
+    for (uint32_t y = 0; y < bitmap->height; y++) {
+        for (uint32_t x = 0; x < bitmap->width; x++) {
+            white += bitmap_get_pixel(bitmap, (int32_t)x, (int32_t)y) == BITMAP_COLOR_WHITE;
+        }
+    }
+    return white;
+}
+
+static bool bitmaps_equal(const Bitmap* a, const Bitmap* b) {
+    if (a->width != b->width || a->height != b->height) return false;
+    for (uint32_t y = 0; y < a->height; y++) {
+        if (memcmp(bitmap_row_pixels(a, y), bitmap_row_pixels(b, y), a->wordsPerRow * sizeof(uint64_t)) != 0 ||
+            memcmp(bitmap_row_mask(a, y), bitmap_row_mask(b, y), a->wordsPerRow * sizeof(uint64_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Bits past the width must stay clear in both planes
+static bool row_tails_clear(const Bitmap* bitmap) {
+    uint32_t bits = bitmap->width % BITMAP_WORD_BITS;
+    if (bits == 0) return true;
+    uint64_t outside = ~((UINT64_C(1) << bits) - 1);
+    for (uint32_t y = 0; y < bitmap->height; y++) {
+        uint32_t last = bitmap->wordsPerRow - 1;
+        if ((bitmap_row_pixels(bitmap, y)[last] | bitmap_row_mask(bitmap, y)[last]) & outside) return false;
+    }
+    return true;
+}
+
+void test_dither_arguments_and_extremes(void) {
+    uint8_t gray[70 * 3];
+    GrayImage image = {gray, NULL, 70, 3, 70};
+    Bitmap bitmap;
+
+    assert(dither_image(NULL, DITHER_BAYER_4X4, &bitmap) == DITHER_ERROR_NULL_POINTER);
+    image.stride = 69;
+    assert(dither_image(&image, DITHER_BAYER_4X4, &bitmap) == DITHER_ERROR_INVALID_SIZE);
+    image.stride = 70;
+    assert(dither_image(&image, DITHER_METHOD_COUNT, &bitmap) == DITHER_ERROR_INVALID_METHOD);
+    bitmap_init(&bitmap, 71, 3);
+    assert(dither_convert(&image, DITHER_BAYER_4X4, DITHER_KERNEL_SCALAR, &bitmap) == DITHER_ERROR_INVALID_SIZE);
+    bitmap_destroy(&bitmap);
+    assert(dither_kernel_is_supported(DITHER_KERNEL_SCALAR));
+    assert(dither_kernel_is_supported(dither_kernel_best()));
+
+    // Black stays black and white stays white under every method
+    for (uint32_t level = 0; level < 2; level++) {
+        memset(gray, level ? 255 : 0, sizeof(gray));
+        for (int method = 0; method < DITHER_METHOD_COUNT; method++) {
+            assert(dither_image(&image, (DitherMethod)method, &bitmap) == DITHER_OK);
+            assert(count_white(&bitmap) == (level ? 70u * 3u : 0u));
+            assert(bitmap_is_opaque(&bitmap, 69, 2) && row_tails_clear(&bitmap));
+            bitmap_destroy(&bitmap);
+        }
+    }
+    printf("✓ Dither arguments and extremes test passed\n");
+}
+
+// Each threshold is used once per tile, so a flat gray level turns exactly
+// the matching number of tile pixels white
+void test_bayer_tiles(void) {
+    uint8_t gray[64 * 64];
+    GrayImage image = {gray, NULL, 64, 64, 64};
+    for (uint32_t level = 0; level < 256; level += 15) {
+        memset(gray, (int)level, sizeof(gray));
+
+        Bitmap bitmap;
+        dither_image(&image, DITHER_BAYER_4X4, &bitmap);
+        uint32_t expected4 = 0;
+        for (uint32_t b = 0; b < 16; b++) expected4 += level > b * 16 + 8;
+        assert(count_white(&bitmap) == expected4 * 256);
+        bitmap_destroy(&bitmap);
+
+        dither_image(&image, DITHER_BAYER_8X8, &bitmap);
+        uint32_t expected8 = 0;
+        for (uint32_t b = 0; b < 64; b++) expected8 += level > b * 4 + 2;
+        assert(count_white(&bitmap) == expected8 * 64);
+        bitmap_destroy(&bitmap);
+    }
+    printf("✓ Bayer tile coverage test passed\n");
+}
+
+// The SIMD kernel matches the scalar one bit for bit, including row tails
+void test_dither_kernels_match(void) {
+    const uint32_t widths[] = {1, 15, 63, 64, 65, 100, 130, 400, 600};
+    for (uint32_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+        uint32_t width = widths[w], height = 11, stride = width + 5;
+        uint8_t* gray = malloc(stride * height);
+        uint8_t* alpha = malloc(stride * height);
+        for (uint32_t i = 0; i < stride * height; i++) {
+            gray[i] = (uint8_t)test_random(&g_seed, 256);
+            alpha[i] = (uint8_t)test_random(&g_seed, 256);
+        }
+        GrayImage image = {gray, alpha, width, height, stride};
+
+        for (int method = 0; method < DITHER_METHOD_COUNT; method++) {
+            Bitmap scalar, best;
+            bitmap_init(&scalar, width, height);
+            assert(dither_convert(&image, (DitherMethod)method, DITHER_KERNEL_SCALAR, &scalar) == DITHER_OK);
+            assert(dither_image(&image, (DitherMethod)method, &best) == DITHER_OK);
+            assert(bitmaps_equal(&scalar, &best));
+            assert(row_tails_clear(&best));
+
+            // Alpha below 128 is transparent, and transparent pixels are black
+            for (uint32_t y = 0; y < height; y++) {
+                for (uint32_t x = 0; x < width; x++) {
+                    bool opaque = alpha[y * stride + x] >= 128;
+                    assert(bitmap_is_opaque(&best, (int32_t)x, (int32_t)y) == opaque);
+                    if (!opaque) assert(bitmap_get_pixel(&best, (int32_t)x, (int32_t)y) == BITMAP_COLOR_BLACK);
+                }
+            }
+            bitmap_destroy(&scalar);
+            bitmap_destroy(&best);
+        }
+        free(gray);
+        free(alpha);
+    }
+    printf("✓ Dither kernels match test passed\n");
+}
+
+// Error diffusion keeps the average brightness of flat and graded areas
+void test_error_diffusion_preserves_tone(void) {
+    const uint32_t size = 128;
+    uint8_t* gray = malloc(size * size);
+    GrayImage image = {gray, NULL, size, size, size};
+    const uint8_t levels[] = {32, 64, 128, 192, 230};
+
+    for (uint32_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        memset(gray, levels[l], size * size);
+        Bitmap bitmap;
+        dither_image(&image, DITHER_FLOYD_STEINBERG, &bitmap);
+        double fraction = (double)count_white(&bitmap) / (size * size);
+        double target = levels[l] / 255.0;
+        assert(fraction > target - 0.01 && fraction < target + 0.01);
+        bitmap_destroy(&bitmap);
+
+        // Atkinson drops a quarter of the error, so mid-tones drift outwards
+        dither_image(&image, DITHER_ATKINSON, &bitmap);
+        fraction = (double)count_white(&bitmap) / (size * size);
+        assert(fraction > target - 0.15 && fraction < target + 0.15);
+        bitmap_destroy(&bitmap);
+    }
+
+    // A horizontal ramp gets brighter from left to right
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) {
+            gray[y * size + x] = (uint8_t)(x * 2);
+        }
+    }
+    Bitmap bitmap;
+    dither_image(&image, DITHER_FLOYD_STEINBERG, &bitmap);
+    uint32_t leftWhite = 0, rightWhite = 0;
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size / 4; x++) {
+            leftWhite += bitmap_get_pixel(&bitmap, (int32_t)x, (int32_t)y) == BITMAP_COLOR_WHITE;
+            rightWhite += bitmap_get_pixel(&bitmap, (int32_t)(size - 1 - x), (int32_t)y) == BITMAP_COLOR_WHITE;
+        }
+    }
+    assert(leftWhite < rightWhite / 4);
+    bitmap_destroy(&bitmap);
+    free(gray);
+    printf("✓ Error diffusion tone test passed\n");
+}
+
+void test_dither_cache(void) {
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    DitherCache cache;
+    assert(dither_cache_init(&cache, 0) == DITHER_ERROR_INVALID_SIZE);
+    assert(dither_cache_init(&cache, 2) == DITHER_OK);
+    uint32_t afterInit = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+
+    uint8_t gray[40 * 20];
+    for (uint32_t i = 0; i < sizeof(gray); i++) gray[i] = (uint8_t)(i * 7);
+    GrayImage image = {gray, NULL, 40, 20, 40};
+    uint64_t ship = dither_asset_key("sprites/ship.png");
+    uint64_t rock = dither_asset_key("sprites/rock.png");
+    assert(ship != rock && ship == dither_asset_key("sprites/ship.png"));
+
+    // Lookup only: a miss without an image converts nothing
+    const Bitmap* bitmap = NULL;
+    assert(dither_cache_get(&cache, ship, DITHER_BAYER_8X8, NULL, &bitmap) == DITHER_ERROR_NULL_POINTER);
+    assert(bitmap == NULL && cache.conversions == 0);
+
+    // Converted once, then served from the cache at the same address
+    assert(dither_cache_get(&cache, ship, DITHER_BAYER_8X8, &image, &bitmap) == DITHER_OK);
+    const Bitmap* first = bitmap;
+    Bitmap direct;
+    dither_image(&image, DITHER_BAYER_8X8, &direct);
+    assert(bitmaps_equal(first, &direct));
+    bitmap_destroy(&direct);
+    for (uint32_t i = 0; i < 5; i++) {
+        assert(dither_cache_get(&cache, ship, DITHER_BAYER_8X8, i % 2 ? &image : NULL, &bitmap) == DITHER_OK);
+        assert(bitmap == first);
+    }
+    assert(cache.conversions == 1 && cache.hits == 5);
+    assert(cache.usedBytes > 0 && memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == afterInit + cache.usedBytes);
+
+    // Another method of the same asset is its own entry; the cache then fills up
+    assert(dither_cache_get(&cache, ship, DITHER_ATKINSON, &image, &bitmap) == DITHER_OK);
+    assert(bitmap != first && cache.count == 2);
+    assert(dither_cache_get(&cache, rock, DITHER_ATKINSON, &image, &bitmap) == DITHER_ERROR_FULL);
+    assert(dither_cache_get(&cache, ship, DITHER_BAYER_8X8, NULL, &bitmap) == DITHER_OK && bitmap == first);
+
+    dither_cache_destroy(&cache);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before);
+    printf("✓ Dither cache test passed\n");
+}
+
+int run_dither_tests(void) {
+    printf("Running dither tests...\n");
+
+    test_dither_arguments_and_extremes();
+    test_bayer_tiles();
+    test_dither_kernels_match();
+    test_error_diffusion_preserves_tone();
+    test_dither_cache();
+
+    printf("All dither tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_dither_tests();
+}
+#endif
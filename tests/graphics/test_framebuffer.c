@@ -0,0 +1,198 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../src/graphics/framebuffer.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint32_t g_seed = 2024;
+
+// Pixel-by-pixel reference blit
+static void reference_blit(Framebuffer* framebuffer, const Bitmap* bitmap, int32_t x, int32_t y, BlitMode mode) {
+    for (int32_t by = 0; by < (int32_t)bitmap->height; by++) {
+        for (int32_t bx = 0; bx < (int32_t)bitmap->width; bx++) {
+            if (bitmap_is_opaque(bitmap, bx, by)) {
+                BitmapColor color = bitmap_get_pixel(bitmap, bx, by);
+                if (mode == BLIT_MODE_INVERTED) {
+                    color = color == BITMAP_COLOR_WHITE ? BITMAP_COLOR_BLACK : BITMAP_COLOR_WHITE;
+                }
+                framebuffer_set_pixel(framebuffer, x + bx, y + by, color);
+            }
+        }
+    }
+}
+
+void test_bitmap_pixels(void) {
+    Bitmap bitmap;
+    assert(bitmap_init(NULL, 8, 8) == BITMAP_ERROR_NULL_POINTER);
+    assert(bitmap_init(&bitmap, 0, 8) == BITMAP_ERROR_INVALID_SIZE);
+    assert(bitmap_init(&bitmap, 70, 3) == BITMAP_OK);
+    assert(bitmap.wordsPerRow == 2 && bitmap.stride == 3);
+
+    // New bitmaps are transparent
+    assert(!bitmap_is_opaque(&bitmap, 0, 0));
+
+    bitmap_set_pixel(&bitmap, 69, 2, BITMAP_COLOR_WHITE);
+    bitmap_set_pixel(&bitmap, 3, 1, BITMAP_COLOR_BLACK);
+    assert(bitmap_get_pixel(&bitmap, 69, 2) == BITMAP_COLOR_WHITE && bitmap_is_opaque(&bitmap, 69, 2));
+    assert(bitmap_get_pixel(&bitmap, 3, 1) == BITMAP_COLOR_BLACK && bitmap_is_opaque(&bitmap, 3, 1));
+    bitmap_set_pixel(&bitmap, 70, 0, BITMAP_COLOR_WHITE);       // Ignored
+    bitmap_clear_pixel(&bitmap, 69, 2);
+    assert(!bitmap_is_opaque(&bitmap, 69, 2) && bitmap_get_pixel(&bitmap, 69, 2) == BITMAP_COLOR_BLACK);
+
+    // Fill keeps bits past the width clear, guard words stay zero
+    bitmap_fill(&bitmap, BITMAP_COLOR_WHITE);
+    assert(bitmap_row_mask(&bitmap, 1)[1] == (UINT64_C(1) << 6) - 1);
+    assert(bitmap_row_pixels(&bitmap, 1)[-1] == 0 && bitmap_row_pixels(&bitmap, 2)[2] == 0);
+
+    bitmap_destroy(&bitmap);
+    assert(bitmap.storage == NULL);
+    printf("✓ Bitmap pixel test passed\n");
+}
+
+void test_framebuffer_basics(void) {
+    Framebuffer framebuffer;
+    assert(framebuffer_init(&framebuffer, 0, 240) == FRAMEBUFFER_ERROR_INVALID_SIZE);
+    assert(framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) == FRAMEBUFFER_OK);
+    assert(framebuffer.wordsPerRow == 7 && framebuffer.lastWordMask == 0xFFFF);
+    assert(framebuffer.kernel == blit_kernel_best());
+
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 399, 239) == BITMAP_COLOR_WHITE);
+    framebuffer_set_pixel(&framebuffer, 0, 0, BITMAP_COLOR_BLACK);
+    framebuffer_set_pixel(&framebuffer, 9, 1, BITMAP_COLOR_BLACK);
+    framebuffer_set_pixel(&framebuffer, 400, 0, BITMAP_COLOR_BLACK);   // Ignored
+    assert(framebuffer_get_pixel(&framebuffer, 0, 0) == BITMAP_COLOR_BLACK);
+
+    // Display rows: 52 bytes, first pixel in the most significant bit
+    static uint8_t rows[FRAMEBUFFER_HEIGHT * FRAMEBUFFER_ROW_BYTES];
+    framebuffer_export_rows(&framebuffer, rows, FRAMEBUFFER_ROW_BYTES);
+    assert(rows[0] == 0x7F && rows[1] == 0xFF);
+    assert(rows[FRAMEBUFFER_ROW_BYTES + 1] == 0xBF);
+    assert(rows[49] == 0xFF && rows[50] == 0 && rows[51] == 0);
+
+    char pbm[16 + FRAMEBUFFER_HEIGHT * 50];
+    FILE* out = fmemopen(pbm, sizeof(pbm), "w");
+    assert(framebuffer_write_pbm(&framebuffer, out));
+    long size = ftell(out);
+    fclose(out);
+    assert(memcmp(pbm, "P4\n400 240\n", 11) == 0);
+    assert(size == 11 + FRAMEBUFFER_HEIGHT * 50);
+    assert((uint8_t)pbm[11] == 0x80);                            // PBM: 1 = black
+
+    // The hash ignores padding bits and changes with the pixels
+    uint64_t hash = framebuffer_hash(&framebuffer);
+    framebuffer.words[6] |= UINT64_C(1) << 40;
+    assert(framebuffer_hash(&framebuffer) == hash);
+    framebuffer_set_pixel(&framebuffer, 1, 0, BITMAP_COLOR_BLACK);
+    assert(framebuffer_hash(&framebuffer) != hash);
+
+    assert(framebuffer_set_blit_kernel(&framebuffer, BLIT_KERNEL_COUNT) == FRAMEBUFFER_ERROR_UNSUPPORTED);
+    framebuffer_set_render_target(&framebuffer);
+    framebuffer_destroy(&framebuffer);
+    assert(framebuffer_get_render_target() == NULL);
+    printf("✓ Framebuffer basics test passed\n");
+}
+
+// Every kernel must match the per-pixel reference, including clipped blits
+void test_blit_kernels_match_reference(void) {
+    Framebuffer expected, actual;
+    framebuffer_init(&expected, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_init(&actual, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+
+    static const uint32_t widths[] = {1, 7, 16, 31, 32, 33, 63, 64, 65, 100, 129, 400, 450};
+    uint32_t checked = 0;
+
+    for (uint32_t kernel = 0; kernel < BLIT_KERNEL_COUNT; kernel++) {
+        if (!blit_kernel_is_supported((BlitKernel)kernel)) continue;
+        assert(framebuffer_set_blit_kernel(&actual, (BlitKernel)kernel) == FRAMEBUFFER_OK);
+
+        for (uint32_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+            Bitmap bitmap;
+            bitmap_init(&bitmap, widths[w], 1 + test_random(&g_seed, 40));
+            test_fill_random_bitmap(&bitmap, &g_seed);
+
+            for (int trial = 0; trial < 24; trial++) {
+                int32_t x = (int32_t)test_random(&g_seed, FRAMEBUFFER_WIDTH + 2 * bitmap.width) - (int32_t)bitmap.width;
+                int32_t y = (int32_t)test_random(&g_seed, FRAMEBUFFER_HEIGHT + 2 * bitmap.height) - (int32_t)bitmap.height;
+                if (trial < 4) {
+                    // Edges: straddling left, right, top and bottom
+                    x = trial == 0 ? -3 : trial == 1 ? FRAMEBUFFER_WIDTH - 5 : x;
+                    y = trial == 2 ? -2 : trial == 3 ? FRAMEBUFFER_HEIGHT - 1 : y;
+                }
+
+                BitmapColor background = trial & 1 ? BITMAP_COLOR_WHITE : BITMAP_COLOR_BLACK;
+                BlitMode mode = trial & 2 ? BLIT_MODE_INVERTED : BLIT_MODE_COPY;
+                framebuffer_clear(&expected, background);
+                framebuffer_clear(&actual, background);
+                reference_blit(&expected, &bitmap, x, y, mode);
+                framebuffer_blit_mode(&actual, &bitmap, x, y, mode);
+
+                if (memcmp(expected.words, actual.words, 7 * FRAMEBUFFER_HEIGHT * sizeof(uint64_t)) != 0) {
+                    printf("Mismatch: kernel %s, mode %d, bitmap %ux%u at (%d, %d)\n",
+                           blit_kernel_to_string((BlitKernel)kernel), mode, bitmap.width, bitmap.height, x, y);
+                    assert(0);
+                }
+                checked++;
+            }
+            bitmap_destroy(&bitmap);
+        }
+    }
+
+    assert(checked > 0);
+    framebuffer_destroy(&expected);
+    framebuffer_destroy(&actual);
+    printf("✓ Blit kernels match reference test passed (%u blits)\n", checked);
+}
+
+void test_blit_offscreen_and_odd_sizes(void) {
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, 100, 10);                    // Partial last word in both widths
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_BLACK);
+    uint64_t blank = framebuffer_hash(&framebuffer);
+
+    Bitmap bitmap;
+    bitmap_init(&bitmap, 20, 4);
+    bitmap_fill(&bitmap, BITMAP_COLOR_WHITE);
+
+    for (uint32_t kernel = 0; kernel < BLIT_KERNEL_COUNT; kernel++) {
+        if (framebuffer_set_blit_kernel(&framebuffer, (BlitKernel)kernel) != FRAMEBUFFER_OK) continue;
+
+        framebuffer_blit(&framebuffer, &bitmap, -20, 0);
+        framebuffer_blit(&framebuffer, &bitmap, 100, 0);
+        framebuffer_blit(&framebuffer, &bitmap, 0, -4);
+        framebuffer_blit(&framebuffer, &bitmap, 0, 10);
+        framebuffer_blit(&framebuffer, NULL, 0, 0);
+        assert(framebuffer_hash(&framebuffer) == blank);
+
+        // Straddling the right edge never touches padding bits
+        framebuffer_blit(&framebuffer, &bitmap, 90, 8);
+        assert(framebuffer_get_pixel(&framebuffer, 99, 9) == BITMAP_COLOR_WHITE);
+        assert(framebuffer_get_pixel(&framebuffer, 89, 9) == BITMAP_COLOR_BLACK);
+        assert((framebuffer.words[9 * framebuffer.wordsPerRow + 1] & ~framebuffer.lastWordMask) == 0);
+        framebuffer_clear(&framebuffer, BITMAP_COLOR_BLACK);
+    }
+
+    bitmap_destroy(&bitmap);
+    framebuffer_destroy(&framebuffer);
+    printf("✓ Offscreen blit test passed\n");
+}
+
+int run_framebuffer_tests(void) {
+    printf("Running framebuffer tests...\n");
+
+    test_bitmap_pixels();
+    test_framebuffer_basics();
+    test_blit_kernels_match_reference();
+    test_blit_offscreen_and_odd_sizes();
+
+    printf("All framebuffer tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_framebuffer_tests();
+}
+#endif
@@ -0,0 +1,70 @@
+#include <stdio.h>
+
+// External test function declarations
+extern int run_framebuffer_tests(void);
+extern int run_sprite_rendering_tests(void);
+extern int run_render_queue_tests(void);
+extern int run_dirty_rect_tests(void);
+extern int run_atlas_tests(void);
+extern int run_band_renderer_tests(void);
+extern int run_dither_tests(void);
+extern int run_tilemap_tests(void);
+extern int run_animation_tests(void);
+extern int run_particle_tests(void);
+
+int main(void) {
+    printf("=== Playdate Engine Graphics Test Suite ===\n\n");
+
+    int total_failures = 0;
+
+    printf("PHASE 6.1: Framebuffer Tests\n");
+    printf("============================\n");
+    total_failures += run_framebuffer_tests();
+
+    printf("PHASE 6.2: Sprite Rendering Tests\n");
+    printf("=================================\n");
+    total_failures += run_sprite_rendering_tests();
+
+    printf("PHASE 6.3: Render Queue Tests\n");
+    printf("=============================\n");
+    total_failures += run_render_queue_tests();
+
+    printf("PHASE 6.4: Dirty Rect Tests\n");
+    printf("===========================\n");
+    total_failures += run_dirty_rect_tests();
+
+    printf("PHASE 6.5: Atlas and Sprite Cache Tests\n");
+    printf("=======================================\n");
+    total_failures += run_atlas_tests();
+
+    printf("PHASE 6.6: Band Renderer Tests\n");
+    printf("==============================\n");
+    total_failures += run_band_renderer_tests();
+
+    printf("PHASE 6.7: Dither Tests\n");
+    printf("=======================\n");
+    total_failures += run_dither_tests();
+
+    printf("PHASE 6.8: Tilemap Tests\n");
+    printf("========================\n");
+    total_failures += run_tilemap_tests();
+
+    printf("PHASE 6.9: Animation Tests\n");
+    printf("==========================\n");
+    total_failures += run_animation_tests();
+
+    printf("PHASE 6.10: Particle Tests\n");
+    printf("==========================\n");
+    total_failures += run_particle_tests();
+
+    // Summary
+    printf("=== Test Suite Summary ===\n");
+    if (total_failures == 0) {
+        printf("🎉 ALL GRAPHICS TESTS PASSED! 🎉\n");
+    } else {
+        printf("❌ %d test(s) failed\n", total_failures);
+    }
+    printf("===========================\n\n");
+
+    return total_failures;
+}
@@ -0,0 +1,370 @@
+#include "../../src/components/particle_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/memory_budget.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/scene_manager.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PARTICLES 37          // Nine PARTICLE_LANES groups and a one-particle tail
+
+static ParticleComponent* add_emitter(TestScene* test) {
+    GameObject* object = test_scene_add(test, 0.0f, 0.0f);
+    ParticleComponent* particles = particle_component_create(object);
+    assert(particles && particle_component_is_particles((Component*)particles));
+    return (ParticleComponent*)test_scene_attach(test, (Component*)particles);
+}
+
+void test_particle_storage(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+
+    assert(particle_component_set_capacity(NULL, 10) == PARTICLE_ERROR_NULL_POINTER);
+    assert(particle_component_set_capacity(particles, 0) == PARTICLE_ERROR_INVALID_CAPACITY);
+    assert(particle_component_set_capacity(particles, PARTICLE_MAX_CAPACITY + 1) == PARTICLE_ERROR_INVALID_CAPACITY);
+    assert(!particle_component_spawn(particles, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f));    // No pool yet
+
+    // 20 bytes per particle, whole SIMD groups, charged to the scene
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    assert(particle_component_set_capacity(particles, 10) == PARTICLE_OK);
+    assert(particles->capacity == 12 && particles->storageBytes == 12 * 5 * sizeof(float));
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before + particles->storageBytes);
+
+    // Spawning stops when the pool is full; dead-on-arrival particles are refused
+    assert(!particle_component_spawn(particles, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+    for (uint32_t i = 0; i < 12; i++) {
+        assert(particle_component_spawn(particles, (float)i, 0.0f, 0.0f, 0.0f, 1.0f));
+    }
+    assert(!particle_component_spawn(particles, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f));
+    assert(particle_component_emit(particles, 5) == 0);
+    particle_component_clear(particles);
+    assert(particles->count == 0 && particle_component_emit(particles, 50) == 12);
+
+    // Resizing discards the particles; removal returns the budget
+    assert(particle_component_set_capacity(particles, 1000) == PARTICLE_OK);
+    assert(particles->count == 0 && particles->capacity == 1000);
+    game_object_remove_component(test.objects[0], COMPONENT_TYPE_PARTICLES);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before);
+
+    test_scene_destroy(&test);
+    printf("✓ Particle storage test passed\n");
+}
+
+static void spawn_pattern(ParticleComponent* particles) {
+    particle_component_clear(particles);
+    for (uint32_t i = 0; i < TEST_PARTICLES; i++) {
+        float f = (float)i;
+        particle_component_spawn(particles, f * 3.0f, 100.0f - f, 10.0f + f, -20.0f + 2.0f * f, 0.055f + 0.01f * f);
+    }
+}
+
+void test_particle_integration_kernels(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+    assert(particle_component_set_capacity(particles, 64) == PARTICLE_OK);
+
+    ParticleEmitterConfig config = {0};
+    config.gravityX = 5.0f;
+    config.gravityY = 98.0f;
+    config.drag = 0.5f;
+    particle_component_set_config(particles, &config);
+    assert(particle_component_set_kernel(NULL, PARTICLE_KERNEL_SCALAR) == PARTICLE_ERROR_NULL_POINTER);
+    assert(particle_kernel_is_supported(PARTICLE_KERNEL_SCALAR));
+    assert(particle_kernel_is_supported(particle_kernel_best()));
+
+    // Semi-implicit Euler: velocity first, then position with the new velocity
+    const float dt = 0.02f;
+    assert(particle_component_set_kernel(particles, PARTICLE_KERNEL_SCALAR) == PARTICLE_OK);
+    spawn_pattern(particles);
+    particle_component_update(particles, dt);
+    float damping = 1.0f - config.drag * dt;
+    for (uint32_t i = 0; i < TEST_PARTICLES; i++) {
+        float f = (float)i;
+        float vx = (10.0f + f) * damping + config.gravityX * dt;
+        float vy = (-20.0f + 2.0f * f) * damping + config.gravityY * dt;
+        assert(test_close_to(particles->vx[i], vx) && test_close_to(particles->vy[i], vy));
+        assert(test_close_to(particles->x[i], f * 3.0f + vx * dt) && test_close_to(particles->y[i], 100.0f - f + vy * dt));
+        assert(test_close_to(particles->life[i], 0.035f + 0.01f * f));
+    }
+
+    // Each kernel agrees with the scalar one over several steps with deaths
+    float x[TEST_PARTICLES], y[TEST_PARTICLES], life[TEST_PARTICLES];
+    uint32_t reference = 0;
+    for (int kernel = PARTICLE_KERNEL_SCALAR; kernel < PARTICLE_KERNEL_COUNT; kernel++) {
+        if (particle_component_set_kernel(particles, (ParticleKernel)kernel) != PARTICLE_OK) {
+            assert(!particle_kernel_is_supported((ParticleKernel)kernel));
+            continue;
+        }
+        spawn_pattern(particles);
+        for (int step = 0; step < 12; step++) {
+            particle_component_update(particles, dt);
+        }
+        if (kernel == PARTICLE_KERNEL_SCALAR) {
+            reference = particles->count;
+            memcpy(x, particles->x, reference * sizeof(float));
+            memcpy(y, particles->y, reference * sizeof(float));
+            memcpy(life, particles->life, reference * sizeof(float));
+            continue;
+        }
+        assert(particles->count == reference);
+        for (uint32_t i = 0; i < reference; i++) {
+            assert(test_close_to(particles->x[i], x[i]) && test_close_to(particles->y[i], y[i]) && test_close_to(particles->life[i], life[i]));
+        }
+    }
+
+    // 0.24 s in: particles with 0.055 + 0.01 i seconds outlive it from i = 19
+    assert(reference == TEST_PARTICLES - 19);
+
+    test_scene_destroy(&test);
+    printf("✓ Particle integration kernel test passed\n");
+}
+
+void test_particle_swap_remove(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+    assert(particle_component_set_capacity(particles, 64) == PARTICLE_OK);
+
+    // Odd particles die this step; vx tags each particle
+    for (uint32_t i = 0; i < TEST_PARTICLES; i++) {
+        particle_component_spawn(particles, 0.0f, 0.0f, (float)i, 0.0f, (i % 2) ? 0.01f : 1.0f);
+    }
+    particle_component_update(particles, 0.02f);
+    assert(particles->count == (TEST_PARTICLES + 1) / 2);
+
+    bool seen[TEST_PARTICLES] = {false};
+    for (uint32_t i = 0; i < particles->count; i++) {
+        uint32_t tag = (uint32_t)particles->vx[i];
+        assert(tag % 2 == 0 && !seen[tag] && particles->life[i] > 0.0f);
+        seen[tag] = true;
+    }
+
+    // Everything dies at once
+    particle_component_update(particles, 2.0f);
+    assert(particles->count == 0);
+
+    test_scene_destroy(&test);
+    printf("✓ Particle swap-remove test passed\n");
+}
+
+void test_particle_emission(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+    assert(particle_component_set_capacity(particles, 400) == PARTICLE_OK);
+    transform_component_set_position(test.objects[0]->transform, 50.0f, 60.0f);
+
+    // Straight down at 20 px/s, 100 per second
+    ParticleEmitterConfig config = {0};
+    config.rate = 100.0f;
+    config.lifetimeMin = 0.5f;
+    config.lifetimeMax = 2.0f;
+    config.speedMin = 20.0f;
+    config.speedMax = 20.0f;
+    config.direction = 1.5707964f;
+    particle_component_set_config(particles, &config);
+
+    particle_component_update(particles, 0.1f);
+    assert(particles->count == 0);                                  // Not emitting yet
+    particle_component_set_emitting(particles, true);
+    particle_component_update(particles, 0.1f);
+    assert(particles->count == 10);
+    for (uint32_t i = 0; i < particles->count; i++) {
+        assert(particles->x[i] == 50.0f && particles->y[i] == 60.0f);
+        assert(fabsf(particles->vx[i]) < 1e-3f && test_close_to(particles->vy[i], 20.0f));
+        assert(particles->life[i] >= 0.5f && particles->life[i] <= 2.0f);
+    }
+
+    // Fractions carry over between frames
+    for (int frame = 0; frame < 6; frame++) {
+        particle_component_update(particles, 0.005f);
+    }
+    assert(particles->count == 13);
+
+    // A burst is clipped to the pool; a huge step fills it without overflowing
+    assert(particle_component_emit(particles, 1000) == 400 - 13);
+    particle_component_clear(particles);
+    particle_component_update(particles, 1e9f);
+    assert(particles->count == 400);
+
+    test_scene_destroy(&test);
+    printf("✓ Particle emission test passed\n");
+}
+
+void test_particle_rendering(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+    assert(particle_component_set_capacity(particles, 16) == PARTICLE_OK);
+
+    Framebuffer framebuffer, expected;
+    assert(framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) == FRAMEBUFFER_OK);
+    assert(framebuffer_init(&expected, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) == FRAMEBUFFER_OK);
+
+    // Pixels round like sprites; off-screen particles are skipped
+    particle_component_spawn(particles, 10.4f, 20.6f, 0.0f, 0.0f, 1.0f);
+    particle_component_spawn(particles, 399.0f, 239.0f, 0.0f, 0.0f, 1.0f);
+    particle_component_spawn(particles, -3.0f, 5.0f, 0.0f, 0.0f, 1.0f);
+    particle_component_spawn(particles, 5.0f, 1e30f, 0.0f, 0.0f, 1.0f);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    particle_component_render(particles, &framebuffer, NULL);
+    assert(framebuffer_get_pixel(&framebuffer, 10, 21) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 399, 239) == BITMAP_COLOR_BLACK);
+    framebuffer_clear(&expected, BITMAP_COLOR_WHITE);
+    framebuffer_set_pixel(&expected, 10, 21, BITMAP_COLOR_BLACK);
+    framebuffer_set_pixel(&expected, 399, 239, BITMAP_COLOR_BLACK);
+    assert(framebuffer_hash(&framebuffer) == framebuffer_hash(&expected));
+
+    // The camera shifts everything
+    RenderCamera camera = {5.0f, 10.0f, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT};
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_BLACK);
+    particle_component_set_color(particles, BITMAP_COLOR_WHITE);
+    particle_component_render(particles, &framebuffer, &camera);
+    assert(framebuffer_get_pixel(&framebuffer, 5, 11) == BITMAP_COLOR_WHITE);
+
+    // Bitmaps match one centred blit per particle, across batch boundaries
+    Bitmap dot;
+    assert(bitmap_init(&dot, 3, 3) == BITMAP_OK);
+    bitmap_set_pixel(&dot, 1, 0, BITMAP_COLOR_BLACK);
+    bitmap_set_pixel(&dot, 0, 1, BITMAP_COLOR_BLACK);
+    bitmap_set_pixel(&dot, 2, 2, BITMAP_COLOR_WHITE);
+    assert(particle_component_set_capacity(particles, 150) == PARTICLE_OK);
+    for (uint32_t i = 0; i < 150; i++) {
+        particle_component_spawn(particles, (float)((i * 37) % 420) - 10.0f, (float)((i * 53) % 260) - 10.0f, 0.0f, 0.0f, 1.0f);
+    }
+    particle_component_set_bitmap(particles, &dot);
+    particle_component_set_draw_mode(particles, BLIT_MODE_COPY);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    particle_component_render(particles, &framebuffer, NULL);
+    framebuffer_clear(&expected, BITMAP_COLOR_WHITE);
+    for (uint32_t i = 0; i < particles->count; i++) {
+        framebuffer_blit(&expected, &dot, (int32_t)lrintf(particles->x[i] - 1.0f), (int32_t)lrintf(particles->y[i] - 1.0f));
+    }
+    assert(framebuffer_hash(&framebuffer) == framebuffer_hash(&expected));
+
+    // Hidden emitters draw nothing
+    particle_component_set_visible(particles, false);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    particle_component_render(particles, &framebuffer, NULL);
+    framebuffer_clear(&expected, BITMAP_COLOR_WHITE);
+    assert(framebuffer_hash(&framebuffer) == framebuffer_hash(&expected));
+
+    bitmap_destroy(&dot);
+    framebuffer_destroy(&expected);
+    framebuffer_destroy(&framebuffer);
+    test_scene_destroy(&test);
+    printf("✓ Particle rendering test passed\n");
+}
+
+void test_particle_scene_systems(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+    assert(particle_component_set_capacity(particles, 5000) == PARTICLE_OK);
+    register_default_systems(test.scene);
+    scene_rebuild_component_arrays(test.scene);
+    scene_set_state(test.scene, SCENE_STATE_ACTIVE);
+    assert(test.scene->particleCount == 1);
+
+    ParticleEmitterConfig config = {0};
+    config.rate = 6000.0f;
+    config.lifetimeMin = 0.2f;
+    config.lifetimeMax = 0.6f;
+    config.speedMin = 10.0f;
+    config.speedMax = 80.0f;
+    config.spread = 6.2831853f;
+    config.gravityY = 50.0f;
+    particle_component_set_config(particles, &config);
+    particle_component_set_emitting(particles, true);
+    transform_component_set_position(test.objects[0]->transform, 200.0f, 120.0f);
+
+    // Steady state runs from the scene without allocating
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    for (int frame = 0; frame < 60; frame++) {
+        scene_update(test.scene, 1.0f / 60.0f);
+    }
+    assert(particles->count > 1000 && particles->count <= particles->capacity);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before);
+
+    // The render system draws into the current target
+    Framebuffer framebuffer;
+    assert(framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) == FRAMEBUFFER_OK);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    framebuffer_set_render_target(&framebuffer);
+    scene_render(test.scene);
+    framebuffer_set_render_target(NULL);
+    assert(framebuffer_get_pixel(&framebuffer, 200, 120) == BITMAP_COLOR_BLACK);
+
+    // Disabled emitters are skipped
+    uint32_t count = particles->count;
+    component_set_enabled((Component*)particles, false);
+    scene_update(test.scene, 1.0f / 60.0f);
+    assert(particles->count == count);
+
+    framebuffer_destroy(&framebuffer);
+    test_scene_destroy(&test);
+    printf("✓ Particle scene system test passed\n");
+}
+
+void test_particle_rate_under_scene_manager(void) {
+    TestScene test;
+    test_scene_create(&test, "Particles", 16);
+    ParticleComponent* particles = add_emitter(&test);
+    assert(particle_component_set_capacity(particles, 256) == PARTICLE_OK);
+    register_default_systems(test.scene);
+    scene_rebuild_component_arrays(test.scene);
+    SceneManager* manager = scene_manager_create();
+    assert(manager && scene_manager_add_scene(manager, test.scene) == SCENE_OK);
+    assert(scene_manager_set_active_scene(manager, test.scene) == SCENE_OK);
+
+    ParticleEmitterConfig config = {0};
+    config.rate = 100.0f;
+    config.lifetimeMin = config.lifetimeMax = 10.0f;
+    particle_component_set_config(particles, &config);
+    particle_component_set_emitting(particles, true);
+    assert(particle_component_spawn(particles, 0.0f, 0.0f, 10.0f, 0.0f, 1.0f));
+
+    // 0.3 s of 10 ms frames under a 60 Hz fixed step: particles age, move
+    // and are emitted by the frame time alone
+    for (uint32_t frame = 0; frame < 30; frame++) {
+        scene_manager_update(manager, 0.010f);
+    }
+    assert(fabsf(particles->life[0] - 0.7f) < 1e-4f);
+    assert(fabsf(particles->x[0] - 3.0f) < 1e-4f);
+    assert(particles->count >= 1 + 29 && particles->count <= 1 + 31);
+
+    scene_manager_remove_scene(manager, test.scene);
+    scene_manager_destroy(manager);
+    scene_set_state(test.scene, SCENE_STATE_INACTIVE);
+    test_scene_destroy(&test);
+    printf("✓ Particle rate under scene manager test passed\n");
+}
+
+int run_particle_tests(void) {
+    printf("Running particle tests...\n");
+
+    test_particle_storage();
+    test_particle_integration_kernels();
+    test_particle_swap_remove();
+    test_particle_emission();
+    test_particle_rendering();
+    test_particle_scene_systems();
+    test_particle_rate_under_scene_manager();
+
+    printf("All particle tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_particle_tests();
+}
+#endif
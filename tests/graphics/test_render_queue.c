@@ -0,0 +1,234 @@
+#include "../../src/graphics/render_queue.h"
+#include "../../src/components/sprite_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static uint32_t g_seed = 99;
+
+void test_render_queue_lifecycle(void) {
+    RenderQueue queue;
+    assert(render_queue_init(NULL, 16) == RENDER_QUEUE_ERROR_NULL_POINTER);
+    assert(render_queue_init(&queue, 0) == RENDER_QUEUE_ERROR_INVALID_CAPACITY);
+    assert(render_queue_init(&queue, 2) == RENDER_QUEUE_OK);
+
+    Bitmap bitmap;
+    bitmap_init(&bitmap, 4, 4);
+    assert(render_queue_submit(&queue, 1, &bitmap, 0, 0) == RENDER_QUEUE_OK);
+    assert(render_queue_submit(&queue, 2, &bitmap, 0, 0) == RENDER_QUEUE_OK);
+    assert(render_queue_submit(&queue, 3, &bitmap, 0, 0) == RENDER_QUEUE_ERROR_FULL);
+
+    // Reserve grows but does not keep submitted commands
+    assert(render_queue_reserve(&queue, 100) == RENDER_QUEUE_OK);
+    assert(queue.capacity >= 100 && queue.count == 0);
+    uint32_t capacity = queue.capacity;
+    assert(render_queue_reserve(&queue, 10) == RENDER_QUEUE_OK);
+    assert(queue.capacity == capacity);
+
+    render_queue_destroy(&queue);
+    assert(queue.capacity == 0);
+    render_queue_destroy(&queue);
+    bitmap_destroy(&bitmap);
+    printf("✓ Render queue lifecycle test passed\n");
+}
+
+static int compare_commands(const void* a, const void* b) {
+    const RenderCommand* left = a;
+    const RenderCommand* right = b;
+    if (left->key != right->key) return left->key < right->key ? -1 : 1;
+    return left->index < right->index ? -1 : left->index > right->index;
+}
+
+// Radix order must equal a stable comparison sort
+void test_render_queue_sort_order(void) {
+    RenderQueue queue;
+    render_queue_init(&queue, 2000);
+    Bitmap bitmap;
+    bitmap_init(&bitmap, 1, 1);
+
+    static RenderCommand expected[2000];
+    for (uint32_t i = 0; i < 2000; i++) {
+        uint64_t key = render_key_make((uint8_t)test_random(&g_seed, 4), (uint16_t)test_random(&g_seed, 3), (uint16_t)test_random(&g_seed, 5),
+                                       (BlitMode)test_random(&g_seed, BLIT_MODE_COUNT), (int32_t)test_random(&g_seed, 600) - 300);
+        render_queue_submit(&queue, key, &bitmap, (int32_t)i, 0);
+        expected[i].key = key;
+        expected[i].index = i;
+    }
+    qsort(expected, 2000, sizeof(RenderCommand), compare_commands);
+    render_queue_sort(&queue);
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        assert(queue.commands[i].key == expected[i].key);
+        assert(queue.commands[i].index == expected[i].index);
+        assert(queue.sorted[i].x == (int32_t)expected[i].index);
+    }
+
+    // Batches cover every command and break exactly on atlas/mode changes
+    uint32_t covered = 0;
+    for (uint32_t b = 0; b < queue.batchCount; b++) {
+        const RenderBatch* batch = &queue.batches[b];
+        assert(batch->start == covered && batch->count > 0);
+        for (uint32_t i = batch->start; i < batch->start + batch->count; i++) {
+            assert((queue.commands[i].key & RENDER_KEY_STATE_MASK) == (queue.commands[batch->start].key & RENDER_KEY_STATE_MASK));
+        }
+        if (b > 0) {
+            assert((queue.commands[batch->start].key & RENDER_KEY_STATE_MASK) !=
+                   (queue.commands[batch->start - 1].key & RENDER_KEY_STATE_MASK));
+        }
+        covered += batch->count;
+    }
+    assert(covered == 2000);
+    uint32_t batchCount = queue.batchCount;
+
+    render_queue_destroy(&queue);
+    bitmap_destroy(&bitmap);
+    printf("✓ Render queue sort order test passed (%u batches)\n", batchCount);
+}
+
+void test_render_queue_skips_constant_bytes(void) {
+    RenderQueue queue;
+    render_queue_init(&queue, 256);
+    Bitmap bitmap;
+    bitmap_init(&bitmap, 1, 1);
+
+    // Same layer, z, atlas and mode; y within one byte: a single pass
+    for (int32_t i = 0; i < 200; i++) {
+        render_queue_submit(&queue, render_key_make(2, 7, 3, BLIT_MODE_COPY, 199 - i), &bitmap, 0, 199 - i);
+    }
+    render_queue_sort(&queue);
+    assert(queue.radixPasses == 1);
+    assert(queue.batchCount == 1 && queue.batches[0].atlasId == 3);
+    assert(queue.sorted[0].y == 0 && queue.sorted[199].y == 199);
+
+    // Identical keys need no pass and keep submission order
+    render_queue_clear(&queue);
+    for (int32_t i = 0; i < 10; i++) {
+        render_queue_submit(&queue, 42, &bitmap, i, 0);
+    }
+    render_queue_sort(&queue);
+    assert(queue.radixPasses == 0);
+    for (int32_t i = 0; i < 10; i++) {
+        assert(queue.sorted[i].x == i);
+    }
+
+    render_queue_destroy(&queue);
+    bitmap_destroy(&bitmap);
+    printf("✓ Render queue constant byte skipping test passed\n");
+}
+
+void test_render_queue_execute(void) {
+    RenderQueue queue;
+    render_queue_init(&queue, 16);
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, 64, 16);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+
+    Bitmap black, white;
+    bitmap_init(&black, 8, 8);
+    bitmap_init(&white, 8, 8);
+    bitmap_fill(&black, BITMAP_COLOR_BLACK);
+    bitmap_fill(&white, BITMAP_COLOR_WHITE);
+    white.atlasId = 1;
+
+    // Submitted top layer first; the sort puts it last
+    render_queue_submit(&queue, render_key_make(1, 0, 1, BLIT_MODE_COPY, 8), &white, 4, 0);
+    render_queue_submit(&queue, render_key_make(0, 0, 0, BLIT_MODE_COPY, 8), &black, 0, 0);
+    // Inverted white draws black
+    render_queue_submit(&queue, render_key_make(0, 0, 1, BLIT_MODE_INVERTED, 8), &white, 32, 0);
+    render_queue_execute(&queue, &framebuffer);
+
+    assert(queue.batchCount == 3);
+    assert(framebuffer_get_pixel(&framebuffer, 2, 2) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 6, 2) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 35, 2) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 35, 9) == BITMAP_COLOR_WHITE);
+
+    framebuffer_destroy(&framebuffer);
+    bitmap_destroy(&black);
+    bitmap_destroy(&white);
+    render_queue_destroy(&queue);
+    printf("✓ Render queue execute test passed\n");
+}
+
+// The sprite pass draws by layer, then z, then bottom edge
+void test_sprite_system_draw_order(void) {
+    component_registry_init();
+    transform_component_register();
+    sprite_component_register();
+
+    Scene* scene = scene_create("SpriteOrder", 10);
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    framebuffer_set_render_target(&framebuffer);
+
+    Bitmap black, white;
+    bitmap_init(&black, 10, 10);
+    bitmap_init(&white, 10, 10);
+    bitmap_fill(&black, BITMAP_COLOR_BLACK);
+    bitmap_fill(&white, BITMAP_COLOR_WHITE);
+
+    SpriteComponent* sprites[3];
+    const Bitmap* bitmaps[3] = {&black, &white, &black};
+    const float ys[3] = {55.0f, 50.0f, 45.0f};
+    for (int i = 0; i < 3; i++) {
+        GameObject* gameObject = game_object_create(scene);
+        transform_component_set_position(gameObject->transform, 50.0f, ys[i]);
+        sprites[i] = sprite_component_create(gameObject);
+        sprite_component_set_bitmap(sprites[i], bitmaps[i]);
+        game_object_add_component(gameObject, (Component*)sprites[i]);
+    }
+    scene_rebuild_component_arrays(scene);
+
+    // Same layer: lower bottom edge draws later (black at y 55 covers white)
+    scene_render_sprites(scene);
+    assert(framebuffer_get_pixel(&framebuffer, 50, 52) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 50, 48) == BITMAP_COLOR_WHITE);   // White over the y 45 sprite
+
+    // Layer wins over y
+    sprite_component_set_layer(sprites[1], 1);
+    scene_render_sprites(scene);
+    assert(framebuffer_get_pixel(&framebuffer, 50, 52) == BITMAP_COLOR_WHITE);
+
+    // z orders within a layer
+    sprite_component_set_layer(sprites[1], 0);
+    sprite_component_set_z(sprites[2], 5);
+    scene_render_sprites(scene);
+    assert(framebuffer_get_pixel(&framebuffer, 50, 48) == BITMAP_COLOR_BLACK);
+
+    const RenderQueue* queue = sprite_system_get_render_queue();
+    assert(queue->count == 3 && queue->batchCount >= 1);
+
+    framebuffer_destroy(&framebuffer);
+    bitmap_destroy(&black);
+    bitmap_destroy(&white);
+    scene_destroy(scene);
+    sprite_system_shutdown();
+    component_registry_shutdown();
+    printf("✓ Sprite system draw order test passed\n");
+}
+
+int run_render_queue_tests(void) {
+    printf("Running render queue tests...\n");
+
+    test_render_queue_lifecycle();
+    test_render_queue_sort_order();
+    test_render_queue_skips_constant_bytes();
+    test_render_queue_execute();
+    test_sprite_system_draw_order();
+
+    printf("All render queue tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_render_queue_tests();
+}
+#endif
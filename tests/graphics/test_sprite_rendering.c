@@ -0,0 +1,194 @@
+#include "../../src/components/sprite_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/update_systems.h"
+#include "../../src/graphics/render_queue.h"
+#include "../../src/systems/spatial_grid.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <stdio.h>
+
+static uint32_t g_seed = 7;
+
+static GameObject* create_sprite_object(Scene* scene, const Bitmap* bitmap, float x, float y, SpriteComponent** out) {
+    GameObject* gameObject = game_object_create(scene);
+    assert(gameObject != NULL);
+    transform_component_set_position(gameObject->transform, x, y);
+
+    SpriteComponent* sprite = sprite_component_create(gameObject);
+    assert(sprite != NULL);
+    sprite_component_set_bitmap(sprite, bitmap);
+    assert(game_object_add_component(gameObject, (Component*)sprite) == GAMEOBJECT_OK);
+
+    if (out) *out = sprite;
+    return gameObject;
+}
+
+void test_sprite_component_basics(void) {
+    component_registry_init();
+    assert(sprite_component_register() == COMPONENT_OK);
+    assert(sizeof(SpriteComponent) == 64);
+
+    Scene* scene = scene_create("SpriteBasics", 10);
+    Bitmap bitmap;
+    bitmap_init(&bitmap, 9, 4);
+
+    SpriteComponent* sprite = NULL;
+    create_sprite_object(scene, &bitmap, 100.4f, 50.6f, &sprite);
+    assert(sprite->visible && sprite->layer == 0);
+
+    // Centered on the transform position, rounded to whole pixels
+    int32_t x, y;
+    sprite_component_get_screen_position(sprite, &x, &y);
+    assert(x == 100 - 4 && y == 51 - 2);
+
+    sprite_component_set_offset(sprite, 0, 0);
+    sprite_component_get_screen_position(sprite, &x, &y);
+    assert(x == 100 && y == 51);
+
+    assert(sprite_component_create(NULL) == NULL);
+
+    bitmap_destroy(&bitmap);
+    scene_destroy(scene);
+    component_registry_shutdown();
+    printf("✓ Sprite component basics test passed\n");
+}
+
+void test_scene_renders_sprites(void) {
+    component_registry_init();
+    transform_component_register();
+    sprite_component_register();
+
+    Scene* scene = scene_create("SpriteRender", 10);
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+
+    Bitmap box;
+    bitmap_init(&box, 4, 4);
+    bitmap_fill(&box, BITMAP_COLOR_BLACK);
+    bitmap_clear_pixel(&box, 0, 0);                // Transparent corner
+
+    SpriteComponent* shown = NULL;
+    SpriteComponent* hidden = NULL;
+    create_sprite_object(scene, &box, 12.0f, 12.0f, &shown);
+    create_sprite_object(scene, &box, 300.0f, 100.0f, &hidden);
+    sprite_component_set_visible(hidden, false);
+    scene_rebuild_component_arrays(scene);
+    assert(scene->spriteCount == 2);
+
+    // Without a render target nothing is drawn
+    uint64_t blank = framebuffer_hash(&framebuffer);
+    scene_render_sprites(scene);
+    assert(framebuffer_hash(&framebuffer) == blank);
+
+    framebuffer_set_render_target(&framebuffer);
+    scene_render_sprites(scene);
+
+    assert(framebuffer_get_pixel(&framebuffer, 10, 10) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 11, 10) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 13, 13) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 14, 13) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&framebuffer, 300, 100) == BITMAP_COLOR_WHITE);
+
+    // Moving the transform moves the sprite
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    transform_component_set_position(shown->base.gameObject->transform, 398.0f, 238.0f);
+    scene_render_sprites(scene);
+    assert(framebuffer_get_pixel(&framebuffer, 399, 239) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&framebuffer, 11, 10) == BITMAP_COLOR_WHITE);
+
+    framebuffer_destroy(&framebuffer);
+    bitmap_destroy(&box);
+    scene_destroy(scene);
+    component_registry_shutdown();
+    printf("✓ Scene sprite rendering test passed\n");
+}
+
+// The grid query must draw exactly what a full scan draws
+void test_sprite_culling_matches_full_scan(void) {
+    component_registry_init();
+    transform_component_register();
+    sprite_component_register();
+
+    Scene* scene = scene_create("SpriteCulling", 400);
+    SpatialGrid* grid = spatial_grid_create(64, 32, 32, 0.0f, 0.0f, 4096);
+    Framebuffer framebuffer;
+    framebuffer_init(&framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    framebuffer_set_render_target(&framebuffer);
+
+    Bitmap small, large;
+    bitmap_init(&small, 16, 16);
+    bitmap_init(&large, 96, 96);
+    bitmap_fill(&small, BITMAP_COLOR_BLACK);
+    bitmap_fill(&large, BITMAP_COLOR_BLACK);
+
+    const RenderCamera camera = {500.0f, 700.0f, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT};
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < 300; i++) {
+        SpriteComponent* sprite = NULL;
+        float x = 8.0f + test_random_float(&g_seed, 2030.0f);
+        float y = 8.0f + test_random_float(&g_seed, 2030.0f);
+        GameObject* gameObject = create_sprite_object(scene, &small, x, y, &sprite);
+        spatial_grid_add_object(grid, gameObject);
+
+        int32_t screenX, screenY;
+        sprite_component_get_screen_position(sprite, &screenX, &screenY);
+        screenX -= 500;
+        screenY -= 700;
+        if (screenX < FRAMEBUFFER_WIDTH && screenY < FRAMEBUFFER_HEIGHT && screenX + 16 > 0 && screenY + 16 > 0) {
+            expected++;
+        }
+    }
+
+    // Centre 40 pixels left of the camera, right edge still visible
+    GameObject* big = create_sprite_object(scene, &large, 460.0f, 800.0f, NULL);
+    spatial_grid_add_object(grid, big);
+    expected++;
+    scene_rebuild_component_arrays(scene);
+
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    uint32_t drawn = sprite_system_render_culled(scene, grid, &camera);
+    uint64_t culledHash = framebuffer_hash(&framebuffer);
+    assert(drawn == expected);
+    assert(drawn < 301);
+    assert(framebuffer_get_pixel(&framebuffer, 2, 100) == BITMAP_COLOR_BLACK);
+
+    grid->enableFrustumCulling = false;
+    framebuffer_clear(&framebuffer, BITMAP_COLOR_WHITE);
+    assert(sprite_system_render_culled(scene, grid, &camera) == expected);
+    assert(framebuffer_hash(&framebuffer) == culledHash);
+
+    // Hidden sprites are skipped
+    grid->enableFrustumCulling = true;
+    sprite_component_set_visible((SpriteComponent*)game_object_get_component(big, COMPONENT_TYPE_SPRITE), false);
+    assert(sprite_system_render_culled(scene, grid, &camera) == expected - 1);
+
+    framebuffer_destroy(&framebuffer);
+    bitmap_destroy(&small);
+    bitmap_destroy(&large);
+    spatial_grid_destroy(grid);
+    scene_destroy(scene);
+    sprite_system_shutdown();
+    component_registry_shutdown();
+    printf("✓ Sprite culling test passed (%u of 301 drawn)\n", drawn);
+}
+
+int run_sprite_rendering_tests(void) {
+    printf("Running sprite rendering tests...\n");
+
+    test_sprite_component_basics();
+    test_scene_renders_sprites();
+    test_sprite_culling_matches_full_scan();
+
+    printf("All sprite rendering tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_sprite_rendering_tests();
+}
+#endif
@@ -0,0 +1,273 @@
+#include "../../src/components/tilemap_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/memory_budget.h"
+#include "../../src/core/scene.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_TILE_IDS 6
+
+static uint32_t g_seed = 4242;
+
+static TilemapComponent* add_tilemap(TestScene* test) {
+    GameObject* object = test_scene_add(test, 0.0f, 0.0f);
+    TilemapComponent* tilemap = tilemap_component_create(object);
+    assert(tilemap && tilemap_component_is_tilemap((Component*)tilemap));
+    return (TilemapComponent*)test_scene_attach(test, (Component*)tilemap);
+}
+
+void test_tilemap_storage(void) {
+    uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    TestScene test;
+    test_scene_create(&test, "Tilemap", 16);
+    TilemapComponent* tilemap = add_tilemap(&test);
+
+    assert(tilemap_component_set_size(NULL, 10, 10, 16) == TILEMAP_ERROR_NULL_POINTER);
+    assert(tilemap_component_set_size(tilemap, 0, 10, 16) == TILEMAP_ERROR_INVALID_SIZE);
+    assert(tilemap_component_set_size(tilemap, 10, 10, 12) == TILEMAP_ERROR_INVALID_SIZE);
+    assert(tilemap_component_set_tileset(tilemap, NULL, 0) == TILEMAP_ERROR_INVALID_SIZE);   // No tile size yet
+
+    // A 50k-tile level costs about one byte per tile
+    uint32_t withComponent = memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes;
+    assert(tilemap_component_set_size(tilemap, 250, 200, 16) == TILEMAP_OK);
+    assert(tilemap->chunkColumns == 16 && tilemap->chunkRows == 13);
+    assert(tilemap->storageBytes == 16 * 13 * (TILEMAP_CHUNK_TILES + 4));
+    assert(tilemap->storageBytes < 250 * 200 * 2);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == withComponent + tilemap->storageBytes);
+
+    // Chunk-major layout, counts follow every write, outside reads are empty
+    tilemap_component_set_tile(tilemap, 17, 3, 5);
+    assert(tilemap->tiles[TILEMAP_CHUNK_TILES + 3 * TILEMAP_CHUNK_SIZE + 1] == 5);
+    assert(tilemap_component_get_tile(tilemap, 17, 3) == 5 && tilemap->chunkFilled[1] == 1);
+    tilemap_component_set_tile(tilemap, 17, 3, 4);
+    assert(tilemap->chunkFilled[1] == 1);
+    tilemap_component_set_tile(tilemap, 17, 3, TILEMAP_EMPTY_TILE);
+    assert(tilemap->chunkFilled[1] == 0);
+    tilemap_component_set_tile(tilemap, 250, 0, 1);
+    tilemap_component_set_tile(tilemap, -1, 0, 1);
+    assert(tilemap_component_get_tile(tilemap, 250, 0) == TILEMAP_EMPTY_TILE);
+    assert(tilemap_component_get_tile(tilemap, 0, -1) == TILEMAP_EMPTY_TILE);
+
+    // Tile bitmaps must cover a whole tile
+    Bitmap small, tile;
+    bitmap_init(&small, 8, 16);
+    bitmap_init(&tile, 16, 16);
+    const Bitmap* tiles[3] = {NULL, &tile, &small};
+    assert(tilemap_component_set_tileset(tilemap, tiles, 3) == TILEMAP_ERROR_INVALID_SIZE);
+    assert(tilemap_component_set_tileset(tilemap, tiles, 2) == TILEMAP_OK);
+    assert(tilemap->tilesetBytes == 2 * 16 * 2 * sizeof(uint32_t));
+
+    // Resizing discards the tiles and keeps the tileset while the tile size holds
+    tilemap_component_set_tile(tilemap, 1, 1, 1);
+    assert(tilemap_component_set_size(tilemap, 20, 20, 16) == TILEMAP_OK);
+    assert(tilemap_component_get_tile(tilemap, 1, 1) == TILEMAP_EMPTY_TILE && tilemap->tileCount == 2);
+    assert(tilemap_component_set_size(tilemap, 20, 20, 8) == TILEMAP_OK && tilemap->tileRows == NULL);
+
+    assert(game_object_remove_component(test.objects[0], COMPONENT_TYPE_TILEMAP) == GAMEOBJECT_OK);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == withComponent);
+    bitmap_destroy(&small);
+    bitmap_destroy(&tile);
+    test_scene_destroy(&test);
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SCENE)->usedBytes == before);
+    printf("✓ Tilemap storage test passed\n");
+}
+
+// Drawn output matches blitting every tile bitmap on its own, for every
+// tile size, camera offset, map origin and draw mode
+void test_tilemap_render_matches_tile_blits(void) {
+    TestScene test;
+    test_scene_create(&test, "Tilemap", 16);
+    TilemapComponent* tilemap = add_tilemap(&test);
+
+    const uint32_t tileSizes[] = {8, 16, 32};
+    for (uint32_t s = 0; s < 3; s++) {
+        uint32_t tileSize = tileSizes[s];
+        Bitmap bitmaps[TEST_TILE_IDS];
+        const Bitmap* tiles[TEST_TILE_IDS] = {NULL};
+        for (uint32_t id = 1; id < TEST_TILE_IDS; id++) {
+            bitmap_init(&bitmaps[id], tileSize, tileSize);
+            test_fill_random_bitmap(&bitmaps[id], &g_seed);
+            tiles[id] = &bitmaps[id];
+        }
+        tiles[TEST_TILE_IDS - 1] = NULL;            // Missing bitmap draws nothing
+
+        uint32_t columns = 37 + s * 5, rows = 23;
+        assert(tilemap_component_set_size(tilemap, columns, rows, tileSize) == TILEMAP_OK);
+        assert(tilemap_component_set_tileset(tilemap, tiles, TEST_TILE_IDS - 1) == TILEMAP_OK);
+        for (uint32_t row = 0; row < rows; row++) {
+            for (uint32_t column = 0; column < columns; column++) {
+                // Leave one chunk column empty; id TEST_TILE_IDS is past the tileset
+                if (column >= 16 && column < 32) continue;
+                tilemap_component_set_tile(tilemap, (int32_t)column, (int32_t)row, (uint8_t)test_random(&g_seed, TEST_TILE_IDS + 1));
+            }
+        }
+
+        Framebuffer reference, drawn;
+        for (uint32_t trial = 0; trial < 24; trial++) {
+            uint32_t width = trial % 3 == 2 ? 100 : FRAMEBUFFER_WIDTH;
+            uint32_t height = trial % 3 == 2 ? 50 : FRAMEBUFFER_HEIGHT;
+            framebuffer_init(&reference, width, height);
+            framebuffer_init(&drawn, width, height);
+            framebuffer_clear(&reference, BITMAP_COLOR_WHITE);
+            framebuffer_clear(&drawn, BITMAP_COLOR_WHITE);
+
+            float originX = (float)test_random(&g_seed, 200) - 100.0f, originY = (float)test_random(&g_seed, 200) - 100.0f;
+            transform_component_set_position(test.objects[0]->transform, originX, originY);
+            RenderCamera camera = {(float)test_random(&g_seed, columns * tileSize + 400) - 300.0f,
+                                   (float)test_random(&g_seed, rows * tileSize + 200) - 150.0f, (float)width, (float)height};
+            BlitMode mode = (BlitMode)(trial % 2);
+            tilemap_component_set_draw_mode(tilemap, mode);
+
+            for (uint32_t row = 0; row < rows; row++) {
+                for (uint32_t column = 0; column < columns; column++) {
+                    uint8_t id = tilemap_component_get_tile(tilemap, (int32_t)column, (int32_t)row);
+                    if (id == TILEMAP_EMPTY_TILE || id >= TEST_TILE_IDS - 1) continue;
+                    framebuffer_blit_mode(&reference, tiles[id],
+                                          (int32_t)originX + (int32_t)(column * tileSize) - (int32_t)camera.x,
+                                          (int32_t)originY + (int32_t)(row * tileSize) - (int32_t)camera.y, mode);
+                }
+            }
+            tilemap_component_render(tilemap, &drawn, &camera);
+            assert(framebuffer_hash(&reference) == framebuffer_hash(&drawn));
+
+            framebuffer_destroy(&reference);
+            framebuffer_destroy(&drawn);
+        }
+
+        for (uint32_t id = 1; id < TEST_TILE_IDS; id++) {
+            bitmap_destroy(&bitmaps[id]);
+        }
+    }
+
+    // Hidden maps and the vtable render draw in screen space into the render target
+    Framebuffer target;
+    framebuffer_init(&target, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+    Bitmap black;
+    bitmap_init(&black, 8, 8);
+    bitmap_fill(&black, BITMAP_COLOR_BLACK);
+    const Bitmap* tiles[2] = {NULL, &black};
+    tilemap_component_set_size(tilemap, 4, 4, 8);
+    tilemap_component_set_tileset(tilemap, tiles, 2);
+    tilemap_component_set_draw_mode(tilemap, BLIT_MODE_COPY);
+    tilemap_component_set_tile(tilemap, 1, 1, 1);
+    transform_component_set_position(test.objects[0]->transform, 64.0f, 0.0f);
+
+    framebuffer_clear(&target, BITMAP_COLOR_WHITE);
+    framebuffer_set_render_target(&target);
+    tilemap_component_set_visible(tilemap, false);
+    tilemap->base.vtable->render((Component*)tilemap);
+    assert(framebuffer_get_pixel(&target, 72, 8) == BITMAP_COLOR_WHITE);
+    tilemap_component_set_visible(tilemap, true);
+    tilemap->base.vtable->render((Component*)tilemap);
+    assert(framebuffer_get_pixel(&target, 71, 8) == BITMAP_COLOR_WHITE);
+    assert(framebuffer_get_pixel(&target, 72, 8) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&target, 79, 15) == BITMAP_COLOR_BLACK);
+    assert(framebuffer_get_pixel(&target, 80, 15) == BITMAP_COLOR_WHITE);
+    framebuffer_set_render_target(NULL);
+
+    framebuffer_destroy(&target);
+    bitmap_destroy(&black);
+    test_scene_destroy(&test);
+    printf("✓ Tilemap render matches tile blits test passed\n");
+}
+
+// Queries read the tile grid directly and agree with a tile-by-tile scan
+void test_tilemap_collision(void) {
+    TestScene test;
+    test_scene_create(&test, "Tilemap", 16);
+    TilemapComponent* tilemap = add_tilemap(&test);
+
+    const uint32_t columns = 70, rows = 40, tileSize = 16;
+    tilemap_component_set_size(tilemap, columns, rows, tileSize);
+    transform_component_set_position(test.objects[0]->transform, -32.0f, 48.0f);
+    for (uint32_t row = 0; row < rows; row++) {
+        for (uint32_t column = 0; column < columns; column++) {
+            if (row < 16) continue;                 // Top chunk row is empty
+            tilemap_component_set_tile(tilemap, (int32_t)column, (int32_t)row, (uint8_t)test_random(&g_seed, 4));
+        }
+    }
+
+    // No solid ids yet: nothing collides
+    assert(!tilemap_component_overlaps_solid(tilemap, -100.0f, -100.0f, 5000.0f, 5000.0f));
+    tilemap_component_set_solid(tilemap, 2, true);
+    tilemap_component_set_solid(tilemap, 3, true);
+    tilemap_component_set_solid(tilemap, TILEMAP_EMPTY_TILE, true);         // Empty never collides
+    assert(tilemap->chunkSolid[0] == 0 && tilemap->chunkSolid[tilemap->chunkColumns * 1] > 0);
+
+    uint32_t expectedTotal = 0;
+    for (uint32_t chunk = 0; chunk < tilemap->chunkColumns * tilemap->chunkRows; chunk++) {
+        expectedTotal += tilemap->chunkSolid[chunk];
+    }
+    TilemapTileHit hits[64];
+    assert(tilemap_component_query_rect(tilemap, -32.0f, 48.0f, (float)(columns * tileSize), (float)(rows * tileSize),
+                                        NULL, 0) == expectedTotal);
+
+    for (uint32_t trial = 0; trial < 400; trial++) {
+        float x = (float)test_random(&g_seed, columns * tileSize + 100) - 150.0f;
+        float y = (float)test_random(&g_seed, rows * tileSize + 100) + 0.5f;
+        float width = (float)test_random(&g_seed, 80) + 0.25f, height = (float)test_random(&g_seed, 80) + 0.25f;
+
+        uint32_t expected = 0;
+        for (int32_t row = 0; row < (int32_t)rows; row++) {
+            for (int32_t column = 0; column < (int32_t)columns; column++) {
+                float tileX = -32.0f + (float)(column * (int32_t)tileSize), tileY = 48.0f + (float)(row * (int32_t)tileSize);
+                bool overlaps = x < tileX + (float)tileSize && tileX < x + width &&
+                                y < tileY + (float)tileSize && tileY < y + height;
+                expected += overlaps && tilemap_component_is_solid(tilemap, column, row);
+            }
+        }
+
+        uint32_t found = tilemap_component_query_rect(tilemap, x, y, width, height, hits, 64);
+        assert(found == expected);
+        assert(tilemap_component_overlaps_solid(tilemap, x, y, width, height) == (expected > 0));
+        for (uint32_t i = 0; i < found && i < 64; i++) {
+            assert(tilemap_component_is_solid(tilemap, hits[i].column, hits[i].row));
+            assert(hits[i].tile == tilemap_component_get_tile(tilemap, hits[i].column, hits[i].row));
+        }
+
+        int32_t column, row;
+        bool inside = tilemap_component_world_to_tile(tilemap, x, y, &column, &row);
+        assert(column == (int32_t)floorf((x + 32.0f) / 16.0f) && row == (int32_t)floorf((y - 48.0f) / 16.0f));
+        assert(tilemap_component_solid_at(tilemap, x, y) == (inside && tilemap_component_is_solid(tilemap, column, row)));
+    }
+
+    // Clearing a flag recounts the chunks; edits keep the counts right
+    tilemap_component_set_solid(tilemap, 3, false);
+    tilemap_component_set_tile(tilemap, 0, 0, 2);
+    assert(tilemap->chunkSolid[0] == 1);
+    tilemap_component_set_tile(tilemap, 0, 0, 3);
+    assert(tilemap->chunkSolid[0] == 0);
+    uint32_t solidTwos = 0;
+    for (int32_t row = 0; row < (int32_t)rows; row++) {
+        for (int32_t column = 0; column < (int32_t)columns; column++) {
+            solidTwos += tilemap_component_get_tile(tilemap, column, row) == 2;
+        }
+    }
+    assert(tilemap_component_query_rect(tilemap, -1000.0f, -1000.0f, 5000.0f, 5000.0f, NULL, 0) == solidTwos);
+    assert(tilemap_component_query_rect(tilemap, 0.0f, 0.0f, 0.0f, 10.0f, NULL, 0) == 0);
+
+    test_scene_destroy(&test);
+    printf("✓ Tilemap collision test passed\n");
+}
+
+int run_tilemap_tests(void) {
+    printf("Running tilemap tests...\n");
+
+    test_tilemap_storage();
+    test_tilemap_render_matches_tile_blits();
+    test_tilemap_collision();
+
+    printf("All tilemap tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_tilemap_tests();
+}
+#endif
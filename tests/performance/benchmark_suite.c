@@ -0,0 +1,1288 @@
+#include "../../src/profiling/benchmark_runner.h"
+#include "../../src/profiling/alloc_tracker.h"
+#include "../../src/core/memory_pool.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/update_systems.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/components/sprite_component.h"
+#include "../../src/components/tilemap_component.h"
+#include "../../src/components/animation_component.h"
+#include "../../src/components/particle_component.h"
+#include "../../src/components/collision_component.h"
+#include "../../src/components/rigidbody_component.h"
+#include "../../src/systems/spatial_grid.h"
+#include "../../src/systems/collision_system.h"
+#include "../../src/systems/rigidbody_system.h"
+#include "../../src/graphics/dirty_rect.h"
+#include "../../src/graphics/dither.h"
+#include "../../src/graphics/band_renderer.h"
+#include "../../src/graphics/render_queue.h"
+#include "../../src/graphics/sprite_cache.h"
+#include "../test_helpers.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_MAX_RESULTS 64
+#define BENCH_SCENE_FRAMES 10
+#define BENCH_SPATIAL_QUERIES 256
+#define BENCH_GRID_CELL_SIZE 64
+#define BENCH_GRID_CELLS 32                 // 2048x2048 world
+#define BENCH_GRID_LOOKUP 65536             // GameObject ids are global and keep growing
+#define BENCH_SPRITE_SIZE 16
+#define BENCH_TILE_SIZE 16
+#define BENCH_TILE_COLUMNS 256
+#define BENCH_TILE_IDS 8
+#define BENCH_ANIMATION_FRAMES 6
+
+typedef struct PoolBench {
+    ObjectPool pool;
+    void** objects;
+} PoolBench;
+
+typedef struct RenderBench {
+    Framebuffer framebuffer;
+    Bitmap sprite;
+    int32_t* positions;                     // x, y pairs
+    RenderQueue queue;
+    SpriteCache cache;
+    BandRenderer bands;
+} RenderBench;
+
+typedef struct DitherBench {
+    uint8_t* gray;
+    GrayImage image;
+    Bitmap bitmap;
+    DitherMethod method;
+    DitherKernel kernel;
+} DitherBench;
+
+typedef struct TilemapBench {
+    Scene* scene;
+    TilemapComponent* tilemap;
+    Framebuffer framebuffer;
+    Bitmap tiles[BENCH_TILE_IDS];
+    RenderCamera camera;
+    uint32_t frame;
+} TilemapBench;
+
+typedef struct AnimationBench {
+    Scene* scene;
+    Bitmap frames[BENCH_ANIMATION_FRAMES];
+    const Bitmap* framePointers[BENCH_ANIMATION_FRAMES];
+    uint16_t durations[BENCH_ANIMATION_FRAMES];
+} AnimationBench;
+
+typedef struct ParticleBench {
+    Scene* scene;
+    ParticleComponent* particles;
+    Framebuffer framebuffer;
+} ParticleBench;
+
+typedef struct CollisionBench {
+    Scene* scene;
+    uint32_t* pairA;
+    uint32_t* pairB;
+    uint32_t frame;
+} CollisionBench;
+
+typedef struct RigidBodyBench {
+    Scene* scene;
+    GameObject** objects;
+} RigidBodyBench;
+
+typedef struct SceneBench {
+    Scene* scene;
+    GameObject** objects;
+    Component** components;
+    SpatialGrid* grid;
+    SpatialQuery* query;
+    uint32_t count;
+    uint32_t frame;
+} SceneBench;
+
+typedef struct SpritePassBench {
+    SceneBench* scene;
+    Framebuffer framebuffer;
+    Bitmap sprite;
+    RenderCamera camera;
+    DirtyRectTracker tracker;
+    uint32_t moving;                        // Sprites moved per frame by the screen passes
+    uint32_t frame;
+} SpritePassBench;
+
+// Deterministic positions so runs are comparable
+static uint32_t g_benchSeed = 12345;
+
+// Object pools
+
+static void* pool_setup(uint32_t count) {
+    PoolBench* bench = calloc(1, sizeof(PoolBench));
+    if (!bench) return NULL;
+
+    bench->objects = malloc(count * sizeof(void*));
+    if (!bench->objects || object_pool_init(&bench->pool, 64, count, "BenchPool") != POOL_OK) {
+        free(bench->objects);
+        free(bench);
+        return NULL;
+    }
+    return bench;
+}
+
+static uint64_t pool_run(void* context, uint32_t count) {
+    PoolBench* bench = context;
+    for (uint32_t i = 0; i < count; i++) {
+        bench->objects[i] = object_pool_alloc(&bench->pool);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        object_pool_free(&bench->pool, bench->objects[i]);
+    }
+    return (uint64_t)count * 2;
+}
+
+static void pool_teardown(void* context) {
+    PoolBench* bench = context;
+    object_pool_destroy(&bench->pool);
+    free(bench->objects);
+    free(bench);
+}
+
+// Scenes, GameObjects and components share this setup
+
+static SceneBench* scene_bench_create(uint32_t count, uint32_t prefilled) {
+    component_registry_init();
+    transform_component_register();
+
+    SceneBench* bench = calloc(1, sizeof(SceneBench));
+    if (!bench) return NULL;
+
+    bench->count = count;
+    bench->scene = scene_create("Benchmark", count + 1);
+    bench->objects = calloc(count, sizeof(GameObject*));
+    bench->components = calloc(count, sizeof(Component*));
+    if (!bench->scene || !bench->objects || !bench->components) {
+        return bench; // Caller checks via scene_bench_valid
+    }
+
+    g_benchSeed = 12345;
+    for (uint32_t i = 0; i < prefilled; i++) {
+        bench->objects[i] = game_object_create(bench->scene);
+        if (!bench->objects[i]) break;
+        // Keep a margin so spatial_update's oscillation stays inside the grid
+        game_object_set_position(bench->objects[i],
+                                 32.0f + test_random_float(&g_benchSeed, BENCH_GRID_CELLS * BENCH_GRID_CELL_SIZE - 64.0f),
+                                 32.0f + test_random_float(&g_benchSeed, BENCH_GRID_CELLS * BENCH_GRID_CELL_SIZE - 64.0f));
+    }
+    return bench;
+}
+
+static void scene_bench_destroy(void* context) {
+    SceneBench* bench = context;
+    if (bench->query) spatial_query_destroy(bench->query);
+    if (bench->grid) spatial_grid_destroy(bench->grid);
+    if (bench->scene) scene_destroy(bench->scene);
+    free(bench->objects);
+    free(bench->components);
+    free(bench);
+    component_registry_shutdown();
+}
+
+static void* scene_bench_valid(SceneBench* bench, uint32_t prefilled) {
+    if (!bench) return NULL;
+    if (!bench->scene || !bench->objects || !bench->components ||
+        (prefilled > 0 && !bench->objects[prefilled - 1])) {
+        scene_bench_destroy(bench);
+        return NULL;
+    }
+    return bench;
+}
+
+static void* component_setup(uint32_t count) {
+    return scene_bench_valid(scene_bench_create(count, 1), 1);
+}
+
+static uint64_t component_run(void* context, uint32_t count) {
+    SceneBench* bench = context;
+    for (uint32_t i = 0; i < count; i++) {
+        bench->components[i] = component_registry_create(COMPONENT_TYPE_TRANSFORM, bench->objects[0]);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        component_registry_destroy(bench->components[i]);
+    }
+    return (uint64_t)count * 2;
+}
+
+static void* gameobject_setup(uint32_t count) {
+    return scene_bench_valid(scene_bench_create(count, 0), 0);
+}
+
+static uint64_t gameobject_run(void* context, uint32_t count) {
+    SceneBench* bench = context;
+    for (uint32_t i = 0; i < count; i++) {
+        bench->objects[i] = game_object_create(bench->scene);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        game_object_destroy(bench->objects[i]);
+    }
+    return (uint64_t)count * 2;
+}
+
+static void* scene_update_setup(uint32_t count) {
+    SceneBench* bench = scene_bench_valid(scene_bench_create(count, count), count);
+    if (bench) {
+        register_default_systems(bench->scene);
+        scene_set_state(bench->scene, SCENE_STATE_ACTIVE);
+    }
+    return bench;
+}
+
+static uint64_t scene_update_run(void* context, uint32_t count) {
+    SceneBench* bench = context;
+    for (uint32_t frame = 0; frame < BENCH_SCENE_FRAMES; frame++) {
+        scene_update(bench->scene, 1.0f / 30.0f);
+    }
+    return (uint64_t)count * BENCH_SCENE_FRAMES;
+}
+
+// Spatial grid
+
+static void* spatial_setup(uint32_t count, bool insert) {
+    SceneBench* bench = scene_bench_valid(scene_bench_create(count, count), count);
+    if (!bench) return NULL;
+
+    bench->grid = spatial_grid_create(BENCH_GRID_CELL_SIZE, BENCH_GRID_CELLS, BENCH_GRID_CELLS,
+                                      0.0f, 0.0f, BENCH_GRID_LOOKUP);
+    bench->query = spatial_query_create(count);
+    if (!bench->grid || !bench->query) {
+        scene_bench_destroy(bench);
+        return NULL;
+    }
+
+    if (insert) {
+        for (uint32_t i = 0; i < count; i++) {
+            spatial_grid_add_object(bench->grid, bench->objects[i]);
+        }
+    }
+    return bench;
+}
+
+static void* spatial_insert_setup(uint32_t count) {
+    return spatial_setup(count, false);
+}
+
+static void spatial_insert_reset(void* context) {
+    SceneBench* bench = context;
+    for (uint32_t i = 0; i < bench->count; i++) {
+        spatial_grid_remove_object(bench->grid, bench->objects[i]);
+    }
+}
+
+static uint64_t spatial_insert_run(void* context, uint32_t count) {
+    SceneBench* bench = context;
+    for (uint32_t i = 0; i < count; i++) {
+        spatial_grid_add_object(bench->grid, bench->objects[i]);
+    }
+    return count;
+}
+
+static void* spatial_populated_setup(uint32_t count) {
+    return spatial_setup(count, true);
+}
+
+static uint64_t spatial_update_run(void* context, uint32_t count) {
+    SceneBench* bench = context;
+
+    // Alternate direction so objects oscillate instead of drifting off the grid
+    float step = (bench->frame++ & 1) ? -24.0f : 24.0f;
+    for (uint32_t i = 0; i < count; i++) {
+        game_object_translate(bench->objects[i], step, step);
+        spatial_grid_update_object(bench->grid, bench->objects[i]);
+    }
+    return count;
+}
+
+static uint64_t spatial_query_run(void* context, uint32_t count) {
+    (void)count;
+    SceneBench* bench = context;
+    uint64_t found = 0;
+    const float world = BENCH_GRID_CELLS * BENCH_GRID_CELL_SIZE;
+    for (uint32_t i = 0; i < BENCH_SPATIAL_QUERIES; i++) {
+        float x = (float)((i * 97u) % BENCH_SPATIAL_QUERIES) / BENCH_SPATIAL_QUERIES * world;
+        float y = (float)((i * 61u) % BENCH_SPATIAL_QUERIES) / BENCH_SPATIAL_QUERIES * world;
+        found += spatial_grid_query_circle(bench->grid, x, y, 96.0f, bench->query);
+    }
+    (void)found;
+    return BENCH_SPATIAL_QUERIES;
+}
+
+// Software rendering
+
+static void render_teardown(void* context) {
+    RenderBench* bench = context;
+    if (!bench) return;
+
+    framebuffer_destroy(&bench->framebuffer);
+    bitmap_destroy(&bench->sprite);
+    render_queue_destroy(&bench->queue);
+    sprite_cache_destroy(&bench->cache);
+    band_renderer_destroy(&bench->bands);
+    free(bench->positions);
+    free(bench);
+}
+
+// Checkerboard disc sprites, some straddling the screen edges
+static void* render_setup(uint32_t count, BlitKernel kernel) {
+    if (!blit_kernel_is_supported(kernel)) return NULL;
+
+    RenderBench* bench = calloc(1, sizeof(RenderBench));
+    if (!bench) return NULL;
+
+    bench->positions = malloc(count * 2 * sizeof(int32_t));
+    if (!bench->positions ||
+        framebuffer_init(&bench->framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) != FRAMEBUFFER_OK ||
+        bitmap_init(&bench->sprite, BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE) != BITMAP_OK ||
+        render_queue_init(&bench->queue, count) != RENDER_QUEUE_OK) {
+        render_teardown(bench);
+        return NULL;
+    }
+    framebuffer_set_blit_kernel(&bench->framebuffer, kernel);
+
+    const int32_t radius = BENCH_SPRITE_SIZE / 2;
+    for (int32_t y = 0; y < BENCH_SPRITE_SIZE; y++) {
+        for (int32_t x = 0; x < BENCH_SPRITE_SIZE; x++) {
+            int32_t dx = x - radius, dy = y - radius;
+            if (dx * dx + dy * dy < radius * radius) {
+                bitmap_set_pixel(&bench->sprite, x, y, (x + y) & 1 ? BITMAP_COLOR_BLACK : BITMAP_COLOR_WHITE);
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        bench->positions[i * 2] = (int32_t)test_random_float(&g_benchSeed, FRAMEBUFFER_WIDTH + BENCH_SPRITE_SIZE) - BENCH_SPRITE_SIZE / 2;
+        bench->positions[i * 2 + 1] = (int32_t)test_random_float(&g_benchSeed, FRAMEBUFFER_HEIGHT + BENCH_SPRITE_SIZE) - BENCH_SPRITE_SIZE / 2;
+    }
+    return bench;
+}
+
+static void* render_scalar32_setup(uint32_t count) {
+    return render_setup(count, BLIT_KERNEL_SCALAR32);
+}
+
+static void* render_scalar64_setup(uint32_t count) {
+    return render_setup(count, BLIT_KERNEL_SCALAR64);
+}
+
+static void* render_simd_setup(uint32_t count) {
+    return render_setup(count, BLIT_KERNEL_SIMD);
+}
+
+static void* render_best_setup(uint32_t count) {
+    return render_setup(count, blit_kernel_best());
+}
+
+static void* render_preshifted_setup(uint32_t count) {
+    RenderBench* bench = render_setup(count, blit_kernel_best());
+    if (bench && sprite_cache_init(&bench->cache, 16, 16 * 1024) != SPRITE_CACHE_OK) {
+        render_teardown(bench);
+        return NULL;
+    }
+    return bench;
+}
+
+static void* render_bands_setup(uint32_t count, uint32_t threads) {
+    RenderBench* bench = render_setup(count, blit_kernel_best());
+    if (bench && band_renderer_init(&bench->bands, 8, threads) != BAND_RENDERER_OK) {
+        render_teardown(bench);
+        return NULL;
+    }
+    return bench;
+}
+
+static void* render_bands_serial_setup(uint32_t count) {
+    return render_bands_setup(count, 0);
+}
+
+static void* render_bands_parallel_setup(uint32_t count) {
+    return render_bands_setup(count, 3);
+}
+
+static uint64_t render_blit_run(void* context, uint32_t count) {
+    RenderBench* bench = context;
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    for (uint32_t i = 0; i < count; i++) {
+        framebuffer_blit(&bench->framebuffer, &bench->sprite, bench->positions[i * 2], bench->positions[i * 2 + 1]);
+    }
+    return count;
+}
+
+// Same draws through the pre-shifted copies (edge-straddling sprites fall back)
+static uint64_t render_preshifted_run(void* context, uint32_t count) {
+    RenderBench* bench = context;
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    for (uint32_t i = 0; i < count; i++) {
+        sprite_cache_blit(&bench->cache, &bench->framebuffer, &bench->sprite, bench->positions[i * 2],
+                          bench->positions[i * 2 + 1], BLIT_MODE_COPY);
+    }
+    return count;
+}
+
+static void render_queue_fill(RenderBench* bench, uint32_t count) {
+    render_queue_clear(&bench->queue);
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t x = bench->positions[i * 2];
+        int32_t y = bench->positions[i * 2 + 1];
+        uint64_t key = render_key_make((uint8_t)(i & 3), 0, 0, BLIT_MODE_COPY, y + BENCH_SPRITE_SIZE);
+        render_queue_submit(&bench->queue, key, &bench->sprite, x, y);
+    }
+}
+
+// Full sprite pass: submit, radix sort by layer/y, batched execute
+static uint64_t render_queue_run(void* context, uint32_t count) {
+    RenderBench* bench = context;
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    render_queue_fill(bench, count);
+    render_queue_execute(&bench->queue, &bench->framebuffer);
+    return count;
+}
+
+// Same pass binned into 8 bands, drawn by the caller alone or with 3 workers
+// (workers inherit the CPU pin; run with --cpu -1 to let them spread)
+static uint64_t render_bands_run(void* context, uint32_t count) {
+    RenderBench* bench = context;
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    render_queue_fill(bench, count);
+    band_renderer_execute(&bench->bands, &bench->queue, &bench->framebuffer);
+    return count;
+}
+
+// Grayscale to 1-bit conversion of a screen-sized image (param = pixels)
+
+static void dither_teardown(void* context) {
+    DitherBench* bench = context;
+    if (!bench) return;
+
+    bitmap_destroy(&bench->bitmap);
+    free(bench->gray);
+    free(bench);
+}
+
+// Radial gradient with some noise, FRAMEBUFFER_WIDTH pixels wide
+static void* dither_setup(uint32_t count, DitherMethod method, DitherKernel kernel) {
+    if (!dither_kernel_is_supported(kernel)) return NULL;
+
+    DitherBench* bench = calloc(1, sizeof(DitherBench));
+    if (!bench) return NULL;
+
+    uint32_t width = FRAMEBUFFER_WIDTH;
+    uint32_t height = count / width;
+    bench->gray = malloc((size_t)width * height);
+    if (!bench->gray || bitmap_init(&bench->bitmap, width, height) != BITMAP_OK) {
+        dither_teardown(bench);
+        return NULL;
+    }
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            int32_t dx = (int32_t)x - (int32_t)width / 2, dy = (int32_t)y - (int32_t)height / 2;
+            int32_t value = 255 - (dx * dx + dy * dy) / 160 + (int32_t)test_random_float(&g_benchSeed, 16);
+            bench->gray[y * width + x] = (uint8_t)(value < 0 ? 0 : value > 255 ? 255 : value);
+        }
+    }
+    bench->image = (GrayImage){bench->gray, NULL, width, height, width};
+    bench->method = method;
+    bench->kernel = kernel;
+    return bench;
+}
+
+static void* dither_bayer_scalar_setup(uint32_t count) {
+    return dither_setup(count, DITHER_BAYER_8X8, DITHER_KERNEL_SCALAR);
+}
+
+static void* dither_bayer_simd_setup(uint32_t count) {
+    return dither_setup(count, DITHER_BAYER_8X8, DITHER_KERNEL_SIMD);
+}
+
+static void* dither_floyd_steinberg_setup(uint32_t count) {
+    return dither_setup(count, DITHER_FLOYD_STEINBERG, DITHER_KERNEL_SCALAR);
+}
+
+static void* dither_atkinson_setup(uint32_t count) {
+    return dither_setup(count, DITHER_ATKINSON, DITHER_KERNEL_SCALAR);
+}
+
+// The per-pixel loop the converter replaces: a threshold per pixel, then
+// bitmap_set_pixel()
+static uint64_t dither_naive_run(void* context, uint32_t count) {
+    DitherBench* bench = context;
+    for (uint32_t y = 0; y < bench->image.height; y++) {
+        for (uint32_t x = 0; x < bench->image.width; x++) {
+            uint8_t value = bench->gray[y * bench->image.stride + x];
+            bitmap_set_pixel(&bench->bitmap, (int32_t)x, (int32_t)y,
+                             value > 127 ? BITMAP_COLOR_WHITE : BITMAP_COLOR_BLACK);
+        }
+    }
+    return count;
+}
+
+static uint64_t dither_run(void* context, uint32_t count) {
+    DitherBench* bench = context;
+    dither_convert(&bench->image, bench->method, bench->kernel, &bench->bitmap);
+    return count;
+}
+
+// Sprite pass over a whole level with the camera seeing a few percent of it
+
+static void sprite_pass_teardown(void* context) {
+    SpritePassBench* bench = context;
+    if (!bench) return;
+
+    if (bench->scene) scene_bench_destroy(bench->scene);
+    framebuffer_destroy(&bench->framebuffer);
+    bitmap_destroy(&bench->sprite);
+    dirty_rect_tracker_destroy(&bench->tracker);
+    sprite_system_shutdown();
+    free(bench);
+}
+
+static void* sprite_pass_setup(uint32_t count, bool culling) {
+    SpritePassBench* bench = calloc(1, sizeof(SpritePassBench));
+    if (!bench) return NULL;
+
+    bench->scene = spatial_setup(count, true);
+    if (!bench->scene || sprite_component_register() != COMPONENT_OK ||
+        framebuffer_init(&bench->framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) != FRAMEBUFFER_OK ||
+        bitmap_init(&bench->sprite, BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE) != BITMAP_OK) {
+        sprite_pass_teardown(bench);
+        return NULL;
+    }
+    bitmap_fill(&bench->sprite, BITMAP_COLOR_BLACK);
+
+    for (uint32_t i = 0; i < count; i++) {
+        SpriteComponent* sprite = sprite_component_create(bench->scene->objects[i]);
+        if (!sprite) {
+            sprite_pass_teardown(bench);
+            return NULL;
+        }
+        sprite_component_set_bitmap(sprite, &bench->sprite);
+        game_object_add_component(bench->scene->objects[i], (Component*)sprite);
+    }
+    scene_rebuild_component_arrays(bench->scene->scene);
+    bench->scene->grid->enableFrustumCulling = culling;
+
+    const float world = BENCH_GRID_CELLS * BENCH_GRID_CELL_SIZE;
+    bench->camera = (RenderCamera){(world - FRAMEBUFFER_WIDTH) / 2, (world - FRAMEBUFFER_HEIGHT) / 2,
+                                   FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT};
+    framebuffer_set_render_target(&bench->framebuffer);
+    return bench;
+}
+
+static void* sprite_pass_full_setup(uint32_t count) {
+    return sprite_pass_setup(count, false);
+}
+
+static void* sprite_pass_culled_setup(uint32_t count) {
+    return sprite_pass_setup(count, true);
+}
+
+static uint64_t sprite_pass_run(void* context, uint32_t count) {
+    SpritePassBench* bench = context;
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    sprite_system_render_culled(bench->scene->scene, bench->scene->grid, &bench->camera);
+    return count;
+}
+
+// Screen-space sprite passes including the display transfer: a full redraw
+// every frame vs dirty regions, with nothing or a few sprites moving
+static uint8_t g_displayRows[FRAMEBUFFER_HEIGHT * FRAMEBUFFER_ROW_BYTES];
+
+static void* sprite_screen_setup(uint32_t count, uint32_t moving) {
+    SpritePassBench* bench = sprite_pass_setup(count, false);
+    if (!bench) return NULL;
+
+    if (dirty_rect_tracker_init(&bench->tracker, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) != DIRTY_RECT_OK) {
+        sprite_pass_teardown(bench);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        transform_component_set_position(bench->scene->objects[i]->transform,
+                                         test_random_float(&g_benchSeed, FRAMEBUFFER_WIDTH), test_random_float(&g_benchSeed, FRAMEBUFFER_HEIGHT));
+    }
+    bench->moving = moving < count ? moving : count;
+    sprite_system_render_dirty(bench->scene->scene, &bench->tracker);
+    return bench;
+}
+
+static void* sprite_screen_static_setup(uint32_t count) {
+    return sprite_screen_setup(count, 0);
+}
+
+static void* sprite_screen_moving_setup(uint32_t count) {
+    return sprite_screen_setup(count, 4);
+}
+
+static void sprite_screen_move(SpritePassBench* bench) {
+    float step = bench->frame++ & 1 ? -3.0f : 3.0f;
+    for (uint32_t i = 0; i < bench->moving; i++) {
+        transform_component_translate(bench->scene->objects[i]->transform, step, step);
+    }
+}
+
+static uint64_t sprite_screen_full_run(void* context, uint32_t count) {
+    SpritePassBench* bench = context;
+    Scene* scene = bench->scene->scene;
+    sprite_screen_move(bench);
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    sprite_system_render_batch(scene->spriteComponents, scene->spriteCount);
+    framebuffer_export_rows(&bench->framebuffer, g_displayRows, FRAMEBUFFER_ROW_BYTES);
+    return count;
+}
+
+static uint64_t sprite_screen_dirty_run(void* context, uint32_t count) {
+    SpritePassBench* bench = context;
+    sprite_screen_move(bench);
+    sprite_system_render_dirty(bench->scene->scene, &bench->tracker);
+    dirty_rect_tracker_export_rows(&bench->tracker, &bench->framebuffer, g_displayRows, FRAMEBUFFER_ROW_BYTES);
+    return count;
+}
+
+// Scrolling view over a tilemap level (param = tiles in the level)
+
+static void tilemap_teardown(void* context) {
+    TilemapBench* bench = context;
+    if (!bench) return;
+
+    if (bench->scene) scene_destroy(bench->scene);
+    framebuffer_destroy(&bench->framebuffer);
+    for (uint32_t i = 0; i < BENCH_TILE_IDS; i++) {
+        bitmap_destroy(&bench->tiles[i]);
+    }
+    free(bench);
+    component_registry_shutdown();
+}
+
+static void* tilemap_setup(uint32_t count) {
+    component_registry_init();
+    transform_component_register();
+
+    TilemapBench* bench = calloc(1, sizeof(TilemapBench));
+    if (!bench) return NULL;
+
+    const Bitmap* tileset[BENCH_TILE_IDS] = {NULL};
+    uint32_t rows = (count + BENCH_TILE_COLUMNS - 1) / BENCH_TILE_COLUMNS;
+    bench->scene = scene_create("TilemapBench", 2);
+    GameObject* level = bench->scene ? game_object_create(bench->scene) : NULL;
+    bench->tilemap = level ? tilemap_component_create(level) : NULL;
+    if (!bench->tilemap || game_object_add_component(level, (Component*)bench->tilemap) != GAMEOBJECT_OK ||
+        tilemap_component_set_size(bench->tilemap, BENCH_TILE_COLUMNS, rows, BENCH_TILE_SIZE) != TILEMAP_OK ||
+        framebuffer_init(&bench->framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) != FRAMEBUFFER_OK) {
+        tilemap_teardown(bench);
+        return NULL;
+    }
+
+    // Checkered tiles with a transparent corner; a quarter of the map is empty
+    g_benchSeed = 12345;
+    for (uint32_t id = 1; id < BENCH_TILE_IDS; id++) {
+        if (bitmap_init(&bench->tiles[id], BENCH_TILE_SIZE, BENCH_TILE_SIZE) != BITMAP_OK) {
+            tilemap_teardown(bench);
+            return NULL;
+        }
+        for (uint32_t y = 0; y < BENCH_TILE_SIZE; y++) {
+            for (uint32_t x = 0; x < BENCH_TILE_SIZE; x++) {
+                if (x + y < id) continue;
+                bitmap_set_pixel(&bench->tiles[id], (int32_t)x, (int32_t)y,
+                                 ((x / id + y) & 1) ? BITMAP_COLOR_BLACK : BITMAP_COLOR_WHITE);
+            }
+        }
+        tileset[id] = &bench->tiles[id];
+    }
+    if (tilemap_component_set_tileset(bench->tilemap, tileset, BENCH_TILE_IDS) != TILEMAP_OK) {
+        tilemap_teardown(bench);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t id = (uint32_t)test_random_float(&g_benchSeed, BENCH_TILE_IDS * 4 / 3);
+        tilemap_component_set_tile(bench->tilemap, (int32_t)(i % BENCH_TILE_COLUMNS), (int32_t)(i / BENCH_TILE_COLUMNS),
+                                   (uint8_t)(id < BENCH_TILE_IDS ? id : TILEMAP_EMPTY_TILE));
+    }
+    bench->camera = (RenderCamera){0.0f, 0.0f, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT};
+    return bench;
+}
+
+// Diagonal scroll so every sub-word shift is exercised
+static void tilemap_scroll(TilemapBench* bench) {
+    uint32_t step = bench->frame++ % 512;
+    bench->camera.x = (float)(step * 3);
+    bench->camera.y = (float)(step % 128);
+}
+
+// What the component replaces: one clipped blit per visible tile
+static uint64_t tilemap_per_tile_run(void* context, uint32_t count) {
+    TilemapBench* bench = context;
+    tilemap_scroll(bench);
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+
+    int32_t cameraX = (int32_t)bench->camera.x, cameraY = (int32_t)bench->camera.y;
+    int32_t column0 = cameraX / BENCH_TILE_SIZE, row0 = cameraY / BENCH_TILE_SIZE;
+    int32_t column1 = (cameraX + FRAMEBUFFER_WIDTH - 1) / BENCH_TILE_SIZE;
+    int32_t row1 = (cameraY + FRAMEBUFFER_HEIGHT - 1) / BENCH_TILE_SIZE;
+    for (int32_t row = row0; row <= row1; row++) {
+        for (int32_t column = column0; column <= column1; column++) {
+            uint8_t id = tilemap_component_get_tile(bench->tilemap, column, row);
+            if (id == TILEMAP_EMPTY_TILE) continue;
+            framebuffer_blit(&bench->framebuffer, &bench->tiles[id],
+                             column * BENCH_TILE_SIZE - cameraX, row * BENCH_TILE_SIZE - cameraY);
+        }
+    }
+    return count;
+}
+
+static uint64_t tilemap_render_run(void* context, uint32_t count) {
+    TilemapBench* bench = context;
+    tilemap_scroll(bench);
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    tilemap_component_render(bench->tilemap, &bench->framebuffer, &bench->camera);
+    return count;
+}
+
+// Animated sprites at 60 Hz (param = instances); 100 ms frames, so about one
+// in six instances changes frame each update
+
+static void animation_teardown(void* context) {
+    AnimationBench* bench = context;
+    if (!bench) return;
+
+    if (bench->scene) scene_destroy(bench->scene);
+    for (uint32_t i = 0; i < BENCH_ANIMATION_FRAMES; i++) {
+        bitmap_destroy(&bench->frames[i]);
+    }
+    free(bench);
+    animation_system_shutdown();
+    component_registry_shutdown();
+}
+
+static void* animation_setup(uint32_t count) {
+    component_registry_init();
+    transform_component_register_with_capacity(count + 1);
+    sprite_component_register_with_capacity(count);
+    animation_component_register_with_capacity(count);
+
+    AnimationBench* bench = calloc(1, sizeof(AnimationBench));
+    if (!bench) return NULL;
+
+    for (uint32_t i = 0; i < BENCH_ANIMATION_FRAMES; i++) {
+        if (bitmap_init(&bench->frames[i], BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE) != BITMAP_OK) {
+            animation_teardown(bench);
+            return NULL;
+        }
+        bench->framePointers[i] = &bench->frames[i];
+        bench->durations[i] = 100;
+    }
+    uint16_t clip;
+    AnimationClip walk = {bench->framePointers, bench->durations, BENCH_ANIMATION_FRAMES, true};
+    bench->scene = scene_create("AnimationBench", count + 1);
+    if (!bench->scene || animation_clip_add(&walk, &clip) != ANIMATION_OK) {
+        animation_teardown(bench);
+        return NULL;
+    }
+
+    // Staggered starts so frame changes spread over the updates
+    g_benchSeed = 12345;
+    for (uint32_t i = 0; i < count; i++) {
+        GameObject* object = game_object_create(bench->scene);
+        SpriteComponent* sprite = object ? sprite_component_create(object) : NULL;
+        AnimationComponent* animation = object ? animation_component_create(object) : NULL;
+        if (!sprite || !animation) {
+            animation_teardown(bench);
+            return NULL;
+        }
+        game_object_add_component(object, (Component*)sprite);
+        game_object_add_component(object, (Component*)animation);
+        animation_component_play(animation, clip);
+        animation_system_update(bench->scene, test_random_float(&g_benchSeed, 0.6f));
+    }
+    return bench;
+}
+
+static uint64_t animation_advance_run(void* context, uint32_t count) {
+    AnimationBench* bench = context;
+    animation_system_update(bench->scene, 1.0f / 60.0f);
+    return count;
+}
+
+// One emitter at steady state (param = particles): lifetimes of 1-3 s and
+// a rate that replaces what dies, gravity and drag
+
+static void particle_teardown(void* context) {
+    ParticleBench* bench = context;
+    if (!bench) return;
+
+    if (bench->scene) scene_destroy(bench->scene);
+    framebuffer_destroy(&bench->framebuffer);
+    free(bench);
+    component_registry_shutdown();
+}
+
+static void* particle_setup(uint32_t count, ParticleKernel kernel) {
+    component_registry_init();
+    transform_component_register();
+
+    ParticleBench* bench = calloc(1, sizeof(ParticleBench));
+    if (!bench) return NULL;
+
+    bench->scene = scene_create("ParticleBench", 2);
+    GameObject* emitter = bench->scene ? game_object_create(bench->scene) : NULL;
+    bench->particles = emitter ? particle_component_create(emitter) : NULL;
+    if (!bench->particles || game_object_add_component(emitter, (Component*)bench->particles) != GAMEOBJECT_OK ||
+        particle_component_set_capacity(bench->particles, count) != PARTICLE_OK ||
+        particle_component_set_kernel(bench->particles, kernel) != PARTICLE_OK ||
+        framebuffer_init(&bench->framebuffer, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT) != FRAMEBUFFER_OK) {
+        particle_teardown(bench);
+        return NULL;
+    }
+
+    ParticleEmitterConfig config = {
+        .rate = (float)count / 2.0f,
+        .lifetimeMin = 1.0f,
+        .lifetimeMax = 3.0f,
+        .speedMin = 20.0f,
+        .speedMax = 120.0f,
+        .direction = -1.5707964f,
+        .spread = 2.0f,
+        .gravityY = 60.0f,
+        .drag = 0.3f
+    };
+    transform_component_set_position(emitter->transform, FRAMEBUFFER_WIDTH / 2, FRAMEBUFFER_HEIGHT - 20);
+    particle_component_set_config(bench->particles, &config);
+    particle_component_set_emitting(bench->particles, true);
+    particle_component_emit(bench->particles, count);
+    return bench;
+}
+
+static void* particle_scalar_setup(uint32_t count) {
+    return particle_setup(count, PARTICLE_KERNEL_SCALAR);
+}
+
+static void* particle_simd_setup(uint32_t count) {
+    return particle_kernel_is_supported(PARTICLE_KERNEL_SIMD) ? particle_setup(count, PARTICLE_KERNEL_SIMD) : NULL;
+}
+
+static void* particle_best_setup(uint32_t count) {
+    return particle_setup(count, particle_kernel_best());
+}
+
+// Operations are the live particles, which hover around the param
+static uint64_t particle_update_run(void* context, uint32_t count) {
+    (void)count;
+    ParticleBench* bench = context;
+    particle_component_update(bench->particles, 1.0f / 60.0f);
+    return bench->particles->count;
+}
+
+static uint64_t particle_render_run(void* context, uint32_t count) {
+    (void)count;
+    ParticleBench* bench = context;
+    framebuffer_clear(&bench->framebuffer, BITMAP_COLOR_WHITE);
+    particle_component_render(bench->particles, &bench->framebuffer, NULL);
+    return bench->particles->count;
+}
+
+// Mixed boxes and circles, 8-24 px, scattered over the screen; the
+// narrow-phase cases test param pairs of nearby colliders, about a quarter
+// of which overlap
+
+#define BENCH_COLLIDERS 950
+
+static void collision_teardown(void* context) {
+    CollisionBench* bench = context;
+    if (!bench) return;
+
+    if (bench->scene) scene_destroy(bench->scene);
+    free(bench->pairA);
+    free(bench->pairB);
+    free(bench);
+    component_registry_shutdown();
+    collision_system_shutdown();
+    collision_system_set_kernel(collision_kernel_best());
+}
+
+static void* collision_setup(uint32_t count, CollisionKernel kernel) {
+    component_registry_init();
+    transform_component_register();
+    g_benchSeed = 12345;
+
+    CollisionBench* bench = calloc(1, sizeof(CollisionBench));
+    if (!bench) return NULL;
+
+    bench->scene = scene_create("CollisionBench", BENCH_COLLIDERS);
+    bench->pairA = malloc(count * sizeof(uint32_t));
+    bench->pairB = malloc(count * sizeof(uint32_t));
+    if (!bench->scene || !bench->pairA || !bench->pairB ||
+        collision_system_set_kernel(kernel) != COLLISION_OK) {
+        collision_teardown(bench);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < BENCH_COLLIDERS; i++) {
+        GameObject* object = game_object_create(bench->scene);
+        CollisionComponent* collider = object ? collision_component_create(object) : NULL;
+        if (!collider || game_object_add_component(object, (Component*)collider) != GAMEOBJECT_OK) {
+            collision_teardown(bench);
+            return NULL;
+        }
+        transform_component_set_position(object->transform, test_random_float(&g_benchSeed, FRAMEBUFFER_WIDTH),
+                                         test_random_float(&g_benchSeed, FRAMEBUFFER_HEIGHT));
+        if (i % 3 == 0) {
+            collision_component_set_circle(collider, 4.0f + test_random_float(&g_benchSeed, 8.0f));
+        } else {
+            collision_component_set_aabb(collider, 8.0f + test_random_float(&g_benchSeed, 16.0f), 8.0f + test_random_float(&g_benchSeed, 16.0f));
+        }
+    }
+
+    // Store order is creation order, so neighbouring indices are unrelated
+    // colliders; pairs are drawn from the colliders near each one instead
+    const CollisionColliders* store = collision_colliders_get();
+    for (uint32_t n = 0; n < count; n++) {
+        uint32_t a = (uint32_t)test_random_float(&g_benchSeed, BENCH_COLLIDERS) % BENCH_COLLIDERS;
+        uint32_t b = a;
+        for (int attempt = 0; attempt < 64 && (b == a || fabsf(store->minX[b] - store->minX[a]) > 32.0f ||
+                                               fabsf(store->minY[b] - store->minY[a]) > 32.0f); attempt++) {
+            b = (uint32_t)test_random_float(&g_benchSeed, BENCH_COLLIDERS) % BENCH_COLLIDERS;
+        }
+        bench->pairA[n] = a;
+        bench->pairB[n] = b;
+    }
+    return bench;
+}
+
+static void* collision_scalar_setup(uint32_t count) {
+    return collision_setup(count, COLLISION_KERNEL_SCALAR);
+}
+
+static void* collision_simd_setup(uint32_t count) {
+    return collision_kernel_is_supported(COLLISION_KERNEL_SIMD) ? collision_setup(count, COLLISION_KERNEL_SIMD) : NULL;
+}
+
+static void* collision_best_setup(uint32_t count) {
+    return collision_setup(count, collision_kernel_best());
+}
+
+// Shooter mix: 70% player bullets (hit enemies only), 20% enemies, 10%
+// player-side colliders
+static void* collision_layers_setup(uint32_t count) {
+    CollisionBench* bench = collision_setup(count, collision_kernel_best());
+    if (!bench) return NULL;
+
+    const CollisionColliders* store = collision_colliders_get();
+    for (uint32_t i = 0; i < store->count; i++) {
+        uint32_t kind = i % 10;
+        uint32_t layer = kind < 7 ? 0x2 : kind < 9 ? 0x4 : 0x1;
+        uint32_t mask = kind < 7 ? 0x4 : kind < 9 ? 0x3 : 0x4;
+        collision_component_set_layer(store->owners[i], layer);
+        collision_component_set_mask(store->owners[i], mask);
+    }
+    return bench;
+}
+
+// Every 20th collider is a continuous bullet crossing 120 px per update
+static void* collision_ccd_setup(uint32_t count) {
+    CollisionBench* bench = collision_setup(count, collision_kernel_best());
+    if (!bench) return NULL;
+
+    const CollisionColliders* store = collision_colliders_get();
+    for (uint32_t i = 0; i < store->count; i += 20) {
+        collision_component_set_aabb(store->owners[i], 2.0f, 2.0f);
+        collision_component_set_continuous(store->owners[i], true);
+    }
+    return bench;
+}
+
+static uint64_t collision_ccd_run(void* context, uint32_t count) {
+    (void)count;
+    CollisionBench* bench = context;
+    const CollisionColliders* store = collision_colliders_get();
+    float step = bench->frame++ % 2 ? -120.0f : 120.0f;
+    for (uint32_t i = 0; i < store->count; i++) {
+        if (!store->continuous[i]) continue;
+        TransformComponent* transform = store->owners[i]->base.gameObject->transform;
+        float x, y;
+        transform_component_get_position(transform, &x, &y);
+        transform_component_set_position(transform, x + step, y);
+    }
+    collision_system_update(bench->scene);
+    return BENCH_COLLIDERS;
+}
+
+static uint64_t collision_narrow_run(void* context, uint32_t count) {
+    CollisionBench* bench = context;
+    collision_system_test_pairs(bench->pairA, bench->pairB, count);
+    return count;
+}
+
+// Full update: refresh, grid rebuild and narrow phase; operations are colliders
+static uint64_t collision_update_run(void* context, uint32_t count) {
+    (void)count;
+    CollisionBench* bench = context;
+    collision_system_update(bench->scene);
+    return BENCH_COLLIDERS;
+}
+
+// Falling, damped bodies scattered over the screen (param = bodies); every
+// eighth is at rest
+
+static void rigidbody_teardown(void* context) {
+    RigidBodyBench* bench = context;
+    if (!bench) return;
+
+    if (bench->scene) scene_destroy(bench->scene);
+    free(bench->objects);
+    free(bench);
+    component_registry_shutdown();
+    rigidbody_system_shutdown();
+    rigidbody_bodies_shutdown();
+}
+
+static void* rigidbody_setup(uint32_t count, RigidBodyKernel kernel) {
+    component_registry_init();
+    transform_component_register();
+    g_benchSeed = 12345;
+
+    RigidBodyBench* bench = calloc(1, sizeof(RigidBodyBench));
+    if (!bench) return NULL;
+
+    bench->scene = scene_create("RigidBodyBench", count);
+    bench->objects = calloc(count, sizeof(GameObject*));
+    if (!bench->scene || !bench->objects || rigidbody_system_set_kernel(kernel) != RIGIDBODY_OK) {
+        rigidbody_teardown(bench);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        GameObject* object = game_object_create(bench->scene);
+        RigidBodyComponent* body = object ? rigidbody_component_create(object) : NULL;
+        if (!body || game_object_add_component(object, (Component*)body) != GAMEOBJECT_OK) {
+            rigidbody_teardown(bench);
+            return NULL;
+        }
+        bench->objects[i] = object;
+        transform_component_set_position(object->transform, test_random_float(&g_benchSeed, FRAMEBUFFER_WIDTH),
+                                         test_random_float(&g_benchSeed, FRAMEBUFFER_HEIGHT));
+        if (i % 8 == 0) continue;
+        rigidbody_component_set_velocity(body, test_random_float(&g_benchSeed, 200.0f) - 100.0f, test_random_float(&g_benchSeed, 200.0f) - 100.0f);
+        rigidbody_component_set_acceleration(body, 0.0f, 400.0f);
+        rigidbody_component_set_damping(body, test_random_float(&g_benchSeed, 0.5f));
+    }
+    return bench;
+}
+
+static void* rigidbody_scalar_setup(uint32_t count) {
+    return rigidbody_setup(count, RIGIDBODY_KERNEL_SCALAR);
+}
+
+static void* rigidbody_simd_setup(uint32_t count) {
+    return rigidbody_kernel_is_supported(RIGIDBODY_KERNEL_SIMD) ? rigidbody_setup(count, RIGIDBODY_KERNEL_SIMD) : NULL;
+}
+
+static uint64_t rigidbody_step_run(void* context, uint32_t count) {
+    RigidBodyBench* bench = context;
+    rigidbody_system_step(bench->scene, 1.0f / 60.0f);
+    return count;
+}
+
+// The same motion done one object at a time through the component API
+static uint64_t rigidbody_per_object_run(void* context, uint32_t count) {
+    RigidBodyBench* bench = context;
+    const float dt = 1.0f / 60.0f;
+    for (uint32_t i = 0; i < count; i++) {
+        GameObject* object = bench->objects[i];
+        RigidBodyComponent* body = (RigidBodyComponent*)game_object_get_component(object, COMPONENT_TYPE_RIGIDBODY);
+        const RigidBodies* store = rigidbody_bodies_get();
+        float vx, vy;
+        rigidbody_component_get_velocity(body, &vx, &vy);
+        float keep = fmaxf(1.0f - store->damping[body->slot] * dt, 0.0f);
+        vx = vx * keep + store->ax[body->slot] * dt;
+        vy = vy * keep + store->ay[body->slot] * dt;
+        rigidbody_component_set_velocity(body, vx, vy);
+        if (vx != 0.0f || vy != 0.0f) {
+            transform_component_translate(object->transform, vx * dt, vy * dt);
+        }
+    }
+    return count;
+}
+
+// Transform pool capacity (DEFAULT_COMPONENT_POOL_SIZE) bounds the object counts
+static const BenchmarkCase g_cases[] = {
+    {"pool_alloc_free", pool_setup, NULL, pool_run, pool_teardown, 1000},
+    {"pool_alloc_free", pool_setup, NULL, pool_run, pool_teardown, 10000},
+    {"component_create_destroy", component_setup, NULL, component_run, scene_bench_destroy, 500},
+    {"spatial_insert", spatial_insert_setup, spatial_insert_reset, spatial_insert_run, scene_bench_destroy, 100},
+    {"spatial_insert", spatial_insert_setup, spatial_insert_reset, spatial_insert_run, scene_bench_destroy, 500},
+    {"spatial_insert", spatial_insert_setup, spatial_insert_reset, spatial_insert_run, scene_bench_destroy, 950},
+    {"spatial_update", spatial_populated_setup, NULL, spatial_update_run, scene_bench_destroy, 100},
+    {"spatial_update", spatial_populated_setup, NULL, spatial_update_run, scene_bench_destroy, 500},
+    {"spatial_update", spatial_populated_setup, NULL, spatial_update_run, scene_bench_destroy, 950},
+    {"spatial_query_circle", spatial_populated_setup, NULL, spatial_query_run, scene_bench_destroy, 100},
+    {"spatial_query_circle", spatial_populated_setup, NULL, spatial_query_run, scene_bench_destroy, 500},
+    {"spatial_query_circle", spatial_populated_setup, NULL, spatial_query_run, scene_bench_destroy, 950},
+    {"scene_update", scene_update_setup, NULL, scene_update_run, scene_bench_destroy, 100},
+    {"scene_update", scene_update_setup, NULL, scene_update_run, scene_bench_destroy, 950},
+    {"gameobject_create_destroy", gameobject_setup, NULL, gameobject_run, scene_bench_destroy, 100},
+    {"gameobject_create_destroy", gameobject_setup, NULL, gameobject_run, scene_bench_destroy, 950},
+    {"render_blit_scalar32", render_scalar32_setup, NULL, render_blit_run, render_teardown, 1000},
+    {"render_blit_scalar64", render_scalar64_setup, NULL, render_blit_run, render_teardown, 1000},
+    {"render_blit_simd", render_simd_setup, NULL, render_blit_run, render_teardown, 1000},
+    {"render_blit_preshifted", render_preshifted_setup, NULL, render_preshifted_run, render_teardown, 1000},
+    {"render_queue_sorted", render_best_setup, NULL, render_queue_run, render_teardown, 1000},
+    {"render_bands_serial", render_bands_serial_setup, NULL, render_bands_run, render_teardown, 1000},
+    {"render_bands_parallel", render_bands_parallel_setup, NULL, render_bands_run, render_teardown, 1000},
+    {"sprite_pass_full", sprite_pass_full_setup, NULL, sprite_pass_run, sprite_pass_teardown, 950},
+    {"sprite_pass_culled", sprite_pass_culled_setup, NULL, sprite_pass_run, sprite_pass_teardown, 950},
+    {"dither_naive_set_pixel", dither_bayer_scalar_setup, NULL, dither_naive_run, dither_teardown, 96000},
+    {"dither_bayer8_scalar", dither_bayer_scalar_setup, NULL, dither_run, dither_teardown, 96000},
+    {"dither_bayer8_simd", dither_bayer_simd_setup, NULL, dither_run, dither_teardown, 96000},
+    {"dither_floyd_steinberg", dither_floyd_steinberg_setup, NULL, dither_run, dither_teardown, 96000},
+    {"dither_atkinson", dither_atkinson_setup, NULL, dither_run, dither_teardown, 96000},
+    {"tilemap_render_per_tile", tilemap_setup, NULL, tilemap_per_tile_run, tilemap_teardown, 50000},
+    {"tilemap_render_chunked", tilemap_setup, NULL, tilemap_render_run, tilemap_teardown, 50000},
+    {"animation_advance", animation_setup, NULL, animation_advance_run, animation_teardown, 1000},
+    {"animation_advance", animation_setup, NULL, animation_advance_run, animation_teardown, 10000},
+    {"particles_update_scalar", particle_scalar_setup, NULL, particle_update_run, particle_teardown, 50000},
+    {"particles_update_simd", particle_simd_setup, NULL, particle_update_run, particle_teardown, 50000},
+    {"particles_render_points", particle_best_setup, NULL, particle_render_run, particle_teardown, 50000},
+    {"collision_narrow_scalar", collision_scalar_setup, NULL, collision_narrow_run, collision_teardown, 65536},
+    {"collision_narrow_simd", collision_simd_setup, NULL, collision_narrow_run, collision_teardown, 65536},
+    {"collision_update", collision_best_setup, NULL, collision_update_run, collision_teardown, BENCH_COLLIDERS},
+    {"collision_update_layers", collision_layers_setup, NULL, collision_update_run, collision_teardown, BENCH_COLLIDERS},
+    {"collision_update_ccd", collision_ccd_setup, NULL, collision_ccd_run, collision_teardown, BENCH_COLLIDERS},
+    {"rigidbody_step_scalar", rigidbody_scalar_setup, NULL, rigidbody_step_run, rigidbody_teardown, 950},
+    {"rigidbody_step_simd", rigidbody_simd_setup, NULL, rigidbody_step_run, rigidbody_teardown, 950},
+    {"rigidbody_step_per_object", rigidbody_scalar_setup, NULL, rigidbody_per_object_run, rigidbody_teardown, 950},
+    {"sprite_screen_full", sprite_screen_moving_setup, NULL, sprite_screen_full_run, sprite_pass_teardown, 200},
+    {"sprite_screen_dirty_moving", sprite_screen_moving_setup, NULL, sprite_screen_dirty_run, sprite_pass_teardown, 200},
+    {"sprite_screen_dirty_static", sprite_screen_static_setup, NULL, sprite_screen_dirty_run, sprite_pass_teardown, 200},
+};
+
+static void print_usage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --json PATH        Write results as JSON\n");
+    printf("  --baseline PATH    Compare against a previous --json output\n");
+    printf("  --threshold PCT    Regression threshold in percent (default %.0f)\n",
+           BENCHMARK_DEFAULT_THRESHOLD_PERCENT);
+    printf("  --warmup N         Warmup runs per case (default %d)\n", BENCHMARK_DEFAULT_WARMUP_RUNS);
+    printf("  --runs N           Measured runs per case (default %d)\n", BENCHMARK_DEFAULT_MEASURED_RUNS);
+    printf("  --cpu N            Pin to CPU N, -1 to disable (default 0)\n");
+    printf("  --no-alloc         Fail if a measured run allocates from the heap\n");
+    printf("  --filter TEXT      Only run cases whose name contains TEXT\n");
+}
+
+int main(int argc, char** argv) {
+    BenchmarkConfig config;
+    benchmark_config_default(&config);
+
+    const char* jsonPath = NULL;
+    const char* baselinePath = NULL;
+    const char* filter = NULL;
+    double threshold = BENCHMARK_DEFAULT_THRESHOLD_PERCENT;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && hasValue) {
+            threshold = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            config.warmupRuns = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--runs") == 0 && hasValue) {
+            config.measuredRuns = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--cpu") == 0 && hasValue) {
+            config.cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--no-alloc") == 0) {
+            config.allocPolicy = ALLOC_TRACK_HEAP;
+        } else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (config.allocPolicy && !alloc_tracker_heap_available()) {
+        printf("Warning: heap allocations cannot be tracked on this platform\n");
+    }
+
+    if (config.cpu >= 0 && !benchmark_pin_cpu(config.cpu)) {
+        printf("Warning: could not pin to CPU %d, results may be noisy\n", config.cpu);
+        config.cpu = -1;
+    }
+
+    printf("=== Playdate Engine Benchmark Suite ===\n");
+    printf("warmup %u, runs %u, cpu %d\n\n", config.warmupRuns, config.measuredRuns, config.cpu);
+    printf("  %-28s %8s %12s %12s %12s %12s\n", "case", "param", "median us", "p95 us", "stddev us", "ns/op");
+
+    BenchmarkResult results[BENCH_MAX_RESULTS];
+    uint32_t resultCount = 0;
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++) {
+        const BenchmarkCase* benchmarkCase = &g_cases[i];
+        if (filter && !strstr(benchmarkCase->name, filter)) continue;
+
+        BenchmarkResult* result = &results[resultCount];
+        BenchmarkResultCode code = benchmark_run(benchmarkCase, &config, result);
+        if (code != BENCHMARK_OK) {
+            printf("  %-28s %8u FAILED (%d)\n", benchmarkCase->name, benchmarkCase->param, code);
+            failures++;
+            continue;
+        }
+
+        printf("  %-28s %8u %12.2f %12.2f %12.2f %12.2f\n", result->name, result->param,
+               result->medianNs / 1000.0, result->p95Ns / 1000.0, result->stddevNs / 1000.0,
+               result->nsPerOp);
+        if (strncmp(result->name, "render_", 7) == 0 && result->nsPerOp > 0.0) {
+            printf("  %-28s %8u %12.0f sprites/ms\n", "", result->param, 1e6 / result->nsPerOp);
+        }
+        if (result->allocations > 0) {
+            printf("  %-28s %8u ALLOCATED %llu time(s) in measured runs\n", result->name, result->param,
+                   (unsigned long long)result->allocations);
+            failures++;
+        }
+        resultCount++;
+    }
+
+    if (jsonPath) {
+        FILE* out = fopen(jsonPath, "w");
+        if (!out || benchmark_write_json(results, resultCount, &config, out) != BENCHMARK_OK) {
+            printf("Error: could not write %s\n", jsonPath);
+            failures++;
+        } else {
+            printf("\nResults written to %s\n", jsonPath);
+        }
+        if (out) fclose(out);
+    }
+
+    if (baselinePath) {
+        static BenchmarkResult baseline[BENCH_MAX_RESULTS];
+        uint32_t baselineCount = 0;
+        FILE* in = fopen(baselinePath, "r");
+        if (!in || benchmark_load_baseline(in, baseline, BENCH_MAX_RESULTS, &baselineCount) != BENCHMARK_OK) {
+            printf("Error: could not read baseline %s\n", baselinePath);
+            if (in) fclose(in);
+            return 1;
+        }
+        fclose(in);
+
+        printf("\nComparison against %s (threshold %.1f%%):\n", baselinePath, threshold);
+        uint32_t regressions = benchmark_compare(results, resultCount, baseline, baselineCount,
+                                                 threshold, stdout);
+        if (regressions > 0) {
+            printf("❌ %u regression(s) detected\n", regressions);
+            return 1;
+        }
+        printf("✓ No regressions\n");
+    }
+
+    return failures > 0 ? 1 : 0;
+}
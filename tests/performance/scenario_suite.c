@@ -0,0 +1,578 @@
+#include "../../src/profiling/benchmark_runner.h"
+#include "../../src/profiling/alloc_tracker.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/update_systems.h"
+#include "../../src/components/tilemap_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/systems/spatial_grid.h"
+#include "../test_helpers.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Scenario benchmarks: every measured run is one full simulated frame
+#define SCENARIO_DT (1.0f / 30.0f)
+#define SCENARIO_DEFAULT_FRAMES 300
+#define SCENARIO_DEFAULT_WARMUP 30
+#define SCENARIO_MAX_COUNTS 16
+#define SCENARIO_MAX_RESULTS 64
+
+// Bullet hell: bullets stream out of emitters across a 2x screen arena
+#define BULLET_CELL_SIZE 32
+#define BULLET_GRID_WIDTH 25                // 800x480 world
+#define BULLET_GRID_HEIGHT 15
+#define BULLET_EMITTERS 8
+#define BULLET_HIT_QUERIES 16               // Player + enemies checking for hits
+#define BULLET_HIT_RADIUS 12.0f
+
+// Crowd: agents steer away from neighbours found with a circle query
+#define CROWD_CELL_SIZE 32
+#define CROWD_NEIGHBOR_RADIUS 24.0f
+#define CROWD_MAX_NEIGHBORS 32
+#define CROWD_DENSITY 400.0f                // World area (px^2) per agent
+
+// Static tilemap: a level of 16x16 tiles with movers colliding against it
+#define TILE_SIZE 16
+#define TILE_COLUMNS 256
+#define TILE_CELL_SIZE 64
+#define TILE_MOVERS 300
+#define TILE_PROBE_RADIUS 12.0f
+
+typedef struct ScenarioObject {
+    GameObject* gameObject;
+    float vx, vy;
+} ScenarioObject;
+
+typedef struct Scenario {
+    Scene* scene;
+    SpatialGrid* grid;
+    SpatialQuery* query;
+    ScenarioObject* movers;
+    uint32_t moverCount;
+    uint32_t staticCount;
+    const TilemapComponent* tilemap;        // Level of the chunked tilemap scenario
+    float minX, minY, maxX, maxY;           // Bounds movers stay inside
+    uint32_t frame;
+    uint64_t hits;                          // Keeps query results observable
+} Scenario;
+
+static uint32_t g_scenarioSeed = 1;
+
+static void scenario_destroy(void* context) {
+    Scenario* scenario = context;
+    if (!scenario) return;
+
+    if (scenario->query) spatial_query_destroy(scenario->query);
+    if (scenario->grid) spatial_grid_destroy(scenario->grid);
+    if (scenario->scene) scene_destroy(scenario->scene);
+    free(scenario->movers);
+    free(scenario);
+    component_registry_shutdown();
+}
+
+// Creates the scene, movers and statics; the grid is sized afterwards since
+// its lookup table is indexed by the (global) GameObject id
+static Scenario* scenario_create(uint32_t moverCount, uint32_t staticCount, uint32_t maxResults) {
+    uint32_t total = moverCount + staticCount;
+    g_scenarioSeed = 1;
+
+    component_registry_init();
+    transform_component_register_with_capacity(total + 1);
+
+    Scenario* scenario = calloc(1, sizeof(Scenario));
+    if (!scenario) {
+        component_registry_shutdown();
+        return NULL;
+    }
+
+    scenario->scene = scene_create("Scenario", total + 1);
+    scenario->movers = calloc(moverCount ? moverCount : 1, sizeof(ScenarioObject));
+    scenario->query = spatial_query_create(maxResults);
+    if (!scenario->scene || !scenario->movers || !scenario->query) {
+        scenario_destroy(scenario);
+        return NULL;
+    }
+    scenario->query->includeStatic = true;
+
+    for (uint32_t i = 0; i < moverCount; i++) {
+        scenario->movers[i].gameObject = game_object_create(scenario->scene);
+        if (!scenario->movers[i].gameObject) {
+            scenario_destroy(scenario);
+            return NULL;
+        }
+    }
+    scenario->moverCount = moverCount;
+
+    register_default_systems(scenario->scene);
+    scene_set_state(scenario->scene, SCENE_STATE_ACTIVE);
+    return scenario;
+}
+
+static bool scenario_create_grid(Scenario* scenario, uint32_t cellSize, uint32_t width, uint32_t height) {
+    GameObject* last = game_object_create(scenario->scene); // Probe for the highest id
+    if (!last) return false;
+    uint32_t lookupSize = game_object_get_id(last) + 1;
+    game_object_destroy(last);
+
+    scenario->grid = spatial_grid_create(cellSize, width, height, 0.0f, 0.0f, lookupSize);
+    return scenario->grid != NULL;
+}
+
+// Moves every mover, reflecting off the bounds, and updates its grid cell
+static void scenario_move_movers(Scenario* scenario) {
+    for (uint32_t i = 0; i < scenario->moverCount; i++) {
+        ScenarioObject* mover = &scenario->movers[i];
+        float x, y;
+        game_object_get_position(mover->gameObject, &x, &y);
+
+        x += mover->vx * SCENARIO_DT;
+        y += mover->vy * SCENARIO_DT;
+        if (x < scenario->minX || x > scenario->maxX) {
+            mover->vx = -mover->vx;
+            x = x < scenario->minX ? scenario->minX : scenario->maxX;
+        }
+        if (y < scenario->minY || y > scenario->maxY) {
+            mover->vy = -mover->vy;
+            y = y < scenario->minY ? scenario->minY : scenario->maxY;
+        }
+
+        game_object_set_position(mover->gameObject, x, y);
+        spatial_grid_update_object(scenario->grid, mover->gameObject);
+    }
+}
+
+// Bullet hell
+
+static void* bullets_setup(uint32_t count) {
+    Scenario* scenario = scenario_create(count, 0, count);
+    if (!scenario) return NULL;
+
+    if (!scenario_create_grid(scenario, BULLET_CELL_SIZE, BULLET_GRID_WIDTH, BULLET_GRID_HEIGHT)) {
+        scenario_destroy(scenario);
+        return NULL;
+    }
+
+    float worldWidth = BULLET_CELL_SIZE * BULLET_GRID_WIDTH;
+    float worldHeight = BULLET_CELL_SIZE * BULLET_GRID_HEIGHT;
+    scenario->minX = BULLET_HIT_RADIUS;
+    scenario->minY = BULLET_HIT_RADIUS;
+    scenario->maxX = worldWidth - BULLET_HIT_RADIUS;
+    scenario->maxY = worldHeight - BULLET_HIT_RADIUS;
+
+    // Radial bursts from a ring of emitters, spread along their paths
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t emitter = i % BULLET_EMITTERS;
+        float ex = worldWidth * (0.2f + 0.6f * (float)(emitter % 4) / 3.0f);
+        float ey = worldHeight * (emitter < 4 ? 0.3f : 0.7f);
+        float angle = test_random_float(&g_scenarioSeed, 1.0f) * 6.2831853f;
+        float speed = 60.0f + test_random_float(&g_scenarioSeed, 1.0f) * 120.0f;
+        float travel = test_random_float(&g_scenarioSeed, 1.0f) * 200.0f;
+
+        ScenarioObject* bullet = &scenario->movers[i];
+        bullet->vx = speed * cosf(angle);
+        bullet->vy = speed * sinf(angle);
+
+        float x = ex + travel * cosf(angle);
+        float y = ey + travel * sinf(angle);
+        if (x < scenario->minX) x = scenario->minX;
+        if (x > scenario->maxX) x = scenario->maxX;
+        if (y < scenario->minY) y = scenario->minY;
+        if (y > scenario->maxY) y = scenario->maxY;
+        game_object_set_position(bullet->gameObject, x, y);
+        spatial_grid_add_object(scenario->grid, bullet->gameObject);
+    }
+    return scenario;
+}
+
+static uint64_t bullets_frame(void* context, uint32_t count) {
+    Scenario* scenario = context;
+
+    scene_update(scenario->scene, SCENARIO_DT);
+    scenario_move_movers(scenario);
+
+    // Player and enemies sweep the arena looking for hits
+    float worldWidth = BULLET_CELL_SIZE * BULLET_GRID_WIDTH;
+    float worldHeight = BULLET_CELL_SIZE * BULLET_GRID_HEIGHT;
+    for (uint32_t i = 0; i < BULLET_HIT_QUERIES; i++) {
+        float t = (float)((scenario->frame + i * 37u) % 300u) / 300.0f;
+        float x = BULLET_HIT_RADIUS + t * (worldWidth - 2.0f * BULLET_HIT_RADIUS);
+        float y = worldHeight * (float)(i + 1) / (BULLET_HIT_QUERIES + 1);
+        scenario->hits += spatial_grid_query_circle(scenario->grid, x, y, BULLET_HIT_RADIUS,
+                                                    scenario->query);
+    }
+
+    scenario->frame++;
+    return count;
+}
+
+// Crowd
+
+static void* crowd_setup(uint32_t count) {
+    Scenario* scenario = scenario_create(count, 0, CROWD_MAX_NEIGHBORS);
+    if (!scenario) return NULL;
+
+    // Square world sized for a constant density, so neighbour counts stay flat
+    uint32_t cells = (uint32_t)(sqrtf(count * CROWD_DENSITY) / CROWD_CELL_SIZE) + 2;
+    if (!scenario_create_grid(scenario, CROWD_CELL_SIZE, cells, cells)) {
+        scenario_destroy(scenario);
+        return NULL;
+    }
+
+    float world = (float)(cells * CROWD_CELL_SIZE);
+    scenario->minX = scenario->minY = CROWD_NEIGHBOR_RADIUS;
+    scenario->maxX = scenario->maxY = world - CROWD_NEIGHBOR_RADIUS;
+
+    for (uint32_t i = 0; i < count; i++) {
+        ScenarioObject* agent = &scenario->movers[i];
+        float x = scenario->minX + test_random_float(&g_scenarioSeed, 1.0f) * (scenario->maxX - scenario->minX);
+        float y = scenario->minY + test_random_float(&g_scenarioSeed, 1.0f) * (scenario->maxY - scenario->minY);
+        agent->vx = (test_random_float(&g_scenarioSeed, 1.0f) - 0.5f) * 40.0f;
+        agent->vy = (test_random_float(&g_scenarioSeed, 1.0f) - 0.5f) * 40.0f;
+        game_object_set_position(agent->gameObject, x, y);
+        spatial_grid_add_object(scenario->grid, agent->gameObject);
+    }
+    return scenario;
+}
+
+static uint64_t crowd_frame(void* context, uint32_t count) {
+    Scenario* scenario = context;
+
+    scene_update(scenario->scene, SCENARIO_DT);
+
+    // Separation steering from neighbour queries
+    for (uint32_t i = 0; i < scenario->moverCount; i++) {
+        ScenarioObject* agent = &scenario->movers[i];
+        float x, y;
+        game_object_get_position(agent->gameObject, &x, &y);
+
+        uint32_t found = spatial_grid_query_circle(scenario->grid, x, y, CROWD_NEIGHBOR_RADIUS,
+                                                   scenario->query);
+        float pushX = 0.0f, pushY = 0.0f;
+        for (uint32_t n = 0; n < found; n++) {
+            GameObject* other = scenario->query->results[n];
+            if (other == agent->gameObject) continue;
+
+            float ox, oy;
+            game_object_get_position(other, &ox, &oy);
+            pushX += x - ox;
+            pushY += y - oy;
+        }
+
+        agent->vx = agent->vx * 0.9f + pushX * 0.5f;
+        agent->vy = agent->vy * 0.9f + pushY * 0.5f;
+        scenario->hits += found;
+    }
+
+    scenario_move_movers(scenario);
+    scenario->frame++;
+    return count;
+}
+
+// Static tilemap with movers
+
+static void* tilemap_setup(uint32_t tileCount) {
+    Scenario* scenario = scenario_create(TILE_MOVERS, tileCount, 64);
+    if (!scenario) return NULL;
+
+    uint32_t rows = (tileCount + TILE_COLUMNS - 1) / TILE_COLUMNS;
+    if (rows == 0) rows = 1;
+
+    // Tiles are created after the movers so both share one id range
+    for (uint32_t i = 0; i < tileCount; i++) {
+        GameObject* tile = game_object_create(scenario->scene);
+        if (!tile) {
+            scenario_destroy(scenario);
+            return NULL;
+        }
+        game_object_set_static(tile, true);
+        game_object_set_position(tile,
+                                 (float)((i % TILE_COLUMNS) * TILE_SIZE) + TILE_SIZE * 0.5f,
+                                 (float)((i / TILE_COLUMNS) * TILE_SIZE) + TILE_SIZE * 0.5f);
+    }
+    scenario->staticCount = tileCount;
+
+    uint32_t gridWidth = (TILE_COLUMNS * TILE_SIZE) / TILE_CELL_SIZE;
+    uint32_t gridHeight = (rows * TILE_SIZE + TILE_CELL_SIZE - 1) / TILE_CELL_SIZE + 1;
+    if (!scenario_create_grid(scenario, TILE_CELL_SIZE, gridWidth, gridHeight)) {
+        scenario_destroy(scenario);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < scenario->scene->gameObjectCount; i++) {
+        spatial_grid_add_object(scenario->grid, scenario->scene->gameObjects[i]);
+    }
+
+    scenario->minX = scenario->minY = TILE_PROBE_RADIUS;
+    scenario->maxX = (float)(gridWidth * TILE_CELL_SIZE) - TILE_PROBE_RADIUS;
+    scenario->maxY = (float)(rows * TILE_SIZE) - TILE_PROBE_RADIUS;
+    if (scenario->maxY < scenario->minY) scenario->maxY = scenario->minY;
+
+    for (uint32_t i = 0; i < TILE_MOVERS; i++) {
+        ScenarioObject* mover = &scenario->movers[i];
+        float angle = test_random_float(&g_scenarioSeed, 1.0f) * 6.2831853f;
+        mover->vx = 80.0f * cosf(angle);
+        mover->vy = 80.0f * sinf(angle);
+        game_object_set_position(mover->gameObject,
+                                 scenario->minX + test_random_float(&g_scenarioSeed, 1.0f) * (scenario->maxX - scenario->minX),
+                                 scenario->minY + test_random_float(&g_scenarioSeed, 1.0f) * (scenario->maxY - scenario->minY));
+        spatial_grid_update_object(scenario->grid, mover->gameObject);
+    }
+    return scenario;
+}
+
+static uint64_t tilemap_frame(void* context, uint32_t tileCount) {
+    (void)tileCount;
+    Scenario* scenario = context;
+
+    scene_update(scenario->scene, SCENARIO_DT);
+    scenario_move_movers(scenario);
+
+    // Each mover probes the tiles around it
+    for (uint32_t i = 0; i < scenario->moverCount; i++) {
+        float x, y;
+        game_object_get_position(scenario->movers[i].gameObject, &x, &y);
+        scenario->hits += spatial_grid_query_circle(scenario->grid, x, y, TILE_PROBE_RADIUS,
+                                                    scenario->query);
+    }
+
+    scenario->frame++;
+    return scenario->moverCount + scenario->staticCount;
+}
+
+// The same level as one TilemapComponent: movers query the tile grid and
+// only the movers are GameObjects
+
+static void* tilemap_chunked_setup(uint32_t tileCount) {
+    Scenario* scenario = scenario_create(TILE_MOVERS, 1, 64);
+    if (!scenario) return NULL;
+
+    uint32_t rows = (tileCount + TILE_COLUMNS - 1) / TILE_COLUMNS;
+    if (rows == 0) rows = 1;
+
+    GameObject* level = game_object_create(scenario->scene);
+    TilemapComponent* tilemap = level ? tilemap_component_create(level) : NULL;
+    if (!tilemap || game_object_add_component(level, (Component*)tilemap) != GAMEOBJECT_OK ||
+        tilemap_component_set_size(tilemap, TILE_COLUMNS, rows, TILE_SIZE) != TILEMAP_OK) {
+        scenario_destroy(scenario);
+        return NULL;
+    }
+    game_object_set_static(level, true);
+    tilemap_component_set_solid(tilemap, 1, true);
+    for (uint32_t i = 0; i < tileCount; i++) {
+        tilemap_component_set_tile(tilemap, (int32_t)(i % TILE_COLUMNS), (int32_t)(i / TILE_COLUMNS), 1);
+    }
+    scenario->staticCount = tileCount;
+    scenario->tilemap = tilemap;
+
+    uint32_t gridWidth = (TILE_COLUMNS * TILE_SIZE) / TILE_CELL_SIZE;
+    uint32_t gridHeight = (rows * TILE_SIZE + TILE_CELL_SIZE - 1) / TILE_CELL_SIZE + 1;
+    if (!scenario_create_grid(scenario, TILE_CELL_SIZE, gridWidth, gridHeight)) {
+        scenario_destroy(scenario);
+        return NULL;
+    }
+
+    scenario->minX = scenario->minY = TILE_PROBE_RADIUS;
+    scenario->maxX = (float)(gridWidth * TILE_CELL_SIZE) - TILE_PROBE_RADIUS;
+    scenario->maxY = (float)(rows * TILE_SIZE) - TILE_PROBE_RADIUS;
+    if (scenario->maxY < scenario->minY) scenario->maxY = scenario->minY;
+
+    for (uint32_t i = 0; i < TILE_MOVERS; i++) {
+        ScenarioObject* mover = &scenario->movers[i];
+        float angle = test_random_float(&g_scenarioSeed, 1.0f) * 6.2831853f;
+        mover->vx = 80.0f * cosf(angle);
+        mover->vy = 80.0f * sinf(angle);
+        game_object_set_position(mover->gameObject,
+                                 scenario->minX + test_random_float(&g_scenarioSeed, 1.0f) * (scenario->maxX - scenario->minX),
+                                 scenario->minY + test_random_float(&g_scenarioSeed, 1.0f) * (scenario->maxY - scenario->minY));
+        spatial_grid_add_object(scenario->grid, mover->gameObject);
+    }
+    return scenario;
+}
+
+static uint64_t tilemap_chunked_frame(void* context, uint32_t tileCount) {
+    (void)tileCount;
+    Scenario* scenario = context;
+    scene_update(scenario->scene, SCENARIO_DT);
+    scenario_move_movers(scenario);
+
+    // Each mover probes the tiles under its bounding box
+    for (uint32_t i = 0; i < scenario->moverCount; i++) {
+        float x, y;
+        game_object_get_position(scenario->movers[i].gameObject, &x, &y);
+        scenario->hits += tilemap_component_query_rect(scenario->tilemap, x - TILE_PROBE_RADIUS, y - TILE_PROBE_RADIUS,
+                                                       2.0f * TILE_PROBE_RADIUS, 2.0f * TILE_PROBE_RADIUS, NULL, 0);
+    }
+
+    scenario->frame++;
+    return scenario->moverCount + scenario->staticCount;
+}
+
+typedef struct ScenarioDefinition {
+    const char* name;
+    BenchmarkSetupFn setup;
+    BenchmarkRunFn frame;
+    uint32_t defaultCount;
+    const char* countLabel;
+} ScenarioDefinition;
+
+static const ScenarioDefinition g_scenarios[] = {
+    {"scenario_bullets", bullets_setup, bullets_frame, 10000, "bullets"},
+    {"scenario_crowd", crowd_setup, crowd_frame, 5000, "agents"},
+    {"scenario_tilemap", tilemap_setup, tilemap_frame, 50000, "tiles"},
+    {"scenario_tilemap_chunked", tilemap_chunked_setup, tilemap_chunked_frame, 50000, "tiles"},
+};
+
+static void print_usage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --scenario NAME    bullets, crowd, tilemap, tilemap_chunked or all (default all)\n");
+    printf("  --counts A,B,...   Object counts to sweep (default: 10000 / 5000 / 50000)\n");
+    printf("  --frames N         Measured frames per run (default %d)\n", SCENARIO_DEFAULT_FRAMES);
+    printf("  --warmup N         Warmup frames (default %d)\n", SCENARIO_DEFAULT_WARMUP);
+    printf("  --cpu N            Pin to CPU N, -1 to disable (default 0)\n");
+    printf("  --no-alloc         Fail if a measured run allocates from the heap\n");
+    printf("  --json PATH        Write results as JSON\n");
+    printf("  --baseline PATH    Compare against a previous --json output\n");
+    printf("  --threshold PCT    Regression threshold in percent (default %.0f)\n",
+           BENCHMARK_DEFAULT_THRESHOLD_PERCENT);
+}
+
+static uint32_t parse_counts(const char* text, uint32_t* counts) {
+    uint32_t count = 0;
+    while (*text && count < SCENARIO_MAX_COUNTS) {
+        char* end = NULL;
+        unsigned long value = strtoul(text, &end, 10);
+        if (end == text) break;
+        if (value > 0) counts[count++] = (uint32_t)value;
+        text = *end == ',' ? end + 1 : end;
+    }
+    return count;
+}
+
+int main(int argc, char** argv) {
+    BenchmarkConfig config;
+    benchmark_config_default(&config);
+    config.warmupRuns = SCENARIO_DEFAULT_WARMUP;
+    config.measuredRuns = SCENARIO_DEFAULT_FRAMES;
+
+    const char* scenarioFilter = NULL;
+    const char* jsonPath = NULL;
+    const char* baselinePath = NULL;
+    double threshold = BENCHMARK_DEFAULT_THRESHOLD_PERCENT;
+    uint32_t counts[SCENARIO_MAX_COUNTS];
+    uint32_t countCount = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--scenario") == 0 && hasValue) {
+            scenarioFilter = argv[++i];
+            if (strcmp(scenarioFilter, "all") == 0) scenarioFilter = NULL;
+        } else if (strcmp(argv[i], "--counts") == 0 && hasValue) {
+            countCount = parse_counts(argv[++i], counts);
+        } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            config.measuredRuns = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            config.warmupRuns = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--cpu") == 0 && hasValue) {
+            config.cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--no-alloc") == 0) {
+            config.allocPolicy = ALLOC_TRACK_HEAP;
+        } else if (strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && hasValue) {
+            threshold = atof(argv[++i]);
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (config.allocPolicy && !alloc_tracker_heap_available()) {
+        printf("Warning: heap allocations cannot be tracked on this platform\n");
+    }
+
+    if (config.cpu >= 0 && !benchmark_pin_cpu(config.cpu)) {
+        printf("Warning: could not pin to CPU %d, results may be noisy\n", config.cpu);
+        config.cpu = -1;
+    }
+
+    printf("=== Playdate Engine Scenario Benchmarks ===\n");
+    printf("warmup %u frames, %u measured frames, cpu %d\n\n",
+           config.warmupRuns, config.measuredRuns, config.cpu);
+    printf("  %-24s %8s %9s %10s %10s %10s %10s\n",
+           "scenario", "count", "fps", "p50 ms", "p95 ms", "p99 ms", "max ms");
+
+    BenchmarkResult results[SCENARIO_MAX_RESULTS];
+    uint32_t resultCount = 0;
+    int failures = 0;
+
+    for (size_t s = 0; s < sizeof(g_scenarios) / sizeof(g_scenarios[0]); s++) {
+        const ScenarioDefinition* scenario = &g_scenarios[s];
+        if (scenarioFilter && !strstr(scenario->name, scenarioFilter)) continue;
+
+        uint32_t defaultCount = scenario->defaultCount;
+        const uint32_t* sweep = countCount > 0 ? counts : &defaultCount;
+        uint32_t sweepCount = countCount > 0 ? countCount : 1;
+
+        for (uint32_t c = 0; c < sweepCount && resultCount < SCENARIO_MAX_RESULTS; c++) {
+            BenchmarkCase benchmarkCase = {scenario->name, scenario->setup, NULL, scenario->frame,
+                                           scenario_destroy, sweep[c]};
+            BenchmarkResult* result = &results[resultCount];
+            BenchmarkResultCode code = benchmark_run(&benchmarkCase, &config, result);
+            if (code != BENCHMARK_OK) {
+                printf("  %-24s %8u FAILED (%d)\n", scenario->name, sweep[c], code);
+                failures++;
+                continue;
+            }
+
+            printf("  %-24s %8u %9.1f %10.3f %10.3f %10.3f %10.3f\n",
+                   scenario->name, sweep[c], 1e9 / result->meanNs,
+                   result->medianNs / 1e6, result->p95Ns / 1e6, result->p99Ns / 1e6,
+                   result->maxNs / 1e6);
+            if (result->allocations > 0) {
+                printf("  %-24s %8u ALLOCATED %llu time(s) in measured frames\n", scenario->name,
+                       sweep[c], (unsigned long long)result->allocations);
+                failures++;
+            }
+            resultCount++;
+        }
+    }
+
+    if (jsonPath) {
+        FILE* out = fopen(jsonPath, "w");
+        if (!out || benchmark_write_json(results, resultCount, &config, out) != BENCHMARK_OK) {
+            printf("Error: could not write %s\n", jsonPath);
+            failures++;
+        } else {
+            printf("\nResults written to %s\n", jsonPath);
+        }
+        if (out) fclose(out);
+    }
+
+    if (baselinePath) {
+        static BenchmarkResult baseline[SCENARIO_MAX_RESULTS];
+        uint32_t baselineCount = 0;
+        FILE* in = fopen(baselinePath, "r");
+        if (!in || benchmark_load_baseline(in, baseline, SCENARIO_MAX_RESULTS, &baselineCount) != BENCHMARK_OK) {
+            printf("Error: could not read baseline %s\n", baselinePath);
+            if (in) fclose(in);
+            return 1;
+        }
+        fclose(in);
+
+        printf("\nComparison against %s (threshold %.1f%%):\n", baselinePath, threshold);
+        uint32_t regressions = benchmark_compare(results, resultCount, baseline, baselineCount,
+                                                 threshold, stdout);
+        if (regressions > 0) {
+            printf("❌ %u regression(s) detected\n", regressions);
+            return 1;
+        }
+        printf("✓ No regressions\n");
+    }
+
+    return failures > 0 ? 1 : 0;
+}
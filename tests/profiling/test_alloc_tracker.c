@@ -0,0 +1,206 @@
+#define _POSIX_C_SOURCE 200809L
+#define _ISOC11_SOURCE
+
+#include "../../src/profiling/alloc_tracker.h"
+#include "../../src/profiling/profiler.h"
+#include "../../src/core/memory_pool.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene_manager.h"
+#include "../../src/core/update_systems.h"
+#include "../../src/components/transform_component.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Keeps the compiler from eliding malloc/free pairs
+static void* volatile g_sink;
+
+static const AllocSite* find_site(const AllocTrackerReport* report, const char* zone) {
+    for (uint32_t i = 0; i < ALLOC_TRACKER_MAX_SITES; i++) {
+        if (report->sites[i].zone && strcmp(report->sites[i].zone, zone) == 0) {
+            return &report->sites[i];
+        }
+    }
+    return NULL;
+}
+
+static void allocating_update_batch(Component** components, uint32_t count, float deltaTime) {
+    (void)components;
+    (void)count;
+    (void)deltaTime;
+    g_sink = malloc(64);
+    free(g_sink);
+}
+
+void test_alloc_tracker_heap(void) {
+    if (!alloc_tracker_heap_available()) {
+        printf("✓ Alloc tracker heap test skipped (no interposition on this libc)\n");
+        return;
+    }
+
+    AllocTrackerReport report;
+    assert(alloc_tracker_begin("heap_test", ALLOC_TRACK_HEAP) == ALLOC_TRACKER_OK);
+    assert(alloc_tracker_is_armed());
+    assert(alloc_tracker_begin("nested", ALLOC_TRACK_HEAP) == ALLOC_TRACKER_ERROR_ALREADY_ARMED);
+
+    g_sink = malloc(100);
+    free(g_sink);
+    g_sink = calloc(4, 25);
+    g_sink = realloc(g_sink, 200);
+    free(g_sink);
+    g_sink = aligned_alloc(16, 64);
+    free(g_sink);
+    free(NULL);                                 // Not an event
+
+    assert(alloc_tracker_end(&report) == 4);
+    assert(!alloc_tracker_is_armed());
+    assert(report.counts[ALLOC_EVENT_MALLOC] == 1);
+    assert(report.counts[ALLOC_EVENT_CALLOC] == 1);
+    assert(report.counts[ALLOC_EVENT_REALLOC] == 1);
+    assert(report.counts[ALLOC_EVENT_ALIGNED] == 1);
+    assert(report.counts[ALLOC_EVENT_FREE] == 3);
+    assert(report.bytes == 100 + 100 + 200 + 64);
+
+    // No zone open: attributed to the scope
+    assert(report.siteCount == 1);
+    assert(find_site(&report, "heap_test") != NULL);
+
+    // Disarmed: nothing recorded
+    g_sink = malloc(8);
+    free(g_sink);
+    assert(alloc_tracker_end(&report) == 0 && report.counts[ALLOC_EVENT_MALLOC] == 0);
+
+    printf("✓ Alloc tracker heap test passed\n");
+}
+
+void test_alloc_tracker_pool_policy(void) {
+    ObjectPool pool;
+    assert(object_pool_init(&pool, 32, 4, "TrackerPool") == POOL_OK);
+
+    AllocTrackerReport report;
+    alloc_tracker_begin("pool_test", ALLOC_TRACK_HEAP);
+    void* object = object_pool_alloc(&pool);
+    object_pool_free(&pool, object);
+    assert(alloc_tracker_end(&report) == 0); // Pool traffic allowed by the policy
+    assert(report.counts[ALLOC_EVENT_POOL_ALLOC] == 1 && report.bytes == 32);
+
+    alloc_tracker_begin("pool_test", ALLOC_TRACK_POOL);
+    object = object_pool_alloc(&pool);
+    object_pool_free(&pool, object);
+    assert(alloc_tracker_end(NULL) == 1);
+
+    object_pool_destroy(&pool);
+    printf("✓ Alloc tracker pool policy test passed\n");
+}
+
+void test_alloc_tracker_zone_attribution(void) {
+#if ENABLE_PROFILER
+    if (!alloc_tracker_heap_available()) return;
+
+    assert(profiler_init(1024) == PROFILER_OK);
+
+    AllocTrackerReport report;
+    alloc_tracker_begin("zone_test", ALLOC_TRACK_ALL);
+    PROFILER_ZONE_BEGIN("outer_zone");
+    g_sink = malloc(16);
+    free(g_sink);
+    PROFILER_ZONE_BEGIN("inner_zone");
+    g_sink = malloc(16);
+    g_sink = realloc(g_sink, 32);
+    free(g_sink);
+    PROFILER_ZONE_END();
+    PROFILER_ZONE_END();
+    assert(alloc_tracker_end(&report) == 3);
+
+    const AllocSite* outer = find_site(&report, "outer_zone");
+    const AllocSite* inner = find_site(&report, "inner_zone");
+    assert(outer && outer->counts[ALLOC_EVENT_MALLOC] == 1);
+    assert(inner && inner->counts[ALLOC_EVENT_MALLOC] == 1 && inner->counts[ALLOC_EVENT_REALLOC] == 1);
+
+    char buffer[1024];
+    FILE* out = fmemopen(buffer, sizeof(buffer), "w");
+    alloc_tracker_print_report(&report, out);
+    fclose(out);
+    assert(strstr(buffer, "inner_zone") && strstr(buffer, "realloc=1"));
+
+    profiler_shutdown();
+    printf("✓ Alloc tracker zone attribution test passed\n");
+#endif
+}
+
+void test_scene_manager_alloc_check(void) {
+    component_registry_init();
+    transform_component_register();
+
+    SceneManager* manager = scene_manager_create();
+    Scene* scene = scene_create("AllocCheckScene", 32);
+    register_default_systems(scene);
+    for (int i = 0; i < 16; i++) {
+        game_object_create(scene);
+    }
+    scene_manager_add_scene(manager, scene);
+    scene_manager_set_active_scene(manager, scene);
+    scene_manager_set_fixed_timestep(manager, 1.0f); // Variable update only
+    scene_manager_set_alloc_check(manager, SCENE_ALLOC_CHECK_REPORT, ALLOC_TRACK_ALL);
+
+    // Steady-state frames of the default systems allocate nothing
+    for (int frame = 0; frame < 8; frame++) {
+        scene_manager_update(manager, 1.0f / 30.0f);
+    }
+    assert(scene_manager_get_alloc_violation_frames(manager) == 0);
+    assert(scene_manager_get_last_alloc_report(manager) == NULL);
+
+    if (alloc_tracker_heap_available()) {
+#if ENABLE_PROFILER
+        profiler_init(1024);                     // System zones give the attribution
+#endif
+        // A system that allocates every frame is caught and attributed
+        scene_register_component_system(scene, COMPONENT_TYPE_TRANSFORM, allocating_update_batch, NULL, 0);
+        scene_manager_update(manager, 1.0f / 30.0f);
+        scene_manager_update(manager, 1.0f / 30.0f);
+        assert(scene_manager_get_alloc_violation_frames(manager) == 2);
+        assert(manager->allocViolations == 2);
+
+        const AllocTrackerReport* report = scene_manager_get_last_alloc_report(manager);
+        assert(report && report->counts[ALLOC_EVENT_MALLOC] == 1);
+#if ENABLE_PROFILER
+        assert(find_site(report, component_type_to_string(COMPONENT_TYPE_TRANSFORM)) != NULL);
+        profiler_shutdown();
+#else
+        assert(find_site(report, "scene_manager_update") != NULL);
+#endif
+    }
+
+    // Already inside a tracking scope (e.g. a benchmark run): not re-armed
+    alloc_tracker_begin("outer_scope", ALLOC_TRACK_HEAP);
+    scene_manager_update(manager, 1.0f / 30.0f);
+    alloc_tracker_end(NULL);
+
+    scene_manager_set_alloc_check(manager, SCENE_ALLOC_CHECK_OFF, 0);
+    scene_manager_update(manager, 1.0f / 30.0f);
+    assert(scene_manager_get_alloc_violation_frames(manager) == 0);
+
+    scene_manager_destroy(manager);
+    component_registry_shutdown();
+    printf("✓ Scene manager allocation check test passed\n");
+}
+
+int run_alloc_tracker_tests(void) {
+    printf("Running allocation tracker tests...\n");
+
+    test_alloc_tracker_heap();
+    test_alloc_tracker_pool_policy();
+    test_alloc_tracker_zone_attribution();
+    test_scene_manager_alloc_check();
+
+    printf("All allocation tracker tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_alloc_tracker_tests();
+}
+#endif
@@ -0,0 +1,196 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../src/profiling/benchmark_runner.h"
+#include "../../src/profiling/alloc_tracker.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct CountingBench {
+    uint32_t resets;
+    uint32_t runs;
+    bool tornDown;
+} CountingBench;
+
+static CountingBench g_counting;
+
+static void* counting_setup(uint32_t param) {
+    (void)param;
+    memset(&g_counting, 0, sizeof(g_counting));
+    return &g_counting;
+}
+
+static void counting_reset(void* context) {
+    ((CountingBench*)context)->resets++;
+}
+
+static uint64_t counting_run(void* context, uint32_t param) {
+    ((CountingBench*)context)->runs++;
+    volatile uint32_t sink = 0;
+    for (uint32_t i = 0; i < param; i++) {
+        sink += i;
+    }
+    return param;
+}
+
+static void counting_teardown(void* context) {
+    ((CountingBench*)context)->tornDown = true;
+}
+
+static void* volatile g_allocSink;
+
+static uint64_t allocating_run(void* context, uint32_t param) {
+    (void)context;
+    g_allocSink = malloc(param);
+    free(g_allocSink);
+    return 1;
+}
+
+static void* failing_setup(uint32_t param) {
+    (void)param;
+    return NULL;
+}
+
+void test_benchmark_summarize(void) {
+    uint64_t samples[] = {500, 100, 300, 200, 400};
+    BenchmarkResult result;
+    memset(&result, 0, sizeof(result));
+
+    benchmark_summarize(samples, 5, 10, &result);
+    assert(result.runs == 5);
+    assert(result.minNs == 100.0 && result.maxNs == 500.0);
+    assert(result.medianNs == 300.0);
+    assert(result.meanNs == 300.0);
+    assert(result.p95Ns == 500.0 && result.p99Ns == 500.0);
+    assert(fabs(result.stddevNs - 158.113883) < 0.001);
+    assert(result.nsPerOp == 30.0);
+
+    // Even count: median averages the middle pair
+    uint64_t even[] = {40, 10, 30, 20};
+    benchmark_summarize(even, 4, 0, &result);
+    assert(result.medianNs == 25.0);
+    assert(result.nsPerOp == 25.0); // No operations reported: per-run time
+
+    printf("✓ Benchmark summarize test passed\n");
+}
+
+void test_benchmark_run(void) {
+    BenchmarkConfig config;
+    benchmark_config_default(&config);
+    assert(config.warmupRuns == BENCHMARK_DEFAULT_WARMUP_RUNS);
+    config.warmupRuns = 2;
+    config.measuredRuns = 5;
+
+    BenchmarkCase benchmarkCase = {"counting", counting_setup, counting_reset, counting_run,
+                                   counting_teardown, 1000};
+    BenchmarkResult result;
+    assert(benchmark_run(&benchmarkCase, &config, &result) == BENCHMARK_OK);
+
+    assert(g_counting.runs == 7 && g_counting.resets == 7);
+    assert(g_counting.tornDown);
+    assert(strcmp(result.name, "counting") == 0);
+    assert(result.param == 1000 && result.runs == 5 && result.operations == 1000);
+    assert(result.minNs <= result.medianNs && result.medianNs <= result.maxNs);
+
+    BenchmarkCase failing = {"failing", failing_setup, NULL, counting_run, NULL, 1};
+    assert(benchmark_run(&failing, &config, &result) == BENCHMARK_ERROR_SETUP_FAILED);
+    assert(benchmark_run(NULL, &config, &result) == BENCHMARK_ERROR_NULL_POINTER);
+
+    // Negative CPU means "do not pin"
+    assert(!benchmark_pin_cpu(-1));
+
+    // Steady-state allocation check
+    assert(result.allocations == 0);
+    config.allocPolicy = ALLOC_TRACK_HEAP;
+    assert(benchmark_run(&benchmarkCase, &config, &result) == BENCHMARK_OK);
+    assert(result.allocations == 0);
+
+    BenchmarkCase allocating = {"allocating", counting_setup, NULL, allocating_run, NULL, 32};
+    assert(benchmark_run(&allocating, &config, &result) == BENCHMARK_OK);
+    assert(result.allocations == (alloc_tracker_heap_available() ? 5u : 0u));
+    assert(!alloc_tracker_is_armed());
+
+    printf("✓ Benchmark run test passed\n");
+}
+
+void test_benchmark_json_roundtrip_and_compare(void) {
+    BenchmarkConfig config;
+    benchmark_config_default(&config);
+
+    BenchmarkResult baseline[3];
+    memset(baseline, 0, sizeof(baseline));
+    const char* names[] = {"pool_alloc_free", "spatial_query_circle", "scene_update"};
+    for (int i = 0; i < 3; i++) {
+        strcpy(baseline[i].name, names[i]);
+        baseline[i].param = 100u * (i + 1);
+        baseline[i].runs = 15;
+        baseline[i].operations = 1000;
+        baseline[i].medianNs = 10000.0 * (i + 1);
+        baseline[i].nsPerOp = 10.0 * (i + 1);
+        baseline[i].allocations = (uint64_t)i;
+    }
+
+    char buffer[4096];
+    FILE* out = fmemopen(buffer, sizeof(buffer), "w");
+    assert(out != NULL);
+    assert(benchmark_write_json(baseline, 3, &config, out) == BENCHMARK_OK);
+    fclose(out);
+    assert(strstr(buffer, "\"results\":[") != NULL);
+    assert(strstr(buffer, "\"name\":\"spatial_query_circle\",\"param\":200") != NULL);
+
+    BenchmarkResult loaded[8];
+    uint32_t loadedCount = 0;
+    FILE* in = fmemopen(buffer, strlen(buffer), "r");
+    assert(benchmark_load_baseline(in, loaded, 8, &loadedCount) == BENCHMARK_OK);
+    fclose(in);
+    assert(loadedCount == 3);
+    assert(strcmp(loaded[2].name, "scene_update") == 0 && loaded[2].param == 300);
+    assert(loaded[1].operations == 1000 && fabs(loaded[1].nsPerOp - 20.0) < 1e-6);
+    assert(loaded[2].allocations == 2);
+
+    // One regression, one improvement, one unchanged, one new case
+    BenchmarkResult current[4];
+    memcpy(current, loaded, sizeof(BenchmarkResult) * 3);
+    current[0].nsPerOp = 12.0;  // +20%
+    current[1].nsPerOp = 10.0;  // -50%
+    current[2].nsPerOp = 30.5;  // +1.7%
+    current[3] = current[2];
+    current[3].param = 999;
+
+    char report[2048];
+    out = fmemopen(report, sizeof(report), "w");
+    assert(benchmark_compare(current, 4, loaded, loadedCount, 10.0, out) == 1);
+    fclose(out);
+    assert(strstr(report, "REGRESSION pool_alloc_free") != NULL);
+    assert(strstr(report, "faster") != NULL);
+    assert(strstr(report, "NEW") != NULL);
+
+    assert(benchmark_compare(current, 4, loaded, loadedCount, 25.0, NULL) == 0);
+
+    // Files that are not benchmark output are rejected
+    const char* garbage = "{\"something\":1}\n";
+    in = fmemopen((void*)garbage, strlen(garbage), "r");
+    assert(benchmark_load_baseline(in, loaded, 8, &loadedCount) == BENCHMARK_ERROR_PARSE);
+    fclose(in);
+
+    printf("✓ Benchmark JSON roundtrip and compare test passed\n");
+}
+
+int run_benchmark_runner_tests(void) {
+    printf("Running benchmark runner tests...\n");
+
+    test_benchmark_summarize();
+    test_benchmark_run();
+    test_benchmark_json_roundtrip_and_compare();
+
+    printf("All benchmark runner tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_benchmark_runner_tests();
+}
+#endif
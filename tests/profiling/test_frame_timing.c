@@ -0,0 +1,203 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../src/profiling/frame_timing.h"
+#include "../../src/core/scene_manager.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/components/transform_component.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void test_frame_histogram_buckets(void) {
+    // Small values map to exact buckets
+    for (uint32_t v = 0; v < FRAME_HISTOGRAM_SUB_BUCKETS * 2; v++) {
+        uint32_t bucket = frame_histogram_bucket_index(v);
+        assert(frame_histogram_bucket_lower_bound(bucket) == v);
+        assert(frame_histogram_bucket_upper_bound(bucket) == v);
+    }
+
+    // Every value lies inside its bucket bounds with bounded relative error
+    uint32_t samples[] = {32, 33, 100, 1000, 16667, 999999, 33333333, 0x80000000u, UINT32_MAX};
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+        uint32_t bucket = frame_histogram_bucket_index(samples[i]);
+        assert(bucket < FRAME_HISTOGRAM_BUCKETS);
+        uint32_t lower = frame_histogram_bucket_lower_bound(bucket);
+        uint32_t upper = frame_histogram_bucket_upper_bound(bucket);
+        assert(lower <= samples[i] && samples[i] <= upper);
+        assert((double)(upper - lower) / lower <= 1.0 / FRAME_HISTOGRAM_SUB_BUCKETS);
+    }
+    assert(frame_histogram_bucket_index(UINT32_MAX) == FRAME_HISTOGRAM_BUCKETS - 1);
+
+    // Buckets are contiguous
+    for (uint32_t b = 1; b < FRAME_HISTOGRAM_BUCKETS; b++) {
+        assert(frame_histogram_bucket_lower_bound(b) == frame_histogram_bucket_upper_bound(b - 1) + 1);
+    }
+
+    printf("✓ Frame histogram bucket test passed\n");
+}
+
+void test_frame_time_percentiles(void) {
+    FrameTimeRecorder recorder;
+    frame_time_recorder_reset(&recorder);
+
+    FramePercentiles percentiles;
+    assert(frame_time_recorder_get_percentiles(&recorder, FRAME_METRIC_UPDATE, false, &percentiles));
+    assert(percentiles.sampleCount == 0 && percentiles.p99Us == 0.0f);
+
+    // 1..100 ms in 1 ms steps
+    for (uint32_t i = 1; i <= 100; i++) {
+        frame_time_recorder_record(&recorder, FRAME_METRIC_UPDATE, (uint64_t)i * 1000000u);
+    }
+    assert(recorder.frameCount == 100);
+
+    assert(frame_time_recorder_get_percentiles(&recorder, FRAME_METRIC_UPDATE, false, &percentiles));
+    assert(percentiles.sampleCount == 100);
+    assert(fabsf(percentiles.p50Us - 50000.0f) <= 50000.0f * 0.07f);
+    assert(fabsf(percentiles.p95Us - 95000.0f) <= 95000.0f * 0.07f);
+    assert(fabsf(percentiles.p99Us - 99000.0f) <= 99000.0f * 0.07f);
+    assert(percentiles.maxUs == 100000.0f);
+    assert(percentiles.p50Us <= percentiles.p95Us && percentiles.p95Us <= percentiles.p99Us);
+    assert(percentiles.p99Us <= percentiles.maxUs);
+
+    // Other metrics are untouched, invalid arguments are rejected
+    assert(frame_time_recorder_get_percentiles(&recorder, FRAME_METRIC_RENDER, false, &percentiles));
+    assert(percentiles.sampleCount == 0);
+    assert(!frame_time_recorder_get_percentiles(&recorder, FRAME_METRIC_COUNT, false, &percentiles));
+    assert(!frame_time_recorder_get_percentiles(NULL, FRAME_METRIC_UPDATE, false, &percentiles));
+
+    printf("✓ Frame time percentile test passed\n");
+}
+
+void test_frame_time_window_eviction(void) {
+    FrameTimeRecorder recorder;
+    frame_time_recorder_reset(&recorder);
+
+    // One slow spike followed by a full window of fast frames
+    frame_time_recorder_record(&recorder, FRAME_METRIC_RENDER, 50000000u);
+    for (uint32_t i = 0; i < FRAME_TIMING_WINDOW; i++) {
+        frame_time_recorder_record(&recorder, FRAME_METRIC_RENDER, 2000000u);
+    }
+
+    FramePercentiles window, lifetime;
+    frame_time_recorder_get_percentiles(&recorder, FRAME_METRIC_RENDER, true, &window);
+    frame_time_recorder_get_percentiles(&recorder, FRAME_METRIC_RENDER, false, &lifetime);
+
+    // The spike has left the window but stays in the lifetime histogram
+    assert(window.sampleCount == FRAME_TIMING_WINDOW);
+    assert(window.maxUs == 2000.0f);
+    assert(fabsf(window.p99Us - 2000.0f) <= 2000.0f * 0.07f);
+    assert(lifetime.sampleCount == FRAME_TIMING_WINDOW + 1);
+    assert(lifetime.maxUs == 50000.0f);
+
+    // Rendering samples do not count as frames
+    assert(recorder.frameCount == 0);
+
+    printf("✓ Frame time window eviction test passed\n");
+}
+
+void test_frame_time_export(void) {
+    FrameTimeRecorder recorder;
+    frame_time_recorder_reset(&recorder);
+    frame_time_recorder_record(&recorder, FRAME_METRIC_UPDATE, 16000000u);
+    frame_time_recorder_record(&recorder, FRAME_METRIC_FIXED_STEP, 1000u);
+    frame_time_recorder_record_fixed_steps(&recorder, 3, 2);
+
+    char buffer[8192];
+    FILE* out = fmemopen(buffer, sizeof(buffer), "w");
+    assert(out != NULL);
+    assert(frame_time_recorder_write_json(&recorder, out));
+    fclose(out);
+
+    assert(strstr(buffer, "\"frames\":1") != NULL);
+    assert(strstr(buffer, "\"fixed_steps\":{\"run\":3,\"merged\":2,\"dropped\":2}") != NULL);
+    assert(strstr(buffer, "\"update\":{\"lifetime\":{\"samples\":1") != NULL);
+    assert(strstr(buffer, "\"fixed_step\":") != NULL);
+    assert(strstr(buffer, "\"render\":") != NULL);
+    assert(strstr(buffer, "\"histogram\":[[") != NULL);
+
+    out = fmemopen(buffer, sizeof(buffer), "w");
+    assert(out != NULL);
+    assert(frame_time_recorder_write_csv(&recorder, out));
+    fclose(out);
+
+    assert(strncmp(buffer, "metric,scope,samples,p50_us", 27) == 0);
+    assert(strstr(buffer, "\nupdate,lifetime,1,") != NULL);
+    assert(strstr(buffer, "\nrender,window,0,") != NULL);
+
+    assert(!frame_time_recorder_write_json(NULL, stdout));
+    assert(!frame_time_recorder_write_csv(&recorder, NULL));
+
+    printf("✓ Frame time export test passed\n");
+}
+
+void test_scene_manager_frame_timing(void) {
+    component_registry_init();
+    transform_component_register();
+
+    SceneManager* manager = scene_manager_create();
+    assert(manager != NULL);
+    assert(manager->maxFixedStepsPerFrame == SCENE_MANAGER_NO_FIXED_STEP_CAP);
+
+    Scene* scene = scene_create("FrameTimingScene", 16);
+    assert(scene_manager_add_scene(manager, scene) == SCENE_OK);
+    assert(scene_manager_set_active_scene(manager, scene) == SCENE_OK);
+
+    scene_manager_set_fixed_timestep(manager, 0.01f);
+
+    // Normal frame: 1 step
+    scene_manager_update(manager, 0.015f);
+    // Hitch without a cap: every step runs, the extra ones count as merged
+    scene_manager_update(manager, 0.1f);
+    const FrameTimeRecorder* timing = scene_manager_get_frame_timing(manager);
+    assert(timing != NULL);
+    uint32_t uncapped = timing->fixedStepsRun;
+    assert(uncapped >= 10 && timing->mergedFixedSteps == uncapped - 2 && timing->droppedFixedSteps == 0);
+
+    // With the opt-in cap: 4 run, whole steps past it dropped, the fraction carried
+    scene_manager_set_max_fixed_steps(manager, 4);
+    assert(manager->maxFixedStepsPerFrame == 4);
+    scene_manager_update(manager, 0.1f);
+    scene_manager_render(manager);
+    assert(timing->frameCount == 3);
+    assert(timing->fixedStepsRun == uncapped + 4);
+    assert(timing->mergedFixedSteps == uncapped - 2 + 3);
+    assert(timing->droppedFixedSteps >= 5);
+    assert(manager->accumulatedTime < manager->fixedTimeStep);
+    scene_manager_set_max_fixed_steps(manager, SCENE_MANAGER_NO_FIXED_STEP_CAP);
+    assert(manager->maxFixedStepsPerFrame == SCENE_MANAGER_NO_FIXED_STEP_CAP);
+
+    FramePercentiles percentiles;
+    frame_time_recorder_get_percentiles(timing, FRAME_METRIC_FIXED_STEP, false, &percentiles);
+    assert(percentiles.sampleCount == uncapped + 4);
+    frame_time_recorder_get_percentiles(timing, FRAME_METRIC_RENDER, false, &percentiles);
+    assert(percentiles.sampleCount == 1);
+
+    scene_manager_reset_frame_timing(manager);
+    assert(timing->frameCount == 0 && timing->fixedStepsRun == 0);
+    assert(scene_manager_get_frame_timing(NULL) == NULL);
+
+    scene_manager_destroy(manager);
+    component_registry_shutdown();
+    printf("✓ Scene manager frame timing test passed\n");
+}
+
+int run_frame_timing_tests(void) {
+    printf("Running frame timing tests...\n");
+
+    test_frame_histogram_buckets();
+    test_frame_time_percentiles();
+    test_frame_time_window_eviction();
+    test_frame_time_export();
+    test_scene_manager_frame_timing();
+
+    printf("All frame timing tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_frame_timing_tests();
+}
+#endif
@@ -0,0 +1,164 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../../src/profiling/perf_counters.h"
+#include "../../src/profiling/profiler.h"
+#include "../../src/systems/spatial_grid.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static volatile uint64_t g_sink = 0;
+
+static void busy_work(uint32_t iterations) {
+    uint64_t value = 1;
+    for (uint32_t i = 0; i < iterations; i++) {
+        value = value * 6364136223846793005ull + i;
+        if (value & 0x10) {
+            g_sink += value;
+        }
+    }
+}
+
+void test_perf_counter_sample_math(void) {
+    PerfCounterSample start = {{100, 200, 10, 5, 3}, 0x1F, 0};
+    PerfCounterSample end = {{150, 260, 12, 4, 9}, 0x0F, 0};
+    PerfCounterSample delta;
+
+    perf_counter_sample_delta(&start, &end, &delta);
+    assert(delta.values[PERF_COUNTER_CYCLES] == 50);
+    assert(delta.values[PERF_COUNTER_INSTRUCTIONS] == 60);
+    assert(delta.values[PERF_COUNTER_L1D_MISSES] == 2);
+    assert(delta.values[PERF_COUNTER_LLC_MISSES] == 0); // Clamped, never wraps
+    assert(delta.validMask == 0x0F);
+
+    PerfCounterSample total;
+    memset(&total, 0, sizeof(total));
+    perf_counter_sample_accumulate(&total, &delta);
+    perf_counter_sample_accumulate(&total, &delta);
+    assert(total.values[PERF_COUNTER_CYCLES] == 100);
+    assert(total.validMask == 0x0F);
+
+    assert(strcmp(perf_counter_type_to_string(PERF_COUNTER_LLC_MISSES), "llc_misses") == 0);
+    assert(strcmp(perf_counter_type_to_string(PERF_COUNTER_COUNT), "unknown") == 0);
+
+    printf("✓ Perf counter sample math test passed\n");
+}
+
+void test_perf_counter_group(void) {
+    PerfCounterGroup group;
+    PerfCounterSample sample;
+
+    assert(perf_counter_group_open(NULL) == PERF_COUNTERS_ERROR_NULL_POINTER);
+
+    PerfCounterResult result = perf_counter_group_open(&group);
+    if (result == PERF_COUNTERS_OK) {
+        assert(perf_counter_group_is_open(&group));
+        assert(group.validMask != 0);
+
+        PerfCounterSample before, after, delta;
+        assert(perf_counter_group_read(&group, &before) == PERF_COUNTERS_OK);
+        busy_work(100000);
+        assert(perf_counter_group_read(&group, &after) == PERF_COUNTERS_OK);
+        perf_counter_sample_delta(&before, &after, &delta);
+
+        assert(delta.validMask == group.validMask);
+        if (delta.validMask & (1u << PERF_COUNTER_INSTRUCTIONS)) {
+            assert(delta.values[PERF_COUNTER_INSTRUCTIONS] >= 100000);
+        }
+        printf("Hardware counters available (mask 0x%x)\n", group.validMask);
+    } else {
+        // Degrades to a closed group that reads as unavailable
+        assert(result == PERF_COUNTERS_ERROR_UNAVAILABLE);
+        assert(!perf_counter_group_is_open(&group));
+        printf("Hardware counters unavailable, falling back to wall time\n");
+    }
+
+    perf_counter_group_close(&group);
+    assert(!perf_counter_group_is_open(&group));
+    assert(perf_counter_group_read(&group, &sample) == PERF_COUNTERS_ERROR_UNAVAILABLE);
+    assert(sample.validMask == 0);
+
+    printf("✓ Perf counter group test passed\n");
+}
+
+void test_profiler_counted_zones(void) {
+    assert(profiler_init(256) == PROFILER_OK);
+    assert(!profiler_thread_counters_enabled());
+
+    // Counted zones without counters behave like plain zones
+    PROFILER_COUNTED_ZONE_BEGIN("plain");
+    PROFILER_ZONE_END();
+    const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(0);
+    assert(profiler_get_event_count(buffer) == 1);
+    assert(profiler_get_event(buffer, 0)->flags == 0);
+    assert(profiler_get_event_counters(buffer, 0) == NULL);
+
+    ProfilerResult result = profiler_enable_thread_counters();
+    assert(result == PROFILER_OK || result == PROFILER_ERROR_COUNTERS_UNAVAILABLE);
+    bool counters = result == PROFILER_OK;
+    assert(profiler_thread_counters_enabled() == counters);
+
+    // Spatial queries are counted zones
+    SpatialGrid* grid = spatial_grid_create(32, 10, 8, 0.0f, 0.0f, 64);
+    SpatialQuery* query = spatial_query_create(16);
+    assert(grid != NULL && query != NULL);
+    spatial_grid_query_circle(grid, 100.0f, 100.0f, 40.0f, query);
+
+    PROFILER_COUNTED_ZONE_BEGIN("outer");
+    PROFILER_ZONE_BEGIN("uncounted");
+    busy_work(50000);
+    PROFILER_ZONE_END();
+    PROFILER_ZONE_END();
+
+    PerfCounterSample total;
+    if (counters) {
+        assert(profiler_sum_zone_counters("outer", &total) == 1);
+        assert(total.validMask != 0);
+        assert(profiler_sum_zone_counters("uncounted", &total) == 0);
+        assert(profiler_sum_zone_counters("spatial_grid_query_circle", &total) == 1);
+    } else {
+        assert(profiler_sum_zone_counters("outer", &total) == 0);
+        assert(total.validMask == 0);
+    }
+
+    // Counter values are exported as trace args when present
+    char trace[8192];
+    FILE* out = fmemopen(trace, sizeof(trace), "w");
+    assert(out != NULL);
+    assert(profiler_write_chrome_trace(out) == PROFILER_OK);
+    fclose(out);
+    if (counters) {
+        assert(strstr(trace, "\"cycles\":") != NULL || strstr(trace, "\"instructions\":") != NULL ||
+               strstr(trace, "_misses\":") != NULL);
+    } else {
+        assert(strstr(trace, "\"cycles\":") == NULL);
+    }
+
+    profiler_disable_thread_counters();
+    assert(!profiler_thread_counters_enabled());
+    assert(profiler_sum_zone_counters("outer", &total) == 0);
+
+    spatial_query_destroy(query);
+    spatial_grid_destroy(grid);
+    profiler_shutdown();
+    assert(profiler_enable_thread_counters() == PROFILER_ERROR_NOT_INITIALIZED);
+    printf("✓ Profiler counted zones test passed\n");
+}
+
+int run_perf_counter_tests(void) {
+    printf("Running perf counter tests...\n");
+
+    test_perf_counter_sample_math();
+    test_perf_counter_group();
+    test_profiler_counted_zones();
+
+    printf("All perf counter tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_perf_counter_tests();
+}
+#endif
@@ -0,0 +1,234 @@
+#include "../../src/profiling/profiler.h"
+#include "../../src/core/memory_pool.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/update_systems.h"
+#include "../../src/components/transform_component.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_TEST_PATH "test_profiler_trace.json"
+
+static const ProfilerEvent* find_event(const ProfilerThreadBuffer* buffer, const char* name) {
+    uint32_t count = profiler_get_event_count(buffer);
+    for (uint32_t i = 0; i < count; i++) {
+        const ProfilerEvent* event = profiler_get_event(buffer, i);
+        if (strcmp(event->name, name) == 0) {
+            return event;
+        }
+    }
+    return NULL;
+}
+
+void test_profiler_clock_monotonic(void) {
+    uint64_t previous = profiler_get_time_ns();
+    for (int i = 0; i < 1000; i++) {
+        uint64_t now = profiler_get_time_ns();
+        assert(now >= previous);
+        previous = now;
+    }
+
+    printf("✓ Profiler monotonic clock test passed\n");
+}
+
+void test_profiler_nested_zones(void) {
+    assert(profiler_init(64) == PROFILER_OK);
+    assert(profiler_get_thread_count() == 1);
+
+    PROFILER_ZONE_BEGIN("outer");
+    assert(strcmp(profiler_get_current_zone(), "outer") == 0);
+    PROFILER_ZONE_BEGIN("inner");
+    assert(strcmp(profiler_get_current_zone(), "inner") == 0);
+    PROFILER_ZONE_END();
+    PROFILER_ZONE_END();
+    assert(profiler_get_current_zone() == NULL);
+
+    const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(0);
+    assert(buffer != NULL);
+    assert(profiler_get_event_count(buffer) == 2);
+
+    // Inner zone closes first and must sit inside the outer zone
+    const ProfilerEvent* inner = profiler_get_event(buffer, 0);
+    const ProfilerEvent* outer = profiler_get_event(buffer, 1);
+    assert(strcmp(inner->name, "inner") == 0 && inner->depth == 1);
+    assert(strcmp(outer->name, "outer") == 0 && outer->depth == 0);
+    assert(inner->startNs >= outer->startNs);
+    assert(inner->startNs + inner->durationNs <= outer->startNs + outer->durationNs);
+
+    // Unbalanced end is ignored
+    PROFILER_ZONE_END();
+    assert(profiler_get_event_count(buffer) == 2);
+
+    profiler_shutdown();
+    printf("✓ Profiler nested zones test passed\n");
+}
+
+void test_profiler_ring_buffer_wrap(void) {
+    assert(profiler_init(5) == PROFILER_OK); // Rounded up to 8
+
+    const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(0);
+    assert(buffer->capacity == 8);
+
+    static const char* names[] = {"z0", "z1", "z2", "z3", "z4", "z5", "z6", "z7", "z8", "z9"};
+    for (int i = 0; i < 10; i++) {
+        PROFILER_ZONE_BEGIN(names[i]);
+        PROFILER_ZONE_END();
+    }
+
+    // Oldest events are overwritten, order is preserved
+    assert(profiler_get_event_count(buffer) == 8);
+    assert(strcmp(profiler_get_event(buffer, 0)->name, "z2") == 0);
+    assert(strcmp(profiler_get_event(buffer, 7)->name, "z9") == 0);
+    assert(profiler_get_event(buffer, 8) == NULL);
+
+    profiler_reset();
+    assert(profiler_get_event_count(buffer) == 0);
+
+    profiler_shutdown();
+    printf("✓ Profiler ring buffer wrap test passed\n");
+}
+
+void test_profiler_enable_and_depth_limit(void) {
+    assert(profiler_init(256) == PROFILER_OK);
+    const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(0);
+
+    // Disabled profiler records nothing
+    profiler_set_enabled(false);
+    PROFILER_ZONE_BEGIN("ignored");
+    PROFILER_ZONE_END();
+    assert(profiler_get_event_count(buffer) == 0);
+    profiler_set_enabled(true);
+
+    // Zones past the depth limit are dropped without unbalancing the stack
+    for (int i = 0; i < PROFILER_MAX_ZONE_DEPTH + 4; i++) {
+        PROFILER_ZONE_BEGIN("deep");
+    }
+    for (int i = 0; i < PROFILER_MAX_ZONE_DEPTH + 4; i++) {
+        PROFILER_ZONE_END();
+    }
+    assert(profiler_get_event_count(buffer) == PROFILER_MAX_ZONE_DEPTH);
+    assert(buffer->droppedZones == 4);
+    assert(buffer->depth == 0);
+
+    // Registering the same thread twice is rejected
+    assert(profiler_register_thread("again") == PROFILER_ERROR_ALREADY_REGISTERED);
+
+    profiler_shutdown();
+
+    // Zones after shutdown are ignored
+    PROFILER_ZONE_BEGIN("after_shutdown");
+    PROFILER_ZONE_END();
+    assert(profiler_get_thread_count() == 0);
+
+    printf("✓ Profiler enable/depth limit test passed\n");
+}
+
+void test_profiler_engine_zones(void) {
+    component_registry_init();
+    transform_component_register();
+    assert(profiler_init(4096) == PROFILER_OK);
+
+    ObjectPool pool;
+    object_pool_init(&pool, 32, 4, "ProfilerPool");
+    void* object = object_pool_alloc(&pool);
+    object_pool_free(&pool, object);
+
+    Scene* scene = scene_create("ProfilerScene", 16);
+    register_default_systems(scene);
+    game_object_create(scene);
+    scene_set_state(scene, SCENE_STATE_ACTIVE);
+    scene_update(scene, 0.016f);
+    scene_render(scene);
+
+    const ProfilerThreadBuffer* buffer = profiler_get_thread_buffer(0);
+    assert(find_event(buffer, "object_pool_alloc") != NULL);
+    assert(find_event(buffer, "object_pool_free") != NULL);
+    assert(find_event(buffer, "scene_render") != NULL);
+
+    const ProfilerEvent* update = find_event(buffer, "scene_update");
+    const ProfilerEvent* transform = find_event(buffer, "Transform");
+    assert(update != NULL && transform != NULL);
+    assert(transform->depth == update->depth + 1);
+
+    scene_destroy(scene);
+    object_pool_destroy(&pool);
+    profiler_shutdown();
+    component_registry_shutdown();
+    printf("✓ Profiler engine zones test passed\n");
+}
+
+void test_profiler_chrome_trace_export(void) {
+    assert(profiler_init(64) == PROFILER_OK);
+
+    PROFILER_ZONE_BEGIN("frame");
+    PROFILER_ZONE_BEGIN("needs \"escaping\"");
+    PROFILER_ZONE_END();
+    PROFILER_ZONE_END();
+
+    assert(profiler_export_chrome_trace(TRACE_TEST_PATH) == PROFILER_OK);
+
+    FILE* file = fopen(TRACE_TEST_PATH, "r");
+    assert(file != NULL);
+    char contents[2048];
+    size_t length = fread(contents, 1, sizeof(contents) - 1, file);
+    contents[length] = '\0';
+    fclose(file);
+    remove(TRACE_TEST_PATH);
+
+    assert(strstr(contents, "\"traceEvents\":[") != NULL);
+    assert(strstr(contents, "\"thread_name\"") != NULL);
+    assert(strstr(contents, "{\"name\":\"main\"}") != NULL);
+    assert(strstr(contents, "\"name\":\"frame\"") != NULL);
+    assert(strstr(contents, "\"name\":\"needs \\\"escaping\\\"\"") != NULL);
+    assert(strstr(contents, "\"ph\":\"X\"") != NULL);
+
+    // Invalid destinations are reported
+    assert(profiler_write_chrome_trace(NULL) == PROFILER_ERROR_IO);
+    assert(profiler_export_chrome_trace(NULL) == PROFILER_ERROR_IO);
+
+    profiler_shutdown();
+    assert(profiler_write_chrome_trace(stdout) == PROFILER_ERROR_NOT_INITIALIZED);
+    printf("✓ Profiler Chrome trace export test passed\n");
+}
+
+void benchmark_profiler_zone_overhead(void) {
+    const int iterations = 100000;
+    assert(profiler_init(PROFILER_DEFAULT_EVENT_CAPACITY) == PROFILER_OK);
+
+    uint64_t start = profiler_get_time_ns();
+    for (int i = 0; i < iterations; i++) {
+        PROFILER_ZONE_BEGIN("overhead");
+        PROFILER_ZONE_END();
+    }
+    uint64_t elapsed = profiler_get_time_ns() - start;
+
+    double perZone = (double)elapsed / iterations;
+    printf("Profiler zone overhead: %.1f ns per begin/end pair\n", perZone);
+    assert(perZone < 1000.0); // Generous bound for CI machines
+
+    profiler_shutdown();
+    printf("✓ Profiler zone overhead benchmark passed\n");
+}
+
+int run_profiler_tests(void) {
+    printf("Running profiler tests...\n");
+
+    test_profiler_clock_monotonic();
+    test_profiler_nested_zones();
+    test_profiler_ring_buffer_wrap();
+    test_profiler_enable_and_depth_limit();
+    test_profiler_engine_zones();
+    test_profiler_chrome_trace_export();
+    benchmark_profiler_zone_overhead();
+
+    printf("All profiler tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_profiler_tests();
+}
+#endif
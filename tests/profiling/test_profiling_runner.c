@@ -0,0 +1,45 @@
+#include <stdio.h>
+
+// External test function declarations
+extern int run_profiler_tests(void);
+extern int run_frame_timing_tests(void);
+extern int run_perf_counter_tests(void);
+extern int run_benchmark_runner_tests(void);
+extern int run_alloc_tracker_tests(void);
+
+int main(void) {
+    printf("=== Playdate Engine Profiling Test Suite ===\n\n");
+
+    int total_failures = 0;
+
+    printf("PHASE 10.1: Profiler Tests\n");
+    printf("==========================\n");
+    total_failures += run_profiler_tests();
+
+    printf("PHASE 10.2: Frame Timing Tests\n");
+    printf("==============================\n");
+    total_failures += run_frame_timing_tests();
+
+    printf("PHASE 10.3: Hardware Counter Tests\n");
+    printf("==================================\n");
+    total_failures += run_perf_counter_tests();
+
+    printf("PHASE 10.4: Benchmark Harness Tests\n");
+    printf("===================================\n");
+    total_failures += run_benchmark_runner_tests();
+
+    printf("PHASE 10.5: Allocation Tracker Tests\n");
+    printf("====================================\n");
+    total_failures += run_alloc_tracker_tests();
+
+    // Summary
+    printf("=== Test Suite Summary ===\n");
+    if (total_failures == 0) {
+        printf("🎉 ALL PROFILING TESTS PASSED! 🎉\n");
+    } else {
+        printf("❌ %d test(s) failed\n", total_failures);
+    }
+    printf("===========================\n\n");
+
+    return total_failures;
+}
@@ -0,0 +1,916 @@
+#include "../../src/systems/collision_system.h"
+#include "../../src/components/collision_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/memory_budget.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/scene_manager.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_COLLIDERS TEST_ODD_COUNT
+
+static void create_scene(TestScene* test) {
+    test_scene_create(test, "Collision", TEST_SCENE_MAX_OBJECTS);
+}
+
+static CollisionComponent* add_collider(TestScene* test, float x, float y) {
+    GameObject* object = test_scene_add(test, x, y);
+    CollisionComponent* collider = collision_component_create(object);
+    assert(collider && collision_component_is_collision((Component*)collider));
+    return (CollisionComponent*)test_scene_attach(test, (Component*)collider);
+}
+
+static CollisionComponent* collider_of(const TestScene* test, uint32_t index) {
+    return (CollisionComponent*)test->components[index];
+}
+
+static void destroy_scene(TestScene* test) {
+    test_scene_destroy(test);
+    collision_system_shutdown();
+}
+
+static const CollisionContact* find_contact(const CollisionComponent* a, const CollisionComponent* b) {
+    uint32_t count;
+    const CollisionContact* contacts = collision_system_get_contacts(&count);
+    for (uint32_t i = 0; i < count; i++) {
+        if ((contacts[i].a == a && contacts[i].b == b) || (contacts[i].a == b && contacts[i].b == a)) {
+            return &contacts[i];
+        }
+    }
+    return NULL;
+}
+
+// Reference overlap from the shapes themselves: box-box by extents,
+// circle-circle by centre distance, box-circle by the closest box point
+static bool reference_overlap(const CollisionComponent* a, const CollisionComponent* b) {
+    float aMinX, aMinY, aMaxX, aMaxY, bMinX, bMinY, bMaxX, bMaxY;
+    collision_component_get_bounds(a, &aMinX, &aMinY, &aMaxX, &aMaxY);
+    collision_component_get_bounds(b, &bMinX, &bMinY, &bMaxX, &bMaxY);
+    bool aCircle = collision_component_get_shape(a) == COLLISION_SHAPE_CIRCLE;
+    bool bCircle = collision_component_get_shape(b) == COLLISION_SHAPE_CIRCLE;
+
+    if (!aCircle && !bCircle) {
+        return aMinX < bMaxX && bMinX < aMaxX && aMinY < bMaxY && bMinY < aMaxY;
+    }
+    if (!aCircle) {
+        const CollisionComponent* swap = a; a = b; b = swap;
+        float t;
+        t = aMinX; aMinX = bMinX; bMinX = t;
+        t = aMinY; aMinY = bMinY; bMinY = t;
+        t = aMaxX; aMaxX = bMaxX; bMaxX = t;
+        t = aMaxY; aMaxY = bMaxY; bMaxY = t;
+    }
+    // a is a circle
+    float radius = (aMaxX - aMinX) * 0.5f;
+    float cx = (aMinX + aMaxX) * 0.5f, cy = (aMinY + aMaxY) * 0.5f;
+    if (bCircle && aCircle) {
+        float rb = (bMaxX - bMinX) * 0.5f;
+        float dx = (bMinX + bMaxX) * 0.5f - cx, dy = (bMinY + bMaxY) * 0.5f - cy;
+        return dx * dx + dy * dy < (radius + rb) * (radius + rb);
+    }
+    float px = fminf(fmaxf(cx, bMinX), bMaxX), py = fminf(fmaxf(cy, bMinY), bMaxY);
+    return (px - cx) * (px - cx) + (py - cy) * (py - cy) < radius * radius;
+}
+
+void test_collision_shapes(void) {
+    TestScene test;
+    create_scene(&test);
+
+    // The store is charged to the components budget at registration
+    assert(collision_component_register() == COMPONENT_OK);
+    const CollisionColliders* store = collision_colliders_get();
+    assert(store->capacity == DEFAULT_COMPONENT_POOL_SIZE && store->bytes > 0);
+
+    CollisionComponent* box = add_collider(&test, 100.0f, 50.0f);
+    CollisionComponent* circle = add_collider(&test, 0.0f, 0.0f);
+    assert(collision_component_get_shape(box) == COLLISION_SHAPE_AABB);
+
+    assert(collision_component_set_aabb(NULL, 1.0f, 1.0f) == COLLISION_ERROR_NULL_POINTER);
+    assert(collision_component_set_aabb(box, -1.0f, 1.0f) == COLLISION_ERROR_INVALID_SHAPE);
+    assert(collision_component_set_circle(circle, NAN) == COLLISION_ERROR_INVALID_SHAPE);
+    assert(collision_component_set_aabb(box, 20.0f, 10.0f) == COLLISION_OK);
+    assert(collision_component_set_circle(circle, 8.0f) == COLLISION_OK);
+    assert(collision_component_get_shape(circle) == COLLISION_SHAPE_CIRCLE);
+
+    float minX, minY, maxX, maxY;
+    assert(collision_component_get_bounds(box, &minX, &minY, &maxX, &maxY));
+    assert(minX == 90.0f && minY == 45.0f && maxX == 110.0f && maxY == 55.0f);
+
+    // Offsets move the shape; the transform is read on refresh
+    collision_component_set_offset(circle, 5.0f, -5.0f);
+    transform_component_set_position(test.objects[1]->transform, 10.0f, 20.0f);
+    collision_component_get_bounds(circle, &minX, &minY, &maxX, &maxY);
+    assert(minX == -3.0f && maxY == 3.0f);                     // Not refreshed yet
+    collision_component_refresh(circle);
+    collision_component_get_bounds(circle, &minX, &minY, &maxX, &maxY);
+    assert(minX == 7.0f && minY == 7.0f && maxX == 23.0f && maxY == 23.0f);
+
+    // Destroying swaps the last collider into the freed slot
+    CollisionComponent* third = add_collider(&test, 0.0f, 0.0f);
+    assert(store->count == 3 && third->slot == 2);
+    game_object_remove_component(test.objects[0], COMPONENT_TYPE_COLLISION);
+    assert(store->count == 2 && third->slot == 0 && store->owners[0] == third);
+    assert(!collision_component_get_bounds(box, &minX, &minY, &maxX, &maxY));
+    assert(collision_component_get_bounds(circle, &minX, &minY, &maxX, &maxY) && minX == 7.0f);
+
+    destroy_scene(&test);
+    printf("✓ Collision shape test passed\n");
+}
+
+void test_collision_contacts(void) {
+    TestScene test;
+    create_scene(&test);
+
+    // Overlapping boxes separate along the shallower axis
+    CollisionComponent* boxA = add_collider(&test, 0.0f, 0.0f);
+    CollisionComponent* boxB = add_collider(&test, 16.0f, 4.0f);
+    collision_component_set_aabb(boxA, 20.0f, 20.0f);
+    collision_component_set_aabb(boxB, 20.0f, 20.0f);
+
+    // Touching boxes do not collide
+    CollisionComponent* touching = add_collider(&test, -20.0f, 0.0f);
+    collision_component_set_aabb(touching, 20.0f, 20.0f);
+
+    // Circles, and a circle against a box corner
+    CollisionComponent* circleA = add_collider(&test, 300.0f, 300.0f);
+    CollisionComponent* circleB = add_collider(&test, 306.0f, 308.0f);
+    collision_component_set_circle(circleA, 6.0f);
+    collision_component_set_circle(circleB, 6.0f);
+    CollisionComponent* corner = add_collider(&test, -200.0f, -200.0f);
+    CollisionComponent* near = add_collider(&test, -183.0f, -183.0f);
+    CollisionComponent* far = add_collider(&test, -218.5f, -218.5f);
+    collision_component_set_aabb(corner, 20.0f, 20.0f);
+    collision_component_set_circle(near, 10.0f);
+    collision_component_set_circle(far, 10.0f);
+
+    register_default_systems(test.scene);
+    scene_rebuild_component_arrays(test.scene);
+    scene_set_state(test.scene, SCENE_STATE_ACTIVE);
+    scene_fixed_update(test.scene, 1.0f / 30.0f);
+
+    uint32_t count;
+    assert(collision_system_get_contacts(&count) && count == 3);
+
+    const CollisionContact* contact = find_contact(boxA, boxB);
+    assert(contact && contact->a == boxA);
+    assert(contact->normalX == 1.0f && contact->normalY == 0.0f && test_close_to(contact->depth, 4.0f));
+    assert(!find_contact(boxA, touching));
+
+    contact = find_contact(circleA, circleB);
+    assert(contact && test_close_to(contact->normalX, 0.6f) && test_close_to(contact->normalY, 0.8f));
+    assert(test_close_to(contact->depth, 2.0f));
+
+    contact = find_contact(corner, near);
+    assert(contact && contact->a == corner);
+    assert(test_close_to(contact->normalX, 0.70710678f) && test_close_to(contact->normalY, 0.70710678f));
+    assert(test_close_to(contact->depth, 10.0f - 7.0f * 1.41421356f));
+    assert(!find_contact(corner, far));
+
+    CollisionStats stats;
+    collision_system_get_stats(&stats);
+    assert(stats.colliders == 8 && stats.contacts == 3 && stats.droppedPairs == 0);
+
+    // Disabled colliders and colliders moved apart no longer collide
+    component_set_enabled((Component*)boxB, false);
+    transform_component_set_position(test.objects[4]->transform, 330.0f, 300.0f);
+    scene_fixed_update(test.scene, 1.0f / 30.0f);
+    collision_system_get_contacts(&count);
+    assert(count == 1 && find_contact(corner, near));
+    collision_system_get_stats(&stats);
+    assert(stats.colliders == 7);
+
+    destroy_scene(&test);
+    printf("✓ Collision contact test passed\n");
+}
+
+// Mixed shapes scattered with a fixed seed
+static void scatter(TestScene* test, float spread) {
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < TEST_COLLIDERS; i++) {
+        float x = test_random_float(&seed, spread);
+        float y = test_random_float(&seed, spread);
+        float size = 4.0f + test_random_float(&seed, 32.0f);
+        CollisionComponent* collider = add_collider(test, x, y);
+        if (i % 3 == 0) {
+            collision_component_set_circle(collider, size * 0.5f);
+        } else {
+            collision_component_set_aabb(collider, size, size * (i % 2 ? 0.5f : 2.0f));
+        }
+    }
+}
+
+void test_collision_narrow_phase_kernels(void) {
+    TestScene test;
+    create_scene(&test);
+    scatter(&test, 300.0f);
+    assert(collision_kernel_is_supported(COLLISION_KERNEL_SCALAR));
+    assert(!collision_kernel_is_supported(COLLISION_KERNEL_COUNT));
+    assert(collision_system_set_kernel(COLLISION_KERNEL_COUNT) == COLLISION_ERROR_UNSUPPORTED);
+
+    // Every pair, tested by each kernel against the reference
+    uint32_t pairCount = TEST_COLLIDERS * (TEST_COLLIDERS - 1) / 2;
+    uint32_t* pairA = malloc(pairCount * sizeof(uint32_t));
+    uint32_t* pairB = malloc(pairCount * sizeof(uint32_t));
+    uint32_t expected = 0, n = 0;
+    for (uint32_t i = 0; i < TEST_COLLIDERS; i++) {
+        for (uint32_t j = i + 1; j < TEST_COLLIDERS; j++) {
+            pairA[n] = collider_of(&test, i)->slot;
+            pairB[n++] = collider_of(&test, j)->slot;
+            expected += reference_overlap(collider_of(&test, i), collider_of(&test, j));
+        }
+    }
+    assert(expected > 50);
+
+    CollisionContact* reference = NULL;
+    for (int kernel = 0; kernel < COLLISION_KERNEL_COUNT; kernel++) {
+        if (!collision_kernel_is_supported((CollisionKernel)kernel)) continue;
+        assert(collision_system_set_kernel((CollisionKernel)kernel) == COLLISION_OK);
+        assert(collision_system_test_pairs(pairA, pairB, pairCount) == expected);
+
+        uint32_t count;
+        const CollisionContact* contacts = collision_system_get_contacts(&count);
+        for (uint32_t i = 0; i < count; i++) {
+            assert(reference_overlap(contacts[i].a, contacts[i].b));
+            assert(contacts[i].depth > 0.0f);
+            assert(test_close_to(contacts[i].normalX * contacts[i].normalX + contacts[i].normalY * contacts[i].normalY, 1.0f));
+        }
+        if (!reference) {
+            reference = malloc(count * sizeof(CollisionContact));
+            memcpy(reference, contacts, count * sizeof(CollisionContact));
+        } else {
+            assert(memcmp(reference, contacts, count * sizeof(CollisionContact)) == 0);
+        }
+    }
+
+    // Out-of-range indices are refused
+    uint32_t bad = TEST_COLLIDERS;
+    assert(collision_system_test_pairs(&bad, pairA, 1) == 0);
+
+    collision_system_set_kernel(collision_kernel_best());
+    free(reference);
+    free(pairA);
+    free(pairB);
+    destroy_scene(&test);
+    printf("✓ Collision narrow phase kernel test passed\n");
+}
+
+void test_collision_broad_phase(void) {
+    const float spreads[] = { 300.0f, 5000.0f };
+    const float cellSizes[] = { 8.0f, 64.0f, 1000.0f };
+    uint32_t spatialBytes = memory_budget_get(MEMORY_SUBSYSTEM_SPATIAL)->usedBytes;
+
+    for (uint32_t s = 0; s < 2; s++) {
+        for (uint32_t c = 0; c < 3; c++) {
+            TestScene test;
+            create_scene(&test);
+            scatter(&test, spreads[s]);
+            assert(collision_system_set_cell_size(cellSizes[c]) == COLLISION_OK);
+
+            uint32_t expected = 0;
+            for (uint32_t i = 0; i < TEST_COLLIDERS; i++) {
+                for (uint32_t j = i + 1; j < TEST_COLLIDERS; j++) {
+                    expected += reference_overlap(collider_of(&test, i), collider_of(&test, j));
+                }
+            }
+
+            // Each overlapping pair is reported once, however many cells it shares
+            assert(collision_system_update(test.scene) == expected);
+            uint32_t count;
+            const CollisionContact* contacts = collision_system_get_contacts(&count);
+            for (uint32_t i = 0; i < count; i++) {
+                for (uint32_t j = i + 1; j < count; j++) {
+                    assert(!(contacts[i].a == contacts[j].a && contacts[i].b == contacts[j].b));
+                }
+            }
+
+            // The grid stays in proportion to the collider count
+            CollisionStats stats;
+            collision_system_get_stats(&stats);
+            assert(stats.colliders == TEST_COLLIDERS && stats.candidatePairs >= expected);
+            assert(stats.cells <= TEST_COLLIDERS * 4 + 2 * 1024);
+
+            // Steady state does not allocate
+            uint32_t before = memory_budget_get(MEMORY_SUBSYSTEM_SPATIAL)->usedBytes;
+            assert(collision_system_update(test.scene) == expected);
+            assert(memory_budget_get(MEMORY_SUBSYSTEM_SPATIAL)->usedBytes == before);
+
+            destroy_scene(&test);
+        }
+    }
+    assert(collision_system_set_cell_size(0.0f) == COLLISION_ERROR_INVALID_SHAPE);
+    collision_system_set_cell_size(COLLISION_DEFAULT_CELL_SIZE);
+
+    // Scratch memory is returned on shutdown
+    assert(memory_budget_get(MEMORY_SUBSYSTEM_SPATIAL)->usedBytes == spatialBytes);
+    assert(collision_system_update(NULL) == 0);
+    printf("✓ Collision broad phase test passed\n");
+}
+
+void test_collision_layers(void) {
+    TestScene test;
+    create_scene(&test);
+
+    // Player bullets hit enemies only; enemies also hit the player
+    enum { PLAYER = 0x1, BULLET = 0x2, ENEMY = 0x4 };
+    CollisionComponent* player = add_collider(&test, 0.0f, 0.0f);
+    CollisionComponent* bullets[3];
+    CollisionComponent* enemies[3];
+    for (int i = 0; i < 3; i++) {
+        bullets[i] = add_collider(&test, (float)i, 0.0f);
+        enemies[i] = add_collider(&test, 0.0f, (float)i);
+    }
+    CollisionComponent* ghost = add_collider(&test, 1.0f, 1.0f);
+    for (uint32_t i = 0; i < test.count; i++) {
+        collision_component_set_aabb(collider_of(&test, i), 10.0f, 10.0f);
+    }
+    assert(collision_component_get_layer(player) == COLLISION_LAYER_DEFAULT);
+    assert(collision_component_get_mask(player) == COLLISION_MASK_ALL);
+    collision_component_set_mask(player, ENEMY);
+    for (int i = 0; i < 3; i++) {
+        collision_component_set_layer(bullets[i], BULLET);
+        collision_component_set_mask(bullets[i], ENEMY);
+        collision_component_set_layer(enemies[i], ENEMY);
+        collision_component_set_mask(enemies[i], PLAYER | BULLET);
+    }
+    collision_component_set_layer(ghost, 0);
+    assert(collision_component_get_layer(ghost) == 0 && collision_component_get_mask(ghost) == COLLISION_MASK_ALL);
+
+    // Nine bullet/enemy pairs and three enemy/player pairs; everything else
+    // is filtered out before the narrow phase
+    assert(collision_system_update(test.scene) == 12);
+    CollisionStats stats;
+    collision_system_get_stats(&stats);
+    assert(stats.colliders == 7 && stats.layerBuckets == 3 && stats.candidatePairs == 12);
+    assert(find_contact(player, enemies[2]) && find_contact(bullets[0], enemies[1]));
+    assert(!find_contact(player, bullets[0]) && !find_contact(bullets[0], bullets[1]));
+    assert(!find_contact(enemies[0], enemies[1]) && !find_contact(ghost, player));
+
+    // Pairs keep store order whichever bucket each collider came from
+    uint32_t count;
+    const CollisionContact* contacts = collision_system_get_contacts(&count);
+    for (uint32_t i = 0; i < count; i++) {
+        assert(contacts[i].a->slot < contacts[i].b->slot);
+    }
+
+    // A one-sided mask is not enough
+    collision_component_set_mask(player, BULLET);
+    assert(collision_system_update(test.scene) == 9);
+
+    destroy_scene(&test);
+    printf("✓ Collision layer test passed\n");
+}
+
+void test_collision_layers_scattered(void) {
+    TestScene test;
+    create_scene(&test);
+    scatter(&test, 300.0f);
+
+    // Several bits per layer, so buckets mix layers
+    static const uint32_t layers[] = { 0x1, 0x2, 0x6, 0x8, 0x10 };
+    static const uint32_t masks[] = { 0x1E, 0x9, 0x1, 0x13, 0x4 };
+    for (uint32_t i = 0; i < test.count; i++) {
+        collision_component_set_layer(collider_of(&test, i), layers[i % 5]);
+        collision_component_set_mask(collider_of(&test, i), masks[(i / 5) % 5]);
+    }
+
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < TEST_COLLIDERS; i++) {
+        for (uint32_t j = i + 1; j < TEST_COLLIDERS; j++) {
+            const CollisionComponent* a = collider_of(&test, i);
+            const CollisionComponent* b = collider_of(&test, j);
+            expected += reference_overlap(a, b) &&
+                        collision_layers_interact(collision_component_get_layer(a), collision_component_get_mask(a),
+                                                  collision_component_get_layer(b), collision_component_get_mask(b));
+        }
+    }
+    assert(expected > 10);
+    assert(collision_system_update(test.scene) == expected);
+
+    destroy_scene(&test);
+    printf("✓ Collision scattered layer test passed\n");
+}
+
+void test_collision_sweeps(void) {
+    TestScene test;
+    create_scene(&test);
+    collision_system_set_cell_size(16.0f);
+
+    // A 2 px wall and a second one further on; the bullet jumps 300 px
+    CollisionComponent* wall = add_collider(&test, 100.0f, 0.0f);
+    CollisionComponent* farWall = add_collider(&test, 200.0f, 0.0f);
+    collision_component_set_aabb(wall, 2.0f, 100.0f);
+    collision_component_set_aabb(farWall, 2.0f, 100.0f);
+    CollisionComponent* bullet = add_collider(&test, 0.0f, 10.0f);
+    collision_component_set_aabb(bullet, 4.0f, 4.0f);
+    assert(!collision_component_is_continuous(bullet));
+
+    // Without CCD the bullet tunnels
+    assert(collision_system_update(test.scene) == 0);
+    transform_component_set_position(test.objects[2]->transform, 300.0f, 10.0f);
+    assert(collision_system_update(test.scene) == 0);
+    uint32_t count;
+    assert(!collision_system_get_sweep_hits(&count) && count == 0);
+
+    // With CCD the first wall is hit at its face: centre x 97 of a 300 px move
+    collision_component_set_continuous(bullet, true);
+    assert(collision_component_is_continuous(bullet));
+    transform_component_set_position(test.objects[2]->transform, 0.0f, 10.0f);
+    collision_component_refresh(bullet);
+    transform_component_set_position(test.objects[2]->transform, 300.0f, 10.0f);
+    assert(collision_system_update(test.scene) == 0);
+    const CollisionSweepHit* hits = collision_system_get_sweep_hits(&count);
+    assert(count == 1 && hits[0].mover == bullet && hits[0].target == wall);
+    assert(test_close_to(hits[0].time, 97.0f / 300.0f) && test_close_to(hits[0].x, 97.0f) && test_close_to(hits[0].y, 10.0f));
+    assert(hits[0].normalX == 1.0f && hits[0].normalY == 0.0f);
+    CollisionStats stats;
+    collision_system_get_stats(&stats);
+    assert(stats.sweeps == 1 && stats.sweepHits == 1);
+
+    // Not moving is not a hit; the sweep starts where the last update ended
+    assert(collision_system_update(test.scene) == 0);
+    collision_system_get_sweep_hits(&count);
+    assert(count == 0);
+
+    // Going back hits the far wall first, from the other side
+    transform_component_set_position(test.objects[2]->transform, -50.0f, 10.0f);
+    collision_system_update(test.scene);
+    hits = collision_system_get_sweep_hits(&count);
+    assert(count == 1 && hits[0].target == farWall && hits[0].normalX == -1.0f);
+    assert(test_close_to(hits[0].x, 203.0f));
+
+    // A circle clipping the wall's top corner hits the rounded corner:
+    // a 4 px circle moving along y = -52 touches the corner (99, -50) at x = 99 - sqrt(12)
+    collision_component_set_circle(bullet, 4.0f);
+    transform_component_set_position(test.objects[2]->transform, 0.0f, -52.0f);
+    collision_component_refresh(bullet);
+    transform_component_set_position(test.objects[2]->transform, 150.0f, -52.0f);
+    collision_system_update(test.scene);
+    hits = collision_system_get_sweep_hits(&count);
+    assert(count == 1 && hits[0].target == wall);
+    assert(test_close_to(hits[0].x, 99.0f - sqrtf(12.0f)) && test_close_to(hits[0].y, -52.0f));
+    assert(test_close_to(hits[0].normalX, sqrtf(12.0f) / 4.0f) && test_close_to(hits[0].normalY, 0.5f));
+
+    // One pixel higher it passes the corner
+    transform_component_set_position(test.objects[2]->transform, 0.0f, -54.5f);
+    collision_component_refresh(bullet);
+    transform_component_set_position(test.objects[2]->transform, 150.0f, -54.5f);
+    collision_system_update(test.scene);
+    collision_system_get_sweep_hits(&count);
+    assert(count == 0);
+
+    // Layers apply to sweeps, and colliders overlapped at the start are ignored
+    collision_component_set_mask(bullet, 0x2);
+    transform_component_set_position(test.objects[2]->transform, 0.0f, 10.0f);
+    collision_component_refresh(bullet);
+    transform_component_set_position(test.objects[2]->transform, 300.0f, 10.0f);
+    collision_system_update(test.scene);
+    collision_system_get_sweep_hits(&count);
+    assert(count == 0);
+    collision_component_set_mask(bullet, COLLISION_MASK_ALL);
+    transform_component_set_position(test.objects[2]->transform, 100.0f, 10.0f);
+    collision_component_refresh(bullet);
+    transform_component_set_position(test.objects[2]->transform, 300.0f, 10.0f);
+    collision_system_update(test.scene);
+    hits = collision_system_get_sweep_hits(&count);
+    assert(count == 1 && hits[0].target == farWall);
+
+    // Re-enabling places the collider: a jump made while disabled is not swept
+    component_set_enabled((Component*)bullet, false);
+    transform_component_set_position(test.objects[2]->transform, 0.0f, 10.0f);
+    collision_system_update(test.scene);
+    component_set_enabled((Component*)bullet, true);
+    collision_system_update(test.scene);
+    collision_system_get_sweep_hits(&count);
+    assert(count == 0);
+
+    // A new collider positioned after creation does not sweep from the origin
+    CollisionComponent* spawned = add_collider(&test, 300.0f, 10.0f);
+    collision_component_set_aabb(spawned, 4.0f, 4.0f);
+    assert(collision_colliders_get()->placed[spawned->slot] == 0);
+    collision_colliders_get()->continuous[spawned->slot] = 1;   // Flagged without the refresh
+    collision_system_update(test.scene);
+    collision_system_get_sweep_hits(&count);
+    assert(count == 0);
+    transform_component_set_position(test.objects[3]->transform, 0.0f, 10.0f);
+    collision_system_update(test.scene);
+    hits = collision_system_get_sweep_hits(&count);
+    assert(count == 1 && hits[0].mover == spawned && hits[0].target == farWall);
+
+    collision_system_set_cell_size(COLLISION_DEFAULT_CELL_SIZE);
+    destroy_scene(&test);
+    printf("✓ Collision sweep test passed\n");
+}
+
+// Distance between two rounded boxes minus their radii; negative overlaps
+static float rounded_separation(float aMinX, float aMinY, float aMaxX, float aMaxY, float aRadius,
+                                float bMinX, float bMinY, float bMaxX, float bMaxY, float bRadius) {
+    float gapX = fmaxf(aMinX - bMaxX, bMinX - aMaxX);
+    float gapY = fmaxf(aMinY - bMaxY, bMinY - aMaxY);
+    if (gapX < 0.0f && gapY < 0.0f) {
+        return fmaxf(gapX, gapY) - aRadius - bRadius;
+    }
+    return sqrtf(fmaxf(gapX, 0.0f) * fmaxf(gapX, 0.0f) + fmaxf(gapY, 0.0f) * fmaxf(gapY, 0.0f)) - aRadius - bRadius;
+}
+
+// Sweeps against sampled motion: every target the sampled mover overlaps
+// is hit no later than the sample, and a reported hit touches its target
+void test_collision_sweeps_sampled(void) {
+    enum { MOVERS = 24, SAMPLES = 4000 };
+    TestScene test;
+    create_scene(&test);
+    scatter(&test, 300.0f);
+    uint32_t targets = test.count;
+    const CollisionColliders* store = collision_colliders_get();
+
+    uint32_t seed = 777;
+    float fromX[MOVERS], fromY[MOVERS], toX[MOVERS], toY[MOVERS];
+    for (uint32_t m = 0; m < MOVERS; m++) {
+        fromX[m] = test_random_float(&seed, 300.0f);
+        fromY[m] = test_random_float(&seed, 300.0f);
+        toX[m] = test_random_float(&seed, 300.0f);
+        toY[m] = test_random_float(&seed, 300.0f);
+
+        CollisionComponent* mover = add_collider(&test, fromX[m], fromY[m]);
+        if (m % 2) {
+            collision_component_set_circle(mover, 1.5f + (float)(m % 5));
+        } else {
+            collision_component_set_aabb(mover, 2.0f + (float)(m % 7), 3.0f);
+        }
+        collision_component_set_layer(mover, 0x2);       // Movers ignore each other
+        collision_component_set_mask(mover, 0x1);
+        collision_component_set_continuous(mover, true);
+        transform_component_set_position(test.objects[test.count - 1]->transform, toX[m], toY[m]);
+    }
+    collision_system_update(test.scene);
+    uint32_t hitCount;
+    const CollisionSweepHit* hits = collision_system_get_sweep_hits(&hitCount);
+
+    uint32_t checked = 0;
+    for (uint32_t m = 0; m < MOVERS; m++) {
+        const CollisionComponent* mover = collider_of(&test, targets + m);
+        uint32_t i = mover->slot;
+        float halfWidth = (store->maxX[i] - store->minX[i]) * 0.5f;
+        float halfHeight = (store->maxY[i] - store->minY[i]) * 0.5f;
+
+        const CollisionSweepHit* hit = NULL;
+        for (uint32_t h = 0; h < hitCount; h++) {
+            if (hits[h].mover == mover) hit = &hits[h];
+        }
+
+        // Earliest sampled overlap with a target not overlapped at the start
+        float sampled = 2.0f;
+        for (uint32_t t = 0; t < targets; t++) {
+            uint32_t j = collider_of(&test, t)->slot;
+            for (uint32_t n = 0; n <= SAMPLES; n++) {
+                float time = (float)n / SAMPLES;
+                float x = fromX[m] + (toX[m] - fromX[m]) * time;
+                float y = fromY[m] + (toY[m] - fromY[m]) * time;
+                float separation = rounded_separation(x - halfWidth, y - halfHeight, x + halfWidth, y + halfHeight,
+                                                      store->radius[i], store->minX[j], store->minY[j],
+                                                      store->maxX[j], store->maxY[j], store->radius[j]);
+                if (separation < 0.0f) {
+                    if (n > 0 && time < sampled) sampled = time;
+                    break;
+                }
+            }
+        }
+
+        if (sampled <= 1.0f) {
+            assert(hit && hit->time <= sampled + 1e-4f);
+        }
+        if (hit) {
+            uint32_t j = hit->target->slot;
+            float separation = rounded_separation(hit->x - halfWidth, hit->y - halfHeight, hit->x + halfWidth,
+                                                  hit->y + halfHeight, store->radius[i], store->minX[j],
+                                                  store->minY[j], store->maxX[j], store->maxY[j], store->radius[j]);
+            assert(fabsf(separation) < 1e-2f);
+            assert(hit->time >= sampled - 2.0f / SAMPLES);
+            checked++;
+        }
+    }
+    assert(checked > MOVERS / 2);
+
+    destroy_scene(&test);
+    printf("✓ Collision sampled sweep test passed\n");
+}
+
+void test_collision_events(void) {
+    TestScene test;
+    create_scene(&test);
+    CollisionComponent* a = add_collider(&test, 0.0f, 0.0f);
+    CollisionComponent* b = add_collider(&test, 10.0f, 0.0f);
+    CollisionComponent* c = add_collider(&test, 200.0f, 0.0f);
+    collision_component_set_aabb(a, 20.0f, 20.0f);
+    collision_component_set_aabb(b, 20.0f, 20.0f);
+    collision_component_set_aabb(c, 20.0f, 20.0f);
+    assert(a->base.id < b->base.id && b->base.id < c->base.id);
+
+    // First touch enters, with a as the lower id and the normal a -> b
+    uint32_t enterCount, stayCount, exitCount;
+    assert(collision_system_update(test.scene) == 1);
+    const CollisionContact* entered = collision_system_get_enter_events(&enterCount);
+    collision_system_get_stay_events(&stayCount);
+    collision_system_get_exit_events(&exitCount);
+    assert(enterCount == 1 && stayCount == 0 && exitCount == 0);
+    assert(entered[0].a == a && entered[0].b == b && entered[0].normalX == 1.0f && entered[0].depth == 10.0f);
+
+    // Still touching stays; the contact is oriented the same way
+    collision_system_update(test.scene);
+    const CollisionContact* stayed = collision_system_get_stay_events(&stayCount);
+    assert(collision_system_get_enter_events(&enterCount) == NULL && enterCount == 0);
+    assert(stayCount == 1 && stayed[0].a == a && stayed[0].b == b && stayed[0].normalX == 1.0f);
+
+    // b leaves and c arrives from the left of a: one exit, one enter
+    transform_component_set_position(test.objects[1]->transform, 100.0f, 0.0f);
+    transform_component_set_position(test.objects[2]->transform, -5.0f, 0.0f);
+    collision_system_update(test.scene);
+    entered = collision_system_get_enter_events(&enterCount);
+    const CollisionExit* exited = collision_system_get_exit_events(&exitCount);
+    collision_system_get_stay_events(&stayCount);
+    assert(enterCount == 1 && entered[0].a == a && entered[0].b == c && entered[0].normalX == -1.0f);
+    assert(exitCount == 1 && exited[0].a == a && exited[0].b == b);
+    assert(exited[0].idA == a->base.id && exited[0].idB == b->base.id && stayCount == 0);
+    CollisionStats stats;
+    collision_system_get_stats(&stats);
+    assert(stats.enters == 1 && stats.stays == 0 && stats.exits == 1);
+
+    // A destroyed collider exits with its id only
+    uint32_t idC = c->base.id;
+    game_object_remove_component(test.objects[2], COMPONENT_TYPE_COLLISION);
+    collision_system_update(test.scene);
+    exited = collision_system_get_exit_events(&exitCount);
+    assert(exitCount == 1 && exited[0].a == a && exited[0].b == NULL && exited[0].idB == idC);
+
+    // Filtering a pair out ends its contact too
+    transform_component_set_position(test.objects[1]->transform, 5.0f, 0.0f);
+    collision_system_update(test.scene);
+    collision_system_get_enter_events(&enterCount);
+    assert(enterCount == 1);
+    collision_component_set_mask(b, 0);
+    collision_system_update(test.scene);
+    exited = collision_system_get_exit_events(&exitCount);
+    assert(exitCount == 1 && exited[0].a == a && exited[0].b == b);
+
+    // Updating no scene leaves no last events and the scene's pairs alone
+    collision_component_set_mask(b, COLLISION_MASK_ALL);
+    collision_system_update(test.scene);
+    assert(collision_system_update(NULL) == 0);
+    assert(collision_system_get_enter_events(&enterCount) == NULL && enterCount == 0);
+    assert(collision_system_get_exit_events(&exitCount) == NULL && exitCount == 0);
+    collision_system_update(test.scene);
+    collision_system_get_enter_events(&enterCount);
+    collision_system_get_stay_events(&stayCount);
+    collision_system_get_exit_events(&exitCount);
+    assert(enterCount == 0 && stayCount == 1 && exitCount == 0);
+
+    destroy_scene(&test);
+    printf("✓ Collision event test passed\n");
+}
+
+static void assert_event_counts(uint32_t enters, uint32_t stays, uint32_t exits) {
+    uint32_t enterCount, stayCount, exitCount;
+    collision_system_get_enter_events(&enterCount);
+    collision_system_get_stay_events(&stayCount);
+    collision_system_get_exit_events(&exitCount);
+    assert(enterCount == enters && stayCount == stays && exitCount == exits);
+}
+
+// Two scenes updated in turn each compare against their own previous pairs
+void test_collision_events_per_scene(void) {
+    TestScene test;
+    create_scene(&test);
+    CollisionComponent* a = add_collider(&test, 0.0f, 0.0f);
+    CollisionComponent* b = add_collider(&test, 10.0f, 0.0f);
+    collision_component_set_aabb(a, 20.0f, 20.0f);
+    collision_component_set_aabb(b, 20.0f, 20.0f);
+
+    Scene* other = scene_create("Other", 8);
+    assert(other);
+    CollisionComponent* others[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        GameObject* object = game_object_create(other);
+        assert(object);
+        transform_component_set_position(object->transform, (float)i * 10.0f, 0.0f);
+        others[i] = collision_component_create(object);
+        assert(others[i]);
+        game_object_add_component(object, (Component*)others[i]);
+        collision_component_set_aabb(others[i], 20.0f, 20.0f);
+    }
+
+    // Each scene's first update enters its own pair; after that both pairs
+    // stay, however the updates interleave
+    collision_system_update(test.scene);
+    assert_event_counts(1, 0, 0);
+    const CollisionContact* entered = collision_system_get_enter_events(NULL);
+    assert(entered[0].a == a && entered[0].b == b);
+    collision_system_update(other);
+    assert_event_counts(1, 0, 0);
+    entered = collision_system_get_enter_events(NULL);
+    assert(entered[0].a == others[0] && entered[0].b == others[1]);
+    for (uint32_t round = 0; round < 3; round++) {
+        collision_system_update(test.scene);
+        assert_event_counts(0, 1, 0);
+        collision_system_update(other);
+        assert_event_counts(0, 1, 0);
+    }
+
+    // Separating one scene's pair exits there only, and each scene's
+    // events stay readable after the other's update
+    transform_component_set_position(test.objects[1]->transform, 100.0f, 0.0f);
+    collision_system_update(test.scene);
+    assert_event_counts(0, 0, 1);
+    collision_system_update(other);
+    assert_event_counts(0, 1, 0);
+    CollisionEvents events;
+    assert(collision_system_get_scene_events(test.scene, &events));
+    assert(events.exitCount == 1 && events.exits[0].a == a && events.exits[0].b == b);
+    assert(events.enters == NULL && events.enterCount == 0 && events.stays == NULL);
+    assert(collision_system_get_scene_events(other, &events));
+    assert(events.stayCount == 1 && events.stays[0].a == others[0] && events.exitCount == 0);
+    assert(!collision_system_get_scene_events(NULL, &events) && events.stayCount == 0);
+
+    scene_destroy(other);
+    destroy_scene(&test);
+    printf("✓ Collision per-scene event test passed\n");
+}
+
+// Under the scene manager detection runs once per fixed step, so the
+// first overlapping frame reports the enter
+void test_collision_events_under_scene_manager(void) {
+    TestScene test;
+    create_scene(&test);
+    CollisionComponent* a = add_collider(&test, 0.0f, 0.0f);
+    CollisionComponent* b = add_collider(&test, 100.0f, 0.0f);
+    collision_component_set_aabb(a, 20.0f, 20.0f);
+    collision_component_set_aabb(b, 20.0f, 20.0f);
+    register_default_systems(test.scene);
+    scene_rebuild_component_arrays(test.scene);
+    SceneManager* manager = scene_manager_create();
+    assert(manager && scene_manager_add_scene(manager, test.scene) == SCENE_OK);
+    assert(scene_manager_set_active_scene(manager, test.scene) == SCENE_OK);
+
+    // One 60 Hz frame is one fixed step
+    float frame = 1.0f / 60.0f;
+    scene_manager_update(manager, frame);
+    assert_event_counts(0, 0, 0);
+    transform_component_set_position(test.objects[1]->transform, 10.0f, 0.0f);
+    scene_manager_update(manager, frame);
+    assert_event_counts(1, 0, 0);
+    scene_manager_update(manager, frame);
+    assert_event_counts(0, 1, 0);
+    transform_component_set_position(test.objects[1]->transform, 100.0f, 0.0f);
+    scene_manager_update(manager, frame);
+    assert_event_counts(0, 0, 1);
+
+    // A frame too short for a step leaves the last step's events
+    scene_manager_update(manager, frame * 0.5f);
+    assert_event_counts(0, 0, 1);
+
+    scene_manager_remove_scene(manager, test.scene);
+    scene_manager_destroy(manager);
+    scene_set_state(test.scene, SCENE_STATE_INACTIVE);
+    destroy_scene(&test);
+    printf("✓ Collision events under scene manager test passed\n");
+}
+
+static int compare_keys(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static uint64_t event_key(uint32_t idA, uint32_t idB) {
+    assert(idA < idB);
+    return (uint64_t)idA << 32 | idB;
+}
+
+static bool has_key(const uint64_t* keys, uint32_t count, uint64_t key) {
+    return bsearch(&key, keys, count, sizeof(uint64_t), compare_keys) != NULL;
+}
+
+// Events over several frames of movement, removal and filtering checked
+// against set differences of the contact pairs
+void test_collision_events_scattered(void) {
+    TestScene test;
+    create_scene(&test);
+    scatter(&test, 300.0f);
+
+    static uint64_t previous[TEST_COLLIDERS * TEST_COLLIDERS], current[TEST_COLLIDERS * TEST_COLLIDERS];
+    uint32_t previousCount = 0;
+    uint32_t seed = 777;
+    for (uint32_t frame = 0; frame < 8; frame++) {
+        for (uint32_t i = frame % 4; i < test.count; i += 4) {
+            if (!collider_of(&test, i)) continue;
+            float dx = test_random_float(&seed, 32.0f) - 16.0f;
+            float dy = test_random_float(&seed, 32.0f) - 16.0f;
+            float x, y;
+            transform_component_get_position(test.objects[i]->transform, &x, &y);
+            transform_component_set_position(test.objects[i]->transform, x + dx, y + dy);
+        }
+        if (frame == 3) {
+            for (uint32_t i = 5; i < test.count; i += 17) {
+                game_object_remove_component(test.objects[i], COMPONENT_TYPE_COLLISION);
+                test.components[i] = NULL;
+            }
+        }
+        if (frame == 5) {
+            for (uint32_t i = 7; i < test.count; i += 13) {
+                if (collider_of(&test, i)) collision_component_set_layer(collider_of(&test, i), 0);
+            }
+        }
+
+        uint32_t contactCount, enterCount, stayCount, exitCount;
+        collision_system_update(test.scene);
+        const CollisionContact* contacts = collision_system_get_contacts(&contactCount);
+        for (uint32_t i = 0; i < contactCount; i++) {
+            uint32_t idA = contacts[i].a->base.id, idB = contacts[i].b->base.id;
+            current[i] = idA < idB ? event_key(idA, idB) : event_key(idB, idA);
+        }
+        qsort(current, contactCount, sizeof(uint64_t), compare_keys);
+
+        // Enters and stays partition the contacts, in key order
+        const CollisionContact* entered = collision_system_get_enter_events(&enterCount);
+        const CollisionContact* stayed = collision_system_get_stay_events(&stayCount);
+        assert(enterCount + stayCount == contactCount);
+        uint64_t last = 0;
+        for (uint32_t i = 0; i < enterCount; i++) {
+            uint64_t key = event_key(entered[i].a->base.id, entered[i].b->base.id);
+            assert(key > last && !has_key(previous, previousCount, key) && has_key(current, contactCount, key));
+            const CollisionContact* contact = find_contact(entered[i].a, entered[i].b);
+            float sign = contact->a == entered[i].a ? 1.0f : -1.0f;
+            assert(entered[i].normalX == sign * contact->normalX && entered[i].depth == contact->depth);
+            last = key;
+        }
+        last = 0;
+        for (uint32_t i = 0; i < stayCount; i++) {
+            uint64_t key = event_key(stayed[i].a->base.id, stayed[i].b->base.id);
+            assert(key > last && has_key(previous, previousCount, key) && has_key(current, contactCount, key));
+            last = key;
+        }
+
+        // Exits are the previous pairs that are gone; destroyed colliders are NULL
+        const CollisionExit* exited = collision_system_get_exit_events(&exitCount);
+        uint32_t expectedExits = 0;
+        for (uint32_t i = 0; i < previousCount; i++) {
+            expectedExits += !has_key(current, contactCount, previous[i]);
+        }
+        assert(exitCount == expectedExits);
+        last = 0;
+        for (uint32_t i = 0; i < exitCount; i++) {
+            uint64_t key = event_key(exited[i].idA, exited[i].idB);
+            assert(key > last && has_key(previous, previousCount, key) && !has_key(current, contactCount, key));
+            last = key;
+            for (uint32_t side = 0; side < 2; side++) {
+                uint32_t id = side ? exited[i].idB : exited[i].idA;
+                CollisionComponent* expected = NULL;
+                for (uint32_t j = 0; j < test.count; j++) {
+                    if (collider_of(&test, j) && collider_of(&test, j)->base.id == id) expected = collider_of(&test, j);
+                }
+                assert((side ? exited[i].b : exited[i].a) == expected);
+            }
+        }
+        if (frame == 0) {
+            assert(enterCount > 0 && stayCount == 0);
+        } else {
+            assert(stayCount > 0 && enterCount > 0 && exitCount > 0);
+        }
+
+        memcpy(previous, current, contactCount * sizeof(uint64_t));
+        previousCount = contactCount;
+    }
+
+    destroy_scene(&test);
+    printf("✓ Collision scattered event test passed\n");
+}
+
+int run_collision_tests(void) {
+    printf("Running collision tests...\n");
+
+    test_collision_shapes();
+    test_collision_contacts();
+    test_collision_narrow_phase_kernels();
+    test_collision_broad_phase();
+    test_collision_layers();
+    test_collision_layers_scattered();
+    test_collision_sweeps();
+    test_collision_sweeps_sampled();
+    test_collision_events();
+    test_collision_events_per_scene();
+    test_collision_events_under_scene_manager();
+    test_collision_events_scattered();
+
+    printf("All collision tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_collision_tests();
+}
+#endif
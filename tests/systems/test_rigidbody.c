@@ -0,0 +1,363 @@
+#include "../../src/systems/rigidbody_system.h"
+#include "../../src/components/rigidbody_component.h"
+#include "../../src/components/transform_component.h"
+#include "../../src/core/component_registry.h"
+#include "../../src/core/game_object.h"
+#include "../../src/core/scene.h"
+#include "../../src/core/scene_manager.h"
+#include "../../src/core/update_systems.h"
+#include "../test_helpers.h"
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_BODIES TEST_ODD_COUNT
+
+static void create_scene(TestScene* test) {
+    test_scene_create(test, "RigidBody", TEST_BODIES + 8);
+}
+
+// New body at (x, y) whose transform starts clean, so a step's dirty flags show
+static RigidBodyComponent* add_body(TestScene* test, float x, float y) {
+    GameObject* object = test_scene_add(test, x, y);
+    RigidBodyComponent* body = rigidbody_component_create(object);
+    assert(body && rigidbody_component_is_rigidbody((Component*)body));
+    test_scene_attach(test, (Component*)body);
+    object->transform->renderDirty = false;
+    object->transform->matrixDirty = false;
+    return body;
+}
+
+static RigidBodyComponent* body_of(const TestScene* test, uint32_t index) {
+    return (RigidBodyComponent*)test->components[index];
+}
+
+static void destroy_scene(TestScene* test) {
+    test_scene_destroy(test);
+    rigidbody_system_shutdown();
+    rigidbody_bodies_shutdown();
+    rigidbody_system_set_fixed_step(RIGIDBODY_DEFAULT_FIXED_STEP);
+}
+
+static void position_of(const TestScene* test, uint32_t index, float* x, float* y) {
+    transform_component_get_position(test->objects[index]->transform, x, y);
+}
+
+void test_rigidbody_motion(void) {
+    TestScene test;
+    create_scene(&test);
+
+    // The store is charged to the components budget at registration
+    assert(rigidbody_component_register() == COMPONENT_OK);
+    const RigidBodies* store = rigidbody_bodies_get();
+    assert(store->capacity == DEFAULT_COMPONENT_POOL_SIZE && store->bytes > 0);
+
+    RigidBodyComponent* body = add_body(&test, 100.0f, 50.0f);
+    float vx, vy;
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 0.0f && vy == 0.0f && rigidbody_component_get_mass(body) == 1.0f);
+    assert(rigidbody_component_set_mass(NULL, 1.0f) == RIGIDBODY_ERROR_NULL_POINTER);
+    assert(rigidbody_component_set_mass(body, -1.0f) == RIGIDBODY_ERROR_INVALID_VALUE);
+    assert(rigidbody_component_set_damping(body, NAN) == RIGIDBODY_ERROR_INVALID_VALUE);
+    assert(rigidbody_system_set_fixed_step(0.0f) == RIGIDBODY_ERROR_INVALID_VALUE);
+
+    // Semi-implicit Euler: the new velocity moves the body
+    rigidbody_component_set_velocity(body, 10.0f, 0.0f);
+    rigidbody_component_set_acceleration(body, 0.0f, 4.0f);
+    assert(rigidbody_system_step(test.scene, 0.5f) == 1);
+    float x, y;
+    position_of(&test, 0, &x, &y);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 10.0f && vy == 2.0f && x == 105.0f && y == 51.0f);
+    assert(test.objects[0]->transform->matrixDirty && test.objects[0]->transform->renderDirty);
+
+    // Forces scale by the inverse mass and last one step; impulses act at once
+    rigidbody_component_set_acceleration(body, 0.0f, 0.0f);
+    rigidbody_component_set_velocity(body, 0.0f, 0.0f);
+    assert(rigidbody_component_set_mass(body, 2.0f) == RIGIDBODY_OK && rigidbody_component_get_mass(body) == 2.0f);
+    rigidbody_component_apply_force(body, 8.0f, 0.0f);
+    rigidbody_system_step(test.scene, 0.5f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 2.0f);
+    rigidbody_system_step(test.scene, 0.5f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 2.0f);
+    rigidbody_component_apply_impulse(body, -4.0f, 6.0f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 0.0f && vy == 3.0f);
+
+    // Damping takes its fraction per second, never past a stop
+    assert(rigidbody_component_set_damping(body, 1.0f) == RIGIDBODY_OK);
+    rigidbody_system_step(test.scene, 0.5f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vy == 1.5f);
+    rigidbody_system_step(test.scene, 4.0f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vy == 0.0f);
+
+    // Kinematic bodies ignore forces and impulses but keep moving
+    assert(rigidbody_component_set_mass(body, 0.0f) == RIGIDBODY_OK && rigidbody_component_get_mass(body) == 0.0f);
+    assert(rigidbody_component_set_damping(body, 0.0f) == RIGIDBODY_OK);
+    rigidbody_component_set_velocity(body, 1.0f, 0.0f);
+    rigidbody_component_apply_impulse(body, 100.0f, 100.0f);
+    rigidbody_component_apply_force(body, 100.0f, 100.0f);
+    rigidbody_system_step(test.scene, 1.0f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 1.0f && vy == 0.0f);
+
+    // Destroying swaps the last body into the freed slot
+    RigidBodyComponent* second = add_body(&test, 0.0f, 0.0f);
+    RigidBodyComponent* third = add_body(&test, 0.0f, 0.0f);
+    rigidbody_component_set_velocity(third, 7.0f, 0.0f);
+    assert(store->count == 3 && third->slot == 2);
+    game_object_remove_component(test.objects[0], COMPONENT_TYPE_RIGIDBODY);
+    assert(store->count == 2 && third->slot == 0 && store->owners[0] == third && second->slot == 1);
+    rigidbody_component_get_velocity(third, &vx, &vy);
+    assert(vx == 7.0f);
+    rigidbody_component_get_velocity(body, &vx, &vy);
+    assert(vx == 0.0f && rigidbody_component_set_mass(body, 1.0f) == RIGIDBODY_ERROR_NULL_POINTER);
+
+    destroy_scene(&test);
+    printf("✓ Rigid body motion test passed\n");
+}
+
+void test_rigidbody_moved_bits(void) {
+    TestScene test;
+    create_scene(&test);
+
+    // Every third body moves; the rest are at rest
+    for (uint32_t i = 0; i < 40; i++) {
+        RigidBodyComponent* body = add_body(&test, 8.0f + (float)i, 32.0f);
+        if (i % 3 == 0) {
+            rigidbody_component_set_velocity(body, 128.0f, 0.0f);
+        }
+    }
+    // Object ids keep growing across tests; the grid indexes by id
+    SpatialGrid* grid = spatial_grid_create(64, 16, 16, 0.0f, 0.0f, game_object_get_id(test.objects[39]) + 1);
+    assert(grid);
+    for (uint32_t i = 0; i < 40; i++) {
+        assert(spatial_grid_add_object(grid, test.objects[i]));
+    }
+    Scene* other = scene_create("Other", 4);
+    GameObject* elsewhere = game_object_create(other);
+    RigidBodyComponent* outside = rigidbody_component_create(elsewhere);
+    game_object_add_component(elsewhere, (Component*)outside);
+    rigidbody_component_set_velocity(outside, 1.0f, 1.0f);
+    component_set_enabled((Component*)body_of(&test, 3), false);
+
+    assert(rigidbody_system_step(test.scene, 0.5f) == 13);
+    RigidBodyStats stats;
+    rigidbody_system_get_stats(&stats);
+    assert(stats.bodies == 39 && stats.steps == 1 && stats.moved == 13);
+    for (uint32_t i = 0; i < 40; i++) {
+        bool moves = i % 3 == 0 && i != 3;
+        TransformComponent* transform = test.objects[i]->transform;
+        assert(rigidbody_system_has_moved(body_of(&test, i)) == moves);
+        assert(transform->renderDirty == moves && transform->matrixDirty == moves);
+        assert(transform->x == 8.0f + (float)i + (moves ? 64.0f : 0.0f));
+    }
+    assert(!rigidbody_system_has_moved(outside) && elsewhere->transform->x == 0.0f);
+
+    // Only moved bodies go back to the grid; they now sit one cell over
+    assert(rigidbody_system_sync_grid(grid) == 13);
+    SpatialQuery* query = spatial_query_create(64);
+    assert(spatial_grid_query_rectangle(grid, 64.0f, 0.0f, 63.0f, 63.0f, query) == 13);
+    assert(spatial_grid_query_rectangle(grid, 0.0f, 0.0f, 63.0f, 63.0f, query) == 27);
+
+    // Another scene's update leaves these bits alone
+    assert(rigidbody_system_step(other, 0.5f) == 1);
+    assert(rigidbody_system_has_moved(body_of(&test, 0)) && rigidbody_system_has_moved(outside));
+
+    // A later update clears the bits, and updating no scene moves nothing
+    rigidbody_system_update(NULL, 1.0f);
+    assert(!rigidbody_system_has_moved(body_of(&test, 0)));
+    assert(rigidbody_system_sync_grid(grid) == 0);
+
+    spatial_query_destroy(query);
+    spatial_grid_destroy(grid);
+    scene_destroy(other);
+    destroy_scene(&test);
+    printf("✓ Rigid body moved bits test passed\n");
+}
+
+void test_rigidbody_fixed_step(void) {
+    TestScene test;
+    create_scene(&test);
+    register_default_systems(test.scene);
+    scene_rebuild_component_arrays(test.scene);
+    RigidBodyComponent* body = add_body(&test, 0.0f, 0.0f);
+    scene_rebuild_component_arrays(test.scene);
+    scene_set_state(test.scene, SCENE_STATE_ACTIVE);
+    rigidbody_component_set_velocity(body, 8.0f, 0.0f);
+
+    // Whole steps only; the remainder carries over
+    assert(rigidbody_system_set_fixed_step(0.25f) == RIGIDBODY_OK && rigidbody_system_get_fixed_step() == 0.25f);
+    float x, y;
+    assert(rigidbody_system_update(test.scene, 0.625f) == 2);
+    position_of(&test, 0, &x, &y);
+    assert(x == 4.0f);
+    assert(rigidbody_system_update(test.scene, 0.125f) == 1);
+    position_of(&test, 0, &x, &y);
+    assert(x == 6.0f);
+    assert(rigidbody_system_update(test.scene, 0.125f) == 0);
+    assert(!rigidbody_system_has_moved(body));
+
+    // A long frame runs at most RIGIDBODY_MAX_STEPS and drops the rest
+    assert(rigidbody_system_update(test.scene, 10.0f) == RIGIDBODY_MAX_STEPS);
+    assert(rigidbody_system_update(test.scene, 0.25f) == 1);
+
+    // The scene steps its bodies in the fixed pass only, by the step it is
+    // given, and resolves their transforms in the same pass
+    position_of(&test, 0, &x, &y);
+    scene_update(test.scene, 0.25f);
+    float after;
+    position_of(&test, 0, &after, &y);
+    assert(after == x);
+    scene_fixed_update(test.scene, 0.5f);
+    position_of(&test, 0, &after, &y);
+    assert(after == x + 4.0f && !test.objects[0]->transform->matrixDirty);
+    assert(test.scene->rigidbodyCount == 1);
+
+    // Each scene carries its own time: two scenes updated every 1/120 s
+    // both step on every other update
+    assert(rigidbody_system_set_fixed_step(RIGIDBODY_DEFAULT_FIXED_STEP) == RIGIDBODY_OK);
+    Scene* other = scene_create("Other", 4);
+    GameObject* elsewhere = game_object_create(other);
+    game_object_add_component(elsewhere, (Component*)rigidbody_component_create(elsewhere));
+    uint32_t steps = 0, otherSteps = 0;
+    for (uint32_t frame = 0; frame < 8; frame++) {
+        steps += rigidbody_system_update(test.scene, 1.0f / 120.0f);
+        otherSteps += rigidbody_system_update(other, 1.0f / 120.0f);
+    }
+    assert(steps == 4 && otherSteps == 4);
+
+    scene_destroy(other);
+    destroy_scene(&test);
+    printf("✓ Rigid body fixed step test passed\n");
+}
+
+// Scalar and SIMD kernels give bit-identical results, including runs of
+// scene bodies that start at any slot and cross moved-bit words
+void test_rigidbody_kernels(void) {
+    TestScene test;
+    create_scene(&test);
+    uint32_t seed = 4242;
+    for (uint32_t i = 0; i < TEST_BODIES; i++) {
+        RigidBodyComponent* body = add_body(&test, (float)i, (float)(i % 17));
+        float values[7];
+        for (uint32_t v = 0; v < 7; v++) {
+            values[v] = test_random_float(&seed, 256.0f) - 128.0f;
+        }
+        if (i % 5 != 1) {
+            rigidbody_component_set_velocity(body, values[0], values[1]);
+        }
+        rigidbody_component_set_acceleration(body, values[2], i % 7 ? values[3] : 0.0f);
+        rigidbody_component_set_damping(body, fabsf(values[4]) / 32.0f);
+        rigidbody_component_set_mass(body, i % 11 ? fabsf(values[5]) / 16.0f + 0.5f : 0.0f);
+        rigidbody_component_apply_force(body, values[6], -values[6]);
+        if (i % 9 == 8 || i == 30) {
+            component_set_enabled((Component*)body, false);
+        }
+    }
+
+    const RigidBodies* store = rigidbody_bodies_get();
+    static float velocity[2][TEST_BODIES * 2], position[2][TEST_BODIES * 2];
+    static float startVelocity[TEST_BODIES * 2], startForce[TEST_BODIES * 2], startPosition[TEST_BODIES * 2];
+    uint32_t moved[2][TEST_BODIES / 32 + 1];
+    for (uint32_t i = 0; i < TEST_BODIES; i++) {
+        startVelocity[i * 2] = store->vx[i];
+        startVelocity[i * 2 + 1] = store->vy[i];
+        startForce[i * 2] = store->forceX[i];
+        startForce[i * 2 + 1] = store->forceY[i];
+        position_of(&test, i, &startPosition[i * 2], &startPosition[i * 2 + 1]);
+    }
+
+    for (uint32_t kernel = 0; kernel < RIGIDBODY_KERNEL_COUNT; kernel++) {
+        if (!rigidbody_kernel_is_supported((RigidBodyKernel)kernel)) {
+            memcpy(velocity[kernel], velocity[0], sizeof(velocity[0]));
+            memcpy(position[kernel], position[0], sizeof(position[0]));
+            memcpy(moved[kernel], moved[0], sizeof(moved[0]));
+            continue;
+        }
+        assert(rigidbody_system_set_kernel((RigidBodyKernel)kernel) == RIGIDBODY_OK);
+        for (uint32_t i = 0; i < TEST_BODIES; i++) {
+            store->vx[i] = startVelocity[i * 2];
+            store->vy[i] = startVelocity[i * 2 + 1];
+            store->forceX[i] = startForce[i * 2];
+            store->forceY[i] = startForce[i * 2 + 1];
+            transform_component_set_position(test.objects[i]->transform, startPosition[i * 2],
+                                             startPosition[i * 2 + 1]);
+        }
+        assert(rigidbody_system_update(test.scene, 3.0f / 60.0f + 0.001f) == 3);
+        memcpy(moved[kernel], store->moved, sizeof(moved[0]));
+        for (uint32_t i = 0; i < TEST_BODIES; i++) {
+            velocity[kernel][i * 2] = store->vx[i];
+            velocity[kernel][i * 2 + 1] = store->vy[i];
+            position_of(&test, i, &position[kernel][i * 2], &position[kernel][i * 2 + 1]);
+        }
+    }
+    assert(rigidbody_system_set_kernel(RIGIDBODY_KERNEL_COUNT) == RIGIDBODY_ERROR_UNSUPPORTED);
+    assert(memcmp(velocity[0], velocity[1], sizeof(velocity[0])) == 0);
+    assert(memcmp(position[0], position[1], sizeof(position[0])) == 0);
+    assert(memcmp(moved[0], moved[1], sizeof(moved[0])) == 0);
+
+    // Disabled bodies stay put; enabled ones all moved
+    for (uint32_t i = 0; i < TEST_BODIES; i++) {
+        bool enabled = !(i % 9 == 8 || i == 30);
+        assert(rigidbody_system_has_moved(body_of(&test, i)) == enabled);
+        assert(enabled || (position[0][i * 2] == startPosition[i * 2] &&
+                           position[0][i * 2 + 1] == startPosition[i * 2 + 1]));
+    }
+
+    destroy_scene(&test);
+    printf("✓ Rigid body kernel test passed\n");
+}
+
+void test_rigidbody_under_scene_manager(void) {
+    TestScene test;
+    create_scene(&test);
+    RigidBodyComponent* body = add_body(&test, 0.0f, 0.0f);
+    rigidbody_component_set_velocity(body, 60.0f, 0.0f);
+    register_default_systems(test.scene);
+    scene_rebuild_component_arrays(test.scene);
+    SceneManager* manager = scene_manager_create();
+    assert(manager && scene_manager_add_scene(manager, test.scene) == SCENE_OK);
+    assert(scene_manager_set_active_scene(manager, test.scene) == SCENE_OK);
+
+    // One second of frames moves the body one second's worth: the fixed
+    // steps integrate and the frame pass does not. Float accumulation may
+    // leave the last step for the next frame.
+    for (uint32_t frame = 0; frame < 60; frame++) {
+        scene_manager_update(manager, 1.0f / 60.0f);
+    }
+    float x, y;
+    position_of(&test, 0, &x, &y);
+    assert(x >= 59.0f - 1e-3f && x <= 60.0f + 1e-3f);
+    assert(!test.objects[0]->transform->matrixDirty);
+
+    scene_manager_remove_scene(manager, test.scene);
+    scene_manager_destroy(manager);
+    scene_set_state(test.scene, SCENE_STATE_INACTIVE);
+    destroy_scene(&test);
+    printf("✓ Rigid body under scene manager test passed\n");
+}
+
+int run_rigidbody_tests(void) {
+    printf("Running rigid body tests...\n");
+
+    test_rigidbody_motion();
+    test_rigidbody_moved_bits();
+    test_rigidbody_fixed_step();
+    test_rigidbody_kernels();
+    test_rigidbody_under_scene_manager();
+
+    printf("All rigid body tests passed! ✓\n\n");
+    return 0;
+}
+
+#ifdef TEST_STANDALONE
+int main(void) {
+    return run_rigidbody_tests();
+}
+#endif
@@ -94,6 +94,50 @@ void test_spatial_queries(void) {
     printf("✓ Spatial queries test passed\n");
 }
 
+void test_rectangle_query(void) {
+    component_registry_init();
+    transform_component_register();
+    
+    Scene* scene = scene_create("RectQueryTest", 10);
+    SpatialGrid* grid = spatial_grid_create(64, 10, 10, 0, 0, 100);
+    SpatialQuery* query = spatial_query_create(50);
+    
+    // Interior cell, edge cells inside and outside the rectangle, far away
+    GameObject* objects[5];
+    const float positions[5][2] = {{200, 200}, {130, 130}, {140, 340}, {400, 400}, {20, 20}};
+    for (int i = 0; i < 5; i++) {
+        objects[i] = game_object_create(scene);
+        game_object_set_position(objects[i], positions[i][0], positions[i][1]);
+        spatial_grid_add_object(grid, objects[i]);
+    }
+    
+    uint32_t found = spatial_grid_query_rectangle(grid, 128, 128, 200, 200, query);
+    assert(found == 2);
+    assert(query->queryWidth == 200 && query->queryHeight == 200);
+    bool foundInterior = false, foundEdge = false;
+    for (uint32_t i = 0; i < found; i++) {
+        foundInterior |= query->results[i] == objects[0];
+        foundEdge |= query->results[i] == objects[1];
+    }
+    assert(foundInterior && foundEdge);
+    
+    // Rectangles hanging off the grid still search the overlapping cells
+    found = spatial_grid_query_rectangle(grid, -100, -100, 150, 150, query);
+    assert(found == 1 && query->results[0] == objects[4]);
+    found = spatial_grid_query_rectangle(grid, 350, 350, 1000, 1000, query);
+    assert(found == 1 && query->results[0] == objects[3]);
+    
+    // Fully outside or empty
+    assert(spatial_grid_query_rectangle(grid, 700, 0, 50, 50, query) == 0);
+    assert(spatial_grid_query_rectangle(grid, 0, 0, 0, 50, query) == 0);
+    
+    spatial_query_destroy(query);
+    spatial_grid_destroy(grid);
+    scene_destroy(scene);
+    component_registry_shutdown();
+    printf("✓ Rectangle query test passed\n");
+}
+
 void test_object_movement(void) {
     component_registry_init();
     transform_component_register();
@@ -162,6 +206,7 @@ int main(void) {
     test_world_to_cell_conversion();
     test_object_addition_removal();
     test_spatial_queries();
+    test_rectangle_query();
     test_object_movement();
     
     printf("\n✓ All spatial grid tests passed!\n");
@@ -12,12 +12,15 @@
 void test_spatial_grid_creation(void);
 void test_object_addition_removal(void);
 void test_spatial_queries(void);
+void test_rectangle_query(void);
 void test_object_movement(void);
 void test_world_to_cell_conversion(void);
 void benchmark_spatial_queries(void);
 void benchmark_object_updates(void);
 void benchmark_large_scale_collision_detection(void);
 void benchmark_memory_usage(void);
+int run_collision_tests(void);
+int run_rigidbody_tests(void);
 
 int main(void) {
     printf("=== Playdate Engine - Phase 5: Spatial Partitioning Test Suite ===\n\n");
@@ -27,8 +30,13 @@ int main(void) {
     test_world_to_cell_conversion();
     test_object_addition_removal();
     test_spatial_queries();
+    test_rectangle_query();
     test_object_movement();
     
+    printf("\n");
+    run_collision_tests();
+    run_rigidbody_tests();
+    
     printf("\nRunning performance benchmarks...\n");
     benchmark_spatial_queries();
     benchmark_object_updates();
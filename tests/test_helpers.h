@@ -0,0 +1,91 @@
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+#include "../src/components/transform_component.h"
+#include "../src/core/component_registry.h"
+#include "../src/core/game_object.h"
+#include "../src/core/scene.h"
+#include "../src/graphics/bitmap.h"
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Shared helpers for the component and system tests. Everything is static
+// inline so the combined runners can link several test files together.
+
+#define TEST_ODD_COUNT 203              // Not a multiple of the SIMD width, so the tail loops run
+#define TEST_SCENE_MAX_OBJECTS (TEST_ODD_COUNT + 32)
+
+// Deterministic LCG; each test file keeps its own seed so results do not
+// depend on which tests ran before
+static inline uint32_t test_random(uint32_t* seed, uint32_t range) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (*seed >> 8) % range;
+}
+
+// Uniform in [0, range)
+static inline float test_random_float(uint32_t* seed, float range) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / (float)(1u << 24) * range;
+}
+
+// Random black and white pixels with roughly a quarter of them transparent
+static inline void test_fill_random_bitmap(Bitmap* bitmap, uint32_t* seed) {
+    for (uint32_t y = 0; y < bitmap->height; y++) {
+        for (uint32_t x = 0; x < bitmap->width; x++) {
+            if (test_random(seed, 4) == 0) {
+                bitmap_clear_pixel(bitmap, (int32_t)x, (int32_t)y);
+            } else {
+                bitmap_set_pixel(bitmap, (int32_t)x, (int32_t)y, test_random(seed, 2) ? BITMAP_COLOR_WHITE : BITMAP_COLOR_BLACK);
+            }
+        }
+    }
+}
+
+static inline bool test_close_to(float a, float b) {
+    return fabsf(a - b) <= 1e-4f * (1.0f + fabsf(b));
+}
+
+// A scene with the transform component registered, plus the objects the
+// test added and the component each one was added with
+typedef struct TestScene {
+    Scene* scene;
+    GameObject* objects[TEST_SCENE_MAX_OBJECTS];
+    Component* components[TEST_SCENE_MAX_OBJECTS];
+    uint32_t count;
+} TestScene;
+
+static inline void test_scene_create(TestScene* test, const char* name, uint32_t capacity) {
+    memset(test, 0, sizeof(TestScene));
+    component_registry_init();
+    transform_component_register();
+    test->scene = scene_create(name, capacity);
+    assert(test->scene);
+}
+
+// New object at (x, y)
+static inline GameObject* test_scene_add(TestScene* test, float x, float y) {
+    assert(test->count < TEST_SCENE_MAX_OBJECTS);
+    GameObject* object = game_object_create(test->scene);
+    assert(object);
+    transform_component_set_position(object->transform, x, y);
+    test->objects[test->count++] = object;
+    return object;
+}
+
+// Attaches a component created for the most recently added object
+static inline Component* test_scene_attach(TestScene* test, Component* component) {
+    assert(test->count > 0 && component);
+    game_object_add_component(test->objects[test->count - 1], component);
+    test->components[test->count - 1] = component;
+    return component;
+}
+
+static inline void test_scene_destroy(TestScene* test) {
+    scene_destroy(test->scene);
+    component_registry_shutdown();
+}
+
+#endif // TEST_HELPERS_H